@@ -0,0 +1,8869 @@
+	.file	"voltage.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/filter.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/sensors/voltage_ids.h"
+	.file 7 "./src/main/sensors/voltage.h"
+	.file 8 "./src/main/sensors/voltage.c"
+	.file 9 "./src/main/target/SITL/target.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "./src/main/drivers/adc.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	voltage.c.ce2959cd
+	.weak	voltage.c.ce2959cd
+voltage.c.ce2959cd:
+	.long	0x730
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF1199
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1079
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1080
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1081
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1082
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1083
+	.uleb128 0x2
+	.long	.LASF1085
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1084
+	.uleb128 0x2
+	.long	.LASF1086
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1087
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1088
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1089
+	.uleb128 0x2
+	.long	.LASF1090
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xc
+	.long	0x87
+	.uleb128 0x2
+	.long	.LASF1091
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0xc
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x1b
+	.long	.LASF1169
+	.byte	0x9
+	.byte	0xa1
+	.byte	0xa
+	.long	0xa9
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1094
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1095
+	.uleb128 0xe
+	.long	.LASF1104
+	.byte	0x2c
+	.byte	0x4
+	.byte	0x22
+	.long	0x16c
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x4
+	.byte	0x23
+	.byte	0xb
+	.long	0xd4
+	.byte	0
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x4
+	.byte	0x23
+	.byte	0xf
+	.long	0xd4
+	.byte	0x4
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x4
+	.byte	0x23
+	.byte	0x13
+	.long	0xd4
+	.byte	0x8
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x4
+	.byte	0x23
+	.byte	0x17
+	.long	0xd4
+	.byte	0xc
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x4
+	.byte	0x23
+	.byte	0x1b
+	.long	0xd4
+	.byte	0x10
+	.uleb128 0x3
+	.string	"x1"
+	.byte	0x4
+	.byte	0x24
+	.byte	0xb
+	.long	0xd4
+	.byte	0x14
+	.uleb128 0x3
+	.string	"x2"
+	.byte	0x4
+	.byte	0x24
+	.byte	0xf
+	.long	0xd4
+	.byte	0x18
+	.uleb128 0x3
+	.string	"y1"
+	.byte	0x4
+	.byte	0x24
+	.byte	0x13
+	.long	0xd4
+	.byte	0x1c
+	.uleb128 0x3
+	.string	"y2"
+	.byte	0x4
+	.byte	0x24
+	.byte	0x17
+	.long	0xd4
+	.byte	0x20
+	.uleb128 0x3
+	.string	"d1"
+	.byte	0x4
+	.byte	0x25
+	.byte	0xb
+	.long	0xd4
+	.byte	0x24
+	.uleb128 0x3
+	.string	"d2"
+	.byte	0x4
+	.byte	0x25
+	.byte	0xf
+	.long	0xd4
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1096
+	.byte	0x4
+	.byte	0x26
+	.byte	0x3
+	.long	0xdb
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1097
+	.uleb128 0x2
+	.long	.LASF1098
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x1b2
+	.uleb128 0x12
+	.long	.LASF1099
+	.value	0xfff
+	.uleb128 0x12
+	.long	.LASF1100
+	.value	0xf000
+	.uleb128 0x12
+	.long	.LASF1101
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1102
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1103
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x1be
+	.uleb128 0x1c
+	.long	0x1ce
+	.uleb128 0x6
+	.long	0x7e
+	.uleb128 0x6
+	.long	0x64
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x1ed
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x16
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x8
+	.long	0x1b2
+	.uleb128 0xe
+	.long	.LASF1105
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x24d
+	.uleb128 0x3
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x17f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1106
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1107
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x24d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1108
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x24d
+	.byte	0x10
+	.uleb128 0x3
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x252
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1109
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x1ce
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x87
+	.uleb128 0x8
+	.long	0x24d
+	.uleb128 0x2
+	.long	.LASF1110
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x1f2
+	.uleb128 0xc
+	.long	0x257
+	.uleb128 0xf
+	.long	0x93
+	.long	0x273
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xc
+	.long	0x268
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x6
+	.byte	0x18
+	.long	0x33e
+	.uleb128 0x1
+	.long	.LASF1111
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1112
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1113
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1114
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1115
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1116
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1118
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1119
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1120
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1121
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1122
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1123
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF1133
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF1134
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x77
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1142
+	.byte	0x6
+	.byte	0x47
+	.byte	0x3
+	.long	0x278
+	.uleb128 0xe
+	.long	.LASF1143
+	.byte	0x4
+	.byte	0x7
+	.byte	0x22
+	.long	0x371
+	.uleb128 0x4
+	.long	.LASF1144
+	.byte	0x7
+	.byte	0x23
+	.byte	0xe
+	.long	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1145
+	.byte	0x7
+	.byte	0x24
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1146
+	.byte	0x7
+	.byte	0x25
+	.byte	0x3
+	.long	0x34a
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x7
+	.byte	0x3f
+	.long	0x3a1
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1149
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1151
+	.byte	0x7
+	.byte	0x44
+	.byte	0x3
+	.long	0x37d
+	.uleb128 0xe
+	.long	.LASF1152
+	.byte	0x3
+	.byte	0x7
+	.byte	0x47
+	.long	0x3e1
+	.uleb128 0x4
+	.long	.LASF1153
+	.byte	0x7
+	.byte	0x48
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1154
+	.byte	0x7
+	.byte	0x49
+	.byte	0xd
+	.long	0x87
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1155
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xd
+	.long	0x87
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x3
+	.long	0x3ad
+	.uleb128 0xc
+	.long	0x3e1
+	.uleb128 0xf
+	.long	0x3e1
+	.long	0x401
+	.uleb128 0x13
+	.long	0x37
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1157
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x21
+	.long	0x3f2
+	.uleb128 0xa
+	.long	.LASF1158
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x68
+	.long	0x3f2
+	.uleb128 0xf
+	.long	0x93
+	.long	0x428
+	.uleb128 0x13
+	.long	0x37
+	.byte	0
+	.uleb128 0xc
+	.long	0x419
+	.uleb128 0xa
+	.long	.LASF1159
+	.byte	0x7
+	.byte	0x61
+	.byte	0x16
+	.long	0x428
+	.uleb128 0xa
+	.long	.LASF1160
+	.byte	0x7
+	.byte	0x63
+	.byte	0x16
+	.long	0x93
+	.uleb128 0xa
+	.long	.LASF1161
+	.byte	0x7
+	.byte	0x64
+	.byte	0x16
+	.long	0x273
+	.uleb128 0x1f
+	.long	0x445
+	.byte	0x8
+	.byte	0x27
+	.byte	0xf
+	.long	0x428
+	.uleb128 0x10
+	.long	0x439
+	.byte	0x43
+	.byte	0xf
+	.uleb128 0xe
+	.long	.LASF1162
+	.byte	0x30
+	.byte	0x8
+	.byte	0x5f
+	.long	0x498
+	.uleb128 0x4
+	.long	.LASF1163
+	.byte	0x8
+	.byte	0x60
+	.byte	0xe
+	.long	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1164
+	.byte	0x8
+	.byte	0x61
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1165
+	.byte	0x8
+	.byte	0x62
+	.byte	0x14
+	.long	0x16c
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1166
+	.byte	0x8
+	.byte	0x63
+	.byte	0x3
+	.long	0x464
+	.uleb128 0xf
+	.long	0x498
+	.long	0x4b3
+	.uleb128 0x13
+	.long	0x37
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1167
+	.byte	0x8
+	.byte	0x65
+	.byte	0x1f
+	.long	0x4a4
+	.uleb128 0x20
+	.long	0x4b3
+	.byte	0x67
+	.byte	0x18
+	.uleb128 0x10
+	.long	0x401
+	.byte	0x6e
+	.byte	0x64
+	.uleb128 0x10
+	.long	0x40d
+	.byte	0x6e
+	.byte	0xa4
+	.uleb128 0xa
+	.long	.LASF1168
+	.byte	0x8
+	.byte	0x6e
+	.byte	0xe3
+	.long	0x263
+	.uleb128 0x21
+	.long	0x4d4
+	.value	0x117
+	.uleb128 0x22
+	.long	.LASF1170
+	.byte	0x8
+	.byte	0x7c
+	.byte	0x16
+	.long	0x428
+	.string	""
+	.uleb128 0x10
+	.long	0x42d
+	.byte	0xfb
+	.byte	0xf
+	.uleb128 0x23
+	.long	.LASF1194
+	.byte	0x4
+	.byte	0x6a
+	.byte	0x6
+	.long	0x517
+	.uleb128 0x6
+	.long	0x517
+	.uleb128 0x6
+	.long	0xd4
+	.uleb128 0x6
+	.long	0xa9
+	.byte	0
+	.uleb128 0x8
+	.long	0x16c
+	.uleb128 0x14
+	.long	.LASF1171
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xe
+	.long	0x7e
+	.long	0x53c
+	.uleb128 0x6
+	.long	0x7e
+	.uleb128 0x6
+	.long	0x64
+	.uleb128 0x6
+	.long	0xb5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1172
+	.byte	0x4
+	.byte	0x6e
+	.byte	0x7
+	.long	0xd4
+	.long	0x557
+	.uleb128 0x6
+	.long	0x517
+	.uleb128 0x6
+	.long	0xd4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1173
+	.byte	0xb
+	.byte	0x33
+	.byte	0xa
+	.long	0x98
+	.long	0x56d
+	.uleb128 0x6
+	.long	0x87
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1175
+	.byte	0x8
+	.value	0x108
+	.byte	0x6
+	.long	0x594
+	.uleb128 0x25
+	.string	"id"
+	.byte	0x8
+	.value	0x108
+	.byte	0x28
+	.long	0x33e
+	.uleb128 0x26
+	.long	.LASF1174
+	.byte	0x8
+	.value	0x108
+	.byte	0x3c
+	.long	0x594
+	.byte	0
+	.uleb128 0x8
+	.long	0x371
+	.uleb128 0xb
+	.long	.LASF1176
+	.byte	0xe9
+	.long	0x5b0
+	.uleb128 0x7
+	.long	.LASF1177
+	.byte	0x8
+	.byte	0xe9
+	.byte	0x32
+	.long	0x594
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1178
+	.byte	0xd8
+	.long	0x5d3
+	.uleb128 0x7
+	.long	.LASF1179
+	.byte	0x8
+	.byte	0xd8
+	.byte	0x27
+	.long	0x87
+	.uleb128 0x7
+	.long	.LASF1177
+	.byte	0x8
+	.byte	0xd8
+	.byte	0x44
+	.long	0x594
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1180
+	.byte	0xcf
+	.uleb128 0x17
+	.long	.LASF1181
+	.byte	0xc7
+	.uleb128 0xb
+	.long	.LASF1182
+	.byte	0xab
+	.long	0x602
+	.uleb128 0xd
+	.uleb128 0x15
+	.string	"i"
+	.byte	0xad
+	.byte	0x12
+	.long	0x87
+	.uleb128 0xd
+	.uleb128 0x9
+	.long	.LASF1183
+	.byte	0xb0
+	.byte	0x21
+	.long	0x602
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x498
+	.uleb128 0xb
+	.long	.LASF1184
+	.byte	0xa3
+	.long	0x635
+	.uleb128 0x7
+	.long	.LASF1185
+	.byte	0x8
+	.byte	0xa3
+	.byte	0x2d
+	.long	0x3a1
+	.uleb128 0x7
+	.long	.LASF1177
+	.byte	0x8
+	.byte	0xa3
+	.byte	0x49
+	.long	0x594
+	.uleb128 0x9
+	.long	.LASF1183
+	.byte	0xa5
+	.byte	0x1d
+	.long	0x602
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1186
+	.byte	0x90
+	.long	0x684
+	.uleb128 0xd
+	.uleb128 0x15
+	.string	"i"
+	.byte	0x92
+	.byte	0x12
+	.long	0x87
+	.uleb128 0xd
+	.uleb128 0x9
+	.long	.LASF1183
+	.byte	0x95
+	.byte	0x21
+	.long	0x602
+	.uleb128 0x9
+	.long	.LASF1187
+	.byte	0x96
+	.byte	0x29
+	.long	0x684
+	.uleb128 0x9
+	.long	.LASF1188
+	.byte	0x98
+	.byte	0x11
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1189
+	.byte	0x99
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x9
+	.long	.LASF1190
+	.byte	0x9b
+	.byte	0x12
+	.long	0x98
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3ed
+	.uleb128 0x27
+	.long	.LASF1200
+	.byte	0x8
+	.byte	0x89
+	.byte	0x11
+	.long	0x98
+	.long	0x6b2
+	.uleb128 0x28
+	.string	"src"
+	.byte	0x8
+	.byte	0x89
+	.byte	0x34
+	.long	0xa4
+	.uleb128 0x7
+	.long	.LASF1187
+	.byte	0x8
+	.byte	0x89
+	.byte	0x59
+	.long	0x684
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1191
+	.byte	0x70
+	.long	0x6e1
+	.uleb128 0x7
+	.long	.LASF1192
+	.byte	0x8
+	.byte	0x70
+	.byte	0x41
+	.long	0x6e1
+	.uleb128 0xd
+	.uleb128 0x15
+	.string	"i"
+	.byte	0x72
+	.byte	0xe
+	.long	0x64
+	.uleb128 0xd
+	.uleb128 0x9
+	.long	.LASF1193
+	.byte	0x73
+	.byte	0x2f
+	.long	0x3ed
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3e1
+	.uleb128 0x29
+	.long	.LASF1195
+	.byte	0x8
+	.byte	0x69
+	.byte	0x19
+	.long	0x602
+	.long	0x703
+	.uleb128 0x7
+	.long	.LASF1196
+	.byte	0x8
+	.byte	0x69
+	.byte	0x34
+	.long	0x87
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1197
+	.byte	0x4a
+	.long	0x71a
+	.uleb128 0x7
+	.long	.LASF1174
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x28
+	.long	0x594
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1201
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xbb
+	.long	0x684
+	.uleb128 0x7
+	.long	.LASF1198
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xd6
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.file 33 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 36 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xb
+	.file 38 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 39 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 40 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 41 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x29
+	.file 42 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1071
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1078
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF956
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF974
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1061
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.37.6498376d1e1396b14288709c9edf6d99,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1202
+	.long	.LASF1203
+	.long	.LASF1204
+	.long	.LASF1205
+	.long	.LASF1206
+	.long	.LASF1207
+	.long	.LASF1208
+	.long	.LASF1209
+	.long	.LASF1210
+	.long	.LASF1211
+	.long	.LASF1212
+	.long	.LASF1213
+	.long	.LASF1214
+	.long	.LASF1215
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1216
+	.byte	0xa
+	.long	.LASF1217
+	.byte	0xa
+	.long	.LASF1218
+	.byte	0xe
+	.long	.LASF1219
+	.byte	0x2
+	.long	.LASF1220
+	.byte	0x3
+	.long	.LASF1221
+	.byte	0x5
+	.long	.LASF1222
+	.byte	0x5
+	.long	.LASF1223
+	.byte	0x5
+	.long	.LASF1224
+	.byte	0x6
+	.long	.LASF1225
+	.byte	0xd
+	.long	.LASF1226
+	.byte	0x4
+	.long	.LASF1227
+	.byte	0xd
+	.long	.LASF1228
+	.byte	0xe
+	.long	.LASF1229
+	.byte	0xe
+	.long	.LASF1229
+	.byte	0xd
+	.long	.LASF1230
+	.byte	0xa
+	.long	.LASF1231
+	.byte	0xd
+	.long	.LASF1232
+	.byte	0xd
+	.long	.LASF1233
+	.byte	0xa
+	.long	.LASF1234
+	.byte	0xa
+	.long	.LASF1235
+	.byte	0xc
+	.long	.LASF1236
+	.byte	0xa
+	.long	.LASF1237
+	.byte	0xb
+	.long	.LASF1238
+	.byte	0xb
+	.long	.LASF1239
+	.byte	0xa
+	.long	.LASF1240
+	.byte	0xa
+	.long	.LASF1241
+	.byte	0xa
+	.long	.LASF1242
+	.byte	0xa
+	.long	.LASF1243
+	.byte	0x9
+	.long	.LASF1244
+	.byte	0x9
+	.long	.LASF1245
+	.byte	0xd
+	.long	.LASF1246
+	.byte	0x8
+	.long	.LASF1247
+	.byte	0x7
+	.long	.LASF1248
+	.byte	0x7
+	.long	.LASF1249
+	.byte	0x1
+	.long	.LASF1250
+	.byte	0x2
+	.long	.LASF1251
+	.byte	0x2
+	.long	.LASF1252
+	.byte	0x4
+	.long	.LASF1253
+	.byte	0x3
+	.long	.LASF1254
+	.byte	0x3
+	.long	.LASF1255
+	.byte	0x5
+	.long	.LASF1256
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1035:
+	.string	"PG_OSD_CONFIG 501"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1172:
+	.string	"biquadFilterApply"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1093:
+	.string	"size_t"
+.LASF1141:
+	.string	"VOLTAGE_METER_ID_CELL_40"
+.LASF1149:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1051:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF934:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF928:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF924:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1012:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF491:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF975:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1123:
+	.string	"VOLTAGE_METER_ID_12V_10"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1152:
+	.string	"voltageSensorADCConfig_s"
+.LASF1156:
+	.string	"voltageSensorADCConfig_t"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1191:
+	.string	"pgResetFn_voltageSensorADCConfig"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1192:
+	.string	"instance"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF1043:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1078:
+	.string	"VBAT_LPF_FREQ 0.4f"
+.LASF1074:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1053:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1063:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1179:
+	.string	"motorNumber"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1187:
+	.string	"config"
+.LASF1183:
+	.string	"state"
+.LASF1189:
+	.string	"rawSample"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF936:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1077:
+	.string	"VBAT_RESDIVMULTIPLIER_DEFAULT 1"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF820:
+	.string	"USE_VCP"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF992:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF973:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1038:
+	.string	"PG_PID_CONFIG 504"
+.LASF970:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF948:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1145:
+	.string	"unfiltered"
+.LASF1045:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF984:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1201:
+	.string	"voltageSensorADCConfig"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF980:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1194:
+	.string	"biquadFilterInitLPF"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1168:
+	.string	"voltageSensorADCConfig_Registry"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF1117:
+	.string	"VOLTAGE_METER_ID_5V_10"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1088:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF910:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1100:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF920:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1157:
+	.string	"voltageSensorADCConfig_SystemArray"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1037:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1108:
+	.string	"copy"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF965:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF914:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1101:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1147:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF1153:
+	.string	"vbatscale"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF923:
+	.string	"Q12 (1 << 12)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1052:
+	.string	"PG_I2C_CONFIG 518"
+.LASF957:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1200:
+	.string	"voltageAdcToVoltage"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF964:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1083:
+	.string	"signed char"
+.LASF1020:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1090:
+	.string	"uint8_t"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF963:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1178:
+	.string	"voltageMeterESCReadMotor"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1158:
+	.string	"voltageSensorADCConfig_CopyArray"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1180:
+	.string	"voltageMeterESCRefresh"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1031:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF998:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF821:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1079:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1004:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1102:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1034:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF969:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1097:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF478:
+	.string	"__P(args) args"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF1111:
+	.string	"VOLTAGE_METER_ID_NONE"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1167:
+	.string	"voltageMeterADCStates"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1006:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1058:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF935:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1029:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1121:
+	.string	"VOLTAGE_METER_ID_12V_1"
+.LASF1122:
+	.string	"VOLTAGE_METER_ID_12V_2"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF937:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1086:
+	.string	"__uint16_t"
+.LASF939:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF933:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF953:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF985:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1044:
+	.string	"PG_ADC_CONFIG 510"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF942:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF945:
+	.string	"PP_IIF_1(t,f) t"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1155:
+	.string	"vbatresdivmultiplier"
+.LASF956:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1010:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1160:
+	.string	"supportedVoltageMeterCount"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF396:
+	.string	"bool _Bool"
+.LASF938:
+	.string	"STR_HELPER(x) #x"
+.LASF1085:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1042:
+	.string	"PG_PWM_CONFIG 508"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF955:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1132:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_7"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1134:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_9"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1099:
+	.string	"PGR_PGN_MASK"
+.LASF949:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1154:
+	.string	"vbatresdivval"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF795:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF952:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1161:
+	.string	"voltageMeterIds"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1196:
+	.string	"index"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1115:
+	.string	"VOLTAGE_METER_ID_5V_1"
+.LASF1116:
+	.string	"VOLTAGE_METER_ID_5V_2"
+.LASF983:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1184:
+	.string	"voltageMeterADCRead"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1176:
+	.string	"voltageMeterESCReadCombined"
+.LASF1070:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF929:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1050:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1119:
+	.string	"VOLTAGE_METER_ID_9V_2"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF921:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1190:
+	.string	"filteredSample"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1107:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1169:
+	.string	"SystemCoreClock"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF932:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF912:
+	.string	"VERY_FAST_MATH "
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1174:
+	.string	"meter"
+.LASF944:
+	.string	"PP_IIF_0(t,f) f"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF954:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF930:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF982:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1009:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF958:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1197:
+	.string	"voltageMeterReset"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF967:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF1021:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1188:
+	.string	"channel"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF993:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF822:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1087:
+	.string	"__uint32_t"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF943:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF1055:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1144:
+	.string	"filtered"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF977:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1019:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF976:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF1027:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1094:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1150:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1120:
+	.string	"VOLTAGE_METER_ID_9V_10"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF468:
+	.string	"__PMT"
+.LASF1041:
+	.string	"PG_PPM_CONFIG 507"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF919:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF950:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF1069:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF915:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF991:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1195:
+	.string	"getVoltageMeterADC"
+.LASF1065:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF987:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1151:
+	.string	"voltageSensorADC_e"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1081:
+	.string	"unsigned int"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF906:
+	.string	"UNIT_TESTED "
+.LASF926:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1073:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF972:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1059:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1072:
+	.string	"ESC_DATA_INVALID 255"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1048:
+	.string	"PG_VCD_CONFIG 514"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF947:
+	.string	"BIT(x) (1 << (x))"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1098:
+	.string	"pgn_t"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1105:
+	.string	"pgRegistry_s"
+.LASF1110:
+	.string	"pgRegistry_t"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1007:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1165:
+	.string	"filter"
+.LASF793:
+	.string	"ACC "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF909:
+	.string	"sq(x) ((x)*(x))"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF989:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1148:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1056:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1186:
+	.string	"voltageMeterADCRefresh"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF1005:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF797:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF777:
+	.string	"USE_NAV "
+.LASF1104:
+	.string	"biquadFilter_s"
+.LASF1096:
+	.string	"biquadFilter_t"
+.LASF1024:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1089:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1163:
+	.string	"voltageFiltered"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF749:
+	.string	"LED_STRIP "
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF996:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF997:
+	.string	"PG_RX_CONFIG 24"
+.LASF978:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1036:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF968:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1068:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF988:
+	.string	"PG_PID_PROFILE 14"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1175:
+	.string	"voltageMeterRead"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1080:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF748:
+	.string	"BLACKBOX "
+.LASF1162:
+	.string	"voltageMeterADCState_s"
+.LASF1166:
+	.string	"voltageMeterADCState_t"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1199:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1014:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF922:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF1039:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF931:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF925:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1030:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1033:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF990:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1057:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1106:
+	.string	"size"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF846:
+	.string	"USE_I2C"
+.LASF1198:
+	.string	"_index"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF799:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF951:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1000:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1091:
+	.string	"uint16_t"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1173:
+	.string	"adcGetChannel"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF904:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1082:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1002:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1066:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1025:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF971:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF847:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF756:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF959:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1060:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF1193:
+	.string	"_reset_template_115"
+.LASF1017:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF999:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1171:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1064:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF986:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1076:
+	.string	"VBAT_RESDIVVAL_DEFAULT 10"
+.LASF1067:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1139:
+	.string	"VOLTAGE_METER_ID_CELL_1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF737:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1015:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1011:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF911:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF918:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1026:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1018:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF738:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF960:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF776:
+	.string	"GPS "
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1040:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1109:
+	.string	"reset"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF1143:
+	.string	"voltageMeter_s"
+.LASF1146:
+	.string	"voltageMeter_t"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1013:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF966:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1003:
+	.string	"PG_GPS_CONFIG 30"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF962:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1118:
+	.string	"VOLTAGE_METER_ID_9V_1"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1001:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1061:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1084:
+	.string	"short int"
+.LASF1170:
+	.string	"voltageMeterAdcChannelMap"
+.LASF1136:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_11"
+.LASF1137:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_12"
+.LASF994:
+	.string	"PG_SERVO_MIXER 21"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1125:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_10"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1135:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_10"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1182:
+	.string	"voltageMeterADCInit"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1164:
+	.string	"voltageUnfiltered"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF907:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1177:
+	.string	"voltageMeter"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1142:
+	.string	"voltageMeterId_e"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF981:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF908:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1032:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1138:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_20"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1022:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1008:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF902:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF905:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF734:
+	.string	"USE_CLI "
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF940:
+	.string	"EXPAND_I(x) x"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1112:
+	.string	"VOLTAGE_METER_ID_BATTERY_1"
+.LASF1113:
+	.string	"VOLTAGE_METER_ID_BATTERY_2"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1126:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_1"
+.LASF1127:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_2"
+.LASF1128:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_3"
+.LASF1129:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_4"
+.LASF1130:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_5"
+.LASF1131:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_6"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1133:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF916:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF974:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF1016:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF927:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1092:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1046:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1062:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF995:
+	.string	"PG_IMU_CONFIG 22"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1023:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1049:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1054:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1159:
+	.string	"voltageMeterADCtoIDMap"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF913:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1124:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_1"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1095:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1103:
+	.string	"pgResetFunc"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1114:
+	.string	"VOLTAGE_METER_ID_BATTERY_10"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF979:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1028:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF917:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1140:
+	.string	"VOLTAGE_METER_ID_CELL_2"
+.LASF1075:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF941:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1185:
+	.string	"adcChannel"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF903:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1071:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF961:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1181:
+	.string	"voltageMeterESCInit"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF1047:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF946:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1252:
+	.string	"io_types.h"
+.LASF1236:
+	.string	"long-double.h"
+.LASF1244:
+	.string	"__locale_t.h"
+.LASF1246:
+	.string	"platform.h"
+.LASF1224:
+	.string	"target.h"
+.LASF1230:
+	.string	"libc-header-start.h"
+.LASF1228:
+	.string	"stdbool.h"
+.LASF1213:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF0:
+	.string	"./src/main/sensors/voltage.c"
+.LASF1203:
+	.string	"src/main/common"
+.LASF1242:
+	.string	"stdint-intn.h"
+.LASF1247:
+	.string	"common_fc_pre.h"
+.LASF1212:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1215:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1237:
+	.string	"stubs.h"
+.LASF1207:
+	.string	"src/main/target/SITL"
+.LASF1234:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1222:
+	.string	"voltage.h"
+.LASF1211:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1221:
+	.string	"voltage_ids.h"
+.LASF1245:
+	.string	"strings.h"
+.LASF1232:
+	.string	"features-time64.h"
+.LASF1223:
+	.string	"voltage.c"
+.LASF1205:
+	.string	"src/main/drivers"
+.LASF1214:
+	.string	"/usr/include"
+.LASF1202:
+	.string	"src/main/build"
+.LASF1248:
+	.string	"common_fc_post.h"
+.LASF1231:
+	.string	"features.h"
+.LASF1239:
+	.string	"typesizes.h"
+.LASF1243:
+	.string	"locale_t.h"
+.LASF1255:
+	.string	"esc_sensor.h"
+.LASF1204:
+	.string	"src/main/config"
+.LASF1240:
+	.string	"time64.h"
+.LASF1217:
+	.string	"stdint-uintn.h"
+.LASF1208:
+	.string	"src/main/target"
+.LASF1251:
+	.string	"utils.h"
+.LASF1250:
+	.string	"maths.h"
+.LASF1206:
+	.string	"src/main/sensors"
+.LASF1209:
+	.string	"src/main"
+.LASF1256:
+	.string	"time.h"
+.LASF1253:
+	.string	"parameter_group_ids.h"
+.LASF1241:
+	.string	"wchar.h"
+.LASF1254:
+	.string	"config_reset.h"
+.LASF1210:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1225:
+	.string	"string.h"
+.LASF1235:
+	.string	"cdefs.h"
+.LASF1229:
+	.string	"stdint.h"
+.LASF1249:
+	.string	"build_config.h"
+.LASF1218:
+	.string	"stddef.h"
+.LASF1238:
+	.string	"stubs-64.h"
+.LASF1233:
+	.string	"wordsize.h"
+.LASF1216:
+	.string	"types.h"
+.LASF1226:
+	.string	"adc.h"
+.LASF1220:
+	.string	"parameter_group.h"
+.LASF1227:
+	.string	"stdc-predef.h"
+.LASF1219:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 \363%\005"
+	.string	"\364\007\347"
+	.string	"\025"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\360\262\252\346\013\n\002\004\001\007\b\333\326\241\250\n\t\264\362\314\211\003"
+	.string	"\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\374\322\374l\021\022\242\302\263\302\013\023\024\240\342\234\212\n"
+	.string	"\016"
+	.ascii	":bZ|S\320\242\352\220\327\f\272P\r\365\n\023j%\004\214;g!\317"
+	.ascii	"\373\257\020\226\033h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 mE\002"
+	.string	"\224\002a"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006\b\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\270"
+	.ascii	" \240\3120pb\247\231\234\031`\007P\203\34020\204\312\340\227"
+	.ascii	"06\200\005"
+	.text
+	.section	.gnu.lto_.inline.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`N\001\205\007"
+	.string	"b\214$)\200)I\007V =\260\330\230\200\204\027\b(\"\260\f\374\364h\001\031Sn\0241\233\340x\240\2775\333\332n\204\220-w\n\277p\330\347\025\375\342\305\202FD \217\036\200~\254\375\366`\330\205\177\261\204\204U\370\036\021\210\2032@\303(\226\267OM\234\2765\232\225\377\263:\367'\007U\306\215\271\027\216oN\343 2s\240\177\b\225\310L\201\023Cf6|R72h\213>\370\352zr\257jffzF\261?\252m\033\343\326Z+y\346\022\004' \200\002\021\273\262\003\334 "
+	.ascii	"\025\275\b\001h\221\034\201XsD\036!\221\314\221\224\247\027\260"
+	.ascii	"\242\245\303`\327\r\020\001\337=\303\220m\271a\212pi\245\272"
+	.ascii	"$\342\f6\224\267\363\312\302\316\b\023\315\341l\206}\271\261"
+	.ascii	"1\204\273\3319%p;\3556\272n\230\327P#_\035Z1\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\335\005"
+	.string	"\022\n '\200)I\007s\005hTX\361\301X\031X\255~D7p\007\037\2171\022\017X\003#\327@\277Yk\233\335\204l\231d$\257\177\250\325C\002"
+	.string	"\252ge\362M\310\007\351P\224ia\2452\205A5O5\317\007V1C\266\201a\030\006\372\304K\354\224\221\215\3521z\002_\204$\270\275\027\373\305:\027\212\0344r&\2078\002\201?0A\241;\234\320\274\260S!\322,\241j\352\3253\341\005\001\027"
+	.string	"G\220\373\331\270$\326\004p\202\246-\313\037\240\"\241c\r"
+	.string	"\354\325*.\214q#\214V\274 0\034\2610\337L\340\335\331\005\332d\264\260"
+	.string	"\b\006\246\251\\Y"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\b\232"
+	.ascii	"\004\t\270\004\n\200\004\013\200\004\f\232\004\r\232\004\016"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\265\003"
+	.string	"\302\304\016\027\260'\035\200$y\220\230S$\355\340\256\206#\2150\246\326\204`)S\027\306A"
+	.string	"?[U\"[\204\220\363\035M\253P\256\362\256\374\255\347|(WMe\237\261'\023~6\317 \030"
+	.ascii	" \204f6\030:\314\304\264\003\203\301 \346\200\212G8B\220\312"
+	.ascii	"\001\2647\fP\233\300l\267\316\f\323D]\326S\206]\351\002e`g\307"
+	.ascii	"\316\301\272\314^F\036@\021"
+	.text
+	.section	.gnu.lto_.lto.b552967853d8da50,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterReset.16.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"]\t"
+	.string	"\026\222B< \005)\035"
+	.string	"\034A\343q\352\311\024Ld\355l4k\b\n\362\311\253\3028\345h\266o\261\373\254|C \3572\260\223\n\001\2104\346w\273r\rA\020\203\330S\345\276g\263\275S\n/"
+	.string	"0"
+	.string	"2"
+	.string	"\007\333'\347\236\355\323\240M\363\260\265\227\215|\314lv\227\312\222\203\217\240\377\330\007T+\324\243@\304\356:\252V\"\267\274m\006\333\022\266o\002,\373\260?\316\315\025\243"
+	.string	"\263\033R\013\260\264\351rb\373\366C\320\356\330\005 \240\307\307|\327_\340a\247\033\354\262^ZvC\0077p>\035>\036\276\354v\306g\t)7m\366\306WL\234\335\205\360U8:\bZ&\237\376i\373D\230\251I\305\232#\013\212\314F"
+	.string	"v\210\212\222\304~\300\356\256e\246\340B\017!P\345>\036\257\226\352h\232\373\324\nQ\351\242\323\240\237\327}\244\372Q\222\205hD9\357\243\237\005w\030\325\243\245\256\363h'\334K\226'^\264\224\f\013"
+	.ascii	"A\263\240L\3008\236\001\027\354S\364\300c\253\342}e,\006]&\202"
+	.ascii	";\267h\347\023"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.18.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\315\t"
+	.string	"\366RE:0\221\322\001\203\2102\024e\216p}\242\205&\345\302Q\345G\263X$\177\300\r\336\032n^im\300\310\271\274I\366\303\300@\361\360\3743\342\351\330y\352W\337f\333&{\247\0243"
+	.string	"3"
+	.string	"4"
+	.string	"\036\005J\232\f\264\301\002;\241\331-;\227\017\340\274z\036\342\274\322\216\217\237\243\177\221s5\214\0262\346\372\354$\354\256'\031\223\335\364\266\013l+\330\226\t\236\246\267\375\223N\277vj/\242\225]\213\233\315\272\324\224\017\333-\373c\003\314\220\350\264I\245\326m\023\246\273\0311(\273\345\201\r<\257\266}\220\207\264\002&#\210F\332\246x\311\003\001mw\021FN\"\372\036\257\206`\315\223\257>\213\036\206\274\230\364\224S\201\335\274\346\315\037\215\2355v\351\232\224\303>\267tf\007Fy\246\222\211\364y\243\220\304\207R\245\252\275\321\267pZ1\200\021\235\030\202\242\352\023;U\352\324\320y\241\330\215D\006\035\276\260[\201`\330}\312=\267tF\351\300\213V\330\017\f"
+	.ascii	"A\263\240\314\320:\201\365>\276\256\t\305&X\351\205\376\022\230"
+	.ascii	"k8)\026/\335!\214\351\232d"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.22.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\357\321\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\030us\350\355\007uq"
+	.string	"\005\001\006'\001\003\202\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.23.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\234\001\355\017"
+	.string	"\326\035jF\360\260(\035\340\230s\356\214wW\224R`\275w SV<\311\234\333\260Za\263\206x\207`\222\313\225\264Y\023bzx\275\225\345-\353o2\221\335\270\311\367>\0316\306\202bU]z\342\371\347Ib\367\3362\245R"
+	.string	"U"
+	.string	"U"
+	.ascii	"\337\007t>\273wt>\355\262i\374+\261\007kHj7v\327\213$\374\313"
+	.ascii	"\357\226\352\372\224Q]>Gj\371\001\021/\261\331\353S\202v7\300"
+	.ascii	"L\203\004\251l&\242\362D\311\343i\3670\211\211\315J\256\034i"
+	.ascii	"w\255\261\031\210\273s\333+\333\016\354\303\b\363\340\255W\237"
+	.ascii	"\343nd\030x\331\365\220\223cg&\214\t\325\203\037\230\221_\263"
+	.ascii	"=\037\027#\377\363i\366|~\\F+\316\302u\320\266\356\365\241\013"
+	.ascii	"A\233\032\273\373\361\351\006\335'H\336c\177VFW\373+W\341:K\006"
+	.ascii	"\002\002v\004\344\360b\367K\340P\367\351\241\355C\"C\343\207"
+	.ascii	"w\t\221Wy\213\013\024\364V\263\273\341\261O?\304\020\342\253"
+	.ascii	"\370\026:\237\bn\262\0203>z\334b70\3151\200\024'[\373;\20411"
+	.ascii	"\372\343\007\277`\004Lq|\332%\212\023\rm4\2538\366\367\322\230"
+	.ascii	"b_w\367\345\210b\237\345\017\250\373\201\td\004\242\340d\022"
+	.ascii	"u\234L\251R\213\225Bu6\211N\020J\255\b\252\n\036k\245b\245N,"
+	.ascii	"/\205*I\360L+\226'*`\325\204\323\312k\251T+\317\363\355#\212"
+	.ascii	"[\336\2056f`Qd\306\024s1b\350\321Fe\326\310`\306\210\342\220"
+	.ascii	"\211$\230\342\\\356\356\312\020\350&\001# \200\0021V\345\001"
+	.ascii	"t\026\024\004\374gHS\356)\263\2115\254\262\331\305\255:\354I"
+	.ascii	"<\003\372\204\217\275\275\222\214M2k\213sAj!\227@\257\267\205"
+	.ascii	"\301N1g\227\3510\001[\276\b\356\335\357Z\311\305\245!\002\033"
+	.ascii	"\354\354m\007|P\356\\\347\t"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.26.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375` \b5,"
+	.string	"\272K\240\020E`\336Q:\343+\0178\026<\365^r\nn\301\252\004\247\002\027\314;\211\024\261\374\200\250\241u\3436\336\226\\f6\\\217N\0376\270\033l\216\210\310DE\356\233\361\006\305w\353>\321\260~\371\266\021B\344N2\362"
+	.string	"\350"
+	.string	"\374"
+	.string	"^\370c\202\304\332\244\334{}\314\214D\257\226\213\"!c\232==\025*\022T\355\305\360\277\034L\213\207a'\206\233\314\361t\345\207\327\333\202\247\314\202\367\024\210n\t\362\253\360\257|\355Y\316\345l\315.X`\313$s*\234Z\276\005\371&\214\337.\034\275\035K%D\336Sf\362\342\260,\245\314\211\220\2436\305\003\357\351o\317\231\267\202|Z\f`\222\350nq\2251\241\300{Jt$\365\251\375\221\372\364W%\3107\343\243\261\357\351\217\031l\340"
+	.string	"\3713\031\274\313d\327\\#\233\273\227\371\364\224\025\360\236\266\217\221\314t\316\034\273_\033\363Z\243\273\367\n\333\b\243\026\371\024m\213\344\357\240\312n"
+	.string	"\311\027\345W\326S\024x\357\025\372\342B\201\266\306\227\226E\233\204\275\217\366\004dm\312\257\260\333\035\324\275\227\255\362\013\354\254\236\231O03\017f^Rng\203e\257d\006\227\033\362\221\024\355\225O\337\345\317\301\366\333h\246\351\356%\313P\177\366\017B\222\266\216\217v\024\212\230m:\345\256\255cfj\331^2\337\336{\263\270\2110\373,;\255\226\201\253\345\002?\313M\253e\246\3252\001\325\362"
+	.string	"\325\262\200\237\345\245\325\262\322j9\300j9i\265\214\364\263\f`\265|\344\263l\264Z.Z-\023\255\226\207V\313B\253\345\240\325\362\372\264s\357j\347\335\317\316\335\263l{\226o\300\007\266&\301\227{o<\377\334\270T\314\222\247\375j\377\331\233\371pn\177\353\245\301\321Y%\346\005\303\3614Uf\216\246'\006w\006JkF\206e\260\355\317T\275\t\243\304=\016:\313\036\013\236\266\2251\242wl\302\332XP\217\266\252\2271v\340\371\340\3521w\257\332\002\035wV1\267xNU@\017\350%=K-"
+	.string	"Y\345uQ\255\304O\237\245~\333\021\264 uG\240\006h\245V\365t\001q:\0025\251\003\264\312\206\324G\235\324=\247\313\211\226}2\200F\352\363\204\353\211\332\020\226\007\210\331\275[\017\362\3349\036\030\352S"
+	.ascii	"} \016Z\257\217\372\200\274\002=\315\327f\031\232?\254\371\204"
+	.ascii	"\315\231\333\2663\024\240^?\355\300d\367\332:\273\336\232\354"
+	.ascii	"\233?g\341t^\347\002\317\311\240\301^i\033\310\325Y\215\272u"
+	.ascii	"\315%\355\223\177M>\273\276\332\201K\366\351\314\034<\330+w-"
+	.ascii	"C\310Vg\361\257\211G\356F\251\307\362(;rm\376\346\201I\266\373"
+	.ascii	"\306\234q}\346\222qH\364\0338\312\223aVp8\037\320\243!^\256\324"
+	.ascii	"1\273\367Bp\3637 B\210\260W\212P\237\362\b&\361-4\215\215\001"
+	.ascii	"s\b2\364%v\307\334\b\020\026*7\316\360<\375b~\347\257\031\304"
+	.ascii	"\243Us\212\027E\023TR$\324\342\325\360\312*E!u\202\312HT\247"
+	.ascii	"\212TT\303\024\304\035\326\360\330+N\261X1\2142Q<\026\257\246"
+	.ascii	"\244N\b\261\tb\004\007\021\032\024\211\301#\25131XD1\274\232"
+	.ascii	"2\272\020Z\035\215VTE+!\225\324p\205\220x\264\022\006\231\330"
+	.ascii	"\310\242x\024^\031\215G\241\217\231|\023\341\262\363\270\344"
+	.ascii	"\210K\266\026\247\275d\th\332*\237\222\331\032\034\367\356\n"
+	.ascii	"q\266\254\237\247X\367\317\216\336{/\332K`\321\236\246\323(\212"
+	.ascii	"\245A7\303\013Y\346tSSD\371,j#\242.\032j\">\027\352\241\357y"
+	.ascii	"P\013\255\035\264\353\025\356\315M\315\323\251\231\221S,W\214"
+	.ascii	"\226\203{\300\314\n\354\326p\350N\031:\233\264Z\3102\2545\345"
+	.ascii	"\235\244}~\251\004\024\007l\247fj`3\255uQi\352\002g\366F5\234"
+	.ascii	"g\240\246~\236#h\004Z\251\231ZiN\027\225\001M\240\300\363\034"
+	.ascii	"\200\246\250"
+	.string	"a4\344\230qhHfd$)HZ\003\220\002\021\2422n\021P\261d\250f\024&\205\302\326\001\260\247T=P\205V\211\353\247?'_\332\222\312{&\323\344\024\265\035}C\n\222\022Y\322\216\234\337Q\214t,\230h\207\037\273\021?\363\345~\226\231\013\037\"\324[\351\203\330\340$\225\275\f\016\034x\026\230\373\263#\260\fH\342\006\330\276\214$\376\231\001%E\030r\202\233E\222\f!\375\323;\363\374E\355\027\245\024\375\277\031\265=\037\224\256\024x\032u\364\001x\211l~\350\3450\230\3267\246\221^\216\215\374\262Ay\210:\267\375F\256\001\020\004\033\260\017\001\346\215\356\322x\355\350\2105\266\2577\244\026\326\316\221^\017[\036\342\004\033\340\264 \252\035 \335<\177^`\005Q\201\222\222\tw\262\023A\302v\265\232\016\026Ii\201\245\0062\256/\315\217\366\270s|\211\256e\247/N-r\265(\330"
+	.string	"\210\212\274\t)O\363\215n\361P\370\311\246>\230o\226\251=\270\346\236wc?O\307\371A2OsO$\021O\223RX\001\246\310\351\327\214\252\344\255\017\335r.\347\354\333"
+	.ascii	"\034\215\b\b\350/\343\302'Pp\365\233V\362?T\330\203\234\326\362"
+	.ascii	"\246\300\367tG\246\177"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.27.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\304\0015\020"
+	.string	"\206\335kH\340\224(\035\3200\004\212?}\224\353x\367C\315\366\343\225\226Z\315!\277Iz\306\245\203\301\031GF\212\375\210\324\374\202\021\005\371\246kD\004)\027\304\340d\032K8Q\023|\f\317\306\"&\253\251@c\177\332&{\247\024Q"
+	.string	"R"
+	.string	"]"
+	.string	"\033cCb%\364\3522Dz\231>O\303\217}\006yY\007\213vU"
+	.string	"\311\331-\033\030%\364z\362\002\240W\356&\240W\223\366\221\227,\366\264\032\bZ\317\356vt\305\311O\322?\355\"\327\013\346\023\200\204\335\365t\275D\334\364\266\023\330\266`\317\224>\236\265\022;;}\354\022fR\032\373\334\356\256\351\214\375\331_/\373)7=\271\351\207F\260 (<\2732?KV\247\336\\\330\276}\034rDja\262O\273Y}?\204\020\311\320\330\220\354\226\f^]\301$\023\2469o\343\227\257A~\30620 \337q\n\3756\266\020\250a\201^\251\020W\022\333\3459'\021\214'\202\016\224"
+	.ascii	"\330\220\036\333s\254@\257\247\n\212\310Z\363\307\263\206bg\177"
+	.ascii	"\363\223\343\274\266B@\304e\233\303q\240X#b\234\210\355n\212"
+	.ascii	"\215\337\b\375\232Wg\020\347]\257\276\250\301\253\307p3[\031"
+	.ascii	"s\300J\321\232\001\340\350\215bU\201#H\201d\226O\005\202\312"
+	.ascii	"\003\360+\231\274\200\251\224wa\302\307\342\005\360W\002[\274"
+	.ascii	"\361%\334\320\211\252PL\201b\227r\361P\335\247\022\273\322\001"
+	.ascii	"\207\030@U7\206\241\252\033\225{n\351\214W`\350\264\250\007O"
+	.ascii	"j{\377A\225|\367q\022\335\214\310\350\301c\322\005/\250\r\006"
+	.ascii	"# `\202Ae\352\001\347\354-]P\034\372A\201aPS\322\306\213\327"
+	.ascii	"\244\356\276\220\303\273\365\310[Mg\205\rF$\024\222r\210J\267"
+	.ascii	"H\fV\240\340&S#L\240\304b\013\254]B\342\ra\215\263Y\210S\322"
+	.ascii	".\260\002>\220'\370\240\025\230\344\305E\311"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.28.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\343\001\345\020"
+	.string	"V\036mH\340\262(\035@%\307_0K\273G>\304X:X\345\237(\246m\031\227\231\324%`\220\201\322\322U\240\035\332\352\251\242\314\345\333\026\254h\2669\206\031cy}\201b\233\225\001\377"
+	.string	"\020\021qb \210pb\311\336{\247\024W"
+	.string	"V"
+	.string	"Y"
+	.string	"k\002t3\233\241cW$y\365\001\356\365\235Sv\216\213 \3663Z\206\231\217\335\375\346\007S\231z\245S\246|\220\b\366\002$~Z.\325+\r\355n\210\013\003\rI\030\227\213\244'd>/\373\310\210\237\226K\346\022$\332]\313\226+\346\336n\373\201m\006\266\034\t\260\236\2255[T\311\371\262/wW\345Ic?v\177\353vh \250\261\273!\b\220\345\251/J<\366\333\357vx\276\n\337\306]\307\343\342W\244^\303\362eq"
+	.ascii	"\020\363\262\241\200{\265\370\001\333+w\221\355\265\363\361\374"
+	.ascii	"\024\276\314\335kw\30339I=\326\302\005\260\0209Y9\007"
+	.string	"7\343\334\362ewe\300\327I9\316sJ\364\306\261AP\351dp\262\344\246m$\367\307\033{B\030bM\225\003\2140z|\027,\362-\227\274\005\005_\304\253-\\\220o\275\276\346\357`\363k\030u\346\234\257\226\355\2617\360\260\2225_v\212bF\216\001 j\204\n\253\035\220PNPL@\222'R\272I\036\2302BE0U\370\302\223)\\\001\303o\2454R\371H\247\360\363\b\330$\001<}(\223\351\364u\342~\322\030vn\244\361\254\246\213\353|9\301\316|\214\327\020\022\306,\376\271\300\347E\376\240Afv\212V\262vJ\347+$\240\307\030+ P\202A,m\007\005\253HC\373';^$d\353\267\303R;S\243$\2731b\372\2201xs\260\026\246\301\304d\246\2769\214\241:\3465X\032\300\351\002\316\027\326\272Iv\243B\220|\304Zn\001K{#kDqkh}\272\201"
+	.ascii	"\357J\217\236)c<W\204\314\260Uv\226\265\243|\211t\256\367\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.29.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 \307m\005"
+	.string	"\002\212%/pU\323\001"
+	.string	"\240\214g\005\300"
+	.string	"\270@\203w w\322\376-!\305EK\310\250\355\324o\007D#TU]t\257Lu\277\3161rk\367\226)\236\"\n\"]\222I\221\225\316jQUZ\021\251\222\023\2552JxN(*\2579\251\204\274o\354\024\225h\361\342\260\300\3662\0303\366\022\376\337\261\263!\242#\340\370\376\355\300\340\001\005"
+	.string	"\216\355\205\214\331\003\353m\276\337v\371\020\374\227Q\263\330B\314\273\236=h\\\266\320\360\370o\250q\230u\\\333\f\333\r\333U\007"
+	.ascii	"3\003\366\231\301\300\367\323e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.30.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 \307u\005"
+	.string	"\002\312%/pU\323\001"
+	.string	"\240\214g\005\200JV#\017~\261Z\214\373\275\216J\362\250\221Q\333\251\337\016\210F\250\252\372\267\340J\005_"
+	.string	"\307\310\255\335[\246\246\244\n2a\222I\221\225\316zUU^\221\311\222\024\255RJxN**\2619\251\214\274o\354\024\225h\361\342\260\300\3664\0307\366\022\376\337\261\263!\002@\300\361\375\230\003\203\007\024B\036\333\0339\263\007\326\353|?\315\005D\360_F\316f\0133\357~\366\260q\332B\303\343\277\341\306e\326qm3l7l[\001\007"
+	.ascii	"3\003\366\231\301\300\367\323e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.31.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`>\001\245\016"
+	.string	"\226\232bF\340\2246\035PD\325\002SD(\254\301,\fS]\327|\310A8\241\254\225|\306,S<vK\304\361\244\324\036i\203\004\"\312\bt\275*\201\341)1\030Cp\016WO\037\020\235q\204\017L\201Q\377\373\357\235RK"
+	.string	"P"
+	.string	"N"
+	.string	"(\024\022\352\017\204>In\022\372\264j\214b\264QR\272\337\214\260\334e\241\263\263[\037\330\001\311\247;[\310\353\314\036\2541\221Z\355\356%_\274{\354\374\343<\300\013\f\211G"
+	.ascii	"+\273\353"
+	.string	"\370\002\023s\313\333f`;\203}\031\001qr\252\325\220\b:\273*~\216,\220\351#\206\217:h:\016\377\253\360\243fw\255\247r\270\225\323\211\005\361\260\251\r>KR\214d|\312\364\034\356\244n\314iV\354\334\254>\215\341(\223m}\336\262\255o$\243}\033\277\321\275r'\005\266D?h\354=\022\304\317\206\347Z\350\240A\\\207F`fw!\3709D\270\3700\270\320'\202 F\274\370\343\203\027\360\321\340\371\367\0133Z\204E\242|\352\013\274\350\343\222\025\217\201\036\232\220\310F\037\273\236\242ta\037\264\273k)c\277\376\001\031\335hift\243\023\006x\003I%E\005\205\222D&\031\325Pr\241\220a\033V\262L\022Q\016,\233\007,\304\245e\230\326B\265\253\245\003K\351\"e\332%R`\354\003\315\256\r\303\262\313\252\336A+e\f\nU\241\312\223\247\037\347\026zj\250\362v\004\034"
+	.ascii	"7\263?\235\005eB\327\322\300x\034\261\005\372B\300MM6\0253\\"
+	.ascii	"\364\3604k_6\246\271\237e%\273\340\3731\315D\373\241o8\013\016"
+	.ascii	"\r%HV\247\2542B\325\016Xh\003\240HSV\300\265\274\020&\031"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.32.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\n\001M\r"
+	.string	"F\030ZF"
+	.string	"s\233\016@\223\212\002~'M\350\357FU\373 \"\241\241\330\210\366D4\022\255\013\302+\204j\323\002 I\215v\262{\307\217\024\244\333\r\300\333k"
+	.string	"\250\224\b\265\232\340\203\236\212\376\243t\275\001\213\275\266\355\224\002A"
+	.string	"G"
+	.string	"G"
+	.string	"&\341O\300\033\330M\375x\331\255\020\374\200\363\351\372\003\327'\347\235\353\323\241-\363J\262o\331Ab\234\331\335\314j\361\3602\364\217r"
+	.string	"'\324\210K\221\317\356Z\236P#\267u\333\rl[\260o\"<(\350\330EQ3dc&\314\013?\345\243\215\271\364\352\257\\\220\221\261\273\330U*\340\307Tb77L\\\034|\0228\241]^U\272\n\250\240\356\310a\244x)\231\3714\350)%\033\373<fc+\264K\373%\017\t$\013\215\223\256\217\376p\027\322"
+	.string	"\222\335\235\340\267\210\b\341\273"
+	.string	"\257O\004>\204\210\262\306\037\037\200\345+\317\020C\005M\220\265\256:\003Q\256,q\314\350\261reW\223\264X\330\337\354\356\332J\331?\371\345,"
+	.string	"\023\035\375\250hZ\303\246I\320\"\320\315\323\351\350GA\002\274y\350\206\320\327\201\003\221y\035\347\215\250\227\2158\204D\331\326y\231g\2019\017\264\313>\216\3532\254\212\337\254\225r\205\0341\242e\372Q\216aUi\200\2105\376\321\336m\004\030"
+	.string	";K\231K\026\031{\215\324\032n;k\206\276`qS\223M\305\016*\0063\232"
+	.ascii	"\202\032\251%\334\272\f\361\023\202\360\267e!\373P\r\311J\224"
+	.ascii	"UA\250\212\363\255\256\200ky!L2"
+	.text
+	.section	.gnu.lto_voltageMeterRead.34.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\327\001\275\021"
+	.string	"f!xI\320\224M: \215\036\340\304B\025\221\037p{\246\214\321WW\003\277\311\026\001Rf\361\300\274\261d\373+r|[$.\300\020\034\037\315\271\207,\023\030\224+\254\312\303Y\033}\311\356\200\337A\200\201\362zmd\220M\366N)a"
+	.string	"b"
+	.string	"b"
+	.string	"\343\201h\f`W\005\220\243]\262\201\031|\257*_y\257\335S\274W\217\366\221\223>\373\242\023!\206\232v\027\244->\276vt\216\276\355\002\226j^\217;\212\221L\310\216\231\316\273O\347\264SP\013b\342df\323\255\222V,\335\366)b&\233\323\204ew=qf9\267w\333\026lO\260g\202e\r\205\013\032%B.\211(\250-\353\217\030\376\320q2\027\362\211\f\260\250Q\373\331]\325\253\355\337Xd7\333\361(\"\027\274\236\214\270\311<h\246"
+	.string	"\2719\227A;\372iz\365\207dl\325\353}\241\321V\331*\020\340\234\267\371\344u\214\017\2329\312.\017\224\204\357\325\344\227r\002?\237\303\3779\216E\224\304f\224\217{\352fC\351D\257@c'\227\204\322\337\256\022\233O\016ie\216i'\322\222\244\024\235\311\244\324\206q\230\307qGk|\352\3014\363\306fgw\035\314\303\300\251\225\224\366\244N\343\235^\260\031\261\231N^\225\330\3111\355|\262I\331\244=\366\273\335]S\036\373A?=\320\377\017A\2570&tU\273\264V \254<\b[\254\024\227\227\351\026+\304\320\022\243A\354"
+	.ascii	"\302^\"\f&\204\2010/-.\260\365\202\201\254\003\0267\204/0F\024"
+	.ascii	"_\240\212\214\275[\312c\n3\312\030\225\375\266\177Che\016I\254"
+	.ascii	"\322\036\243\037\347\227#\021\230\267\033Jwy\3079\303}\270\002"
+	.ascii	"\370\354n\004\277\307\007\321\1771\343\275\016\b\" `\2021\263"
+	.ascii	"j\036\016\253\"&^\220\214\206bCu\340\323\3461\241\305\355\311"
+	.ascii	"\246`&\346\036Pd\355\261\221\254\005t\020.vx\251b\3068\244\341"
+	.ascii	"\032\324\001\366\220\261\302\252\342\330=&\330\266\032\330*p"
+	.ascii	"\b5\301WRf77\231c\3207\321\030\016\024"
+	.text
+	.section	.gnu.lto__reset_template_115.0.35.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.45.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`\017\004u\032"
+	.string	"&\256\242G\260ZQc\020\231\200\377\021\242\245\036\215\314}\315A\354)\372\341\246_v"
+	.string	"6\220\331\020\306\215\270%\322\301\354\222\213\211\217\272r\327\263~\241\347\314\335!?\334\364vm\316 \3423\013\203\020\224\247!\013\311\336R\246\024\207"
+	.string	"\217"
+	.string	"\213"
+	.string	"A\367^\t6i^\266\036\212\357\344Or/\332\261\352\336 i\320\033\310\217-\261\332\2707\271!@/\016\237\325\214W\255G\375%g\222{\223\333\007\334+\244&x/\032\341\243!\220\037\215\376@\352#\371\002\251\217\366\225\330\306\3718g\2239J\344\376\267\203\006\224\341\275\327\365\321\016y\356\266\2129\337w\003N<LF?1n\277t\002NO\230\214~\200^\t\\\004\200\341\336k2\307=\336\366\005\333'l\261D\267\357Oy\352/ye\234iT\256ds\034\r\223\252\260|$UI\021\351R\021\344G$\341L\274\276+\352~(\353\347E\326#\321.\234\335\207T\032\002>} \247\320\374 \253\310\313~\220v)\246xw\240\027\007\f]\223;\220?\262W\326\371\317\217\222@H\222\037\274{\357\352#\020\003O\215+F\371\241\274a"
+	.ascii	"\033@\235\357x\004yC#\035{\365\036\316\367ye\033\367\242\235"
+	.ascii	"\312\341\236:\036|\364{9{\365\361\205wj\r\031\001L\357\362\324"
+	.ascii	"L}\274e\020\206\311Y\327\270\002\201<}\313\312\267\230\013\232"
+	.ascii	"\356=\337\363\324\376\225k)o:\220T\300\362,(|\335G\347\250\250"
+	.ascii	"\357Q\2212/Ctr\204\362\206\267\240s\3516\300\036\\\256\322A,"
+	.ascii	"\355\240\316\334\032\345j\237\364\226?K\035\351\255\323w\322"
+	.ascii	"\013\320\016\312\314\255v\310\312\337{\255Q~\321\235\341\254"
+	.ascii	"Q\266\242\035\262/^+d\253\252\355\321\277\252\252\017\300A*\340"
+	.ascii	"\307\2757\326\250\271A\243\320\310{\017\265\322Vz`\255(e2X\n"
+	.ascii	"\r1\034\230Mi\203\331\314\021'\247\032'fa\202\205W\031\273)P"
+	.ascii	"+m%\213\321\261\233\022\005\314"
+	.string	"\266b\346\302e\326f\246\2544]\262\034\030\013W\254f\272n\024x\326\242\254\271l\263Y\315U/^+4\366\270PO\247\345\261\221~\240\335\360\351\254Q\347\241\005\352\351\2646\304\313X4#>&\246\022:%q\022cm\203#\366\251I<L\314@\223\337\004\303\204\257\273\245>Z/=f\236\032\366/1\025\021\030\nO\355\245\024@\364e\030W\250A0\307\2241\n\251\232\221\240\245I\213\001p\002\021\"4n\020PghhR\351\257=\001a\272x;w$+\263\375D\362\205\262\321\367#\264\b\370zt\3724\334\031w\207\363>Da\037.\210Pq\345\331\327z\230\031\"L:\373\340#\265\312\311\271k\357\f\r\365c\271\025\212\323.\320\214\237g\232\263\345mt\021\335\204\035\t\251\244\021h\212\"\337\006\251\330=;\241D\025f\233\226G\317V|\367\217f\375\276\221\303\220q\257\b\2309\306"
+	.string	"\363[\2362^S\024d\271\264\244Py\300\224"
+	.ascii	"\222b\035\200o\370\320h\203~\353\233\\\270ft\234{d\177\026c\201"
+	.ascii	"K\017\220\214\321[\301\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`(\001\335\007"
+	.string	"BK+2pi\323\001\374\237\265\n\327\017O\216\375_\341\177h\353\266\234\353\370]\274\036"
+	.string	""
+	.string	"p\030\016\315\276\337\276\333\354\377\361\351\255\233\214\005\221@o\273\245L\001N\2309\361\020q\241\223\203$\260\310%\006$r"
+	.string	"\321\0019)B\216\340\232\3157\232oi\333\31622\317\344f\314t\t\260\\\317n\3500,$p\020:\007\034\005\003gt\320\036/\263\274\312/\224k\223g\222W\"\247\350\300'\220K0\353=\036q\274\322\375\\\027P{$\352\331\326\026\302H\321\330\335\265^\240\316\316\270\025\346\301\212\217}\333\002\"uw=\3241\265\255[  \300\002\231\262\322\0010\2647\364R\206\316\233a\352ap\270\300Dra\031\021\214\3623\032\347F\346F`\031\323\032\034\332\3719|n\3659\026_\346\351\361?\250\362d"
+	.ascii	"7\344\354/\360>r|a\235f\016\037\021\2056\310x"
+	.text
+	.section	.gnu.lto_.refs.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\022\005\r\021\200k:s\021\352%\345\332\310\355\204\244M)w\n?a]\300\021w9\264\017\277\360\263\021\326\007k\243_\364\211\376\300\0313\271R\003\374\304\267[_\177\022"
+	.text
+	.section	.gnu.lto_.decls.b552967853d8da50,"e",@progbits
+	.string	"(\265/\375`'\037=\221"
+	.ascii	"\332\357\3104Q0R\312I\007\272\266\252\372Z\352\347b\346.&\246"
+	.ascii	"7\366\337\270\026\025\027\217\316\274U\023A\356$\\\265\021\222"
+	.ascii	"L\024U\373\370\263\347\323\345\221\253Cl\342<\303\367\377+\210"
+	.ascii	"\231\231\355\330\021`\225\351~y[DYV]f\377\377\230\315F\262\245"
+	.ascii	"L\001\300\002?\003P\003wcx\366\2746\207\337\202v\356\035sc\336"
+	.ascii	"\233\326a>v2\035\226\363N\357m\336{\351p\020)\t\347\227\022\264"
+	.ascii	"{\323\243\242\243\2404j\210<\243\3307\022\373\016b\177\336+a"
+	.ascii	"\221Z\234i\215\376\034\007\316M\211~\304t \3334\372\006\275\261"
+	.ascii	"\305EK\243o.\373\024X\370-\310j\350\"\257\330\230k\274\206\255"
+	.ascii	"\360[M\343,\r*W\364\356M\317j\274\206\345X/\b\231\336\243\317"
+	.ascii	"U\033\227\334\036\033n\303n\330\311k\030\356\034\307Y\216\216"
+	.ascii	"\216\212\330I\033\234\234E\363\212,\022=\035q\032=\223\261Ju"
+	.ascii	"N=:0=\342\350\276Dq\013\223b\256\316M\357\251\306e\311\233^\027"
+	.ascii	"/\207\343'\0333\347\334\364\356"
+	.string	"\275vl\206\3210\036\003\301i\330\007\376\201\325p\031>\303N\276\3431g*\334<\232\336\213L\321\303\223\270{\257\222\230\303\005\361\334K\347d\336{\317i\254\306wL\346p\007d\335K\367#D\231\025\033o\366\356\275GEGGG?^\312\234\361*B\317L\354Y\210=\233\3313\231=\377\260\3470{\006\263\347/{\316a\317J;\364\344-{\256aQ\276\262\365\262\210\337\211)\373\025,\263\361\025v\226`\267s\025^\373\216Uz\323{S\241.B\347\n\225F\357\302\376,\375m7@\355\2528\001\366\\\342W\373\372\270\304\357@\333\034\3427\304\"~\375d\021?\b8\304\217\004\213\370=\3414NkRk\354\262\335dJ\304H$nj\215r\024\226rN\031\312Q\250x=\252\335\264{/\247\022\214\335k\305\251\020\337\275VB\314\n0+\200:)C\322\366C\337\366)\213\370Y\016\361s"
+	.ascii	"\216\001+\002\370\273\n\375\233\005\013\274\374\347\357\341\201"
+	.ascii	"\177?\301\340<\1773\321\241\207\374\214\204\356\347)]\340\264"
+	.ascii	"Y\333\207\376\306\341?\233\377m|~\016\372\031\350g\263\237\347"
+	.ascii	"\270\374<d\313\317M?\003\360\363\007o;\340\277\003\377K\374\037"
+	.ascii	"\341g-?\313\375w\273\333\033\370\273\253J\n?\337\370\271\353"
+	.ascii	"g\345\317[?\333\370\231\353\347\034\315\237g\3709\353\347$\225"
+	.ascii	"\277>0\342&\330\277m\374\247\363\177\316\177\177\327\360\263"
+	.ascii	"\332\317\314\237\211\374\034\344g\261\237\303~\006\373\371\353"
+	.ascii	"g\257\237\237~\246\340g\026~V\341g\024~6\341\347\022~&\341g\020"
+	.ascii	"~\356\340g\r~\306\340\347\025?#\375l\342\347\241\377n\377\373"
+	.ascii	"\376\277\371y\201\377y?\223\370\031\201\237\r\370\271\350\347"
+	.ascii	"\235\237C\374L\364\363\377\307\371\017\347\177\372\377\201\377"
+	.ascii	"`\376\013\365\365\365\365\375\325\353\337\371\361\013P&B\270"
+	.ascii	"\344\366~|_[l\032m\266\0352gG\332\352,\320]\372\264\327\232\t"
+	.ascii	"\304R\346E\357.\303\214\200x`ygS\336k\335\004r\266W\245\233M"
+	.ascii	"\305\312\f/\344\233F#gdN\215\341z\3140\325\034\301\332)\203\003"
+	.ascii	"\004\234\323\006]-\245\265\224\264\216\302Wy\357\362V;\036\\"
+	.ascii	"rhB<\350\236L(\357(M\354\231\314v\362\273\227\3231.\345]*\215"
+	.ascii	"\376n\362v\002\324\226f\311\233\2364I\032-I3\261\307{\217\351"
+	.ascii	"\345\342+K.\271\275\356\"\306\310\017K\336L\232\213Y\221\034"
+	.ascii	"\2156\017\035f\345\274p\2049\2535\222d\001r\266\003P\233X\227"
+	.ascii	"]\037z\266\205\314M\t\313\371]i3\207\255\321\357\b\261\337QZ"
+	.ascii	" -K\334\204[\207\267\221>\322]\3662S\260\373A\357*\275L\034\345"
+	.ascii	"\263G\357,\220\222\245\006\322f\357 \017\322Exy\001\0253zw\271"
+	.ascii	"4\352!s\253[B\344]\344j~\356\001>u\332\224=\033\375\233\036\202"
+	.ascii	"\236\3051\363jT\210\220X\020)h\224;I\250\314\2415\352\354\034"
+	.ascii	":\371\377\002u\311\332Re\315\376\375\377\256\225\362\336\213"
+	.ascii	"c'\275\312\253\237\037\3570\033\375@\\y\201[\377\027\331p\357"
+	.ascii	"\321\n\323\215\335\001\316\252\307I\334\377\251L6\311\216\031"
+	.ascii	"\220u!\311v$\233d"
+	.string	"\367\210<r$R^\262c\262y/\321E\"\217-\306.Q\262y\273\356\f2]|S\262\343E\216]\242\213\274V$\222H\262\256d\323\252\213(\331$\353\272M\262;t\221V\312,\344U\022\335&\331\232\333\034\353\032J6\307\272\222M\262%\273%\355\234tUa\226i\3611\211\2747\266\302\254\224C\317d:v\315\334\313lXW\271\300\275acJ3V;8\356\352y\343\312\315j\214\323{/\001[Wec\027\371L\236\215\335{v\005\343nIpL\237w\b?\217@\302\256\026\326\275\005l\335{\344\373\274\367\036\357\275@eXz/\217\241$sk\353\336e\321\326\r;f\301\272\267\331\320\304u%\233ecJY\2524\231\227Fzd\3465C\246\264\315\343\224\253\325\3062\273r\2601j2\036dz\233<wm|\260\355\260<R\226\336c\316\036k\261\f\204\244\367\030t\005\247\\\232"
+	.string	"\016\321!\257\255\321\243\307\037bAF\322\032t\215\276\305\316pzl"
+	.string	"\240\2341l\216\215*)\275}\204\370)\227\351\025b)s\246t\341\321=\252\021\034y4\364x\364\262\363\336\266,\tc[G\177\261\263w\034U\033K\201\252\325W\0308\243\037\033y\345\2102\"&\316\017\032\22493\215\243kgF\032\0333\215*S\036\033_s\3504\355UX\201\245\240\321XA\307\241{e\267d\336\333Z\315\3257\330\331[\235|gu\2153\n\025\275\3256\032\253\246L\240\2252\036zGEGS\315#8X\364\025\211-b\021\277Z\277\354\253\226\355\253F\262sD\317"
+	.ascii	"\252\323\244\316\234"
+	.string	"F_\221\366<\342\307}<\342\367\206s\354\333S\206\006\217M\243}=\313g?\017\217\234\230\031\231\225\035~\036`\333]\017\246\232}\317\023\3133\307\210\221\312\244\362\305Zi\013\353\201\344\225\251FHM\353K\020\215\326#]\262\244\320i\264\352p8:\2657\275\262_\035\027\237\234F\337\223\203\355\351\"DH%\362{K\242\304I\275\272y`\206\274\022\3417`\r2\351\016\236>\333\223\2664\366\261\032\204\325.\027\333\325\335\b\333\273wi\364\203\247\227\006\257\315^\203\034\356'i\365\006J\243\025\207\n\344eW\316|5\2202`\026 B\254\362~\370z\260\301\253d<\246\236\2219y\3021\017X\232\264\245\261<e\351U\214\235U\254\3132`\273V]F^\272\216\240\355]%\235\t\"\035\236L\322\254\315\262Typ\r\253a\b\300q\311\241\001!\241\354\220c\304\206Y\252;\270\202U\260~\236"
+	.ascii	"Z\261\263\241w\225=\230\260n\316\212\364h\364<]\226\271\237?"
+	.ascii	"\236\267\245\327\257\372\325N\3648t\257\231[\334O\031 ~\034\321"
+	.ascii	"\263<O\037\336n\330\331>T\257\232\\^/\023vu\rGv\2414\232\003"
+	.ascii	"h\003\314\311fg\317iq:\b3trz/M\f\235\356[\322C=\326,~.\207.\022"
+	.ascii	"\013\020z[=\247\367\202\216D\367\002\251crU\034\265\253\336\250"
+	.ascii	"ZU\311\316\272U\357\373M\303yQ"
+	.string	"\335j>~\343\247\220\f\322\302\034\371\334\275A\362\fB;\316\323\034p\225\354 \n\032\245\254jU\223\374\\\246\027\207\317[\2222\276\275{\323\032\325\006;k\326\213\322{\331\b"
+	.string	"\232sf/\312\017\375k\262\322\210\253\321\203F\243\025\213\233`l"
+	.ascii	"Qb\377\212dg\235!DC\t\235#\215\326\253\247\311:\326\260q.:\262"
+	.ascii	"<\t\203\304\336\016\261\267a]\307\372\240\347\243\256\321\333"
+	.ascii	"/{\213\303\336n\331\333\031\366\366\006\261\327\374\342\246n"
+	.ascii	"\017\253\355\302h]\361\3316\322k6\335\346\347\021r\022\027\304"
+	.ascii	"\351\306\276\327\214@"
+	.string	"D\214\263Q\224\317\345\327j\336y?O\203A\302\334\312\263o :\315\317\023d\346\310\225)x\366\375\203\263\317\rX\243\215\306b\001\275\224\350\361\201\345G\017\2747\232\277\315\364\031Ni\350\243c\206E\374\2008\304\257\357\224\336x>uszR\032\375\0016\261<n\226z\f\267\035;\333\256\307pz\271\200xs\302L\354\360\201\345\241\221\331\036\323\300\261\022\335\206\007\037O\236@\032a\346\350h4M\373\341\342*2&\006\253\205{\323\204\270\\6`\032\365\001\013\023\246\243x\341\222C\323\022\204L\223F\017DZ\037&\035]\203AcZ7=\252\304}y\203!\033\223\336F\333Kc\375\320Q\303L\177\260>Z\346\346\360~0\201\234Ykg\266X\037/[\276\245\331\370^<..9\264\0369\246\227\037R\353#FN\316\0070\314\035\255\27493\214\330\037\032o\235\345\255\343\326\234<l:\206"
+	.ascii	"\001\367\216\263D\354\310\2305\332X\032\214\351\244\bq\373--"
+	.ascii	"O\225\245w\033;\273\255\235\031,\357\355JqU\3073\245\311\233"
+	.ascii	" \316\034-\3644\275\320\360xc\177x\260r+\315f\357Z\301('\343"
+	.ascii	"\324"
+	.string	"\020\205\241\tOP,` E\t\245\210\306bR\020\252j\352I(\225D,V%\t05U%\024\016\205@c\323O\206!\021\206q(\004\272\340\024\234B\215\301b\214`\214\337\006$\204\020\3420\220\236\240\234\222\212\304`\fRD(\002\246\202B\241\023\f&c\220\203'(' \031STT,\210\016\003)\004\023<p\221d\fF\021\235\214$^x\032N1\005\211C&\241\"\224\007\302\252!\023T\320H\034RQU\025\013\220A5d\"a<\f$\252\252!1\252)\206\023\321\211*\351\211\201'a\225\217\320\205\336)6\375\030\233\204QT;\302(\252\032\244A\252\210\026\213A\"\024\224\023P\006\325\360\t%\032\251*TP\030%5\345\004\204\n\026\253P\341P\312\370\024,\002Ol\212\242B\002\222A4\026\245\242\202%$@\345$B\013\017\206F\246\026,z\030*(\224z\021c\310d"
+	.string	"qh\034\212\340B\203\"\001\\h`\224\022z\300\324\202E\b\031ND\"\213\030AcQ\206\213\246\005`\024\203D\027\202%0\265`\201\2021\030\005\300\t$#\321\211\n\t\312)X\302"
+	.string	"!N \251PR\232\242\212\02146\021\233D4\t70\006\213\301\022\242\250H\374I\212\030\024\006\243\354%\230 \202\t*\230\001\370\nV\234Xq\342\367\nV()\255\230@\311~\002\245jlB\221\242(\"\330\004\345\301P\260\t"
+	.ascii	"#1(5E%e\234\252\212\021@\261)J\312\005\341\220\211\251\005\013"
+	.ascii	"\027E\301)\247\247\"\217\261\251\002\340\224S\f1HA\025\203D\243"
+	.ascii	"\323\213\030\200\214\2071\242\252\247\330\024\004\025\264\306"
+	.ascii	"\2170\036\006R\222p\030#\306\360\311\200\017\251\202\304$\343"
+	.ascii	"pHL\362A\001\325\305&(\247*\030\244^\004\235x\321J/\032\305\213"
+	.ascii	"Vrj\024N\2554C\243\230\241\225d4\n\031\255\004\325\277bS\320"
+	.ascii	"\350dt\301\324\202\0051h\f\212 \300\006B\306\246\t\224\214B\251"
+	.ascii	"*{\250'\013TX\200\"\370\204\024\342\026X\300D\342\204\0218\260"
+	.ascii	"OHIE\342\260(\f\026\223\204RN1\222\236\210\305$\244\003\240\202"
+	.ascii	"\304\240qJ\312\005\341\t\301('\343\3240\006\"\242\023\214'\364"
+	.ascii	"K;\371\301\013B\316\024/L\264\n\031\254&tU-\350)\245oH\027\326"
+	.ascii	"k'd\320\310\346\202\344\240\244N\254r\251D\330\2649\023\245\321"
+	.ascii	"4\365\211\023\273\342\325(P\026\226\252\245b\251r\035\034{\314"
+	.ascii	"\300\224Y^\345\352\344\361ei\264\302\325\2702p\\c\032urYC\323"
+	.ascii	"\350}\264l\020\217\312V\337*[uc\245\362\310\006\003;\037_J\366"
+	.ascii	"\356\322\313\350\257W^\335\2523\275c\336Ugm\353YB\346L\235\265"
+	.ascii	"&j\332\336\330W"
+	.string	"+#TX\263\\\322(WQz\255R\343\346\260\370\326\234j\206t\225iv\021\364\350\306\nM\243=aJ^\227(\251j\365\356\347\036\325.\027\020\316\313\022\276\275\233\\\032\371L\2611e\f\224W\265\327)(T<\r\332\222;\253Fk\372*e\031FN/J\225\362\363\364\354`\326d2g\037\201U\373\352\352j\264\246=\315\317\322h\255i\264>9\227\237%\336^\016\325I]\231\335U\243\225IEc\347\301\324&\017\222\243q\005\f\234\375\r|0\277z\366\312C\202\\\250B\3110\310\002\0252\b!D#4\322$\3512\n\020\004\203a\246\b\242\017\022\200$5\021:\247\024\242\021\221\024$%\205\fcO\370\360\033cE\032#\244\b\341\034\260\330\025C\021\230\305\201\344\364\303~D\342\3319DL0\005B\373\334\205o\211\366\343\375\0241\311\3172%o\250\221\2067\263\370nd`\247=p"
+	.string	"\2772A\024(?\022d\224\313\261W\332b\271'\007s+\251\351&z\333\340}\205\377\334l\301SB\237\264K\306\036\201\371P\302\325Rk\013\231\335\256\222\362\242\204\033_\331\341\217\307\352\224j\346\343\3200E\n\2514\003\224\301L\3061<s\033>\227\253;I\231\3214\265\rT\005\234\001\202\301HGMCc[>n\344u\003\302\250)0\325\273\216<ds=l\254\355\006\260%X\275\030\322p\th5\330\266\236\035d\245[\265nz\304"
+	.string	"[_fI\271\301\367t\351\310Ta\365\024\005n\303\241\257 \225\223\360\301\t~\024+\224\303\fvr\tE\225\204=\275\226\350["
+	.string	"\316\324]\201ds\234I\032!\024\223H\342h\323\267Bj\t\006\351A\270\377b\f\341K\341\374\322\252\fm\353\004o&\200U\3409\233c\030e\0300\031G\213\021\244\r\256\007n\234yn/\366TP\304~!\311\033V\224\322\334\242\026\261W\310\203\361!d)NB!\203\273\276\001/\252Q\246\364 \240\031sw\223\362\030=\333\036\357"
+	.ascii	"\031do\351!\350\320\022#6\320\212S\342R@\275\343\261M\246\267"
+	.ascii	"<5\017@\324\"\244\221-+\236;?\316tFEz\257\306\340\326\207\224"
+	.ascii	"C\327\272\311\376>1\264a(\331{\225\021w|\353\200\236\347[!\255"
+	.ascii	"\300\224`M\326\357\264/\322?^\327V\264c1\212\240Z\234\312\222"
+	.ascii	"z\242M\257g\253\223\303\235\250\373t\254A\260H\032\345h\342:"
+	.ascii	"\022\230\034\315C\216\316\340\265\375YMiC\312p\005\332\377\220"
+	.ascii	"\305\242\200\272\310\"\305\362\202bN2G\002\202\354\005\353\245"
+	.ascii	"\266\344D\005\351\230Q\313v\321\367\217\030\362\314\335 B>\336"
+	.ascii	"\356=8+\266f\021\207\310\036N];+\260\214\251\336\361M/\2454\224"
+	.ascii	"\2353\325\372\207\303\230V\352AB\030"
+	.string	"W\221\274+\34594O\256\230w\327548i\310\266\210\004\330$\007\2541\306\032_kNj\334\316\354\t\322SN\374\033<a\024\313\211\345\305M;*,\213\201F\\+\2323}{\347\252S\276\230y\215+M\306E\317s9F1\355\203\271>Z\n\b\266l\017\211\340\266f"
+	.string	"Ah\347\235\356\002\351\340\266*\003\211\225\r\300Y#Y^h\355\033\036\303\263\350B\300O=\0047\256xM\201\250`\3435\313\351\373P\375\202\016vW\225\343G\352!\016\251\263\347p\213\256\352J\216\370+\302-\006\357\322\225\375o\325\355\231\356\246\251\003\300]a\001\340\261#t>\f@\376\036\202\304\fV\264\240\027phG\207\033%$\200`n \\\203\226\350\350/\230E\035\260O2\\\034\005S\0306d\340yp\272\320\005\355>*lLo\2220\326\257\350\335s(\355\222\27066\336\312\217\262Py\332^\037Vc\255\316\202\343a\322\370\317\2567\222\204\336\265P\225J\367}\303\365~\027-Y%\306\006\331!\f\342\215\023\317\006\026'\304\032\253\324"
+	.string	"Y(\332\321\304\3740q\230\376\034\377\t\006\251\210\003\006!\300a[|"
+	.ascii	"F\243\200\242\225\333]\035\320\316\337\314z\207D1`<Q\001*e\302"
+	.ascii	"l^\260\247\356\b>(]\313\342la\241\360\365\361\330\006\365\342"
+	.ascii	"L\236\346D\026\360\206\226\004\324y9\306\324t\037\351\t\274!"
+	.ascii	"2\023\022\372\002\243\351}.!\004\250L\362X\021\324\237\320I0"
+	.ascii	"\235\307\326\325\036OB\240\277X\304i\213\304\312\001\360\026"
+	.ascii	"\207\2672\325\257.v{MV\276<\364M\211\035iT\005\201\322 \260\321"
+	.ascii	"*\351S\371\202\233o\326\324`\314\257\021D\326\017\200%M\203\t"
+	.ascii	"U\250\024\346\210g\200u\030\031\320\233\353m\312|xr\354\360T"
+	.ascii	"\030\231\256\242\337\310\307X\345\224\204\016y\nk\n\353\270`"
+	.ascii	"\340\223\2725\230\037xY<;\2039&\340\300dJ\216\332\267\006\003"
+	.ascii	"\226'v\305\333\210r~\206\r\304\024\200\r\341|\004g\231k\267\223"
+	.ascii	"~\231\363\312\3667K\3709\234\203\366\0260'\367\275~T\316 \004"
+	.ascii	"\f\2527\bO\204\357\336\272\\\373\177\265O{3\317\033A\271\314"
+	.ascii	"\331\024~\347c\274\021\263\365\302\361\f<W\340\305\220\007^\375"
+	.ascii	" \037!\373\347\225\200;\024\351!\032\353b\345\326\363G\337|q"
+	.ascii	"\347\371\205jf)\305\257=\265o\306\357\205j\005"
+	.text
+	.section	.gnu.lto_.symtab.b552967853d8da50,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b552967853d8da50,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8822 @@
+	.file	"sitl_bench.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	sitl_bench.c.8ddadc4d
+	.weak	sitl_bench.c.8ddadc4d
+sitl_bench.c.8ddadc4d:
+	.long	0x90
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3
+	.long	.LASF1469
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1457
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1458
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1459
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1460
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1461
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1462
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1465
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1463
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1464
+	.uleb128 0x2
+	.long	.LASF1466
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1467
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1468
+	.uleb128 0x5
+	.long	.LASF1470
+	.byte	0x3
+	.byte	0xa1
+	.byte	0xa
+	.long	0x6d
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 4 "./src/main/target/SITL/sitl_bench.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 22 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF724
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF727
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF728
+	.byte	0x4
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF729
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF731
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF771
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 35 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF799
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF800
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1188
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 47 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2f
+	.file 48 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 49 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1098
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1100
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1102
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1106
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1108
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1110
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1112
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1122
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1124
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1126
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1132
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1138
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1140
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1142
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1144
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1148
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1154
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1160
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1172
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1176
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1178
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1180
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1182
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1187
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1192
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1281
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1371
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1372
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1373
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1378
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1379
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1380
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1381
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1382
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1384
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1386
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1388
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1389
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1390
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1391
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1395
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1396
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1397
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1398
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1399
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1400
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1401
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1408
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1421
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1422
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1438
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1441
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1456
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1372
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xa
+	.long	.LASF1
+	.long	.LASF1471
+	.long	.LASF1472
+	.long	.LASF1473
+	.long	.LASF1474
+	.long	.LASF1475
+	.long	.LASF1476
+	.long	.LASF1477
+	.long	.LASF1478
+	.long	.LASF1479
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x32
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1480
+	.byte	0x5
+	.long	.LASF1481
+	.byte	0x5
+	.long	.LASF1482
+	.byte	0x1
+	.long	.LASF1483
+	.byte	0x1
+	.long	.LASF1484
+	.byte	0x8
+	.long	.LASF1485
+	.byte	0x9
+	.long	.LASF1486
+	.byte	0x9
+	.long	.LASF1486
+	.byte	0x8
+	.long	.LASF1487
+	.byte	0x5
+	.long	.LASF1488
+	.byte	0x8
+	.long	.LASF1489
+	.byte	0x8
+	.long	.LASF1490
+	.byte	0x5
+	.long	.LASF1491
+	.byte	0x5
+	.long	.LASF1492
+	.byte	0x7
+	.long	.LASF1493
+	.byte	0x5
+	.long	.LASF1494
+	.byte	0x6
+	.long	.LASF1495
+	.byte	0x6
+	.long	.LASF1496
+	.byte	0x5
+	.long	.LASF1497
+	.byte	0x5
+	.long	.LASF1498
+	.byte	0x5
+	.long	.LASF1499
+	.byte	0x5
+	.long	.LASF1500
+	.byte	0x8
+	.long	.LASF1501
+	.byte	0x9
+	.long	.LASF1502
+	.byte	0x9
+	.long	.LASF1503
+	.byte	0x4
+	.long	.LASF1504
+	.byte	0x4
+	.long	.LASF1505
+	.byte	0x4
+	.long	.LASF1506
+	.byte	0x4
+	.long	.LASF1507
+	.byte	0x4
+	.long	.LASF1508
+	.byte	0x4
+	.long	.LASF1509
+	.byte	0x5
+	.long	.LASF1510
+	.byte	0x5
+	.long	.LASF1511
+	.byte	0x5
+	.long	.LASF1500
+	.byte	0x5
+	.long	.LASF1512
+	.byte	0x8
+	.long	.LASF1513
+	.byte	0x4
+	.long	.LASF1514
+	.byte	0x4
+	.long	.LASF1515
+	.byte	0x8
+	.long	.LASF1516
+	.byte	0x8
+	.long	.LASF1517
+	.byte	0x5
+	.long	.LASF1518
+	.byte	0x5
+	.long	.LASF1519
+	.byte	0x5
+	.long	.LASF1520
+	.byte	0x5
+	.long	.LASF1521
+	.byte	0x5
+	.long	.LASF1522
+	.byte	0x5
+	.long	.LASF1523
+	.byte	0x5
+	.long	.LASF1524
+	.byte	0x3
+	.long	.LASF1525
+	.byte	0x2
+	.long	.LASF1526
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF743:
+	.string	"_IOFBF 0"
+.LASF1176:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF881:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1257:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF806:
+	.string	"__DECL_SIMD_cosl "
+.LASF1291:
+	.string	"USE_CLI_BATCH "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF874:
+	.string	"__DECL_SIMD_atan "
+.LASF766:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1304:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1044:
+	.string	"__DECL_SIMD_asinh "
+.LASF774:
+	.string	"__HAVE_FLOAT64 1"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1107:
+	.string	"__DECL_SIMD_asin"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1042:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF911:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF786:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1019:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF935:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1419:
+	.string	"_GCC_PTRDIFF_T "
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF748:
+	.string	"SEEK_SET 0"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1009:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1282:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF930:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1384:
+	.string	"USE_SERIALRX_SUMH"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1132:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF900:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1102:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1433:
+	.string	"_WCHAR_T_H "
+.LASF896:
+	.string	"__DECL_SIMD_hypotl "
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1385:
+	.string	"USE_SERIALRX_XBUS"
+.LASF964:
+	.string	"__DECL_SIMD_atan2 "
+.LASF856:
+	.string	"__DECL_SIMD_powl "
+.LASF1451:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF918:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF915:
+	.string	"__DECL_SIMD_exp10f "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF888:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1272:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1360:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1185:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1441:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1156:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF902:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF859:
+	.string	"__DECL_SIMD_powf64 "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF1366:
+	.string	"USE_UART7 "
+.LASF1359:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1281:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF932:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1408:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF883:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF804:
+	.string	"__DECL_SIMD_cos "
+.LASF1168:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1265:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1141:
+	.string	"__DECL_SIMD_atan2f"
+.LASF478:
+	.string	"__P(args) args"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1104:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF1058:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1271:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1333:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF724:
+	.string	"__need___va_list "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1013:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1134:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF1299:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1007:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1440:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1328:
+	.string	"VTX_TRAMP "
+.LASF1275:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF788:
+	.string	"__f64x(x) x ##f64x"
+.LASF1178:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"__PTRDIFF_T "
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1367:
+	.string	"USE_UART8 "
+.LASF773:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1065:
+	.string	"__DECL_SIMD_tanf "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF872:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1192:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1434:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1316:
+	.string	"TELEMETRY_MAVLINK "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF1446:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1145:
+	.string	"__DECL_SIMD_log10f"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF826:
+	.string	"__DECL_SIMD_sincosl "
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF842:
+	.string	"__DECL_SIMD_logf64x "
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1421:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1138:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF800:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1080:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1270:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF863:
+	.string	"__DECL_SIMD_powf128x "
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1048:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF721:
+	.string	"NULL"
+.LASF1303:
+	.string	"BLACKBOX "
+.LASF1126:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1110:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1327:
+	.string	"VTX_SMARTAUDIO "
+.LASF1382:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1225:
+	.string	"_Mdouble_ _Float32x"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF913:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1249:
+	.string	"FP_NAN 0"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1292:
+	.string	"USE_PPM "
+.LASF1313:
+	.string	"TELEMETRY_CRSF "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1371:
+	.string	"STACK_CHECK"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF1321:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF1296:
+	.string	"USE_SERIALRX_IBUS "
+.LASF931:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1181:
+	.string	"__DECL_SIMD_tanf"
+.LASF1023:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1361:
+	.string	"USE_UART2 "
+.LASF1463:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1087:
+	.string	"__DECL_SIMD_log"
+.LASF1390:
+	.string	"TELEMETRY_MAVLINK"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1190:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1237:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1232:
+	.string	"__MATHDECL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1261:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1082:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_tanh "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF727:
+	.string	"_____fpos_t_defined 1"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1005:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1109:
+	.string	"__DECL_SIMD_asinf"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1206:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF916:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1209:
+	.string	"__MATH_PRECNAME"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF758:
+	.string	"FOPEN_MAX 16"
+.LASF1240:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1160:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_acosf"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1397:
+	.string	"VTX_COMMON"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF928:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF760:
+	.string	"stdout stdout"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1212:
+	.string	"_Mdouble_ float"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1090:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1312:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1153:
+	.string	"__DECL_SIMD_log1pf"
+.LASF1410:
+	.string	"_STDDEF_H_ "
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF749:
+	.string	"SEEK_CUR 1"
+.LASF1252:
+	.string	"FP_SUBNORMAL 3"
+.LASF1305:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1231:
+	.string	"__MATHDECL_ALIAS"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF784:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF836:
+	.string	"__DECL_SIMD_logl "
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF983:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1020:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1447:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF830:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1461:
+	.string	"signed char"
+.LASF985:
+	.string	"__DECL_SIMD_log2f "
+.LASF702:
+	.string	"__size_t__ "
+.LASF1211:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1383:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1116:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF912:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1349:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1239:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF867:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF993:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1319:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1388:
+	.string	"TELEMETRY_HOTT"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1395:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1258:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1001:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF979:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1215:
+	.string	"_Mdouble_ long double"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF844:
+	.string	"__DECL_SIMD_exp "
+.LASF1262:
+	.string	"math_errhandling 0"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1358:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1139:
+	.string	"__DECL_SIMD_atan2"
+.LASF799:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1115:
+	.string	"__DECL_SIMD_exp2"
+.LASF1453:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1053:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1172:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1002:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1280:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1184:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1454:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1187:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1051:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1084:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF893:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1143:
+	.string	"__DECL_SIMD_log10"
+.LASF1417:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1154:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF1298:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1140:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1061:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF937:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF770:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1267:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF973:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1338:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF869:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF965:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1396:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1255:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1339:
+	.string	"U_ID_0 0"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1220:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1047:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF984:
+	.string	"__DECL_SIMD_log2 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1052:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF815:
+	.string	"__DECL_SIMD_sinf "
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1438:
+	.string	"__DEFINED_wchar_t "
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1151:
+	.string	"__DECL_SIMD_log1p"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF943:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1250:
+	.string	"FP_INFINITE 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1120:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF920:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF910:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1444:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1075:
+	.string	"__DECL_SIMD_cos"
+.LASF808:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1247:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1045:
+	.string	"__DECL_SIMD_asinhf "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF908:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1352:
+	.string	"MAG "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF790:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF789:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF761:
+	.string	"stderr stderr"
+.LASF1077:
+	.string	"__DECL_SIMD_cosf"
+.LASF1456:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF831:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF731:
+	.string	"__FILE_defined 1"
+.LASF1026:
+	.string	"__DECL_SIMD_erfl "
+.LASF734:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1251:
+	.string	"FP_ZERO 2"
+.LASF1018:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1207:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1092:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1277:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1334:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF848:
+	.string	"__DECL_SIMD_expf32 "
+.LASF959:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF891:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF922:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF739:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1169:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1078:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1162:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1335:
+	.string	"SIMULATOR_BUILD "
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF740:
+	.string	"_VA_LIST_DEFINED "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF797:
+	.string	"__STDIO_INLINE"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF755:
+	.string	"FILENAME_MAX 4096"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1288:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF990:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1238:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF726:
+	.string	"__GNUC_VA_LIST "
+.LASF1056:
+	.string	"__DECL_SIMD_erfcl "
+.LASF396:
+	.string	"bool _Bool"
+.LASF944:
+	.string	"__DECL_SIMD_sinh "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF953:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1074:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF878:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1006:
+	.string	"__DECL_SIMD_atanhl "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1196:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1284:
+	.string	"I2C1_OVERCLOCK true"
+.LASF807:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1210:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF991:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF753:
+	.string	"L_tmpnam 20"
+.LASF728:
+	.string	"____mbstate_t_defined 1"
+.LASF1430:
+	.string	"_BSD_WCHAR_T_ "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1227:
+	.string	"_Mdouble_ _Float64x"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1055:
+	.string	"__DECL_SIMD_erfcf "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1148:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF996:
+	.string	"__DECL_SIMD_log1pl "
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1391:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF992:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1142:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1341:
+	.string	"U_ID_2 2"
+.LASF1350:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1386:
+	.string	"LED_STRIP"
+.LASF723:
+	.string	"__need_NULL"
+.LASF849:
+	.string	"__DECL_SIMD_expf64 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF884:
+	.string	"__DECL_SIMD_asin "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1228:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1158:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1133:
+	.string	"__DECL_SIMD_sinhf"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF772:
+	.string	"__HAVE_FLOAT16 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1152:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1167:
+	.string	"__DECL_SIMD_tanh"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF969:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF933:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF905:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1256:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF862:
+	.string	"__DECL_SIMD_powf64x "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF986:
+	.string	"__DECL_SIMD_log2l "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1010:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1161:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1041:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1188:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1043:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF921:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF901:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1409:
+	.string	"_STDDEF_H "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF813:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1171:
+	.string	"__DECL_SIMD_asinh"
+.LASF1455:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1465:
+	.string	"__uint32_t"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF914:
+	.string	"__DECL_SIMD_exp10 "
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF777:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1470:
+	.string	"SystemCoreClock"
+.LASF1226:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1449:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1241:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF810:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF858:
+	.string	"__DECL_SIMD_powf32 "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF939:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF977:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF847:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1325:
+	.string	"VTX_COMMON "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1198:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1159:
+	.string	"__DECL_SIMD_acosh"
+.LASF1246:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1340:
+	.string	"U_ID_1 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1260:
+	.string	"MATH_ERRNO 1"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1057:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1398:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1354:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF796:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF1121:
+	.string	"__DECL_SIMD_exp10f"
+.LASF957:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1106:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1081:
+	.string	"__DECL_SIMD_sinf"
+.LASF1072:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1368:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1418:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1202:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1073:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF791:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF865:
+	.string	"__DECL_SIMD_acosf "
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1194:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF835:
+	.string	"__DECL_SIMD_logf "
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1091:
+	.string	"__DECL_SIMD_exp"
+.LASF1413:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1389:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1278:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1450:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1407:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1197:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF976:
+	.string	"__DECL_SIMD_log10l "
+.LASF966:
+	.string	"__DECL_SIMD_atan2l "
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1230:
+	.string	"__MATHDECL_1"
+.LASF1448:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1136:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1422:
+	.string	"__need_ptrdiff_t"
+.LASF1170:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF1286:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF854:
+	.string	"__DECL_SIMD_pow "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1287:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF963:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF816:
+	.string	"__DECL_SIMD_sinl "
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1445:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF958:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1269:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF720:
+	.string	"__need_size_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1174:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1144:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF1017:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF793:
+	.string	"_BITS_STDIO_H 1"
+.LASF1264:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF954:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1149:
+	.string	"__DECL_SIMD_log2f"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF919:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1423:
+	.string	"__wchar_t__ "
+.LASF1375:
+	.string	"USE_VCP"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1290:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1356:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF763:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF783:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1402:
+	.string	"USE_SPI"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF820:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF945:
+	.string	"__DECL_SIMD_sinhf "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1428:
+	.string	"__WCHAR_T "
+.LASF1468:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1266:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1245:
+	.string	"__MATHCALL_NARROW"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF833:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF468:
+	.string	"__PMT"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF861:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1014:
+	.string	"__DECL_SIMD_acosh "
+.LASF1214:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF981:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1369:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1063:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1222:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1146:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF769:
+	.string	"__f128(x) x ##f128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1343:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF882:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1218:
+	.string	"_Mdouble_ _Float32"
+.LASF1108:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1414:
+	.string	"_T_PTRDIFF "
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF756:
+	.string	"L_ctermid 9"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1123:
+	.string	"__DECL_SIMD_cosh"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF851:
+	.string	"__DECL_SIMD_expf32x "
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1411:
+	.string	"_ANSI_STDDEF_H "
+.LASF747:
+	.string	"EOF (-1)"
+.LASF1062:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1268:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1377:
+	.string	"USE_PWM"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF934:
+	.string	"__DECL_SIMD_expm1 "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1008:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1330:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1094:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF364:
+	.string	"__k8 1"
+.LASF738:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF775:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF765:
+	.string	"__HAVE_FLOAT128 1"
+.LASF978:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1401:
+	.string	"USE_I2C"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF917:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1459:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1112:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1049:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1039:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1362:
+	.string	"USE_UART3 "
+.LASF1122:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF1229:
+	.string	"__MATHDECL_1_IMPL"
+.LASF955:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1203:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1070:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1437:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1308:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1279:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF877:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF843:
+	.string	"__DECL_SIMD_logf128x "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1069:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF974:
+	.string	"__DECL_SIMD_log10 "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF850:
+	.string	"__DECL_SIMD_expf128 "
+.LASF989:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1097:
+	.string	"__DECL_SIMD_powf"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1098:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1114:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF906:
+	.string	"__DECL_SIMD_exp2l "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1387:
+	.string	"TELEMETRY_FRSKY"
+.LASF855:
+	.string	"__DECL_SIMD_powf "
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1412:
+	.string	"_PTRDIFF_T "
+.LASF397:
+	.string	"true 1"
+.LASF1105:
+	.string	"__DECL_SIMD_atanf"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF857:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1348:
+	.string	"ACC "
+.LASF1374:
+	.string	"USE_ADC"
+.LASF1285:
+	.string	"I2C2_OVERCLOCK true"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF795:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF852:
+	.string	"__DECL_SIMD_expf64x "
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF839:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1457:
+	.string	"unsigned char"
+.LASF942:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF832:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1204:
+	.string	"_Mdouble_ double"
+.LASF1037:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1425:
+	.string	"_WCHAR_T "
+.LASF821:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF776:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1244:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1399:
+	.string	"VTX_SMARTAUDIO"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF999:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1016:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1355:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF940:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF903:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1332:
+	.string	"USE_NAV "
+.LASF759:
+	.string	"stdin stdin"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1464:
+	.string	"char"
+.LASF846:
+	.string	"__DECL_SIMD_expl "
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1071:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1029:
+	.string	"__DECL_SIMD_erff64 "
+.LASF925:
+	.string	"__DECL_SIMD_coshf "
+.LASF840:
+	.string	"__DECL_SIMD_logf128 "
+.LASF860:
+	.string	"__DECL_SIMD_powf128 "
+.LASF987:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1003:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF730:
+	.string	"____FILE_defined 1"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1353:
+	.string	"USE_FAKE_MAG "
+.LASF1400:
+	.string	"VTX_TRAMP"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1370:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1420:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF949:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1263:
+	.string	"M_E 2.7182818284590452354"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF890:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1458:
+	.string	"short unsigned int"
+.LASF909:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1295:
+	.string	"USE_SERIALRX_CRSF "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF1021:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF998:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1345:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF834:
+	.string	"__DECL_SIMD_log "
+.LASF866:
+	.string	"__DECL_SIMD_acosl "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1380:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1274:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1469:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF735:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF802:
+	.string	"_MATH_H 1"
+.LASF1068:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1147:
+	.string	"__DECL_SIMD_log2"
+.LASF1431:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1394:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF768:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1066:
+	.string	"__DECL_SIMD_tanl "
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF980:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF837:
+	.string	"__DECL_SIMD_logf16 "
+.LASF864:
+	.string	"__DECL_SIMD_acos "
+.LASF1127:
+	.string	"__DECL_SIMD_expm1"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1302:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF699:
+	.string	"_STDIO_H 1"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1329:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1300:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1067:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF892:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF997:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1179:
+	.string	"__DECL_SIMD_tan"
+.LASF1314:
+	.string	"TELEMETRY_IBUS "
+.LASF1254:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1035:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1309:
+	.string	"USE_RESOURCE_MGMT "
+.LASF389:
+	.string	"SITL 1"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF742:
+	.string	"__ssize_t_defined "
+.LASF1064:
+	.string	"__DECL_SIMD_tan "
+.LASF829:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1124:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1248:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1216:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1259:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1460:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF982:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1119:
+	.string	"__DECL_SIMD_exp10"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1000:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1182:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF947:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1351:
+	.string	"USE_FAKE_GYRO "
+.LASF1276:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF946:
+	.string	"__DECL_SIMD_sinhl "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1111:
+	.string	"__DECL_SIMD_hypot"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF823:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1234:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1118:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF1372:
+	.string	"USE_DASHBOARD"
+.LASF1027:
+	.string	"__DECL_SIMD_erff16 "
+.LASF750:
+	.string	"SEEK_END 2"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1201:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1199:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF719:
+	.string	"__size_t "
+.LASF968:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1336:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1311:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1175:
+	.string	"__DECL_SIMD_erfc"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1165:
+	.string	"__DECL_SIMD_erff"
+.LASF904:
+	.string	"__DECL_SIMD_exp2 "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1318:
+	.string	"USE_DASHBOARD "
+.LASF1442:
+	.string	"UNUSED(x) (void)(x)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF899:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1404:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1373:
+	.string	"TELEMETRY_LTM"
+.LASF1128:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF812:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF960:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1427:
+	.string	"_T_WCHAR "
+.LASF1060:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF803:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1253:
+	.string	"FP_NORMAL 4"
+.LASF825:
+	.string	"__DECL_SIMD_sincosf "
+.LASF870:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1100:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF936:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1406:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF798:
+	.string	"_STRING_H 1"
+.LASF845:
+	.string	"__DECL_SIMD_expf "
+.LASF794:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF827:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1186:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1436:
+	.string	"_GCC_WCHAR_T "
+.LASF1337:
+	.string	"SKIP_IMU_CALC "
+.LASF1033:
+	.string	"__DECL_SIMD_erff128x "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF764:
+	.string	"_BITS_FLOATN_H "
+.LASF745:
+	.string	"_IONBF 2"
+.LASF873:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF741:
+	.string	"__off_t_defined "
+.LASF1117:
+	.string	"__DECL_SIMD_exp2f"
+.LASF956:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1379:
+	.string	"USE_SERIALRX_CRSF"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF898:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF952:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1025:
+	.string	"__DECL_SIMD_erff "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1322:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1381:
+	.string	"USE_SERIALRX_SBUS"
+.LASF887:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF962:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1443:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF767:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1012:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1050:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF549:
+	.string	"__stub_chflags "
+.LASF736:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1344:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1293:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1365:
+	.string	"USE_UART6 "
+.LASF1294:
+	.string	"SERIAL_RX "
+.LASF1164:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1331:
+	.string	"GPS "
+.LASF814:
+	.string	"__DECL_SIMD_sin "
+.LASF1166:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1096:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1040:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1089:
+	.string	"__DECL_SIMD_logf"
+.LASF1416:
+	.string	"_PTRDIFF_T_ "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1403:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1183:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1088:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF771:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1376:
+	.string	"USE_PPM"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1346:
+	.string	"USE_FAKE_LED "
+.LASF1224:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF785:
+	.string	"__f32(x) x ##f32"
+.LASF1163:
+	.string	"__DECL_SIMD_erf"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1235:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1208:
+	.string	"_Mdouble_"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF805:
+	.string	"__DECL_SIMD_cosf "
+.LASF828:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1429:
+	.string	"_WCHAR_T_ "
+.LASF757:
+	.string	"FOPEN_MAX"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1129:
+	.string	"__DECL_SIMD_expm1f"
+.LASF729:
+	.string	"_____fpos64_t_defined 1"
+.LASF818:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF875:
+	.string	"__DECL_SIMD_atanf "
+.LASF1004:
+	.string	"__DECL_SIMD_atanh "
+.LASF995:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1223:
+	.string	"_Mdouble_ _Float128"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1462:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1024:
+	.string	"__DECL_SIMD_erf "
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF746:
+	.string	"BUFSIZ 8192"
+.LASF923:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF907:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1307:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1030:
+	.string	"__DECL_SIMD_erff128 "
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF970:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF926:
+	.string	"__DECL_SIMD_coshl "
+.LASF895:
+	.string	"__DECL_SIMD_hypotf "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1317:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1297:
+	.string	"USE_SERIALRX_SBUS "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1083:
+	.string	"__DECL_SIMD_sincos"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1195:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1180:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1378:
+	.string	"SERIAL_RX"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1323:
+	.string	"USE_SENSOR_NAMES "
+.LASF929:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1157:
+	.string	"__DECL_SIMD_atanhf"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF853:
+	.string	"__DECL_SIMD_expf128x "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF889:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1424:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1054:
+	.string	"__DECL_SIMD_erfc "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF744:
+	.string	"_IOLBF 1"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1131:
+	.string	"__DECL_SIMD_sinh"
+.LASF961:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1233:
+	.string	"__MATHCALL"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF762:
+	.string	"__attr_dealloc_fclose"
+.LASF1173:
+	.string	"__DECL_SIMD_asinhf"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF819:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF787:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1032:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1289:
+	.string	"USE_CLI "
+.LASF1326:
+	.string	"VTX_CONTROL "
+.LASF972:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1079:
+	.string	"__DECL_SIMD_sin"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1324:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF1200:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF879:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1189:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF924:
+	.string	"__DECL_SIMD_cosh "
+.LASF967:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF975:
+	.string	"__DECL_SIMD_log10f "
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1342:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF886:
+	.string	"__DECL_SIMD_asinl "
+.LASF1015:
+	.string	"__DECL_SIMD_acoshf "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1242:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1310:
+	.string	"USE_SERVOS "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1036:
+	.string	"__DECL_SIMD_tanhl "
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF880:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1320:
+	.string	"USE_RCSPLIT "
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1093:
+	.string	"__DECL_SIMD_expf"
+.LASF994:
+	.string	"__DECL_SIMD_log1p "
+.LASF1038:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1135:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1426:
+	.string	"_T_WCHAR_ "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF938:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1439:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF927:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1466:
+	.string	"uint32_t"
+.LASF1155:
+	.string	"__DECL_SIMD_atanh"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF951:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1236:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF824:
+	.string	"__DECL_SIMD_sincos "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1405:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF988:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1435:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF894:
+	.string	"__DECL_SIMD_hypot "
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1150:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1217:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1193:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF817:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1028:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1011:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF751:
+	.string	"P_tmpdir \"/tmp\""
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1283:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF737:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF1095:
+	.string	"__DECL_SIMD_pow"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF868:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF822:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF382:
+	.string	"unix 1"
+.LASF1046:
+	.string	"__DECL_SIMD_asinhl "
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1467:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1432:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1221:
+	.string	"_Mdouble_ _Float64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1301:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1085:
+	.string	"__DECL_SIMD_sincosf"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF725:
+	.string	"__need___va_list"
+.LASF1059:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF885:
+	.string	"__DECL_SIMD_asinf "
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF876:
+	.string	"__DECL_SIMD_atanl "
+.LASF838:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1031:
+	.string	"__DECL_SIMD_erff32x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1315:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF971:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF811:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF732:
+	.string	"__struct_FILE_defined 1"
+.LASF1205:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1103:
+	.string	"__DECL_SIMD_atan"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF897:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1177:
+	.string	"__DECL_SIMD_erfcf"
+.LASF792:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1363:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1347:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1273:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF871:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1086:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF733:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1243:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF841:
+	.string	"__DECL_SIMD_logf32x "
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1357:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1452:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF950:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1130:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1191:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1306:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF948:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF801:
+	.string	"_STRINGS_H 1"
+.LASF1213:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF941:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1113:
+	.string	"__DECL_SIMD_hypotf"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_acos"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1125:
+	.string	"__DECL_SIMD_coshf"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1022:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1076:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1364:
+	.string	"USE_UART5 "
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1393:
+	.string	"TELEMETRY_IBUS"
+.LASF1392:
+	.string	"TELEMETRY_CRSF"
+.LASF809:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF754:
+	.string	"TMP_MAX 238328"
+.LASF1137:
+	.string	"__DECL_SIMD_cbrtf"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1483:
+	.string	"sitl_bench.c"
+.LASF1506:
+	.string	"__FILE.h"
+.LASF1493:
+	.string	"long-double.h"
+.LASF1514:
+	.string	"__locale_t.h"
+.LASF1524:
+	.string	"platform.h"
+.LASF1519:
+	.string	"flt-eval-method.h"
+.LASF1482:
+	.string	"target.h"
+.LASF1520:
+	.string	"fp-logb.h"
+.LASF1518:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1487:
+	.string	"libc-header-start.h"
+.LASF1477:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1517:
+	.string	"math-vector.h"
+.LASF1500:
+	.string	"stdio.h"
+.LASF1499:
+	.string	"stdint-intn.h"
+.LASF1525:
+	.string	"common_fc_pre.h"
+.LASF1476:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1479:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1494:
+	.string	"stubs.h"
+.LASF0:
+	.string	"./src/main/target/SITL/sitl_bench.c"
+.LASF1471:
+	.string	"src/main/target/SITL"
+.LASF1507:
+	.string	"FILE.h"
+.LASF1491:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1503:
+	.string	"__fpos_t.h"
+.LASF1475:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1515:
+	.string	"strings.h"
+.LASF1489:
+	.string	"features-time64.h"
+.LASF1480:
+	.string	"types.h"
+.LASF1510:
+	.string	"floatn.h"
+.LASF1485:
+	.string	"stdbool.h"
+.LASF1478:
+	.string	"/usr/include"
+.LASF1526:
+	.string	"common_fc_post.h"
+.LASF1511:
+	.string	"floatn-common.h"
+.LASF1496:
+	.string	"typesizes.h"
+.LASF1513:
+	.string	"locale_t.h"
+.LASF1488:
+	.string	"features.h"
+.LASF1497:
+	.string	"time64.h"
+.LASF1481:
+	.string	"stdint-uintn.h"
+.LASF1472:
+	.string	"src/main/target"
+.LASF1508:
+	.string	"struct_FILE.h"
+.LASF1505:
+	.string	"__fpos64_t.h"
+.LASF1523:
+	.string	"mathcalls.h"
+.LASF1502:
+	.string	"stdarg.h"
+.LASF1473:
+	.string	"src/main"
+.LASF1492:
+	.string	"cdefs.h"
+.LASF1498:
+	.string	"wchar.h"
+.LASF1521:
+	.string	"fp-fast.h"
+.LASF1504:
+	.string	"__mbstate_t.h"
+.LASF1512:
+	.string	"string.h"
+.LASF1474:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1486:
+	.string	"stdint.h"
+.LASF1501:
+	.string	"stddef.h"
+.LASF1495:
+	.string	"stubs-64.h"
+.LASF1522:
+	.string	"mathcalls-helper-functions.h"
+.LASF1490:
+	.string	"wordsize.h"
+.LASF1516:
+	.string	"math.h"
+.LASF1509:
+	.string	"stdio_lim.h"
+.LASF1484:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.ebb282f3dce7c69,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\013"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ebb282f3dce7c69,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\365\007"
+	.string	"D\016x"
+	.string	""
+	.string	""
+	.string	"\213"
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	"\006\023\001\004\006\025\001 \b\022"
+	.string	"5\200\302\033"
+	.string	"\276"
+	.string	""
+	.string	"?\f\006(\001\017\006(\001"
+	.string	"\bV"
+	.string	"\004\002\310\235\363\346\t\017\300\200\200\304\200\300\204\t"
+	.string	"\275\001\274\001"
+	.string	"\302\001(\277\001\301\001\300\001\004\002\267\340\255\021+\330\220\200\370\377\306\355\2412\242\243\204\200\220\201\001\303\001\273\001\277\001"
+	.string	"\273\001"
+	.string	"?\207\001"
+	.string	"\017SystemCoreClock#./src/main/target/SITL/sitl_bench.c\bGNU C99"
+	.string	"\026.8ddadc4d"
+	.string	"\buint32_t\013/root/repo"
+	.string	" .h"
+	.string	"\b"
+	.string	"h\f"
+	.ascii	"\\\250\337\310\311\206p\252\343Vk\210Z\004N\030\013\312\030"
+	.text
+	.section	.gnu.lto_.symtab.ebb282f3dce7c69,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ebb282f3dce7c69,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
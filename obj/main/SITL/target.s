@@ -0,0 +1,24890 @@
+	.file	"target.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/include/stdint.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 13 "./src/main/target/SITL/target.h"
+	.file 14 "./src/main/drivers/resource.h"
+	.file 15 "./src/main/drivers/io_types.h"
+	.file 16 "./src/main/drivers/serial.h"
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/sockaddr.h"
+	.file 18 "/usr/include/netinet/in.h"
+	.file 19 "./src/main/drivers/system.h"
+	.file 20 "./src/main/drivers/timer.h"
+	.file 21 "./src/main/drivers/pwm_output.h"
+	.file 22 "./src/main/drivers/light_led.h"
+	.file 23 "./src/main/drivers/accgyro/accgyro_fake.h"
+	.file 24 "./src/main/fc/config.h"
+	.file 25 "./src/main/scheduler/scheduler.h"
+	.file 26 "./src/main/rx/rx.h"
+	.file 27 "./src/main/target/SITL/udplink.h"
+	.file 28 "./src/main/target/SITL/target.c"
+	.file 29 "/usr/include/string.h"
+	.file 30 "/usr/include/stdio.h"
+	.file 31 "./src/main/config/feature.h"
+	.file 32 "/usr/include/time.h"
+	.file 33 "/usr/include/pthread.h"
+	.file 34 "./lib/main/dyad/dyad.h"
+	.file 35 "./src/main/drivers/serial_tcp.h"
+	.file 36 "/usr/include/stdlib.h"
+	.file 37 "./src/main/flight/imu.h"
+	.file 38 "/usr/include/errno.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	target.c.d59014b2
+	.weak	target.c.d59014b2
+target.c.d59014b2:
+	.long	0x1856
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2c
+	.long	.LASF3350
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2924
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2925
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2926
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2927
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2928
+	.uleb128 0x4
+	.long	.LASF2929
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2930
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2931
+	.uleb128 0x4
+	.long	.LASF2932
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2933
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2934
+	.uleb128 0x4
+	.long	.LASF2935
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	.LASF2936
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF2937
+	.byte	0x1
+	.byte	0x99
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF2938
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF2939
+	.byte	0x1
+	.byte	0xa9
+	.byte	0xd
+	.long	0x70
+	.uleb128 0x2e
+	.byte	0x8
+	.uleb128 0x17
+	.long	0xc6
+	.uleb128 0x4
+	.long	.LASF2940
+	.byte	0x1
+	.byte	0xc5
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2941
+	.uleb128 0xc
+	.long	0xde
+	.uleb128 0x4
+	.long	.LASF2942
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF2943
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xc
+	.long	0xf6
+	.uleb128 0x4
+	.long	.LASF2944
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF2945
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF2946
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0xc
+	.long	0x11f
+	.uleb128 0x4
+	.long	.LASF2947
+	.byte	0x4
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	.LASF2948
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.long	0xde
+	.long	0x158
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2984
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x8
+	.long	0x2df
+	.uleb128 0x1
+	.long	.LASF2949
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2950
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0xd9
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2951
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0xd9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2952
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0xd9
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2953
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0xd9
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2954
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0xd9
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2955
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0xd9
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2956
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0xd9
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2957
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0xd9
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2958
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0xd9
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2959
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0xd9
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2960
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0xd9
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2961
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x2f8
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2962
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x2fd
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2963
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x70
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF2964
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x70
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF2965
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0x96
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF2966
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x29
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF2967
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x3e
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF2968
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x302
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF2969
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x312
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF2970
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0xa2
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF2971
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x31c
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF2972
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x326
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF2973
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2fd
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF2974
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0xc6
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF2975
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x13c
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF2976
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x70
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF2977
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x32b
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2978
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0x158
+	.uleb128 0x2f
+	.long	.LASF3351
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1a
+	.long	.LASF2979
+	.uleb128 0x5
+	.long	0x2f3
+	.uleb128 0x5
+	.long	0x158
+	.uleb128 0x7
+	.long	0xde
+	.long	0x312
+	.uleb128 0x8
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2eb
+	.uleb128 0x1a
+	.long	.LASF2980
+	.uleb128 0x5
+	.long	0x317
+	.uleb128 0x1a
+	.long	.LASF2981
+	.uleb128 0x5
+	.long	0x321
+	.uleb128 0x7
+	.long	0xde
+	.long	0x33b
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x2df
+	.uleb128 0x17
+	.long	0x33b
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2982
+	.uleb128 0x4
+	.long	.LASF2983
+	.byte	0x8
+	.byte	0x7
+	.byte	0x15
+	.long	0xba
+	.uleb128 0xf
+	.long	.LASF2985
+	.byte	0x10
+	.byte	0x9
+	.byte	0xb
+	.byte	0x8
+	.long	0x380
+	.uleb128 0x1
+	.long	.LASF2986
+	.byte	0x9
+	.byte	0x10
+	.byte	0xc
+	.long	0xae
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2987
+	.byte	0x9
+	.byte	0x15
+	.byte	0x15
+	.long	0xcd
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	0x358
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2988
+	.uleb128 0xf
+	.long	.LASF2989
+	.byte	0x10
+	.byte	0xa
+	.byte	0x33
+	.byte	0x10
+	.long	0x3b4
+	.uleb128 0x1
+	.long	.LASF2990
+	.byte	0xa
+	.byte	0x35
+	.byte	0x23
+	.long	0x3b4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2991
+	.byte	0xa
+	.byte	0x36
+	.byte	0x23
+	.long	0x3b4
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x38c
+	.uleb128 0x4
+	.long	.LASF2992
+	.byte	0xa
+	.byte	0x37
+	.byte	0x3
+	.long	0x38c
+	.uleb128 0xf
+	.long	.LASF2993
+	.byte	0x28
+	.byte	0xb
+	.byte	0x16
+	.byte	0x8
+	.long	0x43b
+	.uleb128 0x1
+	.long	.LASF2994
+	.byte	0xb
+	.byte	0x18
+	.byte	0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2995
+	.byte	0xb
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2996
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x7
+	.long	0x70
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2997
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2998
+	.byte	0xb
+	.byte	0x20
+	.byte	0x7
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2999
+	.byte	0xb
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3000
+	.byte	0xb
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3001
+	.byte	0xb
+	.byte	0x24
+	.byte	0x14
+	.long	0x3b9
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3002
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x20
+	.long	0x465
+	.uleb128 0x14
+	.long	.LASF3003
+	.byte	0x22
+	.byte	0x8
+	.long	0x148
+	.uleb128 0x14
+	.long	.LASF3004
+	.byte	0x23
+	.byte	0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3005
+	.byte	0xc
+	.byte	0x24
+	.byte	0x3
+	.long	0x447
+	.uleb128 0xc
+	.long	0x465
+	.uleb128 0x30
+	.long	.LASF3006
+	.byte	0x38
+	.byte	0xc
+	.byte	0x38
+	.byte	0x7
+	.long	0x49a
+	.uleb128 0x14
+	.long	.LASF3003
+	.byte	0x3a
+	.byte	0x8
+	.long	0x49a
+	.uleb128 0x14
+	.long	.LASF3004
+	.byte	0x3b
+	.byte	0xc
+	.long	0x83
+	.byte	0
+	.uleb128 0x7
+	.long	0xde
+	.long	0x4aa
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x37
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3006
+	.byte	0xc
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x476
+	.uleb128 0xc
+	.long	0x4aa
+	.uleb128 0x24
+	.byte	0x28
+	.byte	0x43
+	.long	0x4e4
+	.uleb128 0x14
+	.long	.LASF3007
+	.byte	0x45
+	.byte	0x1c
+	.long	0x3c5
+	.uleb128 0x14
+	.long	.LASF3003
+	.byte	0x46
+	.byte	0x8
+	.long	0x4e4
+	.uleb128 0x14
+	.long	.LASF3004
+	.byte	0x47
+	.byte	0xc
+	.long	0x83
+	.byte	0
+	.uleb128 0x7
+	.long	0xde
+	.long	0x4f4
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3008
+	.byte	0xc
+	.byte	0x48
+	.byte	0x3
+	.long	0x4bb
+	.uleb128 0x5
+	.long	0x50a
+	.uleb128 0x17
+	.long	0x500
+	.uleb128 0x31
+	.uleb128 0x5
+	.long	0xe5
+	.uleb128 0x17
+	.long	0x50b
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3009
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF3010
+	.uleb128 0xc
+	.long	0x51c
+	.uleb128 0x32
+	.long	.LASF3239
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0xd
+	.byte	0xbe
+	.long	0x54a
+	.uleb128 0x1
+	.long	.LASF3011
+	.byte	0xd
+	.byte	0xc0
+	.byte	0xb
+	.long	0xc6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3012
+	.byte	0xd
+	.byte	0xc1
+	.byte	0x3
+	.long	0x534
+	.uleb128 0x18
+	.long	0x30
+	.byte	0xd
+	.byte	0xf2
+	.byte	0x1
+	.long	0x581
+	.uleb128 0x2
+	.long	.LASF3013
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3014
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3015
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3016
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3017
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3018
+	.byte	0xd
+	.byte	0xf8
+	.byte	0x3
+	.long	0x556
+	.uleb128 0x20
+	.byte	0x88
+	.byte	0xd
+	.byte	0xfa
+	.long	0x5e4
+	.uleb128 0x1
+	.long	.LASF3019
+	.byte	0xd
+	.byte	0xfb
+	.byte	0xc
+	.long	0x51c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3020
+	.byte	0xd
+	.byte	0xfc
+	.byte	0xc
+	.long	0x5e4
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3021
+	.byte	0xd
+	.byte	0xfd
+	.byte	0xc
+	.long	0x5e4
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3022
+	.byte	0xd
+	.byte	0xfe
+	.byte	0xc
+	.long	0x5f4
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF3023
+	.byte	0xd
+	.byte	0xff
+	.byte	0xc
+	.long	0x5e4
+	.byte	0x58
+	.uleb128 0x25
+	.long	.LASF3024
+	.value	0x100
+	.byte	0xc
+	.long	0x5e4
+	.byte	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	0x51c
+	.long	0x5f4
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x51c
+	.long	0x604
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3025
+	.value	0x101
+	.long	0x58d
+	.uleb128 0xc
+	.long	0x604
+	.uleb128 0x33
+	.byte	0x10
+	.byte	0xd
+	.value	0x102
+	.byte	0x9
+	.long	0x62c
+	.uleb128 0x25
+	.long	.LASF3026
+	.value	0x103
+	.byte	0x8
+	.long	0x62c
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x515
+	.long	0x63c
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3027
+	.value	0x104
+	.long	0x614
+	.uleb128 0x18
+	.long	0x30
+	.byte	0xe
+	.byte	0x14
+	.byte	0xe
+	.long	0x76e
+	.uleb128 0x2
+	.long	.LASF3028
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3029
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3030
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3031
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3032
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3033
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3034
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3035
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3036
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3037
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3038
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3039
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3040
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3041
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF3042
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3043
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF3044
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3045
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3046
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3047
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF3048
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3049
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3050
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3051
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF3052
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3053
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF3054
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3055
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF3056
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3057
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF3058
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3059
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF3060
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3061
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF3062
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3063
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF3064
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF3065
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF3066
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF3067
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF3068
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF3069
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF3070
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF3071
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF3072
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF3073
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF3074
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3075
+	.byte	0xf
+	.byte	0x18
+	.byte	0x11
+	.long	0xf6
+	.uleb128 0x4
+	.long	.LASF3076
+	.byte	0xf
+	.byte	0x19
+	.byte	0xf
+	.long	0xc6
+	.uleb128 0x5
+	.long	0xf6
+	.uleb128 0xc
+	.long	0x786
+	.uleb128 0xf
+	.long	.LASF3077
+	.byte	0x1e
+	.byte	0x10
+	.byte	0x54
+	.byte	0x10
+	.long	0x7c5
+	.uleb128 0x1
+	.long	.LASF3078
+	.byte	0x10
+	.byte	0x55
+	.byte	0xd
+	.long	0x7c5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3079
+	.byte	0x10
+	.byte	0x56
+	.byte	0xd
+	.long	0x7c5
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3080
+	.byte	0x10
+	.byte	0x57
+	.byte	0xd
+	.long	0x7c5
+	.byte	0x14
+	.byte	0
+	.uleb128 0x7
+	.long	0x76e
+	.long	0x7d5
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3081
+	.byte	0x10
+	.byte	0x58
+	.byte	0x3
+	.long	0x790
+	.uleb128 0xc
+	.long	0x7d5
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF3082
+	.uleb128 0x4
+	.long	.LASF3083
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF3084
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x12
+	.long	0x113
+	.uleb128 0xf
+	.long	.LASF3085
+	.byte	0x4
+	.byte	0x12
+	.byte	0x1f
+	.byte	0x8
+	.long	0x820
+	.uleb128 0x1
+	.long	.LASF3086
+	.byte	0x12
+	.byte	0x21
+	.byte	0xf
+	.long	0x7f9
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3087
+	.byte	0x12
+	.byte	0x7b
+	.byte	0x12
+	.long	0x107
+	.uleb128 0xf
+	.long	.LASF3088
+	.byte	0x10
+	.byte	0x12
+	.byte	0xf5
+	.byte	0x8
+	.long	0x86e
+	.uleb128 0x1
+	.long	.LASF3089
+	.byte	0x12
+	.byte	0xf7
+	.byte	0x11
+	.long	0x7ed
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3090
+	.byte	0x12
+	.byte	0xf8
+	.byte	0xf
+	.long	0x820
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3091
+	.byte	0x12
+	.byte	0xf9
+	.byte	0x14
+	.long	0x805
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3092
+	.byte	0x12
+	.byte	0xfc
+	.byte	0x13
+	.long	0x86e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x22
+	.long	0x87e
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x13
+	.byte	0x19
+	.byte	0xe
+	.long	0x8b5
+	.uleb128 0x2
+	.long	.LASF3093
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3094
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3095
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3096
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3097
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3098
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3099
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3100
+	.byte	0x13
+	.byte	0x21
+	.byte	0x3
+	.long	0x87e
+	.uleb128 0x4
+	.long	.LASF3101
+	.byte	0x14
+	.byte	0x31
+	.byte	0x12
+	.long	0x113
+	.uleb128 0x34
+	.long	0x8c1
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x14
+	.byte	0x39
+	.byte	0xe
+	.long	0x915
+	.uleb128 0x2
+	.long	.LASF3102
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3103
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3104
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3105
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3106
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3108
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3109
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3110
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3111
+	.byte	0x14
+	.byte	0x43
+	.byte	0x3
+	.long	0x8d2
+	.uleb128 0x5
+	.long	0x54a
+	.uleb128 0xf
+	.long	.LASF3112
+	.byte	0x18
+	.byte	0x14
+	.byte	0x5a
+	.byte	0x10
+	.long	0x975
+	.uleb128 0x15
+	.string	"tim"
+	.byte	0x14
+	.byte	0x5b
+	.byte	0x12
+	.long	0x921
+	.byte	0
+	.uleb128 0x15
+	.string	"tag"
+	.byte	0x14
+	.byte	0x5c
+	.byte	0xd
+	.long	0x76e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3113
+	.byte	0x14
+	.byte	0x5d
+	.byte	0xd
+	.long	0xf6
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3114
+	.byte	0x14
+	.byte	0x5e
+	.byte	0x16
+	.long	0x915
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3115
+	.byte	0x14
+	.byte	0x5f
+	.byte	0xd
+	.long	0xf6
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3116
+	.byte	0x14
+	.byte	0x6c
+	.byte	0x3
+	.long	0x926
+	.uleb128 0xc
+	.long	0x975
+	.uleb128 0x7
+	.long	0x981
+	.long	0x991
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0xc
+	.long	0x986
+	.uleb128 0x23
+	.long	.LASF3137
+	.byte	0x14
+	.byte	0x8b
+	.byte	0x1e
+	.long	0x991
+	.uleb128 0x20
+	.byte	0x28
+	.byte	0x15
+	.byte	0x84
+	.long	0xa05
+	.uleb128 0x15
+	.string	"ccr"
+	.byte	0x15
+	.byte	0x85
+	.byte	0x18
+	.long	0xa05
+	.byte	0
+	.uleb128 0x15
+	.string	"tim"
+	.byte	0x15
+	.byte	0x86
+	.byte	0x12
+	.long	0x921
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3117
+	.byte	0x15
+	.byte	0x87
+	.byte	0xb
+	.long	0x515
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3118
+	.byte	0x15
+	.byte	0x88
+	.byte	0xb
+	.long	0x515
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3119
+	.byte	0x15
+	.byte	0x89
+	.byte	0x9
+	.long	0x7e6
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3120
+	.byte	0x15
+	.byte	0x8a
+	.byte	0x9
+	.long	0x7e6
+	.byte	0x19
+	.uleb128 0x15
+	.string	"io"
+	.byte	0x15
+	.byte	0x8b
+	.byte	0xa
+	.long	0x77a
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x8cd
+	.uleb128 0x4
+	.long	.LASF3121
+	.byte	0x15
+	.byte	0x8c
+	.byte	0x3
+	.long	0x9a2
+	.uleb128 0xf
+	.long	.LASF3122
+	.byte	0x12
+	.byte	0x15
+	.byte	0x8e
+	.byte	0x10
+	.long	0xa65
+	.uleb128 0x1
+	.long	.LASF3123
+	.byte	0x15
+	.byte	0x8f
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3124
+	.byte	0x15
+	.byte	0x90
+	.byte	0xd
+	.long	0xf6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3125
+	.byte	0x15
+	.byte	0x91
+	.byte	0xd
+	.long	0xf6
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3126
+	.byte	0x15
+	.byte	0x92
+	.byte	0xd
+	.long	0xf6
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x15
+	.byte	0x93
+	.byte	0xd
+	.long	0xa65
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.long	0x76e
+	.long	0xa75
+	.uleb128 0x8
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3128
+	.byte	0x15
+	.byte	0x94
+	.byte	0x3
+	.long	0xa16
+	.uleb128 0xc
+	.long	0xa75
+	.uleb128 0xf
+	.long	.LASF3129
+	.byte	0xc
+	.byte	0x15
+	.byte	0x98
+	.byte	0x10
+	.long	0xabb
+	.uleb128 0x1
+	.long	.LASF3130
+	.byte	0x15
+	.byte	0x9a
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3131
+	.byte	0x15
+	.byte	0x9b
+	.byte	0xe
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x15
+	.byte	0x9c
+	.byte	0xd
+	.long	0xabb
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	0x76e
+	.long	0xacb
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3132
+	.byte	0x15
+	.byte	0x9d
+	.byte	0x3
+	.long	0xa86
+	.uleb128 0xc
+	.long	0xacb
+	.uleb128 0xf
+	.long	.LASF3133
+	.byte	0x4
+	.byte	0x16
+	.byte	0x1a
+	.byte	0x10
+	.long	0xb04
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x16
+	.byte	0x1b
+	.byte	0xd
+	.long	0xb04
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3134
+	.byte	0x16
+	.byte	0x1c
+	.byte	0xd
+	.long	0xf6
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0x76e
+	.long	0xb14
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3135
+	.byte	0x16
+	.byte	0x1d
+	.byte	0x3
+	.long	0xadc
+	.uleb128 0xc
+	.long	0xb14
+	.uleb128 0x7
+	.long	0x981
+	.long	0xb35
+	.uleb128 0x8
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xb25
+	.uleb128 0x36
+	.long	0x996
+	.byte	0x1c
+	.byte	0x27
+	.byte	0x17
+	.long	0xb35
+	.uleb128 0x1a
+	.long	.LASF3136
+	.uleb128 0x23
+	.long	.LASF3138
+	.byte	0x17
+	.byte	0x15
+	.byte	0x19
+	.long	0xb57
+	.uleb128 0x5
+	.long	0xb46
+	.uleb128 0x1a
+	.long	.LASF3139
+	.uleb128 0x23
+	.long	.LASF3140
+	.byte	0x17
+	.byte	0x1a
+	.byte	0x1a
+	.long	0xb6d
+	.uleb128 0x5
+	.long	0xb5c
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x18
+	.byte	0x22
+	.byte	0xe
+	.long	0xc4f
+	.uleb128 0x2
+	.long	.LASF3141
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3142
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3143
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3144
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3145
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3146
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF3147
+	.byte	0x80
+	.uleb128 0x16
+	.long	.LASF3148
+	.value	0x100
+	.uleb128 0x16
+	.long	.LASF3149
+	.value	0x200
+	.uleb128 0x16
+	.long	.LASF3150
+	.value	0x400
+	.uleb128 0x16
+	.long	.LASF3151
+	.value	0x1000
+	.uleb128 0x16
+	.long	.LASF3152
+	.value	0x2000
+	.uleb128 0x16
+	.long	.LASF3153
+	.value	0x4000
+	.uleb128 0x16
+	.long	.LASF3154
+	.value	0x8000
+	.uleb128 0xe
+	.long	.LASF3155
+	.long	0x10000
+	.uleb128 0xe
+	.long	.LASF3156
+	.long	0x20000
+	.uleb128 0xe
+	.long	.LASF3157
+	.long	0x40000
+	.uleb128 0xe
+	.long	.LASF3158
+	.long	0x80000
+	.uleb128 0xe
+	.long	.LASF3159
+	.long	0x100000
+	.uleb128 0xe
+	.long	.LASF3160
+	.long	0x200000
+	.uleb128 0xe
+	.long	.LASF3161
+	.long	0x400000
+	.uleb128 0xe
+	.long	.LASF3162
+	.long	0x800000
+	.uleb128 0xe
+	.long	.LASF3163
+	.long	0x2000000
+	.uleb128 0xe
+	.long	.LASF3164
+	.long	0x4000000
+	.uleb128 0xe
+	.long	.LASF3165
+	.long	0x8000000
+	.uleb128 0xe
+	.long	.LASF3166
+	.long	0x10000000
+	.uleb128 0xe
+	.long	.LASF3167
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x19
+	.byte	0x3e
+	.byte	0xe
+	.long	0xcda
+	.uleb128 0x2
+	.long	.LASF3168
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3169
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3170
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3171
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3172
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3173
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3174
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3175
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3176
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3177
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3178
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3179
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3180
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3181
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF3182
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3183
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF3184
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3185
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3186
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3187
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3188
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3189
+	.byte	0x19
+	.byte	0x8f
+	.byte	0x3
+	.long	0xc4f
+	.uleb128 0xf
+	.long	.LASF3190
+	.byte	0x2c
+	.byte	0x1a
+	.byte	0x75
+	.byte	0x10
+	.long	0xe39
+	.uleb128 0x1
+	.long	.LASF3191
+	.byte	0x1a
+	.byte	0x76
+	.byte	0xd
+	.long	0xe39
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3192
+	.byte	0x1a
+	.byte	0x77
+	.byte	0xd
+	.long	0xf6
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3193
+	.byte	0x1a
+	.byte	0x78
+	.byte	0xd
+	.long	0xf6
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3194
+	.byte	0x1a
+	.byte	0x79
+	.byte	0xd
+	.long	0xf6
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3195
+	.byte	0x1a
+	.byte	0x7a
+	.byte	0xd
+	.long	0xf6
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3196
+	.byte	0x1a
+	.byte	0x7b
+	.byte	0xe
+	.long	0x113
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3197
+	.byte	0x1a
+	.byte	0x7c
+	.byte	0xd
+	.long	0xf6
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3198
+	.byte	0x1a
+	.byte	0x7d
+	.byte	0xd
+	.long	0x76e
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3199
+	.byte	0x1a
+	.byte	0x7e
+	.byte	0xd
+	.long	0x76e
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3200
+	.byte	0x1a
+	.byte	0x7f
+	.byte	0xd
+	.long	0xf6
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3201
+	.byte	0x1a
+	.byte	0x80
+	.byte	0xd
+	.long	0xf6
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3202
+	.byte	0x1a
+	.byte	0x81
+	.byte	0xd
+	.long	0xf6
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3203
+	.byte	0x1a
+	.byte	0x82
+	.byte	0xd
+	.long	0xf6
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3204
+	.byte	0x1a
+	.byte	0x83
+	.byte	0xd
+	.long	0xf6
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3205
+	.byte	0x1a
+	.byte	0x84
+	.byte	0xe
+	.long	0x107
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3206
+	.byte	0x1a
+	.byte	0x85
+	.byte	0xe
+	.long	0x107
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3207
+	.byte	0x1a
+	.byte	0x86
+	.byte	0xe
+	.long	0x107
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3208
+	.byte	0x1a
+	.byte	0x87
+	.byte	0xd
+	.long	0xf6
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3209
+	.byte	0x1a
+	.byte	0x88
+	.byte	0xd
+	.long	0xf6
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3210
+	.byte	0x1a
+	.byte	0x89
+	.byte	0xd
+	.long	0xf6
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3211
+	.byte	0x1a
+	.byte	0x8a
+	.byte	0xd
+	.long	0xf6
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3212
+	.byte	0x1a
+	.byte	0x8b
+	.byte	0xd
+	.long	0xf6
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3213
+	.byte	0x1a
+	.byte	0x8c
+	.byte	0xe
+	.long	0x107
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3214
+	.byte	0x1a
+	.byte	0x8e
+	.byte	0xe
+	.long	0x107
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3215
+	.byte	0x1a
+	.byte	0x8f
+	.byte	0xe
+	.long	0x107
+	.byte	0x28
+	.byte	0
+	.uleb128 0x7
+	.long	0xf6
+	.long	0xe49
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3216
+	.byte	0x1a
+	.byte	0x90
+	.byte	0x3
+	.long	0xce6
+	.uleb128 0x20
+	.byte	0x38
+	.byte	0x1b
+	.byte	0x16
+	.long	0xeaa
+	.uleb128 0x15
+	.string	"fd"
+	.byte	0x1b
+	.byte	0x17
+	.byte	0x6
+	.long	0x70
+	.byte	0
+	.uleb128 0x15
+	.string	"si"
+	.byte	0x1b
+	.byte	0x18
+	.byte	0x15
+	.long	0x82c
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3217
+	.byte	0x1b
+	.byte	0x19
+	.byte	0x15
+	.long	0x82c
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3218
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0x6
+	.long	0x70
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3219
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x8
+	.long	0xd9
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3220
+	.byte	0x1b
+	.byte	0x1c
+	.byte	0x6
+	.long	0x7e6
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3221
+	.byte	0x1b
+	.byte	0x1d
+	.byte	0x3
+	.long	0xe55
+	.uleb128 0xa
+	.long	.LASF3222
+	.byte	0x3b
+	.byte	0x13
+	.long	0x604
+	.uleb128 0xa
+	.long	.LASF3223
+	.byte	0x3c
+	.byte	0x15
+	.long	0x63c
+	.uleb128 0xa
+	.long	.LASF3224
+	.byte	0x3e
+	.byte	0x18
+	.long	0x358
+	.uleb128 0xa
+	.long	.LASF3225
+	.byte	0x3f
+	.byte	0xf
+	.long	0x51c
+	.uleb128 0xa
+	.long	.LASF3226
+	.byte	0x40
+	.byte	0x12
+	.long	0x43b
+	.uleb128 0xa
+	.long	.LASF3227
+	.byte	0x42
+	.byte	0x12
+	.long	0x43b
+	.uleb128 0xa
+	.long	.LASF3228
+	.byte	0x44
+	.byte	0xc
+	.long	0x7e6
+	.uleb128 0xa
+	.long	.LASF3229
+	.byte	0x45
+	.byte	0x12
+	.long	0xeaa
+	.uleb128 0xa
+	.long	.LASF3230
+	.byte	0x45
+	.byte	0x1d
+	.long	0xeaa
+	.uleb128 0xa
+	.long	.LASF3231
+	.byte	0x46
+	.byte	0x18
+	.long	0x4f4
+	.uleb128 0xa
+	.long	.LASF3232
+	.byte	0x47
+	.byte	0x18
+	.long	0x4f4
+	.uleb128 0x9
+	.long	.LASF3233
+	.value	0x1df
+	.byte	0xc
+	.long	0x7e6
+	.uleb128 0x7
+	.long	0xa0a
+	.long	0xf4b
+	.uleb128 0x8
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3234
+	.value	0x1e0
+	.byte	0x18
+	.long	0xf3b
+	.uleb128 0x7
+	.long	0xa0a
+	.long	0xf67
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3235
+	.value	0x1e1
+	.byte	0x18
+	.long	0xf57
+	.uleb128 0x7
+	.long	0xea
+	.long	0xf83
+	.uleb128 0x8
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3236
+	.value	0x1e4
+	.byte	0x10
+	.long	0xf73
+	.uleb128 0x7
+	.long	0xea
+	.long	0xf9f
+	.uleb128 0x8
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3237
+	.value	0x1e5
+	.byte	0x10
+	.long	0xf8f
+	.uleb128 0x9
+	.long	.LASF3238
+	.value	0x1e6
+	.byte	0x10
+	.long	0xea
+	.uleb128 0x27
+	.long	.LASF3240
+	.value	0x239
+	.long	0xde
+	.uleb128 0x27
+	.long	.LASF3241
+	.value	0x23a
+	.long	0xde
+	.uleb128 0x28
+	.long	.LASF3242
+	.value	0x23d
+	.long	0xf6
+	.uleb128 0x28
+	.long	.LASF3243
+	.value	0x23e
+	.long	0xf6
+	.uleb128 0x9
+	.long	.LASF3244
+	.value	0x23f
+	.byte	0xe
+	.long	0x33b
+	.uleb128 0x12
+	.long	.LASF3245
+	.byte	0x1d
+	.byte	0x3d
+	.byte	0xe
+	.long	0xc6
+	.long	0x100f
+	.uleb128 0x3
+	.long	0xc6
+	.uleb128 0x3
+	.long	0x70
+	.uleb128 0x3
+	.long	0x13c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3246
+	.byte	0x1e
+	.byte	0xb2
+	.byte	0xc
+	.long	0x70
+	.long	0x1025
+	.uleb128 0x3
+	.long	0x33b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3247
+	.byte	0x1e
+	.value	0x2a9
+	.byte	0xf
+	.long	0x13c
+	.long	0x104b
+	.uleb128 0x3
+	.long	0x505
+	.uleb128 0x3
+	.long	0x13c
+	.uleb128 0x3
+	.long	0x13c
+	.uleb128 0x3
+	.long	0x340
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3248
+	.byte	0x1e
+	.value	0x201
+	.byte	0xc
+	.long	0x70
+	.long	0x1062
+	.uleb128 0x3
+	.long	0x33b
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF3258
+	.byte	0x1e
+	.value	0x2d3
+	.byte	0xd
+	.long	0x1075
+	.uleb128 0x3
+	.long	0x33b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3249
+	.byte	0x1e
+	.value	0x2ce
+	.byte	0x11
+	.long	0x83
+	.long	0x108c
+	.uleb128 0x3
+	.long	0x33b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3250
+	.byte	0x1e
+	.value	0x2c9
+	.byte	0xc
+	.long	0x70
+	.long	0x10ad
+	.uleb128 0x3
+	.long	0x33b
+	.uleb128 0x3
+	.long	0x83
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3251
+	.byte	0x1e
+	.value	0x102
+	.byte	0xe
+	.long	0x33b
+	.long	0x10c9
+	.uleb128 0x3
+	.long	0x510
+	.uleb128 0x3
+	.long	0x510
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3252
+	.byte	0x1f
+	.byte	0x1e
+	.byte	0x5
+	.long	0x7e6
+	.long	0x10df
+	.uleb128 0x3
+	.long	0x113
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF3352
+	.byte	0x26
+	.byte	0x25
+	.byte	0xd
+	.long	0x10eb
+	.uleb128 0x5
+	.long	0x70
+	.uleb128 0x10
+	.long	.LASF3253
+	.byte	0x20
+	.value	0x119
+	.byte	0xc
+	.long	0x70
+	.long	0x110c
+	.uleb128 0x3
+	.long	0x110c
+	.uleb128 0x3
+	.long	0x1111
+	.byte	0
+	.uleb128 0x5
+	.long	0x380
+	.uleb128 0x5
+	.long	0x358
+	.uleb128 0x12
+	.long	.LASF3254
+	.byte	0x21
+	.byte	0xdb
+	.byte	0xc
+	.long	0x70
+	.long	0x1131
+	.uleb128 0x3
+	.long	0x43b
+	.uleb128 0x3
+	.long	0x1131
+	.byte	0
+	.uleb128 0x5
+	.long	0xc6
+	.uleb128 0x21
+	.long	.LASF3255
+	.byte	0x22
+	.byte	0x46
+	.uleb128 0x21
+	.long	.LASF3256
+	.byte	0x23
+	.byte	0x2e
+	.uleb128 0x21
+	.long	.LASF3257
+	.byte	0x22
+	.byte	0x45
+	.uleb128 0x19
+	.long	.LASF3259
+	.byte	0x22
+	.byte	0x4b
+	.long	0x115c
+	.uleb128 0x3
+	.long	0x51c
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3260
+	.byte	0x22
+	.byte	0x4a
+	.long	0x116d
+	.uleb128 0x3
+	.long	0x51c
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3261
+	.byte	0x22
+	.byte	0x44
+	.uleb128 0x12
+	.long	.LASF3262
+	.byte	0x1b
+	.byte	0x20
+	.byte	0x5
+	.long	0x70
+	.long	0x1199
+	.uleb128 0x3
+	.long	0x1199
+	.uleb128 0x3
+	.long	0xc6
+	.uleb128 0x3
+	.long	0x13c
+	.uleb128 0x3
+	.long	0x113
+	.byte	0
+	.uleb128 0x5
+	.long	0xeaa
+	.uleb128 0x19
+	.long	.LASF3263
+	.byte	0x19
+	.byte	0xbf
+	.long	0x11b4
+	.uleb128 0x3
+	.long	0xcda
+	.uleb128 0x3
+	.long	0x113
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3264
+	.byte	0x1e
+	.value	0x164
+	.byte	0xc
+	.long	0x70
+	.long	0x11cc
+	.uleb128 0x3
+	.long	0x50b
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3265
+	.byte	0x1b
+	.byte	0x1f
+	.byte	0x5
+	.long	0x70
+	.long	0x11f1
+	.uleb128 0x3
+	.long	0x1199
+	.uleb128 0x3
+	.long	0x50b
+	.uleb128 0x3
+	.long	0x70
+	.uleb128 0x3
+	.long	0x7e6
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3266
+	.byte	0x21
+	.byte	0xca
+	.byte	0xc
+	.long	0x70
+	.long	0x1216
+	.uleb128 0x3
+	.long	0x121b
+	.uleb128 0x3
+	.long	0x1225
+	.uleb128 0x3
+	.long	0x122a
+	.uleb128 0x3
+	.long	0xc8
+	.byte	0
+	.uleb128 0x5
+	.long	0x43b
+	.uleb128 0x17
+	.long	0x1216
+	.uleb128 0x5
+	.long	0x4b6
+	.uleb128 0x17
+	.long	0x1220
+	.uleb128 0x5
+	.long	0x122f
+	.uleb128 0x3a
+	.long	0xc6
+	.long	0x123e
+	.uleb128 0x3
+	.long	0xc6
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF3267
+	.byte	0x24
+	.value	0x27d
+	.byte	0xd
+	.long	0x1251
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3268
+	.byte	0x21
+	.value	0x30d
+	.byte	0xc
+	.long	0x70
+	.long	0x126d
+	.uleb128 0x3
+	.long	0x126d
+	.uleb128 0x3
+	.long	0x1272
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f4
+	.uleb128 0x5
+	.long	0x471
+	.uleb128 0x10
+	.long	.LASF3269
+	.byte	0x21
+	.value	0x343
+	.byte	0xc
+	.long	0x70
+	.long	0x128e
+	.uleb128 0x3
+	.long	0x126d
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3270
+	.byte	0x25
+	.byte	0x4e
+	.long	0x12ae
+	.uleb128 0x3
+	.long	0x515
+	.uleb128 0x3
+	.long	0x515
+	.uleb128 0x3
+	.long	0x515
+	.uleb128 0x3
+	.long	0x515
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3271
+	.byte	0x17
+	.byte	0x1c
+	.long	0x12ce
+	.uleb128 0x3
+	.long	0xb6d
+	.uleb128 0x3
+	.long	0xea
+	.uleb128 0x3
+	.long	0xea
+	.uleb128 0x3
+	.long	0xea
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3272
+	.byte	0x17
+	.byte	0x17
+	.long	0x12ee
+	.uleb128 0x3
+	.long	0xb57
+	.uleb128 0x3
+	.long	0xea
+	.uleb128 0x3
+	.long	0xea
+	.uleb128 0x3
+	.long	0xea
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3273
+	.byte	0x20
+	.value	0x120
+	.byte	0xc
+	.long	0x70
+	.long	0x130a
+	.uleb128 0x3
+	.long	0x34c
+	.uleb128 0x3
+	.long	0x1111
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3274
+	.byte	0x1b
+	.byte	0x21
+	.byte	0x5
+	.long	0x70
+	.long	0x132a
+	.uleb128 0x3
+	.long	0x1199
+	.uleb128 0x3
+	.long	0x500
+	.uleb128 0x3
+	.long	0x13c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3275
+	.byte	0x21
+	.value	0x316
+	.byte	0xc
+	.long	0x70
+	.long	0x1341
+	.uleb128 0x3
+	.long	0x126d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3276
+	.value	0x288
+	.long	0x1359
+	.uleb128 0x6
+	.long	.LASF3278
+	.value	0x288
+	.byte	0x1f
+	.long	0x1359
+	.byte	0
+	.uleb128 0x5
+	.long	0xe49
+	.uleb128 0xb
+	.long	.LASF3277
+	.value	0x282
+	.long	0x1376
+	.uleb128 0x6
+	.long	.LASF3279
+	.value	0x282
+	.byte	0x30
+	.long	0x1376
+	.byte	0
+	.uleb128 0x5
+	.long	0x7e1
+	.uleb128 0x22
+	.long	.LASF3280
+	.value	0x276
+	.byte	0xe
+	.long	0x581
+	.long	0x13a4
+	.uleb128 0x6
+	.long	.LASF3219
+	.value	0x276
+	.byte	0x2a
+	.long	0x130
+	.uleb128 0x6
+	.long	.LASF3281
+	.value	0x276
+	.byte	0x39
+	.long	0x113
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3282
+	.value	0x26d
+	.byte	0xe
+	.long	0x581
+	.long	0x13c1
+	.uleb128 0x6
+	.long	.LASF3283
+	.value	0x26d
+	.byte	0x28
+	.long	0x130
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3284
+	.value	0x262
+	.long	0x13db
+	.uleb128 0x13
+	.uleb128 0x9
+	.long	.LASF3285
+	.value	0x265
+	.byte	0x18
+	.long	0x13db
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x102
+	.uleb128 0xb
+	.long	.LASF3286
+	.value	0x241
+	.long	0x141e
+	.uleb128 0x9
+	.long	.LASF3285
+	.value	0x242
+	.byte	0x15
+	.long	0x78b
+	.uleb128 0x13
+	.uleb128 0x9
+	.long	.LASF3287
+	.value	0x253
+	.byte	0xe
+	.long	0x83
+	.uleb128 0x13
+	.uleb128 0x11
+	.string	"i"
+	.value	0x257
+	.byte	0x17
+	.long	0x30
+	.uleb128 0x13
+	.uleb128 0x11
+	.string	"c"
+	.value	0x258
+	.byte	0x15
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3288
+	.value	0x233
+	.byte	0xa
+	.long	0x107
+	.long	0x143b
+	.uleb128 0x6
+	.long	.LASF3113
+	.value	0x233
+	.byte	0x20
+	.long	0xf6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3289
+	.value	0x22e
+	.long	0x145f
+	.uleb128 0x6
+	.long	.LASF3290
+	.value	0x22e
+	.byte	0x1c
+	.long	0xf6
+	.uleb128 0x6
+	.long	.LASF3291
+	.value	0x22e
+	.byte	0x29
+	.long	0x515
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3292
+	.value	0x215
+	.long	0x1483
+	.uleb128 0x6
+	.long	.LASF3293
+	.value	0x215
+	.byte	0x25
+	.long	0xf6
+	.uleb128 0x9
+	.long	.LASF3294
+	.value	0x21a
+	.byte	0xc
+	.long	0x51c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3295
+	.value	0x210
+	.long	0x149b
+	.uleb128 0x6
+	.long	.LASF3293
+	.value	0x210
+	.byte	0x2c
+	.long	0xf6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3296
+	.value	0x20c
+	.long	0x14bf
+	.uleb128 0x6
+	.long	.LASF3290
+	.value	0x20c
+	.byte	0x1c
+	.long	0xf6
+	.uleb128 0x6
+	.long	.LASF3291
+	.value	0x20c
+	.byte	0x29
+	.long	0x515
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3297
+	.value	0x207
+	.byte	0x5
+	.long	0x7e6
+	.uleb128 0x1b
+	.long	.LASF3298
+	.value	0x203
+	.byte	0x5
+	.long	0x7e6
+	.uleb128 0x1c
+	.long	.LASF3330
+	.value	0x1ff
+	.uleb128 0x1b
+	.long	.LASF3299
+	.value	0x1fb
+	.byte	0x12
+	.long	0x14ea
+	.uleb128 0x5
+	.long	0xa0a
+	.uleb128 0xb
+	.long	.LASF3300
+	.value	0x1f4
+	.long	0x1515
+	.uleb128 0x6
+	.long	.LASF3301
+	.value	0x1f4
+	.byte	0x2b
+	.long	0x1515
+	.uleb128 0x13
+	.uleb128 0x9
+	.long	.LASF3302
+	.value	0x1f6
+	.byte	0x12
+	.long	0xf6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xad7
+	.uleb128 0xb
+	.long	.LASF3303
+	.value	0x1e8
+	.long	0x1558
+	.uleb128 0x6
+	.long	.LASF3304
+	.value	0x1e8
+	.byte	0x2b
+	.long	0x1558
+	.uleb128 0x6
+	.long	.LASF3305
+	.value	0x1e8
+	.byte	0x41
+	.long	0x107
+	.uleb128 0x6
+	.long	.LASF3293
+	.value	0x1e8
+	.byte	0x55
+	.long	0xf6
+	.uleb128 0x13
+	.uleb128 0x9
+	.long	.LASF3306
+	.value	0x1ee
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa81
+	.uleb128 0x22
+	.long	.LASF3307
+	.value	0x1cb
+	.byte	0x5
+	.long	0x70
+	.long	0x15b4
+	.uleb128 0x6
+	.long	.LASF3308
+	.value	0x1cb
+	.byte	0x22
+	.long	0x1111
+	.uleb128 0x1d
+	.string	"x"
+	.value	0x1cb
+	.byte	0x3b
+	.long	0x1111
+	.uleb128 0x1d
+	.string	"y"
+	.value	0x1cb
+	.byte	0x4f
+	.long	0x1111
+	.uleb128 0x9
+	.long	.LASF3309
+	.value	0x1cc
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x9
+	.long	.LASF3310
+	.value	0x1cd
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x13
+	.uleb128 0x9
+	.long	.LASF3311
+	.value	0x1d0
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3312
+	.value	0x1bb
+	.long	0x15d7
+	.uleb128 0x1d
+	.string	"ms"
+	.value	0x1bb
+	.byte	0x15
+	.long	0x113
+	.uleb128 0x9
+	.long	.LASF3313
+	.value	0x1bf
+	.byte	0xe
+	.long	0x11f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3314
+	.value	0x1b7
+	.long	0x15ee
+	.uleb128 0x1d
+	.string	"us"
+	.value	0x1b7
+	.byte	0x26
+	.long	0x113
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3315
+	.value	0x1ae
+	.long	0x1605
+	.uleb128 0x1d
+	.string	"us"
+	.value	0x1ae
+	.byte	0x21
+	.long	0x113
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3316
+	.value	0x1a7
+	.long	0x1628
+	.uleb128 0x6
+	.long	.LASF3317
+	.value	0x1a7
+	.byte	0x1a
+	.long	0x113
+	.uleb128 0x11
+	.string	"ts"
+	.value	0x1a8
+	.byte	0x15
+	.long	0x358
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3318
+	.value	0x1a3
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x1b
+	.long	.LASF3319
+	.value	0x19f
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x1e
+	.long	.LASF3320
+	.value	0x192
+	.long	0x11f
+	.long	0x1674
+	.uleb128 0x9
+	.long	.LASF3321
+	.value	0x193
+	.byte	0x15
+	.long	0x11f
+	.uleb128 0x11
+	.string	"out"
+	.value	0x194
+	.byte	0x15
+	.long	0x11f
+	.uleb128 0x11
+	.string	"now"
+	.value	0x195
+	.byte	0xe
+	.long	0x11f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3322
+	.value	0x186
+	.long	0x11f
+	.long	0x16a8
+	.uleb128 0x9
+	.long	.LASF3321
+	.value	0x187
+	.byte	0x15
+	.long	0x11f
+	.uleb128 0x11
+	.string	"out"
+	.value	0x188
+	.byte	0x15
+	.long	0x11f
+	.uleb128 0x11
+	.string	"now"
+	.value	0x189
+	.byte	0xe
+	.long	0x11f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3323
+	.value	0x159
+	.long	0x11f
+	.long	0x16c3
+	.uleb128 0x11
+	.string	"ts"
+	.value	0x15a
+	.byte	0x15
+	.long	0x358
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3324
+	.value	0x153
+	.long	0x11f
+	.long	0x16de
+	.uleb128 0x11
+	.string	"ts"
+	.value	0x154
+	.byte	0x15
+	.long	0x358
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3325
+	.value	0x14d
+	.long	0x11f
+	.long	0x16f9
+	.uleb128 0x11
+	.string	"ts"
+	.value	0x14e
+	.byte	0x15
+	.long	0x358
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3326
+	.value	0x145
+	.long	0x171d
+	.uleb128 0x6
+	.long	.LASF3327
+	.value	0x145
+	.byte	0x24
+	.long	0x8b5
+	.uleb128 0x6
+	.long	.LASF3328
+	.value	0x145
+	.byte	0x2e
+	.long	0x70
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3329
+	.value	0x140
+	.long	0x1735
+	.uleb128 0x6
+	.long	.LASF3327
+	.value	0x140
+	.byte	0x20
+	.long	0x8b5
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3331
+	.value	0x13d
+	.uleb128 0x1c
+	.long	.LASF3332
+	.value	0x139
+	.uleb128 0xb
+	.long	.LASF3333
+	.value	0x134
+	.long	0x175b
+	.uleb128 0x6
+	.long	.LASF3334
+	.value	0x134
+	.byte	0x27
+	.long	0x175b
+	.byte	0
+	.uleb128 0x5
+	.long	0xb20
+	.uleb128 0x1c
+	.long	.LASF3335
+	.value	0x127
+	.uleb128 0x1c
+	.long	.LASF3336
+	.value	0x11c
+	.uleb128 0x29
+	.long	.LASF3337
+	.byte	0xe4
+	.long	0x1784
+	.uleb128 0x1f
+	.string	"ret"
+	.byte	0xe5
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF3339
+	.byte	0xd1
+	.long	0xc6
+	.long	0x179d
+	.uleb128 0x2b
+	.long	.LASF3338
+	.byte	0xd1
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF3340
+	.byte	0xc0
+	.long	0xc6
+	.long	0x17bf
+	.uleb128 0x2b
+	.long	.LASF3338
+	.byte	0xc0
+	.long	0xc6
+	.uleb128 0x1f
+	.string	"n"
+	.byte	0xc2
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF3341
+	.byte	0x5d
+	.long	0x1840
+	.uleb128 0x3c
+	.string	"pkt"
+	.byte	0x1c
+	.byte	0x5d
+	.byte	0x24
+	.long	0x1840
+	.uleb128 0xa
+	.long	.LASF3342
+	.byte	0x5e
+	.byte	0x13
+	.long	0x51c
+	.uleb128 0xa
+	.long	.LASF3343
+	.byte	0x5f
+	.byte	0x15
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF3344
+	.byte	0x60
+	.byte	0x1c
+	.long	0x358
+	.uleb128 0xa
+	.long	.LASF3345
+	.byte	0x62
+	.byte	0x15
+	.long	0x358
+	.uleb128 0xa
+	.long	.LASF3346
+	.byte	0x65
+	.byte	0x14
+	.long	0x12b
+	.uleb128 0xa
+	.long	.LASF3347
+	.byte	0x73
+	.byte	0x12
+	.long	0x523
+	.uleb128 0x1f
+	.string	"x"
+	.byte	0x78
+	.byte	0xd
+	.long	0xea
+	.uleb128 0x1f
+	.string	"y"
+	.byte	0x78
+	.byte	0xf
+	.long	0xea
+	.uleb128 0x1f
+	.string	"z"
+	.byte	0x78
+	.byte	0x11
+	.long	0xea
+	.uleb128 0x13
+	.uleb128 0xa
+	.long	.LASF3348
+	.byte	0xac
+	.byte	0x19
+	.long	0x358
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x60f
+	.uleb128 0x3d
+	.long	.LASF3353
+	.byte	0x1c
+	.byte	0x5a
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF3349
+	.byte	0x1c
+	.byte	0x53
+	.byte	0x5
+	.long	0x70
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 39 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 42 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 43 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2b
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 46 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 48 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x30
+	.file 49 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF719
+	.file 53 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF722
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF724
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF726
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF766
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF812
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 64 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF862
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF695
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF863
+	.file 68 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF864
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF881
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF894
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF899
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF920
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF922
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF934
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF941
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF942
+	.byte	0x4
+	.byte	0x4
+	.file 81 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF946
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x52
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x4
+	.byte	0x4
+	.file 86 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 87 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x58
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1337
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x5c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x5d
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1431
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1432
+	.file 96 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x60
+	.file 97 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x61
+	.file 98 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1433
+	.file 99 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1568
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1569
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1585
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1586
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1587
+	.byte	0x4
+	.file 103 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 104 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x68
+	.file 105 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 106 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6a
+	.file 107 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 108 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.file 109 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x6d
+	.file 110 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.file 111 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 112 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x10
+	.file 113 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x71
+	.file 114 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2220
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2221
+	.file 115 "/usr/include/x86_64-linux-gnu/sys/socket.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x73
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2222
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF695
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/socket.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x75
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2225
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/socket_type.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x3
+	.uleb128 0xb4
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.file 119 "/usr/include/x86_64-linux-gnu/asm/socket.h"
+	.byte	0x3
+	.uleb128 0x181
+	.uleb128 0x77
+	.file 120 "/usr/include/asm-generic/socket.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x78
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2399
+	.file 121 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2400
+	.file 122 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.file 123 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x7b
+	.file 124 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.file 125 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2409
+	.file 126 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.file 127 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x7f
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2412
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 128 "/usr/include/x86_64-linux-gnu/asm/sockios.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x80
+	.file 129 "/usr/include/asm-generic/sockios.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x81
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 130 "/usr/include/x86_64-linux-gnu/bits/types/struct_osockaddr.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x82
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2509
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.file 131 "/usr/include/x86_64-linux-gnu/bits/in.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x3
+	.uleb128 0x196
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x197
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2735
+	.file 132 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x84
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 133 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.file 134 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x86
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2741
+	.byte	0x4
+	.byte	0x4
+	.file 135 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x87
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro105
+	.byte	0x4
+	.file 136 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x88
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2759
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 137 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x89
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2760
+	.byte	0x4
+	.file 138 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8a
+	.file 139 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2761
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro106
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2783
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro107
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro108
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.file 140 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8c
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2797
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro109
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro110
+	.byte	0x4
+	.file 141 "./src/main/drivers/timer_def.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x8d
+	.byte	0x7
+	.long	.Ldebug_macro111
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x25
+	.file 142 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8e
+	.byte	0x7
+	.long	.Ldebug_macro112
+	.byte	0x4
+	.file 143 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8f
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2873
+	.byte	0x4
+	.byte	0x4
+	.file 144 "./src/main/config/config_streamer.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x90
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2874
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x18
+	.file 145 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x91
+	.byte	0x4
+	.file 146 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x92
+	.byte	0x4
+	.file 147 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x93
+	.byte	0x7
+	.long	.Ldebug_macro113
+	.byte	0x4
+	.file 148 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x94
+	.byte	0x4
+	.file 149 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x95
+	.byte	0x7
+	.long	.Ldebug_macro114
+	.byte	0x4
+	.file 150 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x96
+	.byte	0x7
+	.long	.Ldebug_macro115
+	.byte	0x4
+	.file 151 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x97
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2886
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro116
+	.byte	0x4
+	.file 152 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x98
+	.file 153 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x99
+	.byte	0x4
+	.file 154 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro117
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro118
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2919
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0x4
+	.file 155 "/usr/include/arpa/inet.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x9b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2920
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2921
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2922
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2923
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF746
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF751
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF821
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.fc9d051d38577d71bf2818359e56065c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF846
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.882ecbf54662e1f16e101552381a65da,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF858
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF868
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF872
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF893
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF919
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF937
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF940
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1222
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1223
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1225
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1227
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1233
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1237
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1253
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1257
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1261
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1263
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1336
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1339
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1341
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1356
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1356
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1366
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1369
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1369
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1369
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1369
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1360
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1378
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1379
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1380
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1381
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1388
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1389
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1390
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1391
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1430
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1468
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1584
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1608
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1647
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1668
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1670
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1609
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1698
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1699
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1700
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1701
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1702
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1703
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1704
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1705
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1706
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1707
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1708
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1709
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1710
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1711
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1712
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1713
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1714
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1715
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1716
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1718
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1720
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1721
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1722
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1723
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1724
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1725
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1726
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1727
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1728
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1735
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1748
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1749
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1765
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1804
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1816
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2184
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.113.4d5d0c05ce1a76c3b97be0da5de43ba3,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2201
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2219
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1749
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.20.08bd3c6531df306b747ad30a61a6808b,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket_type.h.28.5a26c72aa620989d56a4a7f4b904e12a,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2234
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.41.e4f0faad59a1da54fad3da8d9088aa2a,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockaddr.h.24.0f72ba81a432198016bbf84b8b7dd664,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2366
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.192.eb10e7be020a473ce84a66db81ce6bec,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.3.65729c9f805bc1ab8e22fab65fee3ee6,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2408
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2411
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockios.h.3.7ae89caef44885f67ccfdec206df4325,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF2420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.9.ad61275896734f9826c69c5bb28c7264,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2508
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.44.faa1ad965e926697db19cbab56850849,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.41.6a59d6a1707661b231dcfea9d9f6951a,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.43.4df33bb59d312ed38c2a8849594b8e72,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2717
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.422.ee437be11cfc9d4be701124d8f6f0975,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF2734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2740
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2746
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro105:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2757
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro106:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2765
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2772
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2776
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2779
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2780
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2781
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2782
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.3fa7b8f6daaa31edd1696c08c77f2a73,comdat
+.Ldebug_macro107:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2784
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2785
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2786
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2787
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2788
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2789
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2790
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2791
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2792
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2793
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_tcp.h.24.5e3814d8727d3a55be9963c55acf72d9,comdat
+.Ldebug_macro108:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2795
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2796
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro109:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2798
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2799
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2800
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2801
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2802
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro110:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2804
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2805
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2806
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2808
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2810
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2811
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2812
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2813
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timer_def.h.28.c8771ae806ee653b87bb8d95881af2e2,comdat
+.Ldebug_macro111:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2814
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2815
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2816
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2817
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2818
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2819
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2820
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2821
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2823
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2824
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2825
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2827
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2828
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2829
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2830
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2831
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2832
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2833
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2835
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2836
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2837
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2838
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2839
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2840
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2841
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2843
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2845
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2846
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2847
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2848
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2849
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2851
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2852
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2854
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2855
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2856
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2857
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2858
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2861
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2862
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2865
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2866
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2867
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2868
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro112:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2870
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2871
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2872
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro113:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2875
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro114:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2878
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2879
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2880
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2882
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro115:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2883
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2884
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2885
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro116:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2888
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2890
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro117:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2892
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2893
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro118:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2894
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2895
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2896
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2898
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2899
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2900
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2901
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2903
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2904
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2905
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2906
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2907
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2908
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2909
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2910
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2911
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2912
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2914
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2915
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2916
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2917
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2918
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1a
+	.long	.LASF1
+	.long	.LASF3354
+	.long	.LASF3355
+	.long	.LASF3356
+	.long	.LASF3357
+	.long	.LASF3358
+	.long	.LASF3359
+	.long	.LASF3360
+	.long	.LASF3361
+	.long	.LASF3362
+	.long	.LASF3363
+	.long	.LASF3364
+	.long	.LASF3365
+	.long	.LASF3366
+	.long	.LASF3367
+	.long	.LASF3368
+	.long	.LASF3369
+	.long	.LASF3370
+	.long	.LASF3371
+	.long	.LASF3372
+	.long	.LASF3373
+	.long	.LASF3374
+	.long	.LASF3375
+	.long	.LASF3376
+	.long	.LASF3377
+	.long	.LASF3378
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x9c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3379
+	.byte	0x15
+	.long	.LASF3380
+	.byte	0x15
+	.long	.LASF3381
+	.byte	0x15
+	.long	.LASF3382
+	.byte	0x18
+	.long	.LASF3383
+	.byte	0x19
+	.long	.LASF3384
+	.byte	0x14
+	.long	.LASF3385
+	.byte	0x14
+	.long	.LASF3386
+	.byte	0x14
+	.long	.LASF3387
+	.byte	0x14
+	.long	.LASF3388
+	.byte	0x15
+	.long	.LASF3389
+	.byte	0x15
+	.long	.LASF3390
+	.byte	0x15
+	.long	.LASF3391
+	.byte	0xc
+	.long	.LASF3392
+	.byte	0x6
+	.long	.LASF3393
+	.byte	0x6
+	.long	.LASF3394
+	.byte	0x6
+	.long	.LASF3395
+	.byte	0x15
+	.long	.LASF3396
+	.byte	0x12
+	.long	.LASF3397
+	.byte	0x6
+	.long	.LASF3398
+	.byte	0x6
+	.long	.LASF3399
+	.byte	0x6
+	.long	.LASF3400
+	.byte	0x6
+	.long	.LASF3401
+	.byte	0x5
+	.long	.LASF3402
+	.byte	0x7
+	.long	.LASF3403
+	.byte	0xa
+	.long	.LASF3404
+	.byte	0x9
+	.long	.LASF3405
+	.byte	0xc
+	.long	.LASF3406
+	.byte	0xc
+	.long	.LASF3407
+	.byte	0x18
+	.long	.LASF3408
+	.byte	0x18
+	.long	.LASF3409
+	.byte	0x4
+	.long	.LASF3410
+	.byte	0x18
+	.long	.LASF3411
+	.byte	0x18
+	.long	.LASF3412
+	.byte	0x1
+	.long	.LASF3413
+	.byte	0x6
+	.long	.LASF3414
+	.byte	0x18
+	.long	.LASF3415
+	.byte	0x8
+	.long	.LASF3416
+	.byte	0x18
+	.long	.LASF3417
+	.byte	0x18
+	.long	.LASF3382
+	.byte	0x19
+	.long	.LASF3418
+	.byte	0x15
+	.long	.LASF3419
+	.byte	0x18
+	.long	.LASF3420
+	.byte	0x18
+	.long	.LASF3421
+	.byte	0x15
+	.long	.LASF3422
+	.byte	0x15
+	.long	.LASF3423
+	.byte	0x17
+	.long	.LASF3424
+	.byte	0x15
+	.long	.LASF3425
+	.byte	0x16
+	.long	.LASF3426
+	.byte	0x16
+	.long	.LASF3427
+	.byte	0x15
+	.long	.LASF3428
+	.byte	0x15
+	.long	.LASF3429
+	.byte	0x15
+	.long	.LASF3430
+	.byte	0x19
+	.long	.LASF3431
+	.byte	0x14
+	.long	.LASF3432
+	.byte	0x14
+	.long	.LASF3433
+	.byte	0x14
+	.long	.LASF3434
+	.byte	0x14
+	.long	.LASF3435
+	.byte	0x15
+	.long	.LASF3436
+	.byte	0x15
+	.long	.LASF3437
+	.byte	0x15
+	.long	.LASF3408
+	.byte	0x15
+	.long	.LASF3438
+	.byte	0x15
+	.long	.LASF3439
+	.byte	0x15
+	.long	.LASF3379
+	.byte	0x17
+	.long	.LASF3440
+	.byte	0x14
+	.long	.LASF3441
+	.byte	0x14
+	.long	.LASF3442
+	.byte	0x14
+	.long	.LASF3443
+	.byte	0x18
+	.long	.LASF3443
+	.byte	0x15
+	.long	.LASF3444
+	.byte	0x15
+	.long	.LASF3445
+	.byte	0x15
+	.long	.LASF3446
+	.byte	0x15
+	.long	.LASF3447
+	.byte	0x17
+	.long	.LASF3447
+	.byte	0x15
+	.long	.LASF3448
+	.byte	0x14
+	.long	.LASF3449
+	.byte	0x14
+	.long	.LASF3450
+	.byte	0x14
+	.long	.LASF3451
+	.byte	0x15
+	.long	.LASF3452
+	.byte	0x15
+	.long	.LASF3453
+	.byte	0x15
+	.long	.LASF3454
+	.byte	0x18
+	.long	.LASF3455
+	.byte	0x15
+	.long	.LASF3456
+	.byte	0x15
+	.long	.LASF3457
+	.byte	0x14
+	.long	.LASF3458
+	.byte	0x14
+	.long	.LASF3459
+	.byte	0x18
+	.long	.LASF3460
+	.byte	0x18
+	.long	.LASF3461
+	.byte	0x15
+	.long	.LASF3462
+	.byte	0x15
+	.long	.LASF3463
+	.byte	0x15
+	.long	.LASF3464
+	.byte	0x15
+	.long	.LASF3465
+	.byte	0x15
+	.long	.LASF3466
+	.byte	0x15
+	.long	.LASF3467
+	.byte	0x15
+	.long	.LASF3416
+	.byte	0x15
+	.long	.LASF3416
+	.byte	0x11
+	.long	.LASF3416
+	.byte	0x13
+	.long	.LASF3416
+	.byte	0x10
+	.long	.LASF3468
+	.byte	0x10
+	.long	.LASF3410
+	.byte	0x15
+	.long	.LASF3469
+	.byte	0x14
+	.long	.LASF3470
+	.byte	0x14
+	.long	.LASF3471
+	.byte	0x3
+	.long	.LASF3472
+	.byte	0x6
+	.long	.LASF3473
+	.byte	0x19
+	.long	.LASF3474
+	.byte	0xe
+	.long	.LASF3475
+	.byte	0xd
+	.long	.LASF3476
+	.byte	0xd
+	.long	.LASF3477
+	.byte	0x6
+	.long	.LASF3478
+	.byte	0x3
+	.long	.LASF3479
+	.byte	0x6
+	.long	.LASF3480
+	.byte	0x6
+	.long	.LASF3481
+	.byte	0x4
+	.long	.LASF3482
+	.byte	0x2
+	.long	.LASF3483
+	.byte	0x17
+	.long	.LASF3484
+	.byte	0x14
+	.long	.LASF3483
+	.byte	0x15
+	.long	.LASF3485
+	.byte	0x15
+	.long	.LASF3483
+	.byte	0x13
+	.long	.LASF3483
+	.byte	0x10
+	.long	.LASF3486
+	.byte	0x11
+	.long	.LASF3383
+	.byte	0x11
+	.long	.LASF3486
+	.byte	0x13
+	.long	.LASF3487
+	.byte	0x13
+	.long	.LASF3486
+	.byte	0x10
+	.long	.LASF3488
+	.byte	0x13
+	.long	.LASF3488
+	.byte	0x10
+	.long	.LASF3489
+	.byte	0x13
+	.long	.LASF3489
+	.byte	0x10
+	.long	.LASF3490
+	.byte	0x14
+	.long	.LASF3396
+	.byte	0x15
+	.long	.LASF3491
+	.byte	0x18
+	.long	.LASF3491
+	.byte	0x15
+	.long	.LASF3492
+	.byte	0x14
+	.long	.LASF3493
+	.byte	0x15
+	.long	.LASF3494
+	.byte	0x15
+	.long	.LASF3495
+	.byte	0x14
+	.long	.LASF3496
+	.byte	0x15
+	.long	.LASF3497
+	.byte	0x15
+	.long	.LASF3498
+	.byte	0x6
+	.long	.LASF3499
+	.byte	0x6
+	.long	.LASF3500
+	.byte	0x3
+	.long	.LASF3410
+	.byte	0x3
+	.long	.LASF3501
+	.byte	0x4
+	.long	.LASF3502
+	.byte	0x6
+	.long	.LASF3503
+	.byte	0x6
+	.long	.LASF3504
+	.byte	0x6
+	.long	.LASF3505
+	.byte	0x6
+	.long	.LASF3506
+	.byte	0x6
+	.long	.LASF3507
+	.byte	0x6
+	.long	.LASF3508
+	.byte	0x6
+	.long	.LASF3509
+	.byte	0xb
+	.long	.LASF3510
+	.byte	0x6
+	.long	.LASF3511
+	.byte	0x6
+	.long	.LASF3512
+	.byte	0xf
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF3330:
+	.string	"pwmEnableMotors"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2596:
+	.string	"IPV6_RECVERR 25"
+.LASF2982:
+	.string	"long long int"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1929:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF949:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1744:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2719:
+	.string	"ntohs(x) __bswap_16 (x)"
+.LASF1147:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1673:
+	.string	"USE_FAKE_LED "
+.LASF2135:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1843:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1823:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF3130:
+	.string	"servoCenterPulse"
+.LASF2182:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF2769:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF798:
+	.string	"_T_WCHAR "
+.LASF3120:
+	.string	"enabled"
+.LASF1510:
+	.string	"ENOTUNIQ 76"
+.LASF2167:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF2871:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1129:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF3263:
+	.string	"rescheduleTask"
+.LASF2013:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2631:
+	.string	"IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF812:
+	.string	"_STDLIB_H 1"
+.LASF1514:
+	.string	"ELIBBAD 80"
+.LASF2975:
+	.string	"__pad5"
+.LASF1435:
+	.string	"EPERM 1"
+.LASF3191:
+	.string	"rcmap"
+.LASF2576:
+	.string	"IPV6_ADDRFORM 1"
+.LASF3193:
+	.string	"sbus_inversion"
+.LASF2927:
+	.string	"long unsigned int"
+.LASF2289:
+	.string	"AF_INET PF_INET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF794:
+	.string	"__wchar_t__ "
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF966:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1980:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1677:
+	.string	"GYRO "
+.LASF1415:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF2622:
+	.string	"IPV6_AUTOFLOWLABEL 70"
+.LASF1837:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2506:
+	.string	"SCM_TIMESTAMP SO_TIMESTAMP"
+.LASF1604:
+	.string	"_STDBOOL_H "
+.LASF2275:
+	.string	"PF_CAIF 37"
+.LASF2048:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2834:
+	.string	"DEF_TIM_CH__CH_CH2N D(2, 1)"
+.LASF3153:
+	.string	"FEATURE_RX_MSP"
+.LASF3167:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF1014:
+	.string	"__DECL_SIMD_acosf "
+.LASF2781:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF1547:
+	.string	"EHOSTUNREACH 113"
+.LASF720:
+	.string	"__need___va_list"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2638:
+	.string	"IPV6_PMTUDISC_PROBE 3"
+.LASF2868:
+	.string	"DEF_TIM_OUTPUT__D(chan_n,n_channel) PP_IIF(n_channel, TIMER_OUTPUT_N_CHANNEL, TIMER_OUTPUT_NONE)"
+.LASF1961:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1704:
+	.string	"USE_PWM"
+.LASF1019:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1051:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1259:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1595:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2271:
+	.string	"PF_RXRPC 33"
+.LASF2657:
+	.string	"IPPROTO_IPV6 IPPROTO_IPV6"
+.LASF1236:
+	.string	"__DECL_SIMD_log"
+.LASF3256:
+	.string	"tcpDataOutAll"
+.LASF956:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2707:
+	.string	"INADDR_ALLSNOOPERS_GROUP ((in_addr_t) 0xe000006a)"
+.LASF2280:
+	.string	"PF_QIPCRTR 42"
+.LASF866:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1521:
+	.string	"EUSERS 87"
+.LASF380:
+	.string	"__unix 1"
+.LASF759:
+	.string	"_BITS_FLOATN_H "
+.LASF1725:
+	.string	"VTX_CONTROL"
+.LASF839:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF2487:
+	.string	"SO_TIMESTAMPING_OLD 37"
+.LASF3217:
+	.string	"recv"
+.LASF2347:
+	.string	"SOL_RXRPC 272"
+.LASF1953:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1291:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF826:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1683:
+	.string	"USE_FLASHFS "
+.LASF1930:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF2251:
+	.string	"PF_SECURITY 14"
+.LASF2609:
+	.string	"IPV6_HOPLIMIT 52"
+.LASF2787:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1042:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF3200:
+	.string	"spektrum_sat_bind"
+.LASF1202:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2696:
+	.string	"IN_EXPERIMENTAL(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xe0000000)"
+.LASF3245:
+	.string	"memset"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2947:
+	.string	"uintptr_t"
+.LASF3339:
+	.string	"tcpThread"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1163:
+	.string	"__DECL_SIMD_acosh "
+.LASF2162:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2413:
+	.string	"__ASM_GENERIC_SOCKIOS_H "
+.LASF2429:
+	.string	"SO_RCVBUF 8"
+.LASF3233:
+	.string	"pwmMotorsEnabled"
+.LASF2797:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2573:
+	.string	"IP_DEFAULT_MULTICAST_TTL 1"
+.LASF2394:
+	.string	"CMSG_SPACE(len) (CMSG_ALIGN (len) + CMSG_ALIGN (sizeof (struct cmsghdr)))"
+.LASF2598:
+	.string	"IPV6_JOIN_ANYCAST 27"
+.LASF927:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2699:
+	.string	"INADDR_BROADCAST ((in_addr_t) 0xffffffff)"
+.LASF1023:
+	.string	"__DECL_SIMD_atan "
+.LASF2538:
+	.string	"MCAST_LEAVE_SOURCE_GROUP 47"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1642:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1288:
+	.string	"__DECL_SIMD_atan2"
+.LASF2680:
+	.string	"IN_CLASSA(a) ((((in_addr_t)(a)) & 0x80000000) == 0)"
+.LASF1866:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2082:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2471:
+	.string	"SO_DETACH_BPF SO_DETACH_FILTER"
+.LASF1393:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2457:
+	.string	"SO_PROTOCOL 38"
+.LASF2041:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF2378:
+	.string	"MSG_FIN MSG_FIN"
+.LASF1407:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF977:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2893:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2703:
+	.string	"INADDR_LOOPBACK ((in_addr_t) 0x7f000001)"
+.LASF1059:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2313:
+	.string	"AF_WANPIPE PF_WANPIPE"
+.LASF1254:
+	.string	"__DECL_SIMD_atanf"
+.LASF1304:
+	.string	"__DECL_SIMD_atanh"
+.LASF1397:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1615:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF2907:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF2814:
+	.string	"DEF_TIM_DMA_COND(...) "
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2074:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF3341:
+	.string	"updateState"
+.LASF2370:
+	.string	"MSG_PEEK MSG_PEEK"
+.LASF1469:
+	.string	"EDEADLK 35"
+.LASF1287:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF996:
+	.string	"__DECL_SIMD_expf16 "
+.LASF867:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"ENOLINK 67"
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF3028:
+	.string	"OWNER_FREE"
+.LASF1803:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF948:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF3074:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF3087:
+	.string	"in_port_t"
+.LASF1126:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1342:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1327:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2695:
+	.string	"IN_MULTICAST(a) IN_CLASSD(a)"
+.LASF1012:
+	.string	"__DECL_SIMD_powf128x "
+.LASF3308:
+	.string	"result"
+.LASF2209:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2679:
+	.string	"IPPROTO_MH IPPROTO_MH"
+.LASF2152:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1599:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF2236:
+	.string	"PF_LOCAL 1"
+.LASF1732:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF2357:
+	.string	"SOL_TLS 282"
+.LASF1227:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1192:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1805:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2558:
+	.string	"IP_ORIGDSTADDR 20"
+.LASF1593:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1424:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF3344:
+	.string	"last_ts"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF917:
+	.string	"__blkcnt_t_defined "
+.LASF1635:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF2377:
+	.string	"MSG_WAITALL MSG_WAITALL"
+.LASF885:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1551:
+	.string	"EUCLEAN 117"
+.LASF2689:
+	.string	"IN_CLASSB_MAX 65536"
+.LASF2588:
+	.string	"IPV6_MULTICAST_IF 17"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2845:
+	.string	"DEF_TIM_TIM__TIM_TIM9 D(9)"
+.LASF2761:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2294:
+	.string	"AF_BRIDGE PF_BRIDGE"
+.LASF1303:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF1388:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1852:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1191:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1796:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2159:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2529:
+	.string	"IP_BLOCK_SOURCE 38"
+.LASF2528:
+	.string	"IP_UNBLOCK_SOURCE 37"
+.LASF3043:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF3316:
+	.string	"microsleep"
+.LASF2315:
+	.string	"AF_IB PF_IB"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF758:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF2945:
+	.string	"uint32_t"
+.LASF1807:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF3026:
+	.string	"motor_speed"
+.LASF2190:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1925:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1285:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2883:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF3250:
+	.string	"fseek"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1996:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2832:
+	.string	"DEF_TIM_CH__CH_CH4 D(4, 0)"
+.LASF1485:
+	.string	"EL2HLT 51"
+.LASF3268:
+	.string	"pthread_mutex_init"
+.LASF967:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1106:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF3333:
+	.string	"ledInit"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2867:
+	.string	"DEF_TIM_OUTPUT(ch) CONCAT(DEF_TIM_OUTPUT__, DEF_TIM_CH_GET(ch))"
+.LASF1528:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF2683:
+	.string	"IN_CLASSA_HOST (0xffffffff & ~IN_CLASSA_NET)"
+.LASF2465:
+	.string	"SO_SELECT_ERR_QUEUE 45"
+.LASF3201:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF2273:
+	.string	"PF_PHONET 35"
+.LASF2165:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF3005:
+	.string	"pthread_mutexattr_t"
+.LASF750:
+	.string	"FILENAME_MAX 4096"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF881:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1598:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF2412:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF2912:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF1337:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2981:
+	.string	"_IO_wide_data"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2195:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF768:
+	.string	"__HAVE_FLOAT32 1"
+.LASF3237:
+	.string	"servosPwm"
+.LASF957:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2894:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1070:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1746:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1976:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2855:
+	.string	"DEF_TIM_TIM__TIM_TIM19 D(19)"
+.LASF780:
+	.string	"__f32(x) x ##f32"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF3252:
+	.string	"feature"
+.LASF2064:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1252:
+	.string	"__DECL_SIMD_atan"
+.LASF2356:
+	.string	"SOL_KCM 281"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2746:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF2411:
+	.string	"__BITS_PER_LONG 64"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1224:
+	.string	"__DECL_SIMD_cos"
+.LASF1956:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2649:
+	.string	"IPPROTO_IPIP IPPROTO_IPIP"
+.LASF1797:
+	.string	"BIT(x) (1 << (x))"
+.LASF2817:
+	.string	"BTCH_TIM1_CH2N BTCH_TIM1_CH2"
+.LASF1686:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF3229:
+	.string	"stateLink"
+.LASF2102:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF3100:
+	.string	"failureMode_e"
+.LASF2796:
+	.string	"TX_BUFFER_SIZE 16384"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"__DECL_SIMD_exp2f "
+.LASF963:
+	.string	"__DECL_SIMD_sin "
+.LASF1644:
+	.string	"TELEMETRY_SRXL "
+.LASF908:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1550:
+	.string	"ESTALE 116"
+.LASF3023:
+	.string	"velocity_xyz"
+.LASF2155:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2099:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF3346:
+	.string	"realtime_now"
+.LASF2091:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2698:
+	.string	"INADDR_ANY ((in_addr_t) 0x00000000)"
+.LASF852:
+	.string	"__mode_t_defined "
+.LASF2778:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF3323:
+	.string	"millis64_real"
+.LASF2380:
+	.string	"MSG_CONFIRM MSG_CONFIRM"
+.LASF1133:
+	.string	"__DECL_SIMD_log2 "
+.LASF2453:
+	.string	"SO_ACCEPTCONN 30"
+.LASF2345:
+	.string	"SOL_NETLINK 270"
+.LASF2654:
+	.string	"IPPROTO_IDP IPPROTO_IDP"
+.LASF2012:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF962:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1620:
+	.string	"USE_PWM "
+.LASF2027:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"__timeval_defined 1"
+.LASF2272:
+	.string	"PF_ISDN 34"
+.LASF2876:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2364:
+	.string	"__SOCKADDR_COMMON(sa_prefix) sa_family_t sa_prefix ##family"
+.LASF2673:
+	.string	"IPPROTO_HOPOPTS IPPROTO_HOPOPTS"
+.LASF3328:
+	.string	"repeatCount"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1230:
+	.string	"__DECL_SIMD_sinf"
+.LASF1280:
+	.string	"__DECL_SIMD_sinh"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2842:
+	.string	"DEF_TIM_TIM__TIM_TIM6 D(6)"
+.LASF3243:
+	.string	"__config_end"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1422:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1580:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF3204:
+	.string	"rssi_invert"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1531:
+	.string	"EAFNOSUPPORT 97"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2537:
+	.string	"MCAST_JOIN_SOURCE_GROUP 46"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2163:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2766:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1759:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1767:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2582:
+	.string	"IPV6_CHECKSUM 7"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF3037:
+	.string	"OWNER_ADC_EXT"
+.LASF1917:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF3320:
+	.string	"millis64"
+.LASF1122:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2389:
+	.string	"MSG_CMSG_CLOEXEC MSG_CMSG_CLOEXEC"
+.LASF2078:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2965:
+	.string	"_old_offset"
+.LASF1846:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__wur "
+.LASF1523:
+	.string	"EDESTADDRREQ 89"
+.LASF3309:
+	.string	"s_carry"
+.LASF1063:
+	.string	"__DECL_SIMD_exp10 "
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF753:
+	.string	"FOPEN_MAX 16"
+.LASF1775:
+	.string	"IOCFG_IPD 0"
+.LASF3151:
+	.string	"FEATURE_3D"
+.LASF992:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1611:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1394:
+	.string	"__MATHCALL_NARROW"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF845:
+	.string	"EXIT_SUCCESS 0"
+.LASF3109:
+	.string	"TIM_USE_TRANSPONDER"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1634:
+	.string	"TELEMETRY_HOTT "
+.LASF1952:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1889:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1970:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2260:
+	.string	"PF_SNA 22"
+.LASF2125:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2541:
+	.string	"IP_UNICAST_IF 50"
+.LASF2723:
+	.string	"IN6_IS_ADDR_LOOPBACK(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == htonl (1); }))"
+.LASF764:
+	.string	"__f128(x) x ##f128"
+.LASF1475:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF1688:
+	.string	"USE_UART2 "
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF2180:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1470:
+	.string	"ENAMETOOLONG 36"
+.LASF2310:
+	.string	"AF_SNA PF_SNA"
+.LASF2341:
+	.string	"SOL_IRDA 266"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1061:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF3111:
+	.string	"timerUsageFlag_e"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1443:
+	.string	"EBADF 9"
+.LASF1324:
+	.string	"__DECL_SIMD_erfc"
+.LASF3318:
+	.string	"millis"
+.LASF1069:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2129:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF3086:
+	.string	"s_addr"
+.LASF1751:
+	.string	"UNUSED(x) (void)(x)"
+.LASF889:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1544:
+	.string	"ETIMEDOUT 110"
+.LASF2540:
+	.string	"IP_MULTICAST_ALL 49"
+.LASF1412:
+	.string	"M_E 2.7182818284590452354"
+.LASF1944:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2426:
+	.string	"SO_DONTROUTE 5"
+.LASF3097:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF2820:
+	.string	"BTCH_TIM8_CH2N BTCH_TIM8_CH2"
+.LASF2718:
+	.string	"ntohl(x) __bswap_32 (x)"
+.LASF945:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF3198:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1865:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2434:
+	.string	"SO_NO_CHECK 11"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1416:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1940:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF3288:
+	.string	"adcGetChannel"
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3122:
+	.string	"motorDevConfig_s"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2373:
+	.string	"MSG_PROXY MSG_PROXY"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF864:
+	.string	"_ENDIAN_H 1"
+.LASF2656:
+	.string	"IPPROTO_DCCP IPPROTO_DCCP"
+.LASF988:
+	.string	"__DECL_SIMD_logf64 "
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF717:
+	.string	"NULL ((void *)0)"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1770:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF919:
+	.string	"__fsfilcnt_t_defined "
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1645:
+	.string	"USE_DASHBOARD "
+.LASF791:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF999:
+	.string	"__DECL_SIMD_expf128 "
+.LASF989:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2977:
+	.string	"_unused2"
+.LASF550:
+	.string	"__stub_stty "
+.LASF1539:
+	.string	"ENOBUFS 105"
+.LASF2225:
+	.string	"__socklen_t_defined "
+.LASF2948:
+	.string	"size_t"
+.LASF1768:
+	.string	"IO_TAG_NONE 0"
+.LASF2470:
+	.string	"SO_ATTACH_BPF 50"
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF833:
+	.string	"__WCOREFLAG 0x80"
+.LASF2795:
+	.string	"RX_BUFFER_SIZE 1400"
+.LASF3207:
+	.string	"maxcheck"
+.LASF2265:
+	.string	"PF_IB 27"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1761:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2498:
+	.string	"SO_RESERVE_MEM 73"
+.LASF1826:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2839:
+	.string	"DEF_TIM_TIM__TIM_TIM3 D(3)"
+.LASF2484:
+	.string	"SO_BINDTOIFINDEX 62"
+.LASF2299:
+	.string	"AF_DECnet PF_DECnet"
+.LASF2403:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF2659:
+	.string	"IPPROTO_GRE IPPROTO_GRE"
+.LASF726:
+	.string	"__FILE_defined 1"
+.LASF1702:
+	.string	"USE_VCP"
+.LASF1717:
+	.string	"TELEMETRY_MAVLINK"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1458:
+	.string	"EMFILE 24"
+.LASF2997:
+	.string	"__nusers"
+.LASF874:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1546:
+	.string	"EHOSTDOWN 112"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2562:
+	.string	"IP_CHECKSUM 23"
+.LASF2568:
+	.string	"IP_PMTUDISC_DO 2"
+.LASF2340:
+	.string	"SOL_AAL 265"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF718:
+	.string	"__need_NULL"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1142:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1937:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3203:
+	.string	"rssi_scale"
+.LASF2765:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1218:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF978:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2140:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2661:
+	.string	"IPPROTO_AH IPPROTO_AH"
+.LASF739:
+	.string	"_IOLBF 1"
+.LASF829:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF3036:
+	.string	"OWNER_ADC_CURR"
+.LASF2684:
+	.string	"IN_CLASSA_MAX 128"
+.LASF1499:
+	.string	"ENOPKG 65"
+.LASF2785:
+	.string	"_ANSI_STDARG_H_ "
+.LASF3267:
+	.string	"exit"
+.LASF1036:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2366:
+	.string	"_SS_SIZE 128"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1226:
+	.string	"__DECL_SIMD_cosf"
+.LASF2976:
+	.string	"_mode"
+.LASF875:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2747:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1127:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1825:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2017:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1752:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF2640:
+	.string	"IPV6_PMTUDISC_OMIT 5"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2688:
+	.string	"IN_CLASSB_HOST (0xffffffff & ~IN_CLASSB_NET)"
+.LASF2885:
+	.string	"BEEP_ON do {} while (0)"
+.LASF2032:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1387:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2898:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1232:
+	.string	"__DECL_SIMD_sincos"
+.LASF931:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1545:
+	.string	"ECONNREFUSED 111"
+.LASF2890:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1016:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2854:
+	.string	"DEF_TIM_TIM__TIM_TIM18 D(18)"
+.LASF2753:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF2427:
+	.string	"SO_BROADCAST 6"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF3041:
+	.string	"OWNER_PINDEBUG"
+.LASF1964:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2951:
+	.string	"_IO_read_end"
+.LASF776:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2379:
+	.string	"MSG_SYN MSG_SYN"
+.LASF2304:
+	.string	"AF_ROUTE PF_ROUTE"
+.LASF731:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF2451:
+	.string	"SO_GET_FILTER SO_ATTACH_FILTER"
+.LASF2150:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2674:
+	.string	"IPPROTO_ROUTING IPPROTO_ROUTING"
+.LASF3118:
+	.string	"pulseOffset"
+.LASF743:
+	.string	"SEEK_SET 0"
+.LASF3030:
+	.string	"OWNER_PPMINPUT"
+.LASF2881:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF1535:
+	.string	"ENETUNREACH 101"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2771:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF3254:
+	.string	"pthread_join"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1420:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1448:
+	.string	"EFAULT 14"
+.LASF1628:
+	.string	"USE_SERIALRX_XBUS "
+.LASF938:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF3125:
+	.string	"motorPwmInversion"
+.LASF2857:
+	.string	"DEF_TIM_TIM__TIM_TIM21 D(21)"
+.LASF2671:
+	.string	"IPPROTO_RAW IPPROTO_RAW"
+.LASF2745:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF1354:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF939:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2142:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1549:
+	.string	"EINPROGRESS 115"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1875:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2134:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF3096:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF1585:
+	.string	"__struct_tm_defined 1"
+.LASF2599:
+	.string	"IPV6_LEAVE_ANYCAST 28"
+.LASF2744:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF3093:
+	.string	"FAILURE_DEVELOPER"
+.LASF2611:
+	.string	"IPV6_HOPOPTS 54"
+.LASF1439:
+	.string	"EIO 5"
+.LASF2492:
+	.string	"SO_SNDTIMEO_NEW 67"
+.LASF896:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF3337:
+	.string	"systemInit"
+.LASF2996:
+	.string	"__owner"
+.LASF2754:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1652:
+	.string	"VTX_COMMON "
+.LASF2891:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF2957:
+	.string	"_IO_buf_end"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1102:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF3083:
+	.string	"sa_family_t"
+.LASF2115:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1492:
+	.string	"EDEADLOCK EDEADLK"
+.LASF2914:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2176:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2992:
+	.string	"__pthread_list_t"
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3209:
+	.string	"rcInterpolationChannels"
+.LASF762:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2497:
+	.string	"SO_BUF_LOCK 72"
+.LASF2090:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1194:
+	.string	"__DECL_SIMD_asinhf "
+.LASF3253:
+	.string	"nanosleep"
+.LASF2055:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1010:
+	.string	"__DECL_SIMD_powf32x "
+.LASF980:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1588:
+	.string	"sq(x) ((x)*(x))"
+.LASF1926:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF830:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2390:
+	.string	"CMSG_DATA(cmsg) ((cmsg)->__cmsg_data)"
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1587:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF1828:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF3301:
+	.string	"servoConfig"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1699:
+	.string	"USE_DASHBOARD"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2548:
+	.string	"IP_MTU_DISCOVER 10"
+.LASF1104:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF853:
+	.string	"__nlink_t_defined "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2929:
+	.string	"__uint8_t"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2489:
+	.string	"SO_TIMESTAMPNS_NEW 64"
+.LASF2166:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2514:
+	.string	"__CONST_SOCKADDR_ARG const struct sockaddr *"
+.LASF2420:
+	.string	"SIOCGSTAMPNS_OLD 0x8907"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF1834:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF1171:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF716:
+	.string	"NULL"
+.LASF2003:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2285:
+	.string	"AF_UNSPEC PF_UNSPEC"
+.LASF1661:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1558:
+	.string	"EMEDIUMTYPE 124"
+.LASF928:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF2518:
+	.string	"IP_TOS 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2482:
+	.string	"SO_TXTIME 61"
+.LASF1241:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF2762:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF903:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1196:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF382:
+	.string	"unix 1"
+.LASF1977:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1107:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2768:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF2985:
+	.string	"timespec"
+.LASF1711:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1186:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF3016:
+	.string	"FLASH_COMPLETE"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2462:
+	.string	"SO_PEEK_OFF 42"
+.LASF3276:
+	.string	"spektrumBind"
+.LASF882:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2257:
+	.string	"PF_ECONET 19"
+.LASF3170:
+	.string	"TASK_PID"
+.LASF3069:
+	.string	"OWNER_TRANSPONDER"
+.LASF2510:
+	.string	"SHUT_RD SHUT_RD"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF916:
+	.string	"__blksize_t_defined "
+.LASF1995:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2810:
+	.string	"LED1_ON NOOP"
+.LASF1552:
+	.string	"ENOTNAM 118"
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF3145:
+	.string	"FEATURE_SERVO_TILT"
+.LASF897:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1916:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF929:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1376:
+	.string	"_Mdouble_ _Float64x"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF1447:
+	.string	"EACCES 13"
+.LASF1000:
+	.string	"__DECL_SIMD_expf32x "
+.LASF842:
+	.string	"__lldiv_t_defined 1"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF857:
+	.string	"__daddr_t_defined "
+.LASF1757:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF2575:
+	.string	"IP_MAX_MEMBERSHIPS 20"
+.LASF818:
+	.string	"WNOWAIT 0x01000000"
+.LASF2553:
+	.string	"IP_FREEBIND 15"
+.LASF3113:
+	.string	"channel"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1348:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1943:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2888:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF3063:
+	.string	"OWNER_USB_DETECT"
+.LASF3285:
+	.string	"eeprom"
+.LASF2646:
+	.string	"IPPROTO_IP IPPROTO_IP"
+.LASF2050:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1818:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1131:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2250:
+	.string	"PF_NETBEUI 13"
+.LASF2522:
+	.string	"IP_RETOPTS 7"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1005:
+	.string	"__DECL_SIMD_powl "
+.LASF1157:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2239:
+	.string	"PF_INET 2"
+.LASF3235:
+	.string	"servos"
+.LASF1037:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1066:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1453:
+	.string	"ENODEV 19"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF3051:
+	.string	"OWNER_SDCARD"
+.LASF2365:
+	.string	"__SOCKADDR_COMMON_SIZE (sizeof (unsigned short int))"
+.LASF3224:
+	.string	"start_time"
+.LASF2452:
+	.string	"SO_PEERNAME 28"
+.LASF1715:
+	.string	"TELEMETRY_HOTT"
+.LASF2255:
+	.string	"PF_PACKET 17"
+.LASF2320:
+	.string	"AF_IUCV PF_IUCV"
+.LASF3068:
+	.string	"OWNER_LED_STRIP"
+.LASF738:
+	.string	"_IOFBF 0"
+.LASF1009:
+	.string	"__DECL_SIMD_powf128 "
+.LASF979:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2437:
+	.string	"SO_BSDCOMPAT 14"
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF3251:
+	.string	"fopen"
+.LASF1297:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF3156:
+	.string	"FEATURE_DASHBOARD"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2079:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF767:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1774:
+	.string	"IOCFG_AF_OD 0"
+.LASF3073:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF2503:
+	.string	"SO_TIMESTAMPING SO_TIMESTAMPING_OLD"
+.LASF1856:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF3299:
+	.string	"pwmGetMotors"
+.LASF2818:
+	.string	"BTCH_TIM1_CH3N BTCH_TIM1_CH3"
+.LASF1043:
+	.string	"__DECL_SIMD_hypot "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF2355:
+	.string	"SOL_NFC 280"
+.LASF2828:
+	.string	"DEF_TIM_CH_GET(ch) CONCAT2(DEF_TIM_CH__, ch)"
+.LASF2967:
+	.string	"_vtable_offset"
+.LASF2339:
+	.string	"SOL_ATM 264"
+.LASF2222:
+	.string	"_SYS_SOCKET_H 1"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1021:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1629:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2161:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF732:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF1082:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2690:
+	.string	"IN_CLASSC(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xc0000000)"
+.LASF1890:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2478:
+	.string	"SO_COOKIE 57"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF2886:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2909:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF754:
+	.string	"stdin stdin"
+.LASF1195:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2029:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1622:
+	.string	"USE_SERIALRX_CRSF "
+.LASF3352:
+	.string	"__errno_location"
+.LASF1290:
+	.string	"__DECL_SIMD_atan2f"
+.LASF2693:
+	.string	"IN_CLASSC_HOST (0xffffffff & ~IN_CLASSC_NET)"
+.LASF807:
+	.string	"_GCC_WCHAR_T "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1848:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1262:
+	.string	"__DECL_SIMD_hypotf"
+.LASF1313:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1032:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1734:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF2130:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2798:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1114:
+	.string	"__DECL_SIMD_atan2f "
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1361:
+	.string	"_Mdouble_ float"
+.LASF1267:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1076:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1105:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2949:
+	.string	"_flags"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1383:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2368:
+	.string	"_SS_PADSIZE (_SS_SIZE - __SOCKADDR_COMMON_SIZE - sizeof (__ss_aligntype))"
+.LASF880:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2859:
+	.string	"DEF_TIM_DMA_GET(variant,timch) PP_CALL(CONCAT(DEF_TIM_DMA_GET_VARIANT__, variant), CONCAT(DEF_TIM_DMA__, DEF_TIM_TCH2BTCH(timch)), DMA_VARIANT_MISSING, DMA_VARIANT_MISSING, ERROR)"
+.LASF1949:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF868:
+	.string	"__PDP_ENDIAN 3412"
+.LASF3110:
+	.string	"TIM_USE_BEEPER"
+.LASF2853:
+	.string	"DEF_TIM_TIM__TIM_TIM17 D(17)"
+.LASF1301:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF2725:
+	.string	"IN6_IS_ADDR_SITELOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfec00000); }))"
+.LASF1008:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1268:
+	.string	"__DECL_SIMD_exp10"
+.LASF898:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1609:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1740:
+	.string	"_T_PTRDIFF_ "
+.LASF806:
+	.string	"__INT_WCHAR_T_H "
+.LASF1567:
+	.string	"EHWPOISON 133"
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1518:
+	.string	"EILSEQ 84"
+.LASF3168:
+	.string	"TASK_SYSTEM"
+.LASF1802:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF730:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF2589:
+	.string	"IPV6_MULTICAST_HOPS 18"
+.LASF1474:
+	.string	"ELOOP 40"
+.LASF1455:
+	.string	"EISDIR 21"
+.LASF2181:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2020:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"ENOTSOCK 88"
+.LASF793:
+	.string	"__need_wchar_t "
+.LASF814:
+	.string	"WUNTRACED 2"
+.LASF2585:
+	.string	"IPV6_NEXTHOP 9"
+.LASF2959:
+	.string	"_IO_backup_base"
+.LASF1479:
+	.string	"EL2NSYNC 45"
+.LASF1053:
+	.string	"__DECL_SIMD_exp2 "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"___int_size_t_h "
+.LASF1520:
+	.string	"ESTRPIPE 86"
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1800:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1529:
+	.string	"EOPNOTSUPP 95"
+.LASF1046:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF3239:
+	.string	"SystemCoreClock"
+.LASF2114:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"__DECL_SIMD_exp"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2106:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF2751:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF2319:
+	.string	"AF_BLUETOOTH PF_BLUETOOTH"
+.LASF1654:
+	.string	"VTX_SMARTAUDIO "
+.LASF2824:
+	.string	"BTCH_TIM20_CH3N BTCH_TIM20_CH3"
+.LASF997:
+	.string	"__DECL_SIMD_expf32 "
+.LASF892:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1838:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1619:
+	.string	"USE_PPM "
+.LASF2353:
+	.string	"SOL_CAIF 278"
+.LASF2544:
+	.string	"IP_ROUTER_ALERT 5"
+.LASF1156:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1666:
+	.string	"U_ID_0 0"
+.LASF3269:
+	.string	"pthread_mutex_unlock"
+.LASF3045:
+	.string	"OWNER_SYSTEM"
+.LASF1266:
+	.string	"__DECL_SIMD_exp2f"
+.LASF1445:
+	.string	"EAGAIN 11"
+.LASF2509:
+	.string	"__osockaddr_defined 1"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1319:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2666:
+	.string	"IPPROTO_COMP IPPROTO_COMP"
+.LASF1617:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1197:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1719:
+	.string	"TELEMETRY_CRSF"
+.LASF1062:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1532:
+	.string	"EADDRINUSE 98"
+.LASF1718:
+	.string	"USE_RESOURCE_MGMT"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF993:
+	.string	"__DECL_SIMD_exp "
+.LASF2897:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1671:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1154:
+	.string	"__DECL_SIMD_atanhf "
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1264:
+	.string	"__DECL_SIMD_exp2"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF3107:
+	.string	"TIM_USE_SERVO"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2687:
+	.string	"IN_CLASSB_NSHIFT 16"
+.LASF2164:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1849:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1632:
+	.string	"TELEMETRY "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1581:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1378:
+	.string	"__MATHDECL_1_IMPL"
+.LASF3182:
+	.string	"TASK_ALTITUDE"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2133:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"EPROTO 71"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF3020:
+	.string	"imu_angular_velocity_rpy"
+.LASF1735:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF3297:
+	.string	"isMotorProtocolDshot"
+.LASF2218:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1242:
+	.string	"__DECL_SIMD_expf"
+.LASF2151:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF3163:
+	.string	"FEATURE_RX_SPI"
+.LASF1188:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1806:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2054:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1017:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2524:
+	.string	"IP_MULTICAST_TTL 33"
+.LASF1199:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2641:
+	.string	"SOL_IPV6 41"
+.LASF1804:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF3019:
+	.string	"timestamp"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF3274:
+	.string	"udpSend"
+.LASF824:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1829:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF3032:
+	.string	"OWNER_SERVO"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2561:
+	.string	"IP_NODEFRAG 22"
+.LASF3208:
+	.string	"rcInterpolation"
+.LASF1814:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1363:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1355:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF707:
+	.string	"_SIZE_T_DEFINED "
+.LASF1490:
+	.string	"EBADRQC 56"
+.LASF1513:
+	.string	"ELIBACC 79"
+.LASF1801:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2958:
+	.string	"_IO_save_base"
+.LASF2189:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f,i,r) {.dma = d, .ref = c, .irqHandlerCallback = NULL, .flagsShift = f, .irqN = i, .rcc = r, .userParam = 0, .owner = 0, .resourceIndex = 0 }"
+.LASF3264:
+	.string	"printf"
+.LASF1050:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1524:
+	.string	"EMSGSIZE 90"
+.LASF937:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF2418:
+	.string	"SIOCATMARK 0x8905"
+.LASF770:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2507:
+	.string	"SCM_TIMESTAMPNS SO_TIMESTAMPNS"
+.LASF3310:
+	.string	"ns_carry"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2046:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"ENOEXEC 8"
+.LASF2397:
+	.string	"_EXTERN_INLINE __extern_inline"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF3147:
+	.string	"FEATURE_GPS"
+.LASF2215:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF878:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF803:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1967:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF2249:
+	.string	"PF_DECnet 12"
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1670:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1328:
+	.string	"__DECL_SIMD_tan"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF3273:
+	.string	"clock_gettime"
+.LASF3298:
+	.string	"pwmAreMotorsEnabled"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF983:
+	.string	"__DECL_SIMD_log "
+.LASF1305:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF2955:
+	.string	"_IO_write_end"
+.LASF1296:
+	.string	"__DECL_SIMD_log2"
+.LASF2615:
+	.string	"IPV6_RECVDSTOPTS 58"
+.LASF2915:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1295:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1312:
+	.string	"__DECL_SIMD_erf"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1994:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2730:
+	.string	"IN6_IS_ADDR_MC_NODELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x1))"
+.LASF1028:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF854:
+	.string	"__uid_t_defined "
+.LASF1742:
+	.string	"__PTRDIFF_T "
+.LASF1003:
+	.string	"__DECL_SIMD_pow "
+.LASF970:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2344:
+	.string	"SOL_DCCP 269"
+.LASF1464:
+	.string	"EROFS 30"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2633:
+	.string	"IPV6_RXHOPOPTS IPV6_HOPOPTS"
+.LASF926:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2675:
+	.string	"IPPROTO_FRAGMENT IPPROTO_FRAGMENT"
+.LASF2075:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF923:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1238:
+	.string	"__DECL_SIMD_logf"
+.LASF2593:
+	.string	"IPV6_ROUTER_ALERT 22"
+.LASF1872:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1668:
+	.string	"U_ID_2 2"
+.LASF3283:
+	.string	"Page_Address"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF3322:
+	.string	"micros64"
+.LASF1423:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF964:
+	.string	"__DECL_SIMD_sinf "
+.LASF1822:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2873:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1077:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2523:
+	.string	"IP_MULTICAST_IF 32"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF940:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF3348:
+	.string	"out_ts"
+.LASF1246:
+	.string	"__DECL_SIMD_powf"
+.LASF1886:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF3342:
+	.string	"last_timestamp"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF3140:
+	.string	"fakeGyroDev"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2956:
+	.string	"_IO_buf_base"
+.LASF3123:
+	.string	"motorPwmRate"
+.LASF733:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1907:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1089:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1080:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1899:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF3061:
+	.string	"OWNER_BARO_EXTI"
+.LASF1125:
+	.string	"__DECL_SIMD_log10l "
+.LASF1542:
+	.string	"ESHUTDOWN 108"
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1024:
+	.string	"__DECL_SIMD_atanf "
+.LASF2415:
+	.string	"SIOCSPGRP 0x8902"
+.LASF2970:
+	.string	"_offset"
+.LASF2903:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2932:
+	.string	"__uint16_t"
+.LASF2246:
+	.string	"PF_X25 9"
+.LASF3332:
+	.string	"timerInit"
+.LASF3010:
+	.string	"double"
+.LASF2038:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1323:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1098:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2126:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF893:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1613:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF3054:
+	.string	"OWNER_FLASH_CS"
+.LASF2650:
+	.string	"IPPROTO_TCP IPPROTO_TCP"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2270:
+	.string	"PF_IUCV 32"
+.LASF2321:
+	.string	"AF_RXRPC PF_RXRPC"
+.LASF2183:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF737:
+	.string	"__ssize_t_defined "
+.LASF2521:
+	.string	"IP_RECVRETOPTS IP_RETOPTS"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF906:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1155:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1650:
+	.string	"USE_SENSOR_NAMES "
+.LASF2071:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF763:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2007:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1594:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2490:
+	.string	"SO_TIMESTAMPING_NEW 65"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF2892:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF3057:
+	.string	"OWNER_OSD_CS"
+.LASF3241:
+	.string	"_Min_Stack_Size"
+.LASF1047:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF817:
+	.string	"WCONTINUED 8"
+.LASF3260:
+	.string	"dyad_setTickInterval"
+.LASF1784:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF2946:
+	.string	"uint64_t"
+.LASF3080:
+	.string	"ioTagInverter"
+.LASF1049:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1687:
+	.string	"USE_UART1 "
+.LASF2565:
+	.string	"IP_RECVERR_RFC4884 26"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1576:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF2950:
+	.string	"_IO_read_ptr"
+.LASF1685:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF848:
+	.string	"__u_char_defined "
+.LASF1040:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2177:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2266:
+	.string	"PF_MPLS 28"
+.LASF2149:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1755:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2739:
+	.string	"SCHED_FIFO 1"
+.LASF1503:
+	.string	"ESRMNT 69"
+.LASF3206:
+	.string	"mincheck"
+.LASF2863:
+	.string	"DMA_VAR0 0"
+.LASF3186:
+	.string	"TASK_COUNT"
+.LASF1676:
+	.string	"USE_FAKE_ACC "
+.LASF1821:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF1428:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF973:
+	.string	"__DECL_SIMD_sincos "
+.LASF1988:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF813:
+	.string	"WNOHANG 1"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF2065:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2601:
+	.string	"IPV6_ROUTER_ALERT_ISOLATE 30"
+.LASF715:
+	.string	"__need_size_t"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2767:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2831:
+	.string	"DEF_TIM_CH__CH_CH3 D(3, 0)"
+.LASF2329:
+	.string	"AF_KCM PF_KCM"
+.LASF2758:
+	.string	"__sched_priority sched_priority"
+.LASF3017:
+	.string	"FLASH_TIMEOUT"
+.LASF2979:
+	.string	"_IO_marker"
+.LASF1071:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1204:
+	.string	"__DECL_SIMD_erfcf "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1074:
+	.string	"__DECL_SIMD_coshf "
+.LASF840:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2384:
+	.string	"MSG_MORE MSG_MORE"
+.LASF1696:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1167:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2157:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2217:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1689:
+	.string	"USE_UART3 "
+.LASF3082:
+	.string	"_Bool"
+.LASF2990:
+	.string	"__prev"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1234:
+	.string	"__DECL_SIMD_sincosf"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2823:
+	.string	"BTCH_TIM20_CH2N BTCH_TIM20_CH2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF3230:
+	.string	"pwmLink"
+.LASF2450:
+	.string	"SO_DETACH_FILTER 27"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF904:
+	.string	"__suseconds_t_defined "
+.LASF3325:
+	.string	"nanos64_real"
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1739:
+	.string	"_PTRDIFF_T "
+.LASF2475:
+	.string	"SCM_TIMESTAMPING_OPT_STATS 54"
+.LASF2393:
+	.string	"CMSG_ALIGN(len) (((len) + sizeof (size_t) - 1) & (size_t) ~(sizeof (size_t) - 1))"
+.LASF3347:
+	.string	"deltaSim"
+.LASF800:
+	.string	"_WCHAR_T_ "
+.LASF1993:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1079:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1690:
+	.string	"USE_UART4 "
+.LASF1067:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF991:
+	.string	"__DECL_SIMD_logf64x "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2308:
+	.string	"AF_ATMSVC PF_ATMSVC"
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2092:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1359:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2536:
+	.string	"MCAST_LEAVE_GROUP 45"
+.LASF2533:
+	.string	"MCAST_JOIN_GROUP 42"
+.LASF2702:
+	.string	"IN_LOOPBACKNET 127"
+.LASF2063:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2312:
+	.string	"AF_PPPOX PF_PPPOX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF3351:
+	.string	"_IO_lock_t"
+.LASF510:
+	.string	"__always_inline"
+.LASF1691:
+	.string	"USE_UART5 "
+.LASF2062:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF984:
+	.string	"__DECL_SIMD_logf "
+.LASF2303:
+	.string	"AF_NETLINK PF_NETLINK"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF2233:
+	.string	"SOCK_CLOEXEC SOCK_CLOEXEC"
+.LASF1648:
+	.string	"USE_RX_MSP "
+.LASF1840:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1812:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2410:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF2900:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2097:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF849:
+	.string	"__ino_t_defined "
+.LASF2790:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF871:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF3287:
+	.string	"lSize"
+.LASF2700:
+	.string	"INADDR_NONE ((in_addr_t) 0xffffffff)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2295:
+	.string	"AF_ATMPVC PF_ATMPVC"
+.LASF3131:
+	.string	"servoPwmRate"
+.LASF2104:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2880:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1339:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1214:
+	.string	"__DECL_SIMD_tanf "
+.LASF2414:
+	.string	"FIOSETOWN 0x8901"
+.LASF2964:
+	.string	"_flags2"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2467:
+	.string	"SO_MAX_PACING_RATE 47"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2587:
+	.string	"IPV6_UNICAST_HOPS 16"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1607:
+	.string	"false 0"
+.LASF3199:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF1553:
+	.string	"ENAVAIL 119"
+.LASF1039:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF735:
+	.string	"_VA_LIST_DEFINED "
+.LASF2738:
+	.string	"SCHED_OTHER 0"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF3226:
+	.string	"tcpWorker"
+.LASF2624:
+	.string	"IPV6_MINHOPCOUNT 73"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2278:
+	.string	"PF_VSOCK 40"
+.LASF2493:
+	.string	"SO_DETACH_REUSEPORT_BPF 68"
+.LASF841:
+	.string	"__ldiv_t_defined 1"
+.LASF960:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF884:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2971:
+	.string	"_codecvt"
+.LASF710:
+	.string	"__DEFINED_size_t "
+.LASF1433:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF3240:
+	.string	"_estack"
+.LASF2018:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF2325:
+	.string	"AF_CAIF PF_CAIF"
+.LASF2010:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2686:
+	.string	"IN_CLASSB_NET 0xffff0000"
+.LASF1923:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2504:
+	.string	"SO_RCVTIMEO SO_RCVTIMEO_OLD"
+.LASF1235:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1693:
+	.string	"USE_UART7 "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2954:
+	.string	"_IO_write_ptr"
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1341:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF3012:
+	.string	"TIM_TypeDef"
+.LASF835:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF2987:
+	.string	"tv_nsec"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2612:
+	.string	"IPV6_RTHDRDSTOPTS 55"
+.LASF1494:
+	.string	"ENOSTR 60"
+.LASF2045:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF3302:
+	.string	"servoIndex"
+.LASF2431:
+	.string	"SO_RCVBUFFORCE 33"
+.LASF3350:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1183:
+	.string	"__DECL_SIMD_tanh "
+.LASF2772:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF2335:
+	.string	"SOL_RAW 255"
+.LASF2059:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF2801:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF3289:
+	.string	"pwmWriteServo"
+.LASF1694:
+	.string	"USE_UART8 "
+.LASF1948:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"__need_wchar_t"
+.LASF1519:
+	.string	"ERESTART 85"
+.LASF1548:
+	.string	"EALREADY 114"
+.LASF1138:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2004:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2069:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1974:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2122:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF810:
+	.string	"_BSD_WCHAR_T_"
+.LASF3282:
+	.string	"FLASH_ErasePage"
+.LASF1419:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF935:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1438:
+	.string	"EINTR 4"
+.LASF1511:
+	.string	"EBADFD 77"
+.LASF2037:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1205:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1799:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1075:
+	.string	"__DECL_SIMD_coshl "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2580:
+	.string	"IPV6_2292RTHDR 5"
+.LASF1815:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF2511:
+	.string	"SHUT_WR SHUT_WR"
+.LASF837:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1318:
+	.string	"__DECL_SIMD_tanhf"
+.LASF364:
+	.string	"__k8 1"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1958:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF1950:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1396:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF789:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF777:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2645:
+	.string	"IPV6_RTHDR_TYPE_0 0"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF836:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF3174:
+	.string	"TASK_SERIAL"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2327:
+	.string	"AF_NFC PF_NFC"
+.LASF1869:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1871:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF2526:
+	.string	"IP_ADD_MEMBERSHIP 35"
+.LASF2571:
+	.string	"IP_PMTUDISC_OMIT 5"
+.LASF909:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF3004:
+	.string	"__align"
+.LASF2421:
+	.string	"SOL_SOCKET 1"
+.LASF3290:
+	.string	"index"
+.LASF2583:
+	.string	"IPV6_2292HOPLIMIT 8"
+.LASF2877:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2592:
+	.string	"IPV6_LEAVE_GROUP 21"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2025:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF2311:
+	.string	"AF_IRDA PF_IRDA"
+.LASF1590:
+	.string	"FAST_MATH "
+.LASF1139:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF819:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF3349:
+	.string	"lockMainPID"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2232:
+	.string	"SOCK_PACKET SOCK_PACKET"
+.LASF2851:
+	.string	"DEF_TIM_TIM__TIM_TIM15 D(15)"
+.LASF2774:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF705:
+	.string	"_BSD_SIZE_T_ "
+.LASF1863:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1310:
+	.string	"__DECL_SIMD_acoshf"
+.LASF965:
+	.string	"__DECL_SIMD_sinl "
+.LASF1624:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2264:
+	.string	"PF_LLC 26"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF1321:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF2402:
+	.string	"__struct_group_tag(TAG) TAG"
+.LASF895:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1113:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2636:
+	.string	"IPV6_PMTUDISC_WANT 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1244:
+	.string	"__DECL_SIMD_pow"
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF985:
+	.string	"__DECL_SIMD_logl "
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF959:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF2188:
+	.string	"DMA_OUTPUT_STRING \"DMA%d Channel %d:\""
+.LASF1332:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1749:
+	.string	"__need_ptrdiff_t"
+.LASF1898:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"__DECL_SIMD_logf16 "
+.LASF792:
+	.string	"__STDIO_INLINE"
+.LASF821:
+	.string	"__WCLONE 0x80000000"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2443:
+	.string	"SO_RCVTIMEO_OLD 20"
+.LASF761:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1832:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1215:
+	.string	"__DECL_SIMD_tanl "
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF2882:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2783:
+	.string	"DYAD_H "
+.LASF2076:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF2910:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2697:
+	.string	"IN_BADCLASS(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xf0000000)"
+.LASF2156:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF724:
+	.string	"_____fpos64_t_defined 1"
+.LASF1887:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF3160:
+	.string	"FEATURE_TRANSPONDER"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2644:
+	.string	"IPV6_RTHDR_STRICT 1"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2843:
+	.string	"DEF_TIM_TIM__TIM_TIM7 D(7)"
+.LASF2281:
+	.string	"PF_SMC 43"
+.LASF2141:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2516:
+	.string	"IP_OPTIONS 4"
+.LASF2556:
+	.string	"IP_PASSSEC 18"
+.LASF1092:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1457:
+	.string	"ENFILE 23"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF2367:
+	.string	"__ss_aligntype unsigned long int"
+.LASF2806:
+	.string	"LED0_OFF NOOP"
+.LASF708:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1331:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF3329:
+	.string	"failureMode"
+.LASF2933:
+	.string	"__uint32_t"
+.LASF2127:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1441:
+	.string	"E2BIG 7"
+.LASF1809:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2137:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1375:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2911:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf "
+.LASF1437:
+	.string	"ESRCH 3"
+.LASF976:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2077:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF3165:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF721:
+	.string	"__GNUC_VA_LIST "
+.LASF2223:
+	.string	"__iovec_defined 1"
+.LASF2865:
+	.string	"DMA_VAR2 2"
+.LASF3150:
+	.string	"FEATURE_TELEMETRY"
+.LASF3228:
+	.string	"workerRunning"
+.LASF1213:
+	.string	"__DECL_SIMD_tan "
+.LASF3164:
+	.string	"FEATURE_SOFTSPI"
+.LASF921:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF905:
+	.string	"__NFDBITS"
+.LASF3092:
+	.string	"sin_zero"
+.LASF2969:
+	.string	"_lock"
+.LASF2274:
+	.string	"PF_IEEE802154 36"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1938:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2879:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1564:
+	.string	"EOWNERDEAD 130"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF736:
+	.string	"__off_t_defined "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF3042:
+	.string	"OWNER_TIMER"
+.LASF1776:
+	.string	"IOCFG_IPU 0"
+.LASF2878:
+	.string	"I2CDEV_COUNT 4"
+.LASF2619:
+	.string	"IPV6_DONTFRAG 62"
+.LASF3014:
+	.string	"FLASH_ERROR_PG"
+.LASF3286:
+	.string	"FLASH_Unlock"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2261:
+	.string	"PF_IRDA 23"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2494:
+	.string	"SO_PREFER_BUSY_POLL 69"
+.LASF2764:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF944:
+	.string	"alloca"
+.LASF1753:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1208:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2508:
+	.string	"SCM_TIMESTAMPING SO_TIMESTAMPING"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2178:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1330:
+	.string	"__DECL_SIMD_tanf"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1316:
+	.string	"__DECL_SIMD_tanh"
+.LASF1325:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF2862:
+	.string	"DEF_TIM_DMA_GET_VARIANT__2(_0,_1,_2,...) _2"
+.LASF2405:
+	.string	"__FD_SETSIZE"
+.LASF869:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF756:
+	.string	"stderr stderr"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF749:
+	.string	"TMP_MAX 238328"
+.LASF2875:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF3292:
+	.string	"pwmCompleteMotorUpdate"
+.LASF1011:
+	.string	"__DECL_SIMD_powf64x "
+.LASF981:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1403:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2148:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2574:
+	.string	"IP_DEFAULT_MULTICAST_LOOP 1"
+.LASF2826:
+	.string	"BTCH_TIM16_CH1N BTCH_TIM16_CH1"
+.LASF1273:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF951:
+	.string	"_MATH_H 1"
+.LASF760:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2901:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1747:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF3162:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1537:
+	.string	"ECONNABORTED 103"
+.LASF947:
+	.string	"_STRING_H 1"
+.LASF1674:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1554:
+	.string	"EISNAM 120"
+.LASF3033:
+	.string	"OWNER_LED"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1824:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2620:
+	.string	"IPV6_RECVTCLASS 66"
+.LASF1367:
+	.string	"_Mdouble_ _Float32"
+.LASF2724:
+	.string	"IN6_IS_ADDR_LINKLOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfe800000); }))"
+.LASF2925:
+	.string	"short unsigned int"
+.LASF1372:
+	.string	"_Mdouble_ _Float128"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF3114:
+	.string	"usageFlags"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1730:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2822:
+	.string	"BTCH_TIM20_CH1N BTCH_TIM20_CH1"
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1052:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF3246:
+	.string	"fclose"
+.LASF748:
+	.string	"L_tmpnam 20"
+.LASF1160:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1858:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1322:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1015:
+	.string	"__DECL_SIMD_acosl "
+.LASF1712:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1536:
+	.string	"ENETRESET 102"
+.LASF1130:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF3095:
+	.string	"FAILURE_ACC_INIT"
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1743:
+	.string	"_PTRDIFF_T_ "
+.LASF1571:
+	.string	"_BITS_TIME_H 1"
+.LASF3142:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1612:
+	.string	"I2C2_OVERCLOCK true"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF3218:
+	.string	"port"
+.LASF2228:
+	.string	"SOCK_RAW SOCK_RAW"
+.LASF2930:
+	.string	"__int16_t"
+.LASF3071:
+	.string	"OWNER_COMPASS_CS"
+.LASF1842:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2296:
+	.string	"AF_X25 PF_X25"
+.LASF2858:
+	.string	"DEF_TIM_TIM__TIM_TIM22 D(22)"
+.LASF2980:
+	.string	"_IO_codecvt"
+.LASF1792:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF2835:
+	.string	"DEF_TIM_CH__CH_CH3N D(3, 1)"
+.LASF2642:
+	.string	"SOL_ICMPV6 58"
+.LASF3139:
+	.string	"gyroDev_s"
+.LASF3056:
+	.string	"OWNER_MPU_CS"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1385:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2895:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2438:
+	.string	"SO_REUSEPORT 15"
+.LASF2362:
+	.string	"SOMAXCONN 4096"
+.LASF2840:
+	.string	"DEF_TIM_TIM__TIM_TIM4 D(4)"
+.LASF2173:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1216:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF740:
+	.string	"_IONBF 2"
+.LASF2096:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF3171:
+	.string	"TASK_ACCEL"
+.LASF3134:
+	.string	"inversion"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p "
+.LASF832:
+	.string	"__W_CONTINUED 0xffff"
+.LASF2908:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2425:
+	.string	"SO_ERROR 4"
+.LASF890:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF859:
+	.string	"__clock_t_defined 1"
+.LASF1001:
+	.string	"__DECL_SIMD_expf64x "
+.LASF2628:
+	.string	"IPV6_UNICAST_IF 76"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1493:
+	.string	"EBFONT 59"
+.LASF1399:
+	.string	"FP_INFINITE 1"
+.LASF2200:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2267:
+	.string	"PF_CAN 29"
+.LASF861:
+	.string	"__time_t_defined 1"
+.LASF1641:
+	.string	"TELEMETRY_IBUS "
+.LASF3194:
+	.string	"halfDuplex"
+.LASF3103:
+	.string	"TIM_USE_NONE"
+.LASF1302:
+	.string	"__DECL_SIMD_log1pf"
+.LASF3219:
+	.string	"addr"
+.LASF3060:
+	.string	"OWNER_MPU_EXTI"
+.LASF2009:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF913:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1370:
+	.string	"_Mdouble_ _Float64"
+.LASF2570:
+	.string	"IP_PMTUDISC_INTERFACE 4"
+.LASF2001:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2256:
+	.string	"PF_ASH 18"
+.LASF1836:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1679:
+	.string	"MAG "
+.LASF3075:
+	.string	"ioTag_t"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF987:
+	.string	"__DECL_SIMD_logf32 "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2943:
+	.string	"uint8_t"
+.LASF2254:
+	.string	"PF_ROUTE PF_NETLINK"
+.LASF727:
+	.string	"__struct_FILE_defined 1"
+.LASF2634:
+	.string	"IPV6_RXDSTOPTS IPV6_DSTOPTS"
+.LASF3129:
+	.string	"servoDevConfig_s"
+.LASF1922:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF3132:
+	.string	"servoDevConfig_t"
+.LASF2605:
+	.string	"IPV6_HDRINCL 36"
+.LASF2755:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF2235:
+	.string	"PF_UNSPEC 0"
+.LASF1035:
+	.string	"__DECL_SIMD_asinl "
+.LASF3136:
+	.string	"accDev_s"
+.LASF1763:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1714:
+	.string	"TELEMETRY_FRSKY"
+.LASF1237:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2292:
+	.string	"AF_APPLETALK PF_APPLETALK"
+.LASF3076:
+	.string	"IO_t"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2244:
+	.string	"PF_BRIDGE 7"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2648:
+	.string	"IPPROTO_IGMP IPPROTO_IGMP"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2850:
+	.string	"DEF_TIM_TIM__TIM_TIM14 D(14)"
+.LASF1658:
+	.string	"GPS "
+.LASF3024:
+	.string	"position_xyz"
+.LASF2021:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1555:
+	.string	"EREMOTEIO 121"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2546:
+	.string	"IP_PKTOPTIONS 9"
+.LASF3027:
+	.string	"servo_packet"
+.LASF2252:
+	.string	"PF_KEY 15"
+.LASF1614:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF3266:
+	.string	"pthread_create"
+.LASF2968:
+	.string	"_shortbuf"
+.LASF1914:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2800:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1573:
+	.string	"CLOCK_REALTIME 0"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2715:
+	.string	"INET6_ADDRSTRLEN 46"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF2999:
+	.string	"__spins"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF2543:
+	.string	"MCAST_INCLUDE 1"
+.LASF2512:
+	.string	"SHUT_RDWR SHUT_RDWR"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF3262:
+	.string	"udpRecv"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF3035:
+	.string	"OWNER_ADC_BATT"
+.LASF1697:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF3177:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF2775:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1185:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1159:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1217:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1857:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"__WALL 0x40000000"
+.LASF2721:
+	.string	"htons(x) __bswap_16 (x)"
+.LASF3009:
+	.string	"float"
+.LASF1504:
+	.string	"ECOMM 70"
+.LASF2072:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF3183:
+	.string	"TASK_TELEMETRY"
+.LASF2047:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1201:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1862:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF2995:
+	.string	"__count"
+.LASF2924:
+	.string	"unsigned char"
+.LASF2658:
+	.string	"IPPROTO_RSVP IPPROTO_RSVP"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2044:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3236:
+	.string	"motorsPwm"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF1083:
+	.string	"__DECL_SIMD_expm1 "
+.LASF879:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF2213:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2682:
+	.string	"IN_CLASSA_NSHIFT 24"
+.LASF2555:
+	.string	"IP_XFRM_POLICY 17"
+.LASF2837:
+	.string	"DEF_TIM_TIM__TIM_TIM1 D(1)"
+.LASF2398:
+	.string	"SCM_RIGHTS SCM_RIGHTS"
+.LASF2080:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1883:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"__MATHDECL"
+.LASF3324:
+	.string	"micros64_real"
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF1444:
+	.string	"ECHILD 10"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF858:
+	.string	"__key_t_defined "
+.LASF1162:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2713:
+	.string	"IN6ADDR_LOOPBACK_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1 } } }"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1065:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1854:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF2584:
+	.string	"SCM_SRCRT IPV6_RXSRCRT"
+.LASF3127:
+	.string	"ioTags"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1278:
+	.string	"__DECL_SIMD_expm1f"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1058:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1343:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2123:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF695:
+	.string	"__need_size_t "
+.LASF2819:
+	.string	"BTCH_TIM8_CH1N BTCH_TIM8_CH1"
+.LASF2784:
+	.string	"_STDARG_H "
+.LASF1486:
+	.string	"EBADE 52"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2158:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2578:
+	.string	"IPV6_2292HOPOPTS 3"
+.LASF379:
+	.string	"linux 1"
+.LASF3155:
+	.string	"FEATURE_LED_STRIP"
+.LASF3152:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3312:
+	.string	"delay"
+.LASF1733:
+	.string	"DEFIO_NO_PORTS "
+.LASF2486:
+	.string	"SO_TIMESTAMPNS_OLD 35"
+.LASF2531:
+	.string	"IP_DROP_SOURCE_MEMBERSHIP 40"
+.LASF1178:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1596:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1934:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF3058:
+	.string	"OWNER_RX_SPI_CS"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1315:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1497:
+	.string	"ENOSR 63"
+.LASF2821:
+	.string	"BTCH_TIM8_CH3N BTCH_TIM8_CH3"
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF3072:
+	.string	"OWNER_SPI_PREINIT"
+.LASF808:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3234:
+	.string	"motors"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1621:
+	.string	"SERIAL_RX "
+.LASF2710:
+	.string	"s6_addr16 __in6_u.__u6_addr16"
+.LASF2276:
+	.string	"PF_ALG 38"
+.LASF3055:
+	.string	"OWNER_BARO_CS"
+.LASF2749:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF2630:
+	.string	"IPV6_FREEBIND 78"
+.LASF2408:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF2374:
+	.string	"MSG_TRUNC MSG_TRUNC"
+.LASF2229:
+	.string	"SOCK_RDM SOCK_RDM"
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1750:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2174:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF3232:
+	.string	"mainLoopLock"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF3084:
+	.string	"in_addr_t"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF3007:
+	.string	"__data"
+.LASF3143:
+	.string	"FEATURE_RX_SERIAL"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF3353:
+	.string	"sendMotorUpdate"
+.LASF3205:
+	.string	"midrc"
+.LASF790:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF2906:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1091:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF3070:
+	.string	"OWNER_VTX"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1773:
+	.string	"IOCFG_AF_PP 0"
+.LASF1985:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2779:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1006:
+	.string	"__DECL_SIMD_powf16 "
+.LASF703:
+	.string	"__SIZE_T "
+.LASF2202:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF900:
+	.string	"____sigset_t_defined "
+.LASF2002:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF3238:
+	.string	"idlePulse"
+.LASF1471:
+	.string	"ENOLCK 37"
+.LASF1603:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2869:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF3271:
+	.string	"fakeGyroSet"
+.LASF3314:
+	.string	"delayMicroseconds_real"
+.LASF2936:
+	.string	"__off_t"
+.LASF2372:
+	.string	"MSG_CTRUNC MSG_CTRUNC"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF1574:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF2922:
+	.string	"ACC_SCALE (256 / 9.80665)"
+.LASF1013:
+	.string	"__DECL_SIMD_acos "
+.LASF1231:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1874:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1884:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2789:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF3112:
+	.string	"timerHardware_s"
+.LASF1783:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1713:
+	.string	"LED_STRIP"
+.LASF2617:
+	.string	"IPV6_RECVPATHMTU 60"
+.LASF2454:
+	.string	"SO_PEERSEC 31"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2036:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1684:
+	.string	"USE_FAKE_FLASH "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1716:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF873:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF2459:
+	.string	"SO_RXQ_OVFL 40"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1250:
+	.string	"__DECL_SIMD_acosf"
+.LASF2525:
+	.string	"IP_MULTICAST_LOOP 34"
+.LASF2147:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2139:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF3284:
+	.string	"FLASH_Lock"
+.LASF2238:
+	.string	"PF_FILE PF_LOCAL"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1766:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1582:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2905:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1360:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2550:
+	.string	"IP_RECVTTL 12"
+.LASF2060:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"_STDDEF_H "
+.LASF1509:
+	.string	"EOVERFLOW 75"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2669:
+	.string	"IPPROTO_MPLS IPPROTO_MPLS"
+.LASF2788:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2326:
+	.string	"AF_ALG PF_ALG"
+.LASF1251:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF3067:
+	.string	"OWNER_INVERTER"
+.LASF2407:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF3021:
+	.string	"imu_linear_acceleration_xyz"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF2322:
+	.string	"AF_ISDN PF_ISDN"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF775:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1434:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF3215:
+	.string	"rx_max_usec"
+.LASF2199:
+	.string	"UNIT_TESTED "
+.LASF1760:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF954:
+	.string	"__DECL_SIMD_cosf "
+.LASF747:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1088:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF870:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF925:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF843:
+	.string	"RAND_MAX 2147483647"
+.LASF1374:
+	.string	"_Mdouble_ _Float32x"
+.LASF1271:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF1835:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1844:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2692:
+	.string	"IN_CLASSC_NSHIFT 8"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pl "
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1352:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF3126:
+	.string	"useUnsyncedPwm"
+.LASF1680:
+	.string	"USE_FAKE_MAG "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2732:
+	.string	"IN6_IS_ADDR_MC_SITELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x5))"
+.LASF1893:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"FP_NORMAL 4"
+.LASF2849:
+	.string	"DEF_TIM_TIM__TIM_TIM13 D(13)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1819:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2221:
+	.string	"_NETINET_IN_H 1"
+.LASF2741:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF2717:
+	.string	"GROUP_FILTER_SIZE(numsrc) (sizeof (struct group_filter) - sizeof (struct sockaddr_storage) + ((numsrc) * sizeof (struct sockaddr_storage)))"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF1311:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1365:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF3222:
+	.string	"fdmPkt"
+.LASF1827:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1463:
+	.string	"ESPIPE 29"
+.LASF3066:
+	.string	"OWNER_RX_BIND"
+.LASF2087:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3291:
+	.string	"value"
+.LASF3085:
+	.string	"in_addr"
+.LASF1358:
+	.string	"__MATH_PRECNAME"
+.LASF2500:
+	.string	"SO_RCVMARK 75"
+.LASF2245:
+	.string	"PF_ATMPVC 8"
+.LASF3047:
+	.string	"OWNER_SPI_MISO"
+.LASF2342:
+	.string	"SOL_NETBEUI 267"
+.LASF2694:
+	.string	"IN_CLASSD(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xe0000000)"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF2712:
+	.string	"IN6ADDR_ANY_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } } }"
+.LASF1465:
+	.string	"EMLINK 31"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1081:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1446:
+	.string	"ENOMEM 12"
+.LASF3176:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF2579:
+	.string	"IPV6_2292DSTOPTS 4"
+.LASF1965:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2291:
+	.string	"AF_IPX PF_IPX"
+.LASF3189:
+	.string	"cfTaskId_e"
+.LASF1073:
+	.string	"__DECL_SIMD_cosh "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2359:
+	.string	"SOL_MPTCP 284"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF2193:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1368:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1410:
+	.string	"MATH_ERREXCEPT 2"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2972:
+	.string	"_wide_data"
+.LASF2317:
+	.string	"AF_CAN PF_CAN"
+.LASF2829:
+	.string	"DEF_TIM_CH__CH_CH1 D(1, 0)"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2581:
+	.string	"IPV6_2292PKTOPTIONS 6"
+.LASF804:
+	.string	"_WCHAR_T_H "
+.LASF1502:
+	.string	"EADV 68"
+.LASF2187:
+	.string	"DMA_OUTPUT_INDEX 0"
+.LASF2324:
+	.string	"AF_IEEE802154 PF_IEEE802154"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2000:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1992:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2441:
+	.string	"SO_RCVLOWAT 18"
+.LASF3248:
+	.string	"fgetc"
+.LASF1110:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2191:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF2604:
+	.string	"IPV6_XFRM_POLICY 35"
+.LASF1466:
+	.string	"EPIPE 32"
+.LASF702:
+	.string	"_T_SIZE "
+.LASF2833:
+	.string	"DEF_TIM_CH__CH_CH1N D(1, 1)"
+.LASF1279:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF915:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1274:
+	.string	"__DECL_SIMD_coshf"
+.LASF3106:
+	.string	"TIM_USE_MOTOR"
+.LASF3029:
+	.string	"OWNER_PWMINPUT"
+.LASF1971:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1263:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF3212:
+	.string	"max_aux_channel"
+.LASF1150:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2600:
+	.string	"IPV6_MULTICAST_ALL 29"
+.LASF1586:
+	.string	"__itimerspec_defined 1"
+.LASF1168:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2557:
+	.string	"IP_TRANSPARENT 19"
+.LASF1391:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF838:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1041:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2488:
+	.string	"SO_TIMESTAMP_NEW 63"
+.LASF1762:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1808:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1786:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1905:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF3031:
+	.string	"OWNER_MOTOR"
+.LASF1627:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2554:
+	.string	"IP_IPSEC_POLICY 16"
+.LASF2023:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2816:
+	.string	"BTCH_TIM1_CH1N BTCH_TIM1_CH1"
+.LASF2455:
+	.string	"SO_PASSSEC 34"
+.LASF1721:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF918:
+	.string	"__fsblkcnt_t_defined "
+.LASF1741:
+	.string	"_T_PTRDIFF "
+.LASF1118:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2022:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1007:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2874:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF3244:
+	.string	"eepromFd"
+.LASF709:
+	.string	"_SIZE_T_DECLARED "
+.LASF2375:
+	.string	"MSG_DONTWAIT MSG_DONTWAIT"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF3181:
+	.string	"TASK_BARO"
+.LASF1060:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF3227:
+	.string	"udpWorker"
+.LASF1096:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1336:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2586:
+	.string	"IPV6_AUTHHDR 10"
+.LASF1643:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2591:
+	.string	"IPV6_JOIN_GROUP 20"
+.LASF755:
+	.string	"stdout stdout"
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF876:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF2782:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1853:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2757:
+	.string	"sched_priority sched_priority"
+.LASF3011:
+	.string	"test"
+.LASF1120:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2376:
+	.string	"MSG_EOR MSG_EOR"
+.LASF1791:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF3172:
+	.string	"TASK_ATTITUDE"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF2535:
+	.string	"MCAST_UNBLOCK_SOURCE 44"
+.LASF2448:
+	.string	"SO_BINDTODEVICE 25"
+.LASF1308:
+	.string	"__DECL_SIMD_acosh"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF3345:
+	.string	"now_ts"
+.LASF3149:
+	.string	"FEATURE_SONAR"
+.LASF1811:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF955:
+	.string	"__DECL_SIMD_cosl "
+.LASF1506:
+	.string	"EMULTIHOP 72"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1579:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2792:
+	.string	"_VA_LIST "
+.LASF1481:
+	.string	"EL3RST 47"
+.LASF3128:
+	.string	"motorDevConfig_t"
+.LASF2073:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1845:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2247:
+	.string	"PF_INET6 10"
+.LASF1724:
+	.string	"VTX_COMMON"
+.LASF2146:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2590:
+	.string	"IPV6_MULTICAST_LOOP 19"
+.LASF1222:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1350:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1100:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1729:
+	.string	"USE_SPI"
+.LASF3223:
+	.string	"pwmPkt"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1649:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2105:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1256:
+	.string	"__DECL_SIMD_asin"
+.LASF1738:
+	.string	"_ANSI_STDDEF_H "
+.LASF2286:
+	.string	"AF_LOCAL PF_LOCAL"
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1180:
+	.string	"__DECL_SIMD_erff32x "
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1782:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2208:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF796:
+	.string	"_WCHAR_T "
+.LASF1449:
+	.string	"ENOTBLK 15"
+.LASF2960:
+	.string	"_IO_save_end"
+.LASF2547:
+	.string	"IP_PMTUDISC 10"
+.LASF2243:
+	.string	"PF_NETROM 6"
+.LASF2627:
+	.string	"IPV6_TRANSPARENT 75"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2856:
+	.string	"DEF_TIM_TIM__TIM_TIM20 D(20)"
+.LASF2805:
+	.string	"LED0_TOGGLE NOOP"
+.LASF2773:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF1109:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2632:
+	.string	"IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP"
+.LASF1108:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1859:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2124:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1270:
+	.string	"__DECL_SIMD_exp10f"
+.LASF2811:
+	.string	"LED2_TOGGLE NOOP"
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2813:
+	.string	"LED2_ON NOOP"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1608:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1048:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF779:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2499:
+	.string	"SO_TXREHASH 74"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1527:
+	.string	"EPROTONOSUPPORT 93"
+.LASF1187:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2916:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF2210:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2545:
+	.string	"IP_PKTINFO 8"
+.LASF1414:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF486:
+	.string	"__flexarr []"
+.LASF3161:
+	.string	"FEATURE_AIRMODE"
+.LASF2293:
+	.string	"AF_NETROM PF_NETROM"
+.LASF3098:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF1935:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1810:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2224:
+	.string	"__BITS_SOCKET_H "
+.LASF942:
+	.string	"__have_pthread_attr_t 1"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF961:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1084:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1380:
+	.string	"__MATHDECL_ALIAS"
+.LASF1653:
+	.string	"VTX_CONTROL "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF3064:
+	.string	"OWNER_BEEPER"
+.LASF1247:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF2651:
+	.string	"IPPROTO_EGP IPPROTO_EGP"
+.LASF2240:
+	.string	"PF_AX25 3"
+.LASF1418:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2111:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF3108:
+	.string	"TIM_USE_LED"
+.LASF1572:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2706:
+	.string	"INADDR_ALLRTRS_GROUP ((in_addr_t) 0xe0000002)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1577:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2175:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF3331:
+	.string	"timerStart"
+.LASF924:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2024:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF3202:
+	.string	"rssi_channel"
+.LASF1225:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1462:
+	.string	"ENOSPC 28"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2635:
+	.string	"IPV6_PMTUDISC_DONT 0"
+.LASF894:
+	.string	"_SYS_SELECT_H 1"
+.LASF801:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1847:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2848:
+	.string	"DEF_TIM_TIM__TIM_TIM12 D(12)"
+.LASF2103:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1496:
+	.string	"ETIME 62"
+.LASF1986:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF3115:
+	.string	"output"
+.LASF1119:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2194:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF2567:
+	.string	"IP_PMTUDISC_WANT 1"
+.LASF1362:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF2369:
+	.string	"MSG_OOB MSG_OOB"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF3141:
+	.string	"FEATURE_RX_PPM"
+.LASF2263:
+	.string	"PF_WANPIPE 25"
+.LASF2921:
+	.string	"RAD2DEG (180.0 / M_PI)"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF2016:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF2759:
+	.string	"_BITS_SETJMP_H 1"
+.LASF2101:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1334:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1605:
+	.string	"bool _Bool"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2802:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1027:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2138:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2268:
+	.string	"PF_TIPC 30"
+.LASF2382:
+	.string	"MSG_ERRQUEUE MSG_ERRQUEUE"
+.LASF2314:
+	.string	"AF_LLC PF_LLC"
+.LASF2952:
+	.string	"_IO_read_base"
+.LASF3119:
+	.string	"forceOverflow"
+.LASF2084:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF3008:
+	.string	"pthread_mutex_t"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1701:
+	.string	"USE_ADC"
+.LASF3022:
+	.string	"imu_orientation_quat"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2214:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1637:
+	.string	"USE_SERVOS "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2051:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1212:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1692:
+	.string	"USE_UART6 "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2061:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1112:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1099:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1737:
+	.string	"_STDDEF_H_ "
+.LASF2729:
+	.string	"IN6_IS_ADDR_MULTICAST(a) (((const uint8_t *) (a))[0] == 0xff)"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2653:
+	.string	"IPPROTO_UDP IPPROTO_UDP"
+.LASF3277:
+	.string	"uartPinConfigure"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1179:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1569:
+	.string	"errno (*__errno_location ())"
+.LASF802:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2192:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1398:
+	.string	"FP_NAN 0"
+.LASF1731:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2131:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF3001:
+	.string	"__list"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2290:
+	.string	"AF_AX25 PF_AX25"
+.LASF1395:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1771:
+	.string	"IOCFG_OUT_PP 0"
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF3335:
+	.string	"systemResetToBootloader"
+.LASF2716:
+	.string	"IP_MSFILTER_SIZE(numsrc) (sizeof (struct ip_msfilter) - sizeof (struct in_addr) + (numsrc) * sizeof (struct in_addr))"
+.LASF2043:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2904:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2793:
+	.string	"_VA_LIST_T_H "
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF3294:
+	.string	"outScale"
+.LASF2750:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1097:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF3195:
+	.string	"rx_spi_protocol"
+.LASF2760:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2259:
+	.string	"PF_RDS 21"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1982:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"EFBIG 27"
+.LASF2300:
+	.string	"AF_NETBEUI PF_NETBEUI"
+.LASF1249:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF3196:
+	.string	"rx_spi_id"
+.LASF2825:
+	.string	"BTCH_TIM15_CH1N BTCH_TIM15_CH1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2253:
+	.string	"PF_NETLINK 16"
+.LASF2169:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1136:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF3321:
+	.string	"last"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1512:
+	.string	"EREMCHG 78"
+.LASF2931:
+	.string	"short int"
+.LASF1382:
+	.string	"__MATHCALL"
+.LASF872:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2439:
+	.string	"SO_PASSCRED 16"
+.LASF1991:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1758:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF901:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1124:
+	.string	"__DECL_SIMD_log10f "
+.LASF2302:
+	.string	"AF_KEY PF_KEY"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF734:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF3190:
+	.string	"rxConfig_s"
+.LASF3216:
+	.string	"rxConfig_t"
+.LASF1795:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF3303:
+	.string	"motorDevInit"
+.LASF698:
+	.string	"__SIZE_T__ "
+.LASF797:
+	.string	"_T_WCHAR_ "
+.LASF1068:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF697:
+	.string	"__size_t__ "
+.LASF2231:
+	.string	"SOCK_DCCP SOCK_DCCP"
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2815:
+	.string	"DEF_TIM_TCH2BTCH(timch) CONCAT(B, timch)"
+.LASF3280:
+	.string	"FLASH_ProgramWord"
+.LASF1779:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2307:
+	.string	"AF_ECONET PF_ECONET"
+.LASF2401:
+	.string	"_LINUX_STDDEF_H "
+.LASF1707:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1085:
+	.string	"__DECL_SIMD_expm1l "
+.LASF3166:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF2056:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2234:
+	.string	"SOCK_NONBLOCK SOCK_NONBLOCK"
+.LASF3102:
+	.string	"TIM_USE_ANY"
+.LASF2456:
+	.string	"SO_MARK 36"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1785:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF831:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1904:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2242:
+	.string	"PF_APPLETALK 5"
+.LASF1473:
+	.string	"ENOTEMPTY 39"
+.LASF1489:
+	.string	"ENOANO 55"
+.LASF2283:
+	.string	"PF_MCTP 45"
+.LASF1726:
+	.string	"VTX_SMARTAUDIO"
+.LASF1299:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF2464:
+	.string	"SO_LOCK_FILTER 44"
+.LASF2559:
+	.string	"IP_RECVORIGDSTADDR IP_ORIGDSTADDR"
+.LASF473:
+	.string	"__P(args) args"
+.LASF1172:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF2052:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"__f64(x) x ##f64"
+.LASF2961:
+	.string	"_markers"
+.LASF1245:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1261:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF694:
+	.string	"_STDIO_H 1"
+.LASF1659:
+	.string	"USE_NAV "
+.LASF2672:
+	.string	"IPPROTO_MPTCP IPPROTO_MPTCP"
+.LASF2963:
+	.string	"_fileno"
+.LASF1223:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1460:
+	.string	"ETXTBSY 26"
+.LASF1430:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF3242:
+	.string	"__config_start"
+.LASF1239:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF1880:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF994:
+	.string	"__DECL_SIMD_expf "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1243:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1896:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2334:
+	.string	"AF_MAX PF_MAX"
+.LASF2756:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1600:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1233:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF3296:
+	.string	"pwmWriteMotor"
+.LASF2722:
+	.string	"IN6_IS_ADDR_UNSPECIFIED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == 0; }))"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2513:
+	.string	"__SOCKADDR_ARG struct sockaddr *__restrict"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2083:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2621:
+	.string	"IPV6_TCLASS 67"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF2594:
+	.string	"IPV6_MTU_DISCOVER 23"
+.LASF2120:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF389:
+	.string	"SITL 1"
+.LASF2469:
+	.string	"SO_INCOMING_CPU 49"
+.LASF1973:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF2602:
+	.string	"IPV6_RECVERR_RFC4884 31"
+.LASF2660:
+	.string	"IPPROTO_ESP IPPROTO_ESP"
+.LASF1543:
+	.string	"ETOOMANYREFS 109"
+.LASF783:
+	.string	"__f64x(x) x ##f64x"
+.LASF886:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2433:
+	.string	"SO_OOBINLINE 10"
+.LASF2184:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF3307:
+	.string	"timeval_sub"
+.LASF2606:
+	.string	"IPV6_RECVPKTINFO 49"
+.LASF1459:
+	.string	"ENOTTY 25"
+.LASF899:
+	.string	"__sigset_t_defined 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF3225:
+	.string	"simRate"
+.LASF847:
+	.string	"_SYS_TYPES_H 1"
+.LASF1931:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF2040:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1616:
+	.string	"USE_CLI "
+.LASF844:
+	.string	"EXIT_FAILURE 1"
+.LASF2664:
+	.string	"IPPROTO_ENCAP IPPROTO_ENCAP"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1781:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF3157:
+	.string	"FEATURE_OSD"
+.LASF1525:
+	.string	"EPROTOTYPE 91"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF851:
+	.string	"__gid_t_defined "
+.LASF2934:
+	.string	"long int"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1347:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF3179:
+	.string	"TASK_GPS"
+.LASF1651:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF729:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF3040:
+	.string	"OWNER_SERIAL_RX"
+.LASF941:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2171:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1033:
+	.string	"__DECL_SIMD_asin "
+.LASF2435:
+	.string	"SO_PRIORITY 12"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF3313:
+	.string	"start"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF2288:
+	.string	"AF_FILE PF_FILE"
+.LASF2938:
+	.string	"__time_t"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1161:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2625:
+	.string	"IPV6_ORIGDSTADDR 74"
+.LASF3159:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1556:
+	.string	"EDQUOT 122"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF3059:
+	.string	"OWNER_SPI_CS"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF891:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1427:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2348:
+	.string	"SOL_PPPOL2TP 273"
+.LASF2026:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1345:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF2491:
+	.string	"SO_RCVTIMEO_NEW 66"
+.LASF1072:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1408:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2809:
+	.string	"LED1_OFF NOOP"
+.LASF2847:
+	.string	"DEF_TIM_TIM__TIM_TIM11 D(11)"
+.LASF1789:
+	.string	"EXPAND_I(x) x"
+.LASF1258:
+	.string	"__DECL_SIMD_asinf"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1320:
+	.string	"__DECL_SIMD_asinh"
+.LASF1164:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2473:
+	.string	"SO_ATTACH_REUSEPORT_EBPF 52"
+.LASF3185:
+	.string	"TASK_RCSPLIT"
+.LASF795:
+	.string	"__WCHAR_T__ "
+.LASF1206:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1561:
+	.string	"EKEYEXPIRED 127"
+.LASF2913:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF2154:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2920:
+	.string	"_ARPA_INET_H 1"
+.LASF745:
+	.string	"SEEK_END 2"
+.LASF2186:
+	.string	"DMA_MOD_OFFSET 1"
+.LASF1379:
+	.string	"__MATHDECL_1"
+.LASF3340:
+	.string	"udpThread"
+.LASF1265:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2677:
+	.string	"IPPROTO_NONE IPPROTO_NONE"
+.LASF828:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF3039:
+	.string	"OWNER_SERIAL_TX"
+.LASF1578:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2734:
+	.string	"IN6_IS_ADDR_MC_GLOBAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0xe))"
+.LASF2381:
+	.string	"MSG_RST MSG_RST"
+.LASF2204:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2351:
+	.string	"SOL_RDS 276"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF3018:
+	.string	"FLASH_Status"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF2866:
+	.string	"DEF_TIM_AF_GET(timch,pin) CONCAT4(DEF_TIM_AF__, pin, __, timch)"
+.LASF1219:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2033:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1602:
+	.string	"Q12 (1 << 12)"
+.LASF1908:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF3300:
+	.string	"servoDevInit"
+.LASF2953:
+	.string	"_IO_write_base"
+.LASF2336:
+	.string	"SOL_DECNET 261"
+.LASF2442:
+	.string	"SO_SNDLOWAT 19"
+.LASF1283:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF2608:
+	.string	"IPV6_RECVHOPLIMIT 51"
+.LASF2786:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF2316:
+	.string	"AF_MPLS PF_MPLS"
+.LASF3326:
+	.string	"indicateFailure"
+.LASF2623:
+	.string	"IPV6_ADDR_PREFERENCES 72"
+.LASF1137:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF3090:
+	.string	"sin_port"
+.LASF1606:
+	.string	"true 1"
+.LASF2736:
+	.string	"_SCHED_H 1"
+.LASF2887:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF2626:
+	.string	"IPV6_RECVORIGDSTADDR IPV6_ORIGDSTADDR"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1115:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2400:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF2220:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF769:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2505:
+	.string	"SO_SNDTIMEO SO_SNDTIMEO_OLD"
+.LASF1406:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1401:
+	.string	"FP_SUBNORMAL 3"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF855:
+	.string	"__pid_t_defined "
+.LASF887:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1405:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF785:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF2306:
+	.string	"AF_ASH PF_ASH"
+.LASF706:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1557:
+	.string	"ENOMEDIUM 123"
+.LASF952:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF2416:
+	.string	"FIOGETOWN 0x8903"
+.LASF1672:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF995:
+	.string	"__DECL_SIMD_expl "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1560:
+	.string	"ENOKEY 126"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF3138:
+	.string	"fakeAccDev"
+.LASF2094:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2942:
+	.string	"int16_t"
+.LASF2170:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2089:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1541:
+	.string	"ENOTCONN 107"
+.LASF2424:
+	.string	"SO_TYPE 3"
+.LASF2447:
+	.string	"SO_SECURITY_ENCRYPTION_NETWORK 24"
+.LASF1817:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF2643:
+	.string	"IPV6_RTHDR_LOOSE 0"
+.LASF1022:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF751:
+	.string	"L_ctermid 9"
+.LASF2015:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"AF_RDS PF_RDS"
+.LASF1647:
+	.string	"USE_RCSPLIT "
+.LASF3003:
+	.string	"__size"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF968:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF420:
+	.string	"__USE_GNU"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1450:
+	.string	"EBUSY 16"
+.LASF2301:
+	.string	"AF_SECURITY PF_SECURITY"
+.LASF3305:
+	.string	"_idlePulse"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF827:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF3117:
+	.string	"pulseScale"
+.LASF1276:
+	.string	"__DECL_SIMD_expm1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF3046:
+	.string	"OWNER_SPI_SCK"
+.LASF2844:
+	.string	"DEF_TIM_TIM__TIM_TIM8 D(8)"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2323:
+	.string	"AF_PHONET PF_PHONET"
+.LASF1210:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1515:
+	.string	"ELIBSCN 81"
+.LASF1004:
+	.string	"__DECL_SIMD_powf "
+.LASF3137:
+	.string	"timerHardware"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF972:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1468:
+	.string	"ERANGE 34"
+.LASF3099:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF1477:
+	.string	"EIDRM 43"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2432:
+	.string	"SO_KEEPALIVE 9"
+.LASF958:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1495:
+	.string	"ENODATA 61"
+.LASF3214:
+	.string	"rx_min_usec"
+.LASF1356:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1369:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1920:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"EDOTDOT 73"
+.LASF2896:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2808:
+	.string	"LED1_TOGGLE NOOP"
+.LASF2333:
+	.string	"AF_MCTP PF_MCTP"
+.LASF1025:
+	.string	"__DECL_SIMD_atanl "
+.LASF392:
+	.string	"__REVISION__ \"1485f56\""
+.LASF2902:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1373:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2428:
+	.string	"SO_SNDBUF 7"
+.LASF1211:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1655:
+	.string	"VTX_TRAMP "
+.LASF910:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1705:
+	.string	"SERIAL_RX"
+.LASF2485:
+	.string	"SO_TIMESTAMP_OLD 29"
+.LASF696:
+	.string	"__need_NULL "
+.LASF1484:
+	.string	"ENOCSI 50"
+.LASF2028:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2358:
+	.string	"SOL_XDP 283"
+.LASF1636:
+	.string	"USE_RESOURCE_MGMT "
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1955:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2670:
+	.string	"IPPROTO_ETHERNET IPPROTO_ETHERNET"
+.LASF725:
+	.string	"____FILE_defined 1"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1667:
+	.string	"U_ID_1 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF2705:
+	.string	"INADDR_ALLHOSTS_GROUP ((in_addr_t) 0xe0000001)"
+.LASF2262:
+	.string	"PF_PPPOX 24"
+.LASF969:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2966:
+	.string	"_cur_column"
+.LASF3278:
+	.string	"rxConfig"
+.LASF3025:
+	.string	"fdm_packet"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF3279:
+	.string	"pSerialPinConfig"
+.LASF1456:
+	.string	"EINVAL 22"
+.LASF1165:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1482:
+	.string	"ELNRNG 48"
+.LASF2917:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1269:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1625:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1584:
+	.string	"TIMER_ABSTIME 1"
+.LASF2616:
+	.string	"IPV6_DSTOPTS 59"
+.LASF2711:
+	.string	"s6_addr32 __in6_u.__u6_addr32"
+.LASF1947:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2230:
+	.string	"SOCK_SEQPACKET SOCK_SEQPACKET"
+.LASF2468:
+	.string	"SO_BPF_EXTENSIONS 48"
+.LASF1959:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1646:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1868:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF3257:
+	.string	"dyad_update"
+.LASF1193:
+	.string	"__DECL_SIMD_asinh "
+.LASF1860:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF3275:
+	.string	"pthread_mutex_trylock"
+.LASF2297:
+	.string	"AF_INET6 PF_INET6"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1769:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF2676:
+	.string	"IPPROTO_ICMPV6 IPPROTO_ICMPV6"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2986:
+	.string	"tv_sec"
+.LASF932:
+	.string	"__LOCK_ALIGNMENT "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1103:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1895:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"FP_ZERO 2"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF3221:
+	.string	"udpLink_t"
+.LASF2227:
+	.string	"SOCK_DGRAM SOCK_DGRAM"
+.LASF2387:
+	.string	"MSG_ZEROCOPY MSG_ZEROCOPY"
+.LASF1200:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1207:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2206:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2740:
+	.string	"SCHED_RR 2"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1631:
+	.string	"LED_STRIP "
+.LASF2830:
+	.string	"DEF_TIM_CH__CH_CH2 D(2, 0)"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1756:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2277:
+	.string	"PF_NFC 39"
+.LASF1639:
+	.string	"TELEMETRY_LTM "
+.LASF2019:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF3338:
+	.string	"data"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2776:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF2610:
+	.string	"IPV6_RECVHOPOPTS 53"
+.LASF2241:
+	.string	"PF_IPX 4"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2595:
+	.string	"IPV6_MTU 24"
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1286:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2841:
+	.string	"DEF_TIM_TIM__TIM_TIM5 D(5)"
+.LASF1056:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF860:
+	.string	"__clockid_t_defined 1"
+.LASF1559:
+	.string	"ECANCELED 125"
+.LASF766:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2392:
+	.string	"CMSG_FIRSTHDR(mhdr) ((size_t) (mhdr)->msg_controllen >= sizeof (struct cmsghdr) ? (struct cmsghdr *) (mhdr)->msg_control : (struct cmsghdr *) 0)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2066:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2551:
+	.string	"IP_RECVTOS 13"
+.LASF1778:
+	.string	"NOOP do {} while (0)"
+.LASF2436:
+	.string	"SO_LINGER 13"
+.LASF2460:
+	.string	"SO_WIFI_STATUS 41"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2983:
+	.string	"clockid_t"
+.LASF2937:
+	.string	"__off64_t"
+.LASF3255:
+	.string	"dyad_shutdown"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1176:
+	.string	"__DECL_SIMD_erff16 "
+.LASF752:
+	.string	"FOPEN_MAX"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2846:
+	.string	"DEF_TIM_TIM__TIM_TIM10 D(10)"
+.LASF3079:
+	.string	"ioTagRx"
+.LASF2709:
+	.string	"s6_addr __in6_u.__u6_addr8"
+.LASF1467:
+	.string	"EDOM 33"
+.LASF3088:
+	.string	"sockaddr_in"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1772:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2070:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2515:
+	.string	"__USE_KERNEL_IPV6_DEFS 0"
+.LASF1833:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2481:
+	.string	"SO_ZEROCOPY 60"
+.LASF2928:
+	.string	"signed char"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF1533:
+	.string	"EADDRNOTAVAIL 99"
+.LASF862:
+	.string	"__timer_t_defined 1"
+.LASF2284:
+	.string	"PF_MAX 46"
+.LASF1431:
+	.string	"_ERRNO_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2352:
+	.string	"SOL_IUCV 277"
+.LASF2385:
+	.string	"MSG_WAITFORONE MSG_WAITFORONE"
+.LASF2445:
+	.string	"SO_SECURITY_AUTHENTICATION 22"
+.LASF2449:
+	.string	"SO_ATTACH_FILTER 26"
+.LASF1384:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF2665:
+	.string	"IPPROTO_PIM IPPROTO_PIM"
+.LASF1491:
+	.string	"EBADSLT 57"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2422:
+	.string	"SO_DEBUG 1"
+.LASF1478:
+	.string	"ECHRNG 44"
+.LASF1220:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2667:
+	.string	"IPPROTO_SCTP IPPROTO_SCTP"
+.LASF1881:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1662:
+	.string	"SIMULATOR_BUILD "
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF784:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1152:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF936:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF3091:
+	.string	"sin_addr"
+.LASF3220:
+	.string	"isServer"
+.LASF2807:
+	.string	"LED0_ON NOOP"
+.LASF1575:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1284:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1436:
+	.string	"ENOENT 2"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF3173:
+	.string	"TASK_RX"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF1209:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF1538:
+	.string	"ECONNRESET 104"
+.LASF2363:
+	.string	"_BITS_SOCKADDR_H 1"
+.LASF2446:
+	.string	"SO_SECURITY_ENCRYPTION_TRANSPORT 23"
+.LASF2121:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2153:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2889:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF2655:
+	.string	"IPPROTO_TP IPPROTO_TP"
+.LASF846:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2338:
+	.string	"SOL_PACKET 263"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1568:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF2994:
+	.string	"__lock"
+.LASF1317:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1454:
+	.string	"ENOTDIR 20"
+.LASF1765:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1722:
+	.string	"TELEMETRY_SRXL"
+.LASF2517:
+	.string	"IP_HDRINCL 3"
+.LASF3259:
+	.string	"dyad_setUpdateTimeout"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1413:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF3306:
+	.string	"motorIndex"
+.LASF2726:
+	.string	"IN6_IS_ADDR_V4MAPPED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == htonl (0xffff); }))"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1228:
+	.string	"__DECL_SIMD_sin"
+.LASF782:
+	.string	"__f32x(x) x ##f32x"
+.LASF1932:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2935:
+	.string	"__uint64_t"
+.LASF1839:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1371:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF2145:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2939:
+	.string	"__clockid_t"
+.LASF1698:
+	.string	"STACK_CHECK"
+.LASF805:
+	.string	"___int_wchar_t_h "
+.LASF2395:
+	.string	"CMSG_LEN(len) (CMSG_ALIGN (sizeof (struct cmsghdr)) + (len))"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF3094:
+	.string	"FAILURE_MISSING_ACC"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF3148:
+	.string	"FEATURE_FAILSAFE"
+.LASF2477:
+	.string	"SO_INCOMING_NAPI_ID 56"
+.LASF1190:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2110:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2196:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1094:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2058:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2172:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2532:
+	.string	"IP_MSFILTER 41"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1451:
+	.string	"EEXIST 17"
+.LASF1128:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2042:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2629:
+	.string	"IPV6_RECVFRAGSIZE 77"
+.LASF2681:
+	.string	"IN_CLASSA_NET 0xff000000"
+.LASF2577:
+	.string	"IPV6_2292PKTINFO 2"
+.LASF2607:
+	.string	"IPV6_PKTINFO 50"
+.LASF1610:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2360:
+	.string	"SOL_MCTP 285"
+.LASF1170:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF2287:
+	.string	"AF_UNIX PF_UNIX"
+.LASF2838:
+	.string	"DEF_TIM_TIM__TIM_TIM2 D(2)"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1392:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1516:
+	.string	"ELIBMAX 82"
+.LASF3078:
+	.string	"ioTagTx"
+.LASF1983:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2093:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1530:
+	.string	"EPFNOSUPPORT 96"
+.LASF1723:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF1111:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2354:
+	.string	"SOL_ALG 279"
+.LASF3049:
+	.string	"OWNER_I2C_SCL"
+.LASF1357:
+	.string	"_Mdouble_"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF3231:
+	.string	"updateLock"
+.LASF2742:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1349:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1790:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1086:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2483:
+	.string	"SCM_TXTIME SO_TXTIME"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2993:
+	.string	"__pthread_mutex_s"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2944:
+	.string	"uint16_t"
+.LASF2614:
+	.string	"IPV6_RTHDR 57"
+.LASF2298:
+	.string	"AF_ROSE PF_ROSE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1720:
+	.string	"TELEMETRY_IBUS"
+.LASF2569:
+	.string	"IP_PMTUDISC_PROBE 3"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2637:
+	.string	"IPV6_PMTUDISC_DO 2"
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF772:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF3270:
+	.string	"imuSetAttitudeQuat"
+.LASF3169:
+	.string	"TASK_GYROPID"
+.LASF2205:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2812:
+	.string	"LED2_OFF NOOP"
+.LASF2343:
+	.string	"SOL_LLC 268"
+.LASF1583:
+	.string	"CLOCK_TAI 11"
+.LASF1660:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF2085:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2383:
+	.string	"MSG_NOSIGNAL MSG_NOSIGNAL"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2988:
+	.string	"long long unsigned int"
+.LASF2328:
+	.string	"AF_VSOCK PF_VSOCK"
+.LASF3077:
+	.string	"serialPinConfig_s"
+.LASF3081:
+	.string	"serialPinConfig_t"
+.LASF2279:
+	.string	"PF_KCM 41"
+.LASF2006:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF3258:
+	.string	"rewind"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2034:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2708:
+	.string	"INADDR_MAX_LOCAL_GROUP ((in_addr_t) 0xe00000ff)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2804:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF2527:
+	.string	"IP_DROP_MEMBERSHIP 36"
+.LASF3050:
+	.string	"OWNER_I2C_SDA"
+.LASF3154:
+	.string	"FEATURE_RSSI_ADC"
+.LASF3015:
+	.string	"FLASH_ERROR_WRP"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF2495:
+	.string	"SO_BUSY_POLL_BUDGET 70"
+.LASF1229:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1540:
+	.string	"EISCONN 106"
+.LASF3089:
+	.string	"sin_family"
+.LASF2572:
+	.string	"SOL_IP 0"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF1640:
+	.string	"TELEMETRY_CRSF "
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF2440:
+	.string	"SO_PEERCRED 17"
+.LASF3038:
+	.string	"OWNER_ADC_RSSI"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1472:
+	.string	"ENOSYS 38"
+.LASF1333:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1057:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1116:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2480:
+	.string	"SO_PEERGROUPS 59"
+.LASF3311:
+	.string	"nsec"
+.LASF1919:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1153:
+	.string	"__DECL_SIMD_atanh "
+.LASF1911:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2479:
+	.string	"SCM_TIMESTAMPING_PKTINFO 58"
+.LASF2691:
+	.string	"IN_CLASSC_NET 0xffffff00"
+.LASF3048:
+	.string	"OWNER_SPI_MOSI"
+.LASF1389:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1390:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF3124:
+	.string	"motorPwmProtocol"
+.LASF1664:
+	.string	"SKIP_IMU_CALC "
+.LASF1421:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF2899:
+	.string	"PWM_PULSE_MIN 750"
+.LASF3247:
+	.string	"fwrite"
+.LASF1830:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1177:
+	.string	"__DECL_SIMD_erff32 "
+.LASF3249:
+	.string	"ftell"
+.LASF1487:
+	.string	"EBADR 53"
+.LASF1307:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF856:
+	.string	"__id_t_defined "
+.LASF799:
+	.string	"__WCHAR_T "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1517:
+	.string	"ELIBEXEC 83"
+.LASF1182:
+	.string	"__DECL_SIMD_erff128x "
+.LASF974:
+	.string	"__DECL_SIMD_sincosf "
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF3187:
+	.string	"TASK_NONE"
+.LASF2791:
+	.string	"_VA_LIST_ "
+.LASF1946:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1189:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1166:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1306:
+	.string	"__DECL_SIMD_atanhf"
+.LASF2647:
+	.string	"IPPROTO_ICMP IPPROTO_ICMP"
+.LASF757:
+	.string	"__attr_dealloc_fclose"
+.LASF719:
+	.string	"__need___va_list "
+.LASF699:
+	.string	"_SIZE_T "
+.LASF850:
+	.string	"__dev_t_defined "
+.LASF1101:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2752:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1708:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1335:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2566:
+	.string	"IP_PMTUDISC_DONT 0"
+.LASF1913:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF2349:
+	.string	"SOL_BLUETOOTH 274"
+.LASF2560:
+	.string	"IP_MINTTL 21"
+.LASF1181:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1346:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2663:
+	.string	"IPPROTO_BEETPH IPPROTO_BEETPH"
+.LASF2409:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF2219:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF2678:
+	.string	"IPPROTO_DSTOPTS IPPROTO_DSTOPTS"
+.LASF3304:
+	.string	"motorConfig"
+.LASF914:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF765:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1029:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF822:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1623:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1203:
+	.string	"__DECL_SIMD_erfc "
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2371:
+	.string	"MSG_DONTROUTE MSG_DONTROUTE"
+.LASF788:
+	.string	"_BITS_STDIO_H 1"
+.LASF2391:
+	.string	"CMSG_NXTHDR(mhdr,cmsg) __cmsg_nxthdr (mhdr, cmsg)"
+.LASF3044:
+	.string	"OWNER_SONAR_ECHO"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF1851:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2603:
+	.string	"IPV6_IPSEC_POLICY 34"
+.LASF2872:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF3180:
+	.string	"TASK_COMPASS"
+.LASF2549:
+	.string	"IP_RECVERR 11"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF3317:
+	.string	"usec"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF2794:
+	.string	"__va_list__ "
+.LASF2728:
+	.ascii	"IN6_ARE_ADDR_EQUAL(a,b) (__extension__ ({ const struct in6_a"
+	.ascii	"ddr *__a = (const struct in6_addr *) (a); const struct in6_a"
+	.ascii	"ddr *__b = (const struct in6_addr *"
+	.string	") (b); __a->__in6_u.__u6_addr32[0] == __b->__in6_u.__u6_addr32[0] && __a->__in6_u.__u6_addr32[1] == __b->__in6_u.__u6_addr32[1] && __a->__in6_u.__u6_addr32[2] == __b->__in6_u.__u6_addr32[2] && __a->__in6_u.__u6_addr32[3] == __b->__in6_u.__u6_addr32[3]; }))"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF1877:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2978:
+	.string	"FILE"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF2780:
+	.string	"__cleanup_fct_attribute "
+.LASF1998:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1277:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1326:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1820:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF2476:
+	.string	"SO_MEMINFO 55"
+.LASF2652:
+	.string	"IPPROTO_PUP IPPROTO_PUP"
+.LASF1597:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1257:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2685:
+	.string	"IN_CLASSB(a) ((((in_addr_t)(a)) & 0xc0000000) == 0x80000000)"
+.LASF1700:
+	.string	"TELEMETRY_LTM"
+.LASF2423:
+	.string	"SO_REUSEADDR 2"
+.LASF2704:
+	.string	"INADDR_UNSPEC_GROUP ((in_addr_t) 0xe0000000)"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2117:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2563:
+	.string	"IP_BIND_ADDRESS_NO_PORT 24"
+.LASF883:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1780:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2031:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF3002:
+	.string	"pthread_t"
+.LASF1601:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1728:
+	.string	"USE_I2C"
+.LASF3146:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF2864:
+	.string	"DMA_VAR1 1"
+.LASF2472:
+	.string	"SO_ATTACH_REUSEPORT_CBPF 51"
+.LASF2941:
+	.string	"char"
+.LASF2918:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2039:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3034:
+	.string	"OWNER_ADC"
+.LASF728:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF863:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1158:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1754:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1351:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1788:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2444:
+	.string	"SO_SNDTIMEO_OLD 21"
+.LASF1928:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"STR_HELPER(x) #x"
+.LASF2258:
+	.string	"PF_ATMSVC 20"
+.LASF3053:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1364:
+	.string	"_Mdouble_ long double"
+.LASF2035:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF990:
+	.string	"__DECL_SIMD_logf32x "
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1018:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1045:
+	.string	"__DECL_SIMD_hypotl "
+.LASF1248:
+	.string	"__DECL_SIMD_acos"
+.LASF2998:
+	.string	"__kind"
+.LASF2458:
+	.string	"SO_DOMAIN 39"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF744:
+	.string	"SEEK_CUR 1"
+.LASF920:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1174:
+	.string	"__DECL_SIMD_erff "
+.LASF1570:
+	.string	"_TIME_H 1"
+.LASF1087:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF3006:
+	.string	"pthread_attr_t"
+.LASF1669:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1366:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF815:
+	.string	"WSTOPPED 2"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2168:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2852:
+	.string	"DEF_TIM_TIM__TIM_TIM16 D(16)"
+.LASF1626:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2799:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF2496:
+	.string	"SO_NETNS_COOKIE 71"
+.LASF1184:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2803:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2743:
+	.string	"__CPU_SETSIZE 1024"
+.LASF2777:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF2552:
+	.string	"IP_MTU 14"
+.LASF2919:
+	.string	"__UDPLINK_H "
+.LASF1429:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2216:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1979:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2109:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"_GCC_SIZE_T "
+.LASF2211:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF3158:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF1377:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2461:
+	.string	"SCM_WIFI_STATUS SO_WIFI_STATUS"
+.LASF2701:
+	.string	"INADDR_DUMMY ((in_addr_t) 0xc0000008)"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF2735:
+	.string	"_PTHREAD_H 1"
+.LASF1173:
+	.string	"__DECL_SIMD_erf "
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3211:
+	.string	"fpvCamAngleDegrees"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1565:
+	.string	"ENOTRECOVERABLE 131"
+.LASF1044:
+	.string	"__DECL_SIMD_hypotf "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2714:
+	.string	"INET_ADDRSTRLEN 16"
+.LASF2399:
+	.string	"__ASM_GENERIC_SOCKET_H "
+.LASF975:
+	.string	"__DECL_SIMD_sincosl "
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF2989:
+	.string	"__pthread_internal_list"
+.LASF2203:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF2144:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2136:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF3121:
+	.string	"pwmOutputPort_t"
+.LASF700:
+	.string	"_SYS_SIZE_T_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1483:
+	.string	"EUNATCH 49"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1452:
+	.string	"EXDEV 18"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF865:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1841:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF3104:
+	.string	"TIM_USE_PPM"
+.LASF3213:
+	.string	"airModeActivateThreshold"
+.LASF1314:
+	.string	"__DECL_SIMD_erff"
+.LASF704:
+	.string	"_SIZE_T_ "
+.LASF1117:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF3295:
+	.string	"pwmShutdownPulsesForAllMotors"
+.LASF1794:
+	.string	"PP_IIF_1(t,f) t"
+.LASF2248:
+	.string	"PF_ROSE 11"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2639:
+	.string	"IPV6_PMTUDISC_INTERFACE 4"
+.LASF1255:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2179:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2737:
+	.string	"_BITS_SCHED_H 1"
+.LASF2098:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF930:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2662:
+	.string	"IPPROTO_MTP IPPROTO_MTP"
+.LASF2406:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF1329:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2331:
+	.string	"AF_SMC PF_SMC"
+.LASF2396:
+	.string	"__CMSG_PADDING(len) ((sizeof (size_t) - ((len) & (sizeof (size_t) - 1))) & (sizeof (size_t) - 1))"
+.LASF2318:
+	.string	"AF_TIPC PF_TIPC"
+.LASF463:
+	.string	"__PMT"
+.LASF1589:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1132:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1764:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2057:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2049:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1281:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF825:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF3175:
+	.string	"TASK_DISPATCH"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF3281:
+	.string	"Data"
+.LASF3133:
+	.string	"statusLedConfig_s"
+.LASF3135:
+	.string	"statusLedConfig_t"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF3343:
+	.string	"last_realtime"
+.LASF713:
+	.string	"_SIZET_ "
+.LASF1476:
+	.string	"ENOMSG 42"
+.LASF1682:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1411:
+	.string	"math_errhandling 0"
+.LASF1831:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF701:
+	.string	"_T_SIZE_ "
+.LASF1910:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"__DECL_SIMD_expf64 "
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2081:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2466:
+	.string	"SO_BUSY_POLL 46"
+.LASF2197:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2226:
+	.string	"SOCK_STREAM SOCK_STREAM"
+.LASF2962:
+	.string	"_chain"
+.LASF2388:
+	.string	"MSG_FASTOPEN MSG_FASTOPEN"
+.LASF953:
+	.string	"__DECL_SIMD_cos "
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1563:
+	.string	"EKEYREJECTED 129"
+.LASF1289:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2542:
+	.string	"MCAST_EXCLUDE 0"
+.LASF1508:
+	.string	"EBADMSG 74"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF2201:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1404:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1198:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1292:
+	.string	"__DECL_SIMD_log10"
+.LASF3327:
+	.string	"mode"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1962:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"____mbstate_t_defined 1"
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1134:
+	.string	"__DECL_SIMD_log2f "
+.LASF1892:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1562:
+	.string	"EKEYREVOKED 128"
+.LASF2332:
+	.string	"AF_XDP PF_XDP"
+.LASF1309:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2763:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF1678:
+	.string	"USE_FAKE_GYRO "
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1618:
+	.string	"USE_CLI_BATCH "
+.LASF2733:
+	.string	"IN6_IS_ADDR_MC_ORGLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x8))"
+.LASF2520:
+	.string	"IP_RECVOPTS 6"
+.LASF2940:
+	.string	"__syscall_slong_t"
+.LASF2474:
+	.string	"SO_CNX_ADVICE 53"
+.LASF1221:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2613:
+	.string	"IPV6_RECVRTHDR 56"
+.LASF1272:
+	.string	"__DECL_SIMD_cosh"
+.LASF911:
+	.string	"NFDBITS __NFDBITS"
+.LASF2116:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1534:
+	.string	"ENETDOWN 100"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2836:
+	.string	"DEF_TIM_TIM_GET(tim) CONCAT2(DEF_TIM_TIM__, tim)"
+.LASF2386:
+	.string	"MSG_BATCH MSG_BATCH"
+.LASF1440:
+	.string	"ENXIO 6"
+.LASF2827:
+	.string	"BTCH_TIM17_CH1N BTCH_TIM17_CH1"
+.LASF950:
+	.string	"_STRINGS_H 1"
+.LASF1997:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"__DECL_SIMD_log1p"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF946:
+	.string	"__COMPAR_FN_T "
+.LASF1989:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1816:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2132:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2991:
+	.string	"__next"
+.LASF1657:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF2237:
+	.string	"PF_UNIX PF_LOCAL"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2534:
+	.string	"MCAST_BLOCK_SOURCE 43"
+.LASF3116:
+	.string	"timerHardware_t"
+.LASF3336:
+	.string	"systemReset"
+.LASF1175:
+	.string	"__DECL_SIMD_erfl "
+.LASF1633:
+	.string	"TELEMETRY_FRSKY "
+.LASF1123:
+	.string	"__DECL_SIMD_log10 "
+.LASF1793:
+	.string	"PP_IIF_0(t,f) f"
+.LASF2597:
+	.string	"IPV6_V6ONLY 26"
+.LASF1146:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF722:
+	.string	"_____fpos_t_defined 1"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2501:
+	.string	"SO_TIMESTAMP SO_TIMESTAMP_OLD"
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2417:
+	.string	"SIOCGPGRP 0x8904"
+.LASF742:
+	.string	"EOF (-1)"
+.LASF1298:
+	.string	"__DECL_SIMD_log2f"
+.LASF2770:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF2430:
+	.string	"SO_SNDBUFFORCE 32"
+.LASF2282:
+	.string	"PF_XDP 44"
+.LASF1745:
+	.string	"___int_ptrdiff_t_h "
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF1727:
+	.string	"VTX_TRAMP"
+.LASF1591:
+	.string	"VERY_FAST_MATH "
+.LASF1526:
+	.string	"ENOPROTOOPT 92"
+.LASF1566:
+	.string	"ERFKILL 132"
+.LASF912:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2053:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1260:
+	.string	"__DECL_SIMD_hypot"
+.LASF2404:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF943:
+	.string	"_ALLOCA_H 1"
+.LASF1902:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"__DECL_SIMD_log10f"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2539:
+	.string	"MCAST_MSFILTER 48"
+.LASF1340:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1253:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF3052:
+	.string	"OWNER_SDCARD_CS"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2720:
+	.string	"htonl(x) __bswap_32 (x)"
+.LASF1498:
+	.string	"ENONET 64"
+.LASF2530:
+	.string	"IP_ADD_SOURCE_MEMBERSHIP 39"
+.LASF774:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF3188:
+	.string	"TASK_SELF"
+.LASF2030:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"__DECL_SIMD_exp10f "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF2973:
+	.string	"_freeres_list"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF3272:
+	.string	"fakeAccSet"
+.LASF1095:
+	.string	"__DECL_SIMD_sinhl "
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2112:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1813:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF834:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1709:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1901:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"WEXITED 4"
+.LASF809:
+	.string	"__DEFINED_wchar_t "
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1386:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1630:
+	.string	"BLACKBOX "
+.LASF2984:
+	.string	"_IO_FILE"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2519:
+	.string	"IP_TTL 2"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1638:
+	.string	"CMS "
+.LASF2748:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF934:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2305:
+	.string	"AF_PACKET PF_PACKET"
+.LASF3065:
+	.string	"OWNER_OSD"
+.LASF1703:
+	.string	"USE_PPM"
+.LASF3315:
+	.string	"delayMicroseconds"
+.LASF933:
+	.string	"__ONCE_ALIGNMENT "
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2884:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF2731:
+	.string	"IN6_IS_ADDR_MC_LINKLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x2))"
+.LASF1275:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2337:
+	.string	"SOL_X25 262"
+.LASF3184:
+	.string	"TASK_BLACKBOX"
+.LASF3105:
+	.string	"TIM_USE_PWM"
+.LASF3062:
+	.string	"OWNER_USB"
+.LASF1850:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2861:
+	.string	"DEF_TIM_DMA_GET_VARIANT__1(_0,_1,...) _1"
+.LASF1748:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2207:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1078:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF714:
+	.string	"__size_t "
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF3210:
+	.string	"rcInterpolationInterval"
+.LASF3192:
+	.string	"serialrx_provider"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF971:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1488:
+	.string	"EXFULL 54"
+.LASF2419:
+	.string	"SIOCGSTAMP_OLD 0x8906"
+.LASF771:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF3334:
+	.string	"statusLedConfig"
+.LASF2346:
+	.string	"SOL_TIPC 271"
+.LASF2463:
+	.string	"SO_NOFCS 43"
+.LASF877:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2870:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3013:
+	.string	"FLASH_BUSY"
+.LASF1500:
+	.string	"EREMOTE 66"
+.LASF787:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1426:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF2198:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF3144:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF823:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF2668:
+	.string	"IPPROTO_UDPLITE IPPROTO_UDPLITE"
+.LASF1695:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2269:
+	.string	"PF_BLUETOOTH 31"
+.LASF1093:
+	.string	"__DECL_SIMD_sinh "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2502:
+	.string	"SO_TIMESTAMPNS SO_TIMESTAMPNS_OLD"
+.LASF1135:
+	.string	"__DECL_SIMD_log2l "
+.LASF2160:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2330:
+	.string	"AF_QIPCRTR PF_QIPCRTR"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF741:
+	.string	"BUFSIZ 8192"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF3178:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF1409:
+	.string	"MATH_ERRNO 1"
+.LASF1432:
+	.string	"_BITS_ERRNO_H 1"
+.LASF1020:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF2067:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF3197:
+	.string	"rx_spi_rf_channel_count"
+.LASF2350:
+	.string	"SOL_PNPIPE 275"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF1480:
+	.string	"EL3HLT 46"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF3101:
+	.string	"timCCR_t"
+.LASF2185:
+	.string	"DMA_MOD_VALUE 7"
+.LASF1282:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1169:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1338:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2361:
+	.string	"SOL_SMC 286"
+.LASF1293:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1149:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2860:
+	.string	"DEF_TIM_DMA_GET_VARIANT__0(_0,...) _0"
+.LASF2923:
+	.string	"GYRO_SCALE (16.4)"
+.LASF1878:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF3261:
+	.string	"dyad_init"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF3265:
+	.string	"udpInit"
+.LASF2088:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2564:
+	.string	"IP_RECVFRAGSIZE 25"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF907:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF2727:
+	.string	"IN6_IS_ADDR_V4COMPAT(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && ntohl (__a->__in6_u.__u6_addr32[3]) > 1; }))"
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF746:
+	.string	"P_tmpdir \"/tmp\""
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1675:
+	.string	"ACC "
+.LASF1417:
+	.string	"M_PI 3.14159265358979323846"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2974:
+	.string	"_freeres_buf"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2618:
+	.string	"IPV6_PATHMTU 61"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2212:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF922:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF3319:
+	.string	"micros"
+.LASF2926:
+	.string	"unsigned int"
+.LASF3293:
+	.string	"motorCount"
+.LASF2118:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF1681:
+	.string	"BARO "
+.LASF1968:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF3000:
+	.string	"__elision"
+.LASF1353:
+	.string	"_Mdouble_ double"
+.LASF2108:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF2100:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1777:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1798:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3487:
+	.string	"posix_types_64.h"
+.LASF3388:
+	.string	"thread-shared-types.h"
+.LASF3399:
+	.string	"pwm_output.h"
+.LASF3462:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3377:
+	.string	"/usr/include"
+.LASF3466:
+	.string	"mathcalls-helper-functions.h"
+.LASF3435:
+	.string	"stdio_lim.h"
+.LASF3437:
+	.string	"floatn-common.h"
+.LASF3382:
+	.string	"stdint.h"
+.LASF3497:
+	.string	"pthread_stack_min.h"
+.LASF3488:
+	.string	"bitsperlong.h"
+.LASF3355:
+	.string	"src/main/build"
+.LASF3374:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3431:
+	.string	"__fpos_t.h"
+.LASF3503:
+	.string	"flash.h"
+.LASF3410:
+	.string	"time.h"
+.LASF3447:
+	.string	"select.h"
+.LASF3493:
+	.string	"cpu-set.h"
+.LASF3501:
+	.string	"config_streamer.h"
+.LASF3510:
+	.string	"bus.h"
+.LASF3470:
+	.string	"struct_itimerspec.h"
+.LASF3365:
+	.string	"src/main/target/SITL"
+.LASF3467:
+	.string	"mathcalls.h"
+.LASF3390:
+	.string	"pthreadtypes.h"
+.LASF3507:
+	.string	"sound_beeper.h"
+.LASF3373:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3418:
+	.string	"libc-header-start.h"
+.LASF3442:
+	.string	"timer_t.h"
+.LASF3495:
+	.string	"struct___jmp_buf_tag.h"
+.LASF3403:
+	.string	"scheduler.h"
+.LASF3474:
+	.string	"platform.h"
+.LASF3378:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3432:
+	.string	"__mbstate_t.h"
+.LASF3492:
+	.string	"struct_sched_param.h"
+.LASF3485:
+	.string	"socket_type.h"
+.LASF3392:
+	.string	"resource.h"
+.LASF3512:
+	.string	"inet.h"
+.LASF3452:
+	.string	"atomic_wide_counter.h"
+.LASF3361:
+	.string	"src/main/flight"
+.LASF3371:
+	.string	"/usr/include/netinet"
+.LASF3415:
+	.string	"imu.h"
+.LASF3504:
+	.string	"rx_pwm.h"
+.LASF3400:
+	.string	"light_led.h"
+.LASF3482:
+	.string	"build_config.h"
+.LASF3417:
+	.string	"stdc-predef.h"
+.LASF3505:
+	.string	"sdcard.h"
+.LASF3460:
+	.string	"math.h"
+.LASF3443:
+	.string	"endian.h"
+.LASF3412:
+	.string	"dyad.h"
+.LASF3419:
+	.string	"features.h"
+.LASF3367:
+	.string	"src/main"
+.LASF3385:
+	.string	"FILE.h"
+.LASF3428:
+	.string	"time64.h"
+.LASF3494:
+	.string	"setjmp.h"
+.LASF3413:
+	.string	"serial_tcp.h"
+.LASF3464:
+	.string	"fp-logb.h"
+.LASF3421:
+	.string	"wordsize.h"
+.LASF3370:
+	.string	"/usr/include/linux"
+.LASF3449:
+	.string	"__sigset_t.h"
+.LASF3420:
+	.string	"features-time64.h"
+.LASF3459:
+	.string	"strings.h"
+.LASF3409:
+	.string	"feature.h"
+.LASF3358:
+	.string	"src/main/drivers/accgyro"
+.LASF3453:
+	.string	"struct_rwlock.h"
+.LASF3445:
+	.string	"byteswap.h"
+.LASF3402:
+	.string	"config.h"
+.LASF3425:
+	.string	"stubs.h"
+.LASF3509:
+	.string	"gyro.h"
+.LASF3406:
+	.string	"target.c"
+.LASF3438:
+	.string	"waitflags.h"
+.LASF3391:
+	.string	"target.h"
+.LASF3477:
+	.string	"io_def.h"
+.LASF3475:
+	.string	"common_fc_pre.h"
+.LASF3471:
+	.string	"maths.h"
+.LASF3439:
+	.string	"waitstatus.h"
+.LASF3360:
+	.string	"src/main/fc"
+.LASF3429:
+	.string	"wchar.h"
+.LASF3422:
+	.string	"timesize.h"
+.LASF3356:
+	.string	"src/main/common"
+.LASF3404:
+	.string	"rx.h"
+.LASF3376:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3498:
+	.string	"rcc_types.h"
+.LASF3484:
+	.string	"struct_iovec.h"
+.LASF3441:
+	.string	"time_t.h"
+.LASF3491:
+	.string	"sched.h"
+.LASF3383:
+	.string	"stddef.h"
+.LASF3465:
+	.string	"fp-fast.h"
+.LASF3469:
+	.string	"struct_tm.h"
+.LASF3436:
+	.string	"floatn.h"
+.LASF3463:
+	.string	"flt-eval-method.h"
+.LASF3506:
+	.string	"bus_i2c.h"
+.LASF3368:
+	.string	"/usr/include/arpa"
+.LASF3354:
+	.string	"lib/main/dyad"
+.LASF3398:
+	.string	"timer.h"
+.LASF3426:
+	.string	"stubs-64.h"
+.LASF3472:
+	.string	"io.h"
+.LASF3481:
+	.string	"parameter_group.h"
+.LASF3473:
+	.string	"stdbool.h"
+.LASF3496:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF0:
+	.string	"./src/main/target/SITL/target.c"
+.LASF3433:
+	.string	"__fpos64_t.h"
+.LASF3416:
+	.string	"errno.h"
+.LASF3363:
+	.string	"src/main/scheduler"
+.LASF3489:
+	.string	"sockios.h"
+.LASF3486:
+	.string	"posix_types.h"
+.LASF3478:
+	.string	"utils.h"
+.LASF3446:
+	.string	"uintn-identity.h"
+.LASF3468:
+	.string	"errno-base.h"
+.LASF3458:
+	.string	"__locale_t.h"
+.LASF3386:
+	.string	"clockid_t.h"
+.LASF3483:
+	.string	"socket.h"
+.LASF3461:
+	.string	"math-vector.h"
+.LASF3444:
+	.string	"endianness.h"
+.LASF3381:
+	.string	"stdint-uintn.h"
+.LASF3408:
+	.string	"stdio.h"
+.LASF3440:
+	.string	"clock_t.h"
+.LASF3384:
+	.string	"struct_FILE.h"
+.LASF3401:
+	.string	"accgyro_fake.h"
+.LASF3502:
+	.string	"adc.h"
+.LASF3424:
+	.string	"long-double.h"
+.LASF3490:
+	.string	"struct_osockaddr.h"
+.LASF3423:
+	.string	"cdefs.h"
+.LASF3430:
+	.string	"stdarg.h"
+.LASF3362:
+	.string	"src/main/rx"
+.LASF3427:
+	.string	"typesizes.h"
+.LASF3369:
+	.string	"/usr/include/asm-generic"
+.LASF3395:
+	.string	"sockaddr.h"
+.LASF3511:
+	.string	"sensor.h"
+.LASF3476:
+	.string	"common_fc_post.h"
+.LASF3457:
+	.string	"locale_t.h"
+.LASF3366:
+	.string	"src/main/target"
+.LASF3508:
+	.string	"vcd.h"
+.LASF3411:
+	.string	"pthread.h"
+.LASF3500:
+	.string	"axis.h"
+.LASF3396:
+	.string	"in.h"
+.LASF3405:
+	.string	"udplink.h"
+.LASF3397:
+	.string	"system.h"
+.LASF3359:
+	.string	"src/main/drivers"
+.LASF3448:
+	.string	"sigset_t.h"
+.LASF3394:
+	.string	"serial.h"
+.LASF3456:
+	.string	"stdlib-float.h"
+.LASF3414:
+	.string	"stdlib.h"
+.LASF3499:
+	.string	"timer_def.h"
+.LASF3434:
+	.string	"__FILE.h"
+.LASF3387:
+	.string	"struct_timespec.h"
+.LASF3450:
+	.string	"struct_timeval.h"
+.LASF3364:
+	.string	"src/main/sensors"
+.LASF3380:
+	.string	"stdint-intn.h"
+.LASF3454:
+	.string	"alloca.h"
+.LASF3480:
+	.string	"dma.h"
+.LASF3357:
+	.string	"src/main/config"
+.LASF3379:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3389:
+	.string	"struct_mutex.h"
+.LASF3455:
+	.string	"stdlib-bsearch.h"
+.LASF3407:
+	.string	"string.h"
+.LASF3479:
+	.string	"io_def_generated.h"
+.LASF3451:
+	.string	"pthreadtypes-arch.h"
+.LASF3393:
+	.string	"io_types.h"
+.LASF3372:
+	.string	"/usr/include/x86_64-linux-gnu/asm"
+.LASF3375:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\256\002-\022"
+	.string	"\004\033\242\003"
+	.string	"K"
+	.string	"\315\320\247q\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\256\234\262\364\013"
+	.string	"\003\240\342\234\212\n\004\005\336\251\234\254\005\f\002\001\001\002\001\006\352\263\360\321\b\t\325\336\237\242\r"
+	.string	"\n\376\220\361\f\002\002\003\002\003\013\234\362\341N"
+	.string	"\f\r\251\306\315\231\b"
+	.string	"\016\324\240\313\347\002\006\002\004\017\020\021\372\255\302\243\003\022\316\225\216\324\007"
+	.string	"\023\301\325\215\205\016"
+	.string	"\024\274\205\242\255\006"
+	.string	"\025\225\221\315\200\006"
+	.string	"\026\210\377\206\247\006"
+	.string	"\027\271\303\275\241\r\n\002\005\002\006\006\002\006\030\031\230\336\335\312\001\032\237\346\337\233\003@\002\007\002\b\002\007\002\007\b\002\t\002\t\n\002\n\033\034\037 \315\343\301\244\013!\"\247\333\250\364\n#$%\263\330\307\313&\261\213\233\205\b\n\004\002\004'()\264\251\257\307\f*+,\367\267\311\301\004"
+	.string	"-.\222\321\201\352\t\b\013\002\013/\211\307\340\277\f\0020\314\345\244\232\005"
+	.string	"1\362\357\204\233\017"
+	.string	"2\202\220\306\317\004\0203\374\322\253\376\003\006\002\f\002\f\002"
+	.string	"\002\r4567\333\217\352\217\004\01689\313\322\375\213\007"
+	.string	":\236\376\250\313\b"
+	.string	";\350\300\306\254\005<\222\252\354\340\007"
+	.string	"=\202\321\322\374\007\004\f\002\017>?\360\251\206\306\017@\243\205\305\376\016\020\002\020\002\021A\310\342\324\f\002\002\f\002\022BC\317\253\250\341\002"
+	.string	"D\212\370\343\273\001E\202\322\365\203\t\002\002\023\002\023FG\311\224\247\360\013\b\001\002\001H\373\220\322\206\007"
+	.string	"I\257\230\220\213\016"
+	.string	"J\324\226\242\363\f"
+	.string	"K\202\275\352\302\f"
+	.string	"LMN\240\342\234\212\n"
+	.ascii	"C\250\3414\203\224q\320H\020mJ*m`\002b\246\216\033\021\340t$"
+	.ascii	"R\221X\3202\323\001\361\002~\323\315\244\033p\026j_\274\361\260"
+	.ascii	"\372\265\302\231\016t\f\333z\325\217i\330\321z1\251\215\303\204"
+	.ascii	".\357*\234P\334\251\215\236\350\003\024\262\00765\244\321\005"
+	.ascii	",v\r\300\242\365\316\233\344L\211/C\026\353*\342r\"\f\370l\313"
+	.ascii	"\204\303\224q\321\310/,\314\330-\307\275\031vI\2625\224\342w"
+	.ascii	"\025\361\320#\341.=\314\231B\021i\201$:\026\355\234\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`(\001%\007"
+	.string	"b\t\032\026\240$O:\321\257\376\312{\226\240\rF\255)\266\325\"Mn\231\002\007"
+	.ascii	"\360x\231\352\250\023M\274T\322hQ\350@\375\323=\274\3239\033"
+	.ascii	"V\323\352iY\355\260\243u\273\353.\203\271p\3222\263\ne\362]\022"
+	.ascii	"\031R9\032\2743x\213#1~q\256\340\f|\230\t\204\241pw\002\237\275"
+	.ascii	"A)`;\336\366\363\354{\004@\250AM\317\202\026\227\326P\202a\254"
+	.ascii	"\254\007\020hE\201QZ7\314C*v\203Vt\231c\263(\271\026\361,\220"
+	.ascii	"8q?(\312E\221\023\257G:Y\235\207\241\366\266-Z\204\267\205+E"
+	.ascii	"1\347\202\262\027\310q\210!+\036\301\205\030`\346\211\365\254"
+	.ascii	"b\021\035\205\263\037\210g\361\254V\023\3516\236\2402\365\362"
+	.ascii	"\004`P$\307\031(\221{x\310\347D\277\257\016<m\t\271("
+	.text
+	.section	.gnu.lto_.inline.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`!\n\005\035"
+	.string	"6\237pH\340\322h8\243\"<\r\"dt\235\002.\330Cm8\277\221HD\347\200\346`\3270\331x?S\242\222\246v0\230\241\224\226\266O\2101\006.\225Z\312E\242\316wq\021\210\004\276\205\232A\276A\270\273\275\261\355\226R\246V"
+	.string	"Z"
+	.string	"\\"
+	.string	"\273\233\221s\013]\253\327\253lW\304@\241;\335\224*\215\\\236\345Y\236#\227'/\f\370\277\254\215Qm\227R\364\242w\002\366\322\317\377Q\337\207\356\256\3752\026\352n\222\257\212*\352\257\273_s\273\273\301\177\3068\270\236 \340\376\332\201y34F\310\037\366S+\377\226\200\377ic\210n\350\334D\017{d\003\321\252\007\320\307\226'G\244\304\352\247-\214\217\032\033\032\363\262C~"
+	.string	"\361x\021\211\242\362\323\335-\362\245O\331\237g,\362\304\365n\231|\326\352-\272\273t\225\311\277\372\375&\3238Dw\227<\205\372wN.\273\263\360\242\226\347\315\241\332\300\237\3065I=\031\325k\025\300\252.NROf\374\002\226\225\225/I~\307\324\303\360\373\375\373rX\215\211\177l\305qY\253\272o\341\267V\365s]\201\346zxD\343\023\260\274<yf:\002\324\367\"9\0259R'#\216p\"LH\330\201\033(\360\233\356^}\200\200\007\337\360k`\030<5v\324L\344\334\220P\317p\203A\257\240\213]\217\241q\306\270!\0354\254_\320\227\247\336\205\217\314\244\270-\013 6$T\253\343\351\334\256\273\005!2\332\310\364\n\024\276\020eU9\266;\023\230"
+	.string	"\020\r\034H*o\221\360\222mG\200\360\300\374\356\240\301\377\376\261\371\004\211+d\363\t\n\317\340\001\200\331\250\2419cC\"M6v\003`\002\231!\"c\007\022\300C9\305\263\314\030\242\314\210\004\023J \022L\224Pa\323\032<\037\313\247D\355\222\265\247\023Q\372\242\033\301\r\227l\262%\231\274\220\361\336\367(\023aR\204\030x\b\245$\342KAQ\330\317\374\270G\330\336\305=$\206\352\3248\f\"\b\301\2614\331t\024\336\231\202R\342\007.\255U\242\201\210S)\263\226\250\317\362']\314\021H\356*\273N#\301\265\251\227\2260\373"
+	.string	"`\373\254\314\355.\203\230\026\222\232\305\343"
+	.string	"p\366\364I\315\272q\004\022"
+	.string	"\301\326\\\253!\245\002\370\335\035\342\374\263\323\022\313{\205v\350mQ\371 c\370\027|\360c\267:l\022E\017o\335\223:yE\001\254B!.s\224\300O\344\325\205\321\346P\335 \247\362O\215\364g\023\373g\345\214!n\027\001Pm\366\005\357\364\205\333\302\305\312\353Q\374\025\334\274\213\213\203\024\365\260\025\247\033D\370\r\026\267a\201d(\2134\203'\032\311*QC\001M\220\251\304t-*\006"
+	.ascii	"iCo\324L\373\2129\240\231\346y[\265d7\217/e\3074\275\200\337"
+	.ascii	"\243o45\214\316\336+\252\344\307\207z\302B\211H\271\207\322A"
+	.ascii	"\rm\205\317\225*5!L;\224\242\241\270\203.\307\210\024BO\371:"
+	.ascii	"\023\200\366\304\031\207'\225\272m\222[Cy<\252\3119$\305\032"
+	.ascii	"\373\252\226|\265t\256\357>P\262\034\261\234\251$+\024\363\002"
+	.ascii	"-\n\0311\211\316\362\244\253P\301\320KS\007\342\033\236\004p"
+	.ascii	"7\020\316\232\376\256\034\231\207T\025\333\3560\216\230\023\302"
+	.ascii	"\002(\274l\013d\225\260I\020\356\374\003\340G\277\303\313K\250"
+	.ascii	"\220O\263\377.\301\307\2276w\230\\<\376\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`L\r\375)"
+	.string	"\006\372\312H\240\234M\007\334\3148\006\226\037\2225~\362|MQ\275+\335\0310\272p\320%>\364|;\356\355\017\332\b\350\245\202l\373u|\207&\337\t=i\305\231r\02374\315\252\004c\311X?[\321\tX\204\354\266[\246\224\002\251"
+	.string	"\263"
+	.string	"\301"
+	.string	"F\276n\017\362\001\336\3459\020\236~7N\353\364z\275^\376\332\363w\354\3353\222z:\205\024\214}\346\371\254\343\376\260\312\363'\376\256\323\363^\317\333\213\3473u\017\340\376\340iU\312JR\317\006!\005\377\275\275@\357,\3407\250\244\236\fB\2323W=\013\204\364\353\276\351\235\035o,\340\347\354S\347r_\342\357\215\342\347)\330\375\035\345\313\221\036m\232\212o\325\330\261\205\327\215\324\353\215\211\301\343\301p\360\337\335\331\227@\367%\360\275\363\177]\355_\227\013\271\222\246.z\252\247\207~C\337\347\273\335[\354w\320-`A\376\331=\327\3202zj\003\374\242\2475s\271Q\317\377\361 \350\031\007\330\224\245%G=\177\213i)\311\362,\2577\364 )\370\334s\324\255\241;C\267Q7\006\013\027z>'\370\\\341[C\205\006?#\271;%j"
+	.string	"`"
+	.string	"\200\371\036\372\330\214BL\354\356\t\335\035\241\273!"
+	.ascii	"u\177}\271\b\0324\210\236\326\241\247\177\345L\003\257]\273g"
+	.ascii	"O\277~Sw\005=B\376_w,\313G=\275IH?\361\373y> \365\364\"!\375"
+	.ascii	"\204\336\337\035A\367\001+\316\303@\225 \365\364\033\022\nL!"
+	.ascii	"R\317\035\001)M]\224\213\324\363\206~\223\363(\236\373\034Ww"
+	.ascii	"GP\335\256\251k\241\233\322iXV\016(kF5\342\322\304\255\206\257"
+	.ascii	"J\034\305\240\203X\320\206\t\2156 {d\257\013RG\205UU\332pR'8"
+	.ascii	"\220H\2429M\375t\020\246\215#S\210\267\022\347\356\305i\231l"
+	.ascii	"\304];\326.VQ\"We\356t\230z~:B\372P\0362\231z~1B\372O\035>-4"
+	.ascii	"\365\244YB\372\305\336y>\343\270?\024\017\007&\256\245\346\211"
+	.ascii	"\351i\032\n\245\214\317\3164u\221\326\232zR#Zl\300\377\310\320"
+	.ascii	"\034\356\305\375\313\223\236v\347\274\213o\020\323\246\203\204"
+	.ascii	"\byQ\3177\023\322\237\255z\276WH?'C\234\f\221\001~g\3173\352"
+	.ascii	"\371\\!\245\020=\342H\245\333\016\233X7\247\313\351\213wW\244"
+	.ascii	"\025\256\\\302\221Q&\256\355\b4\314\312\356\025\2566\302Z\225"
+	.ascii	"\341\3165kc\256\007\253\252\244\345\312\222\206#k7\237*sH\234"
+	.ascii	"\2113\361\002\321\020\f\013G\332v!p,\242\254I\342H\037Q\024\361"
+	.ascii	"]\201\257\316F1IY\023\327L]\254e\270\304\370Z|\261pi\"7\356\354"
+	.ascii	"5k\027/%h\032M\n\204=\222\331\321\311\332q\267c\215pieU\350j"
+	.ascii	"6+\313\324D\263NB\r\033\201\254L&\243\272c\371\341\342\235\215"
+	.ascii	"\254YM!\300\367F\232S:-\212\242I\342\240\250\306k\233\312i\031"
+	.ascii	"\276c\255\264\231e\251T\226\360i\231\031\200\356\250!E\207hd"
+	.ascii	"DD\222\202$\031\306p\002\021\242\"\252\007\022 \022a\214\343"
+	.ascii	"I\n1\305\f!\210\221\031R\220\224\224&\313\030\247\003\225\002"
+	.ascii	"f\356\203\211q\326 \350\017!N\372\316'{\232\212\033\f\177\207"
+	.ascii	"\023h'Nx\r\250\231\314\300t\017\340\340n\002\321\177\005\252"
+	.ascii	"yS\254\357<\353\020\243\250\354Lm\t\271\344\020\221\274e\211"
+	.ascii	"\024r#\253\312.\350\245\233\325\311\236$R\356 0E\344\032\256"
+	.ascii	"\b\364\241\247\004\272{\320*\351\2059\231\211)\\\310\2735\244"
+	.ascii	"\013\372\032A\254\214\235\314K\334\\\001Q\342\bCWt\372\206!&"
+	.ascii	"\243\205\212\227\335\220^\034\023\247(Zc\221\002N\370FJ\352\352"
+	.ascii	"\323\001\324 \230"
+	.string	"\260_q\203\023\316\300O\367\016\215\357\\\351\245\017I@\325\344\214\351\200$.\321\264\tA\2700\bru\036H\021T\213D+\204\275\353\354^\254I\336\251!\001\311\230)\030_K\002!\020\265\367\227j#'\037\300q\370\347G:\204\300JC \351\033\021h[p1\371\224w\016\024\\\345v\023\255Z#\365(\251\244Y\033\320\225\017\304\300\313\232\1771\025F\217U\321\314\216S<a\307\265A\004Z\303\316c\021p\375S\210{\237Bdx\025\036f\024G\022q\242\364\316\260\241\326\026\327\256y\335\031`\213\370\244d\210\021 Lo\271\2414\222W\026\222\375JK\351\304\323\223\257U\"\367\320\260~\324\266\236Np\322c\243\022\232-\367k\"\016\303\r'\003\265\034\366\304\031\200\214\240)_\235\023\314h\256\324?\272\03749\200B\216I\302\2353a-\003SV:u\270\350\306e\247>\005k\212\030\260"
+	.string	"=\001ev\230\031^k\277+h%ik<B@\202\321\305\"%\270<\240\022~M~\270\nLX<\311\260\230\263\007T\242"
+	.ascii	"\221\266\214z\026\374\3324\376\344*\350)\2547\372\322\3527\323"
+	.ascii	"hr\2457\205\212\240v\200\016\n\024"
+	.text
+	.section	.gnu.lto_.pureconst.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \217\265\003"
+	.string	"\362\210\034!PW\206\003a\314\354\022\316\025{n\314\314\314L\316\366\331\337\317b\023\216F#\273\213\230\305\025\363;\254\212M\261\250{bMl\211%\375FWtC\027t??\317\253\316\345\3746Ws3k\230\267\313\265\334\312/\354R\356\344Jn\344B\270=n9n\3432\330\005]\212_\202E\260\007f\006f\205K\270\003j\202\033\240\306\013\340\3460\347\034+"
+	.text
+	.section	.gnu.lto_.ipa_modref.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\246\002U\013"
+	.string	"\022\017,-`o\226\0030\f\3030\250)\212\"\246(\212\"djB\367\222=\276\006\0045\025\245\237\2246\013\272"
+	.string	"\216Z\334P^\324\350\016;\311\024z>,\235I+D\020?\364\320\016\016uc\345\255\241y\252\274\f\013\303\224\347\276P\213\n\2247\212\223\235\350)Zr\311\243\325R\324\216\334\266\272.\200\027ib\227u8\252\304n\336\306\b\b\207\033\030\026$]\345\256\347\265\013=C;\320\023\3644r\244\311\263d\367y~\306\250\3244\nZ\355\250\227\344e<a+\021v`\260\221W\240\0228\220y\002\234\200uN\344M\317z\352\363A\214J-\001\\\250A\301\205&\255d\2171`\202BF\306\r\021p\231S\026NaA![{\006V\036\252NKx\324\355\003\3150\270*\030\fM\204|\230\th\204\f\2618\227\035\235E\0139\177\r\332\323n\275\027\205\263DN\311\210c\373"
+	.ascii	"\312\223\255\305\211\376\352\266-\310\2550\361\230\r5\214O\230"
+	.ascii	"\246\2116h\3642\372\002\341\343\253\024\255\320\004xe\005\355"
+	.ascii	"\320\300\240T\311\302B\270\375 \216\266\352\007\036\025\300B"
+	.ascii	"\361Ge\t\331\344C\322t\300\241\242\365l\216A\251\260w\037=\266"
+	.ascii	"I\227\027z\332*\326\210\247\3028\365\241\375\340\304\273\331"
+	.ascii	"\225\037\343\021\201\234\243\372\211\252\313\024"
+	.text
+	.section	.gnu.lto_.lto.5fc4e2df5d262bb9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.79.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"m\007"
+	.string	"\262\01644PO\323\001\214\276\232\241i\213jrL"
+	.string	"\202A\314"
+	.string	"?\217]\206q\f\264$\250\371olH\031,kc\013\004\020\341\001\336xM\260n\344\261do)S\n\356P\b\n\007\t\361\362,X\234+:0p\032b\307\372Djr\365\340\261\342UUV\224\272\375[\r\251N \235\360&\217r\025\f`\027\364\315\357\236\362\361A\016\r\201\345\267C\037\213\016\355\b\211\374\246Z\220A\241\232%\215M\031\273\323R9\354\277\325\220\375\264\276\201\220\277\320\354Z\324\314\254\013d\021\261\235\331\222_r\223\314ny\235\007\367\215\217\212\225\230\335\215\323\005\242\303\367\200\350P;\236=3\377'\177$\0300\033\247=7\006\273\353\334\270\213[o\233\3006e{$\t"
+	.ascii	"{\311'cZ\367\206\205\300\330\343\232\270\033\201\265\020\231"
+	.ascii	"\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.80.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\305\007"
+	.string	"\362\31657@o\222\016\200T\213+`\2201S\035S\3044\203\005\233?`u\260\324\366W\366\217\242\357\314\226V\300\231\375\270\372/\323\242\352\20225\362\020\235\361\203\254}Bd\n\207>\007\t\006\bq$R\300@\243\330\260"
+	.string	"b\210!,\213\237\316\227\203\b\213\243\353\302\"\247\313f\022\242\n\\V&H\361\346\t\364\023M\271\216d\003*\"M]\017Y\246\251U\256\035) \323\324\355\2024\004\342r\324:\202\364\272\325\272$M\255\227\230x\335\356T\300\322\217\204\005%\337\313w\245\0073\276\231\204\250\207\036\256)\252\314\213\030\230\\Y&\035\177\277\234\366\234\265_i\267\221MyX\250Z23B\215j}\332\355G7\333\251\324\007@\220\231\277\355\204\321a\177\317\377\371K\002\013"
+	.ascii	"{\3117c\232\372\206\247Lc\300\021\200\0218*\037\327Dh!\020p\231"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_updateState.81.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\330\022EZ"
+	.ascii	"\312\226\370 L \322\312I\007\217\006'<\363Y\257\310>\351$\223"
+	.ascii	"4p\322O\376\266\342<\361\302\357\246\302\215\311\007\n\250\377"
+	.ascii	"\332?/\212L\310\331\222\342\341p\036\234z\f\240\252\032\276W"
+	.ascii	"\341X\340\020\005\347\254\017]`\037i\212\374\315\022iR&\031\362"
+	.ascii	"\001\310\001\r\002?\224\267\215x\031\345\375\005I|i\200p@\201"
+	.ascii	"M\003R\326*}@T9\363\255\314\353~\272\377\356G\373\325\376\265"
+	.ascii	"\377\315\017\347\237s!\0271\021\243\273\337\303\375n\037h\205"
+	.ascii	"\233\236n_w\273MS'\227\333\357p?\007t\002\213\017\177\324\226"
+	.ascii	"\216\177\324\316\263>k{}\326\n\315\361\271\202:\216P\177r\266"
+	.ascii	"\314\020\364\024\344\31799\237+\023\312*\366+{9\230\351!\317"
+	.ascii	"<\355\227\373=5\320\304a\221\221K\303<\035\356x\366zT\320\223"
+	.ascii	"g\355\004\271\300\202le\304\340\325ZA\b\342q\262\277s\035\226"
+	.ascii	"\250\350\220\203\214b\327Q\355*\303\305\fV\360\346\222\226\247"
+	.ascii	"\335\337\331\337p;N\216\203\214b\227\262\206\005\331\243S.\t"
+	.ascii	"\336,\376N<\377\266+\334\254/\367\004\t\201\274\230\335\334\323"
+	.ascii	"\311\332\025\336\344\247\335\315\331n\303\343\334m\205N\205\344"
+	.ascii	"\274-\375\234'\277:\246\254V\214pY\232\351\325\nF\025\274\371"
+	.ascii	"zT\203\013\216\007DR\216mx\265*\205Ly\332}\263\365\212\004#\001"
+	.ascii	"'\355\016/\202,k]\036 S\013\241h\326J\366e\331@\360f\215\262"
+	.ascii	"\247+\337&=Z\bE\243\262\202\001\371\2424[\272\271\013\004o\036"
+	.ascii	"\261\223\rO\347\335\233\235M\3723\021\216Tk\nr\226\265*\231\326"
+	.ascii	")xs\225\037q\336\f\236x\336\334t\227\207+\305\324\247\261I\272"
+	.ascii	"\321\253\265:\365\nO/,\"\n\002O\363\327\234\356\213\302\270."
+	.ascii	",r{\0130b[N\004\204\002#\246\345\301\026`\304\306\016\034\263"
+	.ascii	"K\362\37190-\277b\255U\030\206d\363\007#\311\347\3020\314\353"
+	.ascii	"\207B\217\353\355g\300L\340\337\215.rf{`\304Lx\377\236\274\364"
+	.ascii	"\270\f\303\272~\350\017\311>w;K\t;2\003\241j\255\313_ab_\364"
+	.ascii	"\273\273fw\313v\2232\b\377\332\363\275/U\263\0373C\272\206\377"
+	.ascii	"\225\2569\337R6i\r\310\346\332\277\275h\315\020\0215d{\203P6"
+	.ascii	"5\207J\324\215\2451{\257\367\275\245\303d\227\374\257]\2367\333"
+	.ascii	"\315W\336&\360B[\301Z\273\b\330\023J\221>\202\265\326\217\021"
+	.ascii	"\341\274i6\213\2723\224\r\315\334\002Z\236\221u"
+	.string	"\207\331_\277\251\322\342\272\370\207]:\367A\254\326\2721\272j5\272\350\376\365\221^\216\335}$\336\276\207\347)\260\037\263\0320\300\377b\240\225\312\306\214\334\327L\b\211g\344\276e\266\027\346r\364\341\274h\344C\233\202w!\220\200\377\225\243\237\205\354\330\\k\300R/\317\004\177y\267\253\340\027\215\357N\020\305\377\332\242Ws-\020\313\025 \330\3117w\267\007Q#\267\227W\371\320\256\362\310\035f\367\277\332)\354\022y\225\020y\253N\367\245\"\362N\021y\223\020y\245^\367EB\344\265\200\310[\001\221\367\310\b^#C\336\"\277\373\022\021\301;D\004/\005D^!D\336 D\336(\"/\220\243}\177\\\355\353\343k\337\036G\373B]\355\313\343k\337\035\177\363\325\361\263\037\201\303\371\346 \362\342 \362>\031\361\336@ym\240\2745P^'\224\267\t\345eByi$\361.%\361\316H\342\025"
+	.string	"\211W\006\312\253\204\304\033\003\345\205\201\304\373\002\345u\201\304\033"
+	.string	"\312\333\342\210\2678\344\005`\310\313b\310\273\002\345U\201\362\246@yQ\240\274'P^\023(o\t\224\227\004\312;\"\004\257\210!/q\310\2334\344EBy\217P\336\020(\357\020\3455ByQ\224W\210\362\026\241\274D(o\020\345\005\242\274'\312k\242\274\001gq5\314U\264\237.n\315\334e\234\257\273\0202\243\335\221\3100W\001]\310 3{\203*\267\271\n\326\300\312'\3731WW\177\334\372\274h\224\373\236\317\ti\330\363O\2113\303\026\372\262e\317\371#\347RS\245\331\315h\001z\251\273-9v\344\276\031\375\023\2244\333:\nwhlw\274\252\230\251\273<\372\372\n\351h\001\232\355$e8B\246\227w"
+	.string	"\007\320/:F\313\240\222VQj\031j\266p\304\260B\251q\300\350\0300l\335\r\r\0020\372n.\372\305\013[\347\301\314\035\027}\036Zt"
+	.string	"\315\224\344kb\027\266\270-\214\311\244V^\250Es[\221\252\2277"
+	.string	"\257h\026\r@\027\263\244Z\312\230\005\251-i\227.\347\315b\023\215\365h"
+	.string	"|4\213\037\275\202\354G\037ME\377H\321*\372\364\203\242S\250\020\006\005\230\217\276\332\211\366a\242O\364\351\247D\233"
+	.string	"\263\245Dw\002]\211V\252\023A\247\356\345\365 \321=\354|\250\233\363\245\220RYwE\214h\022}\302!\317\034\275l)}\341.bF\264\022\237\023#uR\023[D\357\246(\244a\222\315\265\313Z\330\204\251t\205\264\254\354\274)\242\211\306v4\221G'A5R?\311\267\007\325G;j\250\020}4\354\020|\205\261\224\260v\316\233CC<\372jF\315\003m#a\243L\034\006&$\264\243\277V\324;Z\0072\316\310}\313\273/vr\220F\262\272[D\324Em\022B\236\t6Q\277\rI\203\251l1\211\251\265\253\200\335\264\005\236\222\222\2719\244\0136S\331\0330\217\331zx\24035g&\235\335e\027:\232*M\017\263\3510\247\243\377\346Ec\237\255\243\331\016\322\314Q\217\243"
+	.ascii	"\273\251l\214\223g\277(;\273\323ce\332\360\371\005\373\254Q\356"
+	.ascii	"\345\311\340\243o\236\363u\270+MS\202\216\215|L_@\223\246Is\336"
+	.ascii	"|\035\256\351\232`\255\306UVY"
+	.string	"M\206UVYR\035h\2750\322\332\340I\226\025\326\231\245%\245\365\344\352\254\262\312j\362\003naaMUIe5\tfiIyp\325\344\364\340\252\211\224\025\223%Z\033LYa\241L\226DMim`\245$\370\301\267\016\302\367\006\025\016\0335\f\030@IS\222\226\006\034\364V5E\020\304\201('-+\f\260\246\264\234\232,\231b\342T\205\225\345\324T\334+\016\254\260\234\264\256\256\260\234\204J\343\177\265SX(c\037Yx\202\004</l\316V\332\274I+z\362\253\025\f\217\317\371\361\320\270o\025\340/\331\016\312!:\256\203b\b\312\036\224CP\016\235P\202\200\322\327\325\003\216^?i\224>\202p4\213:\270\271\247^>\251\327P\214\334S\263\210\223\347\006\3031\334\327\215>\302q\356\330`<~\276\362r\260\321*\340N\324aLBX\200F\210\312\006\305Q\265\224\007:Q\030B."
+	.ascii	"\207\364\355\376\200\033\227\244\333\311hG\322Rvk0\016K\207k"
+	.ascii	"\227\334\366\225\347\324:\272F\267\037$\236\246\246\321Nm\n\212"
+	.ascii	"\"C\026:+i\336\226kL\335\324G\236Q\322L}\302!\361\2224\2156\005"
+	.ascii	"!\361\214fs\265\216\356\356\317\277\347\301>y\226{x#\f\221)y"
+	.ascii	"\253\263eO\032\345HUO\265\022\252\256j3\210\251\376\331\031A"
+	.ascii	"\bo//I\273-/W\317\3178\246$\023\303\"#g\246W\271\352\322\236"
+	.ascii	"\312\236\324k\t\270YD\252-\350$}$-\325\246\237$_\005}\244-8r"
+	.ascii	"[\352"
+	.string	"%\247\202\206q\274[\352u\244K\324\025\305\301!a>\264T\re\f\016\351\327=\212\314\030g\307H\027i#}\"]\344\f\032Wg\216H\377nH\023\351\013J\362\031?\344\244\240\207\364\221^\2044\005\r\204K\362\265\236\273+\365i\2243H\013\241\001HGu\220\376\271A\2329\006\372\247\304\321\311Q\245\r\017\030\325@x\315MT\227\250;;\335\246\311\273\245Q\b"
+	.string	"\322Fe\001\201\216\250\201$E\231R\206FDD$I\222\264\006q\005\304 \005\231,;\021@-t\212FD\222$\2514\007\340G\370Bo\330*\274\237\035'\361\234jz\212\f\217\250\257S)\027J\267\246g\341if\316G_e\034\237\322\245:\024Lv3\220\032@\214\031\235\355\0358{\224\271\253\321\207Rg\303\033'\003b%rNF)\225@g)>POb\330\372\304)\265\275\335\267p7s\032l,\305\034R-7n\212\325p~\354* \bMK\276L\326m\323z\366\223G\3575\306$\031W7\013\302\233\221\372\200\234\212<}k6\355"
+	.ascii	"yM\271\216\201\355\273\027\270\304a5\201]\353Cq\330\324\363\231"
+	.ascii	"\206\006`\032\235%\007\030\276\242\020\237)I\221\275<\f\226\302"
+	.ascii	"\306\371\335\301\233\235q\276y\214\266\227\004c(\322\227\016"
+	.ascii	"9\330\0203\177\\\360\346\237\346\225\330\374\032\3562o\303l@"
+	.ascii	"\001\366%\354\013Y\004\341\032\353\213\035\222\357\237\224Q\227"
+	.ascii	"\201\001\244\310\357u\206FK\332\227\232 \374.\023,M%;*7e\201"
+	.ascii	"\001\270k\200,Jwdx\340\3558\335:t\244\205\272\n\257\003\377\243"
+	.ascii	"\327/\221\303]U\213\216\031s\345UZ\242v\237\355\243:g\252\344"
+	.ascii	"\254\375\325N\021dTcb\246Q\\Vbz\022@)\313\276c\301\342~P\300"
+	.ascii	"\235\003{d)3\021"
+	.string	"x\353A\315d\241G\262l\020\336\212-w\306\211\264P\315Y}s\314\354\017p\211@\266o=\260\021\356\252\313\206\371c\310W\216\264=5\264\340\017\253!\251\367\211O\0257I\370=\360\201\333\360\332\205\351\216-\276\026J\322g\304d?\345\351X\f\006#\224SR8\036J6\252\243f`4.\321\302\334\254\024\232\n\364\027\344Y\336\0046\236\342\031\f\335\231\363\017\243F\037\336\360\201\001\340\003F\224Q\r\035\006\306\371&\306\270(\230\302N-\341\264\200a\021\004\264\350G\n\\G\367\202\256\240_\243\016\021\252\341P\242\326wa\230\303\f\320\250\307K9n\360|\340\311\236\354\365U&\bG\n\333R\215\252\3220\242s\320\347\031+\356\225u\201.\352U\223\340U\353\3625cP\221\315\227Gs\bht:M\334\243~m\243\221B;\227\"\034\205\214\316\325\245\372\217\233z\311\021\217\361\241\344H\330C"
+	.ascii	"\f\2560$|\202\313\031\3523hh<\003\n\266\260I\267\f\215\244h\356"
+	.ascii	"\341l\340\240\026\320\020\301\3032D\351\026\243\035d\005\027"
+	.ascii	"\255\237(E6vO\336xPO6\312Z(\231\321\227\347C^\r\356;eF\005\002"
+	.ascii	"!\323\350\027O\232\337\306I\214M1qi\257 \246n\362\364n93\344"
+	.ascii	"W\224\246h\372\374\212J\207\242h4\362\321\347\217?%9\357\205"
+	.ascii	"\306\250\364\027!\355[\"\321\312\0209\250\311\261\330j\232\341"
+	.ascii	"w\004r\330\242\024u\237\032"
+	.text
+	.section	.gnu.lto_udpThread.82.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`~\002\365\024"
+	.string	"\306\345\211I\260TRc\210\242 J\236\364\227\361\226\347\223\2236\310\253\345\327e\\\275\"\017\322\004\232:\207j!\226\365\t\355\260\205\261 \346\323\237\005a\315&\364\007\356\037>\b\034\f\035\314Oy\327\2741\3701?c\357-\267\224)\005r"
+	.string	"t"
+	.string	"r"
+	.string	">\315\333\337\270\324\316\006;\020dQT^\t\005\345Xro\360t\360\005\310[\363+\344mu2i[w/I;\232\225\356\374J\374\372\312\372\361^\312~A\303S\024\277\037J\376\220n\001@\035}T\201B\2729V\230\212j\361\"Q\322X\205W>P~@\264~\370\0042\254~\204d\375\216NK\013\367^S\337\257\350>\271m%\333665\021<\247\020\225\212\365\313\210\020\253\232\022U\270\374\302G`\352Q1\313\214\212\004\220\020\205%\271T\314\016\362hm\262\317b4E\303\025h_x\227\224\372'\032\244\206Vh\305\\\335;4\326\344\002\261[0.\374\355\235?4\3129\003&x\034\273\013\315e\362\210L+'\337\221{\257\313\2551\230\267\263\361+\344\371\002\346\364T\006\273\200{\201T<\356\r6\b\343\275\367\222\023\212^.l"
+	.string	"\372\252\367\270\261l\031\307F\357\363\f\250\362,#B! .)\031k\223\377\212\265\004\3542+\320B7\027YV\334\220\b\020e\342\024\342RY/\274L\nu\220\347\220\027\272\275\310W]\353\246`H\326w\210\320\271\335\310\333W]\207\316\274\267w\237o\365\253\021\376\323\255{t\364\276[_G\242\004\275\257\2542LA5ni\251\355\330f5\232\r\027\242\206\247\246S\331\271!|\200y\340\200\202\204\332\313"
+	.string	"Z\216V\033\215\363\222\241f\206\346\314\331@\340h\271s'\207\246s\342\340z\316\227\231o<6\334\231\273\335p'\312}\005\236\257Qa1z\365\3072\033\006\250\357Ec3\370\217\r\216\271\345`\236\230Y`\323\201\022k\024\243\312\332d\037\362\365B\021\237\353]>\376\223=\334\334\324\223\244\036\035\263,\305\0370 `\002!\202\214\017rrv\344\217hw\262\f\212\221\354\257\200\301*\266]P\362\334\214\0161\245\324\220\344\235\302\236\212\035\006H\204\343\323r4\006f\003\364\272\025e7\344"
+	.string	"\r\222@\\r~\340\236\346\333\243\255\372\027\n\027Q\027E\214\004\315\301\020\331!\2729\306B\212A\003&k\234}`c\2745\246\311"
+	.ascii	"\341 \215\330&/\257f\256\031\257\353\221\001"
+	.text
+	.section	.gnu.lto_tcpThread.83.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\302\001]\020"
+	.string	"\366\233jI\260VU:\322\226\3007\247N\320h\240\371\330\271\254\353\256\340d\211qz\235\212\203\340o\264rF\375gz\337\376}N\340=d\363\027\326\0324\337\240\344?\367KlK\205-?\024\334\303\337~\202\027\316\317\315n\262eJ\001S"
+	.string	"P"
+	.string	"Z"
+	.ascii	"9\222\316\213\0228\232\324:R\217G0\372,\335\300\350S\2720\270"
+	.ascii	"\262OP\256\314\227DX\f\341\021g\237 \3516\023\343$\336@\325\020"
+	.ascii	"P\317s\276'\304\332\2024h.\237\363\224\233 7\216\360\2104_\322"
+	.ascii	"\204Z\253\027'\346\356\321m\177\260\235\301\276/s\355\0211{\234"
+	.ascii	"Q59\363\351G\357\200P\215/\250.\221=\316V\266\260\257\262\031"
+	.ascii	"\002\262\324\331\273\276iw;\273/)R\353\314\257\250\372\314\036"
+	.ascii	"\031\266e\266\311\2469\225\357q\374s\002\265\352px\324:20-}\336"
+	.ascii	"\306w2\373'\301h\023\356\020>\351\325%Z-\317Io\312\214.) \261"
+	.ascii	"\355\220\375\235\347\220\361a\270\345\332\343>}\327\350\363\022"
+	.ascii	"\200\n\332\376|B\241\004\004YbjLB\004\340\t\365\244\216\217\233"
+	.ascii	"(}\n\252\231X\341\223\244EHi\335\343:\214\334\324\324j\t\277"
+	.ascii	"_\221\255VZ\212-\002\306\006$FAa\271\264P\254\260\005\003\261"
+	.ascii	"\362\262\212\r\360\003\017*\016\032D\200\300J\025\bc!\013\364"
+	.ascii	"*ua\305\002\006\032k\271`a\214\272\260\204-t\005\203\241)\224"
+	.ascii	"_/-\030\215\275^0j\032\353\245\216^\326\360\315\240\311\232\005"
+	.ascii	"\244X\177\207\006{\301y\033\254\372\344P\"QA\301\247\003) \300"
+	.ascii	"\002\231\261\271\003\"\344\354\233/\030\376\036\351Vr\022\352"
+	.ascii	"\033,\343\266\032\215\261\2033B\230\017mK\230\254\362W1\304\356"
+	.ascii	"c\001tC\302\bb\271\no\"\201J\2440nr\237\314l\002\376\274\001"
+	.ascii	"M\367\371bR\304r\203\242\237\336\331N\200y\013\217%t\351\023"
+	.ascii	"-\007~\371%\210'"
+	.text
+	.section	.gnu.lto_systemInit.84.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`R\006\225!"
+	.string	"\206\367\312I\200XN:t.l\314\221N\357\202\237\3706]\265\267f\205Q\276;\031p\233y\262F\212'gw|\333\240bA\211\030Q\225\252\226iZ\314a\031\317\341\333w\032\363\020Q`\237c :\212/\370\317/\361D\332\336I\006\251"
+	.string	"\263"
+	.string	"\274"
+	.ascii	"S\344\336\262\235\353V\032\355\355\352\376.\337\034\335=\035"
+	.ascii	"\234\233\331\266\267}\005 \340\256j\200M\370\222\363U\035]f3"
+	.ascii	"\325\300n\366w\377g\315K\343\204n\344e\370f\275\206\032\261P"
+	.ascii	"4/(n9\347\236\233\375Co\372\276s\336\334\275w\336l\334M\346\312"
+	.ascii	"\257\374%O\254\224\304\345\234\177\327\353\37076h\315i\356\256"
+	.ascii	"\305\375#\223\306\337\264\315\026\020,\031\026\355\232/\261b"
+	.ascii	"X\331\263\315#/Yew}w\024\350\2644\t\220\244\332]\034c?\273]\221"
+	.ascii	"\234\262\266\246B\316\271-2\351"
+	.string	"\342\315{wGuw\232n3J\277\362Z\262X0\262G\332+\304U\265\266\274um]\232\354\026\330\f\033r\314\256X!B\217GIsl\bf\f\271\267\253{\376[\002I\030*\213\246\021\330>\207\363\312\253\031M9\225\016\037\214\214N\021GW\210\213H\317v\217 1u\215m\245\214\235\214XZ>\322\331O\273\023\244\276\217\006\006\203\347M\002`\340\244l]\347\bY\342\330>\023\245n\237/\031v\204\233K\350Q\003\317\315n&\"\3255vT\216{\253\261W>\t\024\232\263\324\221\375#GR\354\373\270\331OP\366\310\233}\250\363\246\317\273SD\331#\333Wu\215\235Sc9@.d\366\310\036\025\235{\2455\342\025-\320\343\241\274\340\322\361y\243\365\350+\321\315]\341.{\244N\220\345\220\305\271W>\016\277\b\360\225\205\036\037\306\243\205e\270\341\fq\005\331\2367\032\217\367\032\034\246\261"
+	.string	"L\316\307#\261\r\364x\035<7\257\374\033\356r{\031|\003\007\356\352\362\302;\354\2218j4\226aa[P\0010\306\210\351\201\036\337\002\200Z\3262\006[\ro'\211%\367\306\2737\273O\312\316\265\003\373\373\225\030\f\207\341 ^0Y\227\267a1<\206\3110\031.\202\313\354\221\274;\304eu\215\275\223\314roN\322\312N,l\\\360\031z<\221\346\307\026\013\323\276JIO\252\020\205*,\252\300\265X\240o\222\032\244i\272\32444\341\363\200A\204o}\352\320\004\345\301\267\016\233\206\t\032(\375I\177\322\241 \240\033U\270\244\022\217\234\202\253\001'\"\261(A3P\211\252*\364-\005\211E\302\025\230\344\364\344\023\256@\241z\341@\247i\272\016\233\210H0\t\327b\212\342\b\235\016*\361"
+	.ascii	"\350G\002\204\244T\300*To\007\323\242\020DF\277U\250\244\002"
+	.ascii	"\327_\323\020\310\364\013\252\305_\352k\242\223P\375\255D\242"
+	.ascii	"\372\343)\363o\016\020g\330\244\356TW\260?\322y\036\033\317n"
+	.ascii	"<\205\253\314hm}\335X\261H\253\242mMK\314\246\227\325\263\372"
+	.ascii	"\227_i\253,\225\n\034\200\202\250AD\351\030C4\"AAqR\230\003\300"
+	.ascii	"\002\221\031\272:\021\320(\b\241D\244$I\226\003\330m%\333\255"
+	.ascii	"\234)\3771-\276\276`\317\n\260\336\325\0201;5\263\212\016\241"
+	.ascii	"\200A\350\035\003(\236\252U\\\215B,\263\335(\331\243?.\356\377"
+	.ascii	"\244d@\035L,\267\022\274\030\347\304n+\036\003l\3408\344\320"
+	.ascii	"G$\376\350\316\341;|\b\300\312<\351\"\355p\260/\237\235\270\212"
+	.ascii	"\317F\025\360\027W\264\317O!\273\t\377\217-\032`o_\27603\020"
+	.ascii	"7Jj\326H\244AC\336$g\224g\206p&\260e\b\344O\261\223+\301\275"
+	.ascii	"\346\250\302\204\261Q3U\270}\314\252}\254\225%\343]\357\244\361"
+	.ascii	"\300\302A\312\334\204\233\305\361|\340\005\244\313\214\227*3"
+	.ascii	"X\201`\022=\2172\301<\273;Pm\374y\225\224\307\334\016hm\362`"
+	.ascii	"\024\3629\001\025\004\230\377I#\205\247Q\366<\bT\036p?3w\251"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_systemReset.85.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"u\n"
+	.string	"\346\222E= \005)\0358\316L\235,\034\216$\320\024r\232\3546\027n\3248\214\224\203o\341Q\207\331!\001O\020`S\277!K\\\342\217\032\253D()\334\031\341\016\360U8\345Q\203\260-S\n2"
+	.string	"3"
+	.string	"4"
+	.string	"?\262\333\006\354\222\344p\273\323\351\270\330\276\310.\333\3473\226\375\215l\204v\333\335)W\356\272\272|+\310aw\255\260\022\223[\336\366\201\355\006\373\021\0018\036\220\3722\242\275\360\030\0163\274\353\030\020\231\t\357\354\226\207\036f\022\210|\3710\2578\251\005\260\255\n\260g/\225*\366\005V\246\330W\353\325\017iN\372\330\313\315V\240~\206wi\237P\244\020\371\262O{\315\227R\251\274w\227!\224Ql\277\362\374\231\323\254\374\026\263@=\354\235\017z\357F="
+	.string	">4g\203F\030?\361\223\300`}\243\330\022M\004F\225 (\036&\346\370\245\302\32385T'\326D\205\342,\221\fn|\341\034A0\234\"\220\357\221*\334\266\270\210\325ns\3051\005\025"
+	.ascii	"{\345\313Y\033\007k\017\324l\234\025A\300\0174\246\025\013 R"
+	.ascii	"\247ai\f\346\201\305O%wj\007\301\220\357*+\345i\213k\242\256"
+	.ascii	"\020\310\313\020\230\001("
+	.text
+	.section	.gnu.lto_systemResetToBootloader.86.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\345\n"
+	.string	"\246\023I@ \005)\035"
+	.string	"<\312TY\200\215\300\251\020\250,zc\350\207\207\241H9p\330\023k\267\350F\237k\233A\020\330\352\327\207l\262&\306R\260\001&U\b\332\211Q\345\001\037\205\331\372!l\313\224\0026"
+	.string	"6"
+	.string	"6"
+	.string	"\241\365\241\331\374&\240V\224\334\201Z\353"
+	.string	"\310\330\276\310.\233\300e0\365<?'3\\\255u\312\227\273\276.\337\013z\250\265za)*\267\274m\004\333\022\366)\002\267\221\315\371\200&"
+	.string	"h}\034\321n\370\r\210\035\336\205\024\230\314\205wvKd\0173\211D\276\374\232_\304j\001[]\003\266\354\265\322\305>A\225-\366\327\373\365\003\031,\365\264o\317i\037\253\341l\006\353ox\227\366\207\"\225\310\227\375\331w\300\224J\345\275\273\f\255\214b3_y~\316uV~\214Yt\017{\347S\357\335h@V\bA\216\217v\214\224BP\323\b\212`\205\006\013\034\305\226xJ0\2524a\212\260\230#\230\n\277qz\250>\326D\205\342,\221L?\300p\216\224\206S\004\362=Z\206\333\030\001\025"
+	.ascii	"{\345\313Y\033\007k\017\324l\234\025A\300\0174\246\025\013 R"
+	.ascii	"\247ai\f\346\201\305O%wj\007\301\220\357*+\345i\213k\242\256"
+	.ascii	"\020\310\313\020\230\001("
+	.text
+	.section	.gnu.lto_ledInit.87.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\245\t"
+	.string	"\026\322D=\020%)\035"
+	.string	"O\300\004\233\341-`\365R\310\n\275\b\b\260\244\252\232\206\244C\216,\376\377\264\004\342x\031\255\230)@\024\245\360\267]r\254F\035+\003\251R/@\223\267=i{\247\024/"
+	.string	"1"
+	.string	"5"
+	.string	"\006\244w\246\243H\357L\332B/[\3665A(8\242\335\255\224\345\344'\351_\346\0015\033\355\263D\261\273\2365\233\312Mo\373\300\266\206m\233\223\256\330\037\355\356\232\336l\2320t \334nJ"
+	.string	""
+	.string	"\233\353t\\l\377d{7\023\237\366_\016C>f\344\004\2737\234\234\335r\301\325\364\316\345\003_XG\020\f\353\251\334\217\226\336\314\362\311\221\320\022\227\246O#\332\n\237\2319\342\035\210\351\304\002\341\235\035\"2_s\312\204\322\214\352\231;<?;\213\354\222\026\366<o\214\311T\031\257\257\003C\300\016\033\017\r\f\022\020/\257"
+	.string	"\026\343\220\201\025\257o%\316\306\326(\016\330\345\255.T\254:~\260\2605VY\254\345Q]\241X\275\224\301\217\013"
+	.ascii	"z\022\266\227|2\246\243\3170\234)\360\264\267\322<]\360\373V"
+	.ascii	"S\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_timerInit.88.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"%\007"
+	.string	"2\21515Po\322\030\200<\374\332\305l*\r\nO\210\0326\226\3056\235;@\f\021\304\271g\333CZd\244\255q\235\231\346\236G\305\257\002\024\315\364\325\0315i{\313\024C\b\247\025\3428\310\nd\315\206\201?p\201\201\323\211\263z\220\236\031C\226\007\024?2\"\302\315\027D%\343\274.\0315\333*f\337\250\263B\272x\030g\334Z\"\361\007J21\202R\024\001\032\261@\251\257\260p\252\275\311x\331.\305TZw\372-s\357\343\025\263o\364\317\340\244%\323.\307\213\313\222(\024\221_5c\257\242[\310\352I\313\206\t\313\356\306\007\242\230:l\325\021\025\320D\231:"
+	.string	"\205\335\335i\242\016\375\351O\360'\374\036\001\n"
+	.ascii	"{\3117c\332\363\206\315\241\177x\256\342\302H\026,~\031\002\\"
+	.ascii	"\272E;\237"
+	.text
+	.section	.gnu.lto_timerStart.89.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \312U\005"
+	.string	"\202\211#,pU\323\001\232\240\001\336\270\3023\273b\261q\322\376-\025\310\206m>%f\247h\326\251O\207\227\007\034p|`\377\306H\255\335;\245\266\250EC\301P\355r\314JS\310\243\302\324\232\022\245&g\221k\252\226eS%p/\277i\")6l\004\260A.J\214}\301\312\317\216\b\201\207\302]\313@\300\202\006\237\215\355K\336l\321A\315\336\023V:\243\335U\231\371\366\270\371\347\274\320y\334#!\261\273\216\235w\271\345m\037lS\266\261\t"
+	.ascii	"{\3117\323b\237\031\f|\277k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failureMode.90.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"e\n"
+	.string	"\206SIA \345*\035"
+	.string	",\004\002\360"
+	.string	";\316\204\262#+\301\302\246@\r"
+	.string	"\234|\001W\375#\374\377\246\r{1\200p\313-\326\232`*\002\316\340\226T\004Orc\203\001\342*L2@\356\212\032!{\247\0242"
+	.string	"6"
+	.string	"5"
+	.string	"\357\270'p\336\231\264\013\274\244\355\001\270Pl\020\354n\245/\246\223<G'\351\217b\347XN?\260\330g\247\264\273\236/\330\312\335\335v\311\266\206\355[\223\272\330\357\\\006jLg\366k\377\344\030RN\340\300\256\312\002\005{\353\004\300\330>\310\376h\244O\3731\227!_3\261\301\256\354&\300n\331\340\352y\347=\304\tv\307\2473\237\2433\333\021\262ik9\267\273K\315\231\223\276<\315\352\200\266\333\372k\304\323\232Xxg\223\224\314\277\354\235P\226?\363\217-6`g\002\273d\005\376\200\n\236H$\332\bA\321\"\034W\037(SGF\310\017\034\244\221\203\004\004\370!\204\240\230\342|\372*0(.\252*\364\030M\252\n\2022\245\352i\024\251\237g1$\034\253J\024\307\n\262\003\016"
+	.string	"2\311\361K.@'&!\034\204\b\"\312"
+	.ascii	"! Zn\261V\243\203{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.91.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"u\013"
+	.string	"\006\325QG\360\312j:"
+	.string	"6<\311\365\322\343\205\341\3202\256:\004\r=R\036\247\324\231\335\303,\340\366\315.9B\311\3267a\243\351u\331X\214^\342eWs\313\3161|\214h\255\353\253\027\371k\257_\226\026:f\255\355-S8"
+	.string	"<"
+	.string	"?"
+	.string	"\266\356s\364\353\341\3162\005\207;\216'8\334\375\327\300'\2559\302\215\r\004\016\335}\253\001.\231\226gn\300\037S\006c\332\371\350\356SS&\200_\371\177\305\377\362\177\2060Z\013\374\314uw\277\316~\2561S.\224\340B\312\206n"
+	.string	"\037<\364\255\233p\340?\203~/"
+	.string	"\211\236\247`\301\326\335\243\223x\270\363hHL\177^\300\fJ\256\305\374\323M@B\337\352\236F\327\365\354\305V8^R\024\307\013:\233\271\256\263\243(\270\311\324\231w(\255\354\200\037\270\"h\33516_\236\230\351\202\273\377\005\206\262y[Sa\017!\240\025\006`h\332\341?\003\207"
+	.string	"-\254H$Z\tA\321\004\245b=F\021e]\\\237\neCDJ6\034_\252\3247\202A\262^\"\b\371\205\255p\004}\203\205\244\221\321\301\001z\022!(\256\270\237\274\322I\211\351\222a\313\370\221\227\225\n\r"
+	.ascii	"\260s@\231\344\354%\237\214\351\3703l\234\225\2256\343\302Z\013"
+	.ascii	"c\017U#\205^H\020f,\256I\006"
+	.text
+	.section	.gnu.lto_nanos64_real.92.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\276\0015\020"
+	.string	"\206\036lF\360\262&\035@\243\244\277z\307\326R|\272\237\257\266\201\"\2158\033\2647\337\370e\230R\266\3329\033P\210{\375\032kZ\231\212\274\354\225\256\243\275?\317\272\240\r\300C\315\336\2044\033\273nk\333\244\221\275\245L)W"
+	.string	"Q"
+	.string	"W"
+	.string	"^\361i.!"
+	.string	"*\231=\306\312?\225\257\0273\332IA\023\264\033c\340\321\035\367\370E\371/\016c\305,$\037\212\231m\207\304\b\031C\273_\347\357#\333#\367"
+	.ascii	"\333\243\2368\313\223\305?\355\361F\307\f\231L\313S$aw\2352\231"
+	.ascii	"\231[o\273\200\355\tvR\b\262\003\267S@\344eN\211\320\026\013"
+	.ascii	"\230\365\030i\341\023DhS\210\375\265\244\232\260\017Wkl\247Q"
+	.ascii	"0}\202i\023L\2274M\202\351\021Ls\232\026\301\364\006\323Q\323"
+	.ascii	"\020\246\025\246S\323\027\311\320\003C\343B\303\217]\230\332"
+	.ascii	"\220\365\211=+\376\375\016\234\212\200tZ>\215\327P\361U<z\365"
+	.ascii	"\312\313\036\375\327\366(R\0076\263\250\252\233\336\243\201\032"
+	.ascii	"Uw\240\234\306\202:\340g\206\343>ptv\r!\304\256\013\201T\325"
+	.ascii	"{7/\232\232@\274 \273\303i-nw\033\\\001\374\314\\\262\346\343"
+	.ascii	"\354\220\020\227\3179\355\305\005.\331\260@A\202\007\f8\250D"
+	.ascii	"Rb\351\023\225\005\f\025.t\261\025\n\314$\326y`\231\264\272\023"
+	.ascii	"XJ\247J\331\365a\005\353b.\027\254+}{\270Z\203\322\224\213\276"
+	.ascii	"X\005\356\226\210\020\224\2235\237\024\245\367x\230t\323\223"
+	.ascii	"F\036\217\305K\326\\\322\221\232HZR\222\0346X<$\375\r\033NG\""
+	.ascii	"\r\" p\002!2\273\r`b\366\347\2236-\265\r\243\220\366\205e\251"
+	.ascii	"\n\033F \207\335V\b\013Ys\215HAd\261\t\333m\357q\025>\"T\264"
+	.ascii	"\373\214\337]\307vw\335a\336\270ok\231E=F*{\213\f\330I\332\334"
+	.ascii	"rK\\ j\305$t2"
+	.text
+	.section	.gnu.lto_micros64_real.93.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\353\001%\021"
+	.string	"& rF\340\362$\035H\325(\004$@\2378\332Bjw2\t1x%)-?x%\030\006v\224\264^\361\241\t)i\240)\020\236\260\200\3079z\2703\324\202>\370jxF\3112\036c\245{\304\326\032ido)S\n["
+	.string	"W"
+	.string	"_"
+	.string	"3\025\367~;\307\227\271\305`\306\202t\0309\367p\276\235\317j\211\250(j\327G\301\243\271\355\361\013\300w\361\0279\326!\340\245"
+	.ascii	"\322\226\210D(M\355z\234\275\243h\217\333O\264GEq\235\247\216"
+	.ascii	"\177\331\341\314)H\354g\347\251\232\260\273\316\330\017\320\255"
+	.ascii	"\267\215\3006\005;o\002SR[>\351\262\232-\266\340\266\315M>f\225"
+	.ascii	"\020\272c\001N;P\216<!R\233Clo'\365\204}\270*d;m\002\323%0M\002"
+	.ascii	"\323#0\335\202i\226\246W0\275iZ\005\323\032LG\230\206\232V\230"
+	.ascii	"NM\377$\303SOP\013\r:v{>\"\013\025\003L25Vz\034*\3354\245\211"
+	.ascii	"\206/\3433p\374\242G\303\324\344c\217~\215\366\250\322+\r!EM"
+	.ascii	"\325\202xn|\004\213\022<H\034\315l\254\335\362}1@\354\302\f@"
+	.ascii	"\215\372\316\210'?\253B\2159b.\223Q=\320CS\025H\027ew\270lf\333"
+	.ascii	"\335\b\327\001CH\260\374\374#\250f\331\360\300A\003\t\0208\254"
+	.ascii	"\004\260y\245_V,`\250p\201{\301\304\270\\^\234\007\031\227\031"
+	.ascii	"\356\305e\303\255\250\230\346\003\214\213{\321\320\270\270\226"
+	.ascii	"\267\207\253B&\252\002S\036\343\300]\023-QI\371\271DM\364\335"
+	.ascii	"\023\354\007\320\356:\001\211\226h2uF#\252)\211j>\272\025-\335"
+	.ascii	"tDS\232X\332Z)K\013\024\t% p\002\241\2629\017`b\366\347\223\231"
+	.ascii	"\336k\206\005\211}\357\331\337\375h\276\035\006\243y\274(\252"
+	.ascii	"\225w\307^\t\r\321\032\273\312,.\356{\003\307}\034:b\340G\303"
+	.ascii	"\223\b/\031\030\3231\206y\304\001\f\313\007jL\304\272Dd(N\022"
+	.ascii	"\347\264[Y\002\321\025S\273\310"
+	.text
+	.section	.gnu.lto_millis64_real.94.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\353\001\035\021"
+	.string	"f\240rF\340\324$\035$\3128\316{\0016\022\371\024f\216\236\307\370=\0130\260\031\025\214\351D\354\241\324\225\212\264H\031\024\336\\\216\f\200"
+	.string	"-J\366 \221\264\037w\275\207\240\242\007Iv\202\b\207bk\255\221F\366\2262\245\\"
+	.string	"V"
+	.string	"a"
+	.string	"\361\251\305\275\337\346\361gn1@zQ:\r\236{;\337.h\325\264\")j7H\301\243\271\355\361\013\300\227\361\031<\356)\340\251\030\322\232b\210`\232\332\3658{_\321\036\267\253h\217\232\342=\317\036\377\263\303'\037CdB>O\325\204\335u\312\204\206n\275\355\004\266)\330\251\023[~\3513\234M\266\340v\216N^\346\226\020\352\343\001H\204\254 \231H\"\265\271\304\366|RQ\330\207\273\273\326\"\333\351\024\230F\201\351\023\230v\301t\013\246Y\232^\301\364\246i\025Lk0\035a\032jZa:5}\225\fJ\200\210\2224\350\330\005\372\230l\22059V\372\036*\335\224\005\n\207o\3437v|\026\217\236\301\311\313\036}\034\355Q\245g2R\212\232\252\021\375\360\370\b\030%\210\220x\361\264cm\230\357\253\001b7v"
+	.ascii	"j\324wG?\371Y\025j\374A\363Y\215*\202\"\232\252G\272(\273\303"
+	.ascii	"g6\333\356F\270\0220R\212\345\347#ySR\001~\331\360\300A\003\t"
+	.ascii	"\0208\270\004\310\201\245e\\,`\250p\201\203\315\320\274b`\234"
+	.ascii	"\207\232\030\033N\346\225\303\271\264\370\346\303\314\213\203"
+	.ascii	"\335\334\274\270\226\267\207\253E)\332\022\323\037\357\300\335"
+	.ascii	"\0230\367\376\250\245\374\214\242)\372\016HL\211\005\234(\212"
+	.ascii	"\246Sw\344RMOT3\322\271h\351\246.e\201bik\245,5\320\304)$ \200"
+	.ascii	"\202\241\2621\017 b\366\347\223\231\336\333\206\r\022\353]\234"
+	.ascii	"#\021\370t\030\334\346\261EQV\356\035{%\024\304i\354\"\363\270"
+	.ascii	"\276\357\215\036\367M\350\350\300\217\205G\"\\2:\246c\f\303\210"
+	.ascii	"\0036,\035(\351Od N\362s\265['\201\344\212\251\025d"
+	.text
+	.section	.gnu.lto_micros64.95.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\254\001\375\017"
+	.string	"\246\335hF\360\224\223\016d\\%\261\253G\216\007\312\302\307\016\225f\243\272\016\016_\247\216v`\341 (\007k\302\t\2656\025G\266dh\031|\360\004\214\253\211\272m,\246\350"
+	.string	"\344\245\353\021\254\252.3\020K\244\221\275\245L)R"
+	.string	"O"
+	.string	"R"
+	.string	"\252k\263\370-s\t`\032\234\345}\202'\266\026\027\n\330\234!\202Kw\332\245\177\3438X\354\025\b_\274d\256\022-4:s\206\235\303\023\310.\265\013\310.\327\305\275\253\347\277\365\310z\345\250\\PWO\2049\247U\345\362r\357m\037\260-\301V\223\232\332\037V\364*\320^`\361-\312%3%2\212\263B\310\324\035;D\351\266\260\037\347\306\330V\207\316\272AR\315I\365'\2527\251\326\244\332#\325\231T\313\250\216Q\275R\255Q}\022.F\212\031\033r\3464\02132\203\310\033\032g}5\333\036\004\342Y]m\357\002Ud+\327\263\007g>\036\357a\233\016\256qMv\231\355\266\212+w] l\027\264q\017\312|4\"v\007\274V_\335\2030_\307wx\276\f\207 \351U\227>)\273\374\002x\255R\032\263\342\324"
+	.string	"\355Y\027\245t\307\001f\200\301\301\002\005\017L2\214H@\224T\326(#\n\026&T\350N)\032L'\247N\205\303\t\251C1\255t#\221K\036RL\335\251T2u\\8\037\347\306\204V\224\332\317\334\206l\363\217\004\314\215\316\220V8m\b\261\030\221\021s\246\f|\226\333\366\263?\002\302r\374\b"
+	.string	"\303\306\266>\256*\242m% P\002\201\250\354b!\341\273\363\311\232\316\221\206\003d\221\200\221\221\207D\207\264\237p\353z\340\270t2>\273\261\212P<<3"
+	.ascii	"\r\001\r\215l-\276F\230\237w\271\362\302\273\263`\210yF\354\r"
+	.ascii	"\307\253\370\234jx\no\207)\346\342\374\tr\311%\b\2376\265\202"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_millis64.96.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\254\001\365\017"
+	.string	"\246\235hE\360t\224\016$\231\221\306\306DlW[\tw\213\244\331H\275\2054\366\300\375\0066\257\036f\365\n\326\3336a\216\240\274\264=\275(\346fD]8\223\252\232\254Oy\377\377\nN\342\372Y\222Fb\311\336R\246\024S"
+	.string	"N"
+	.string	"R"
+	.string	"\252k\267\3705\346\022"
+	.ascii	"ip\225\367\371\225\330\\V3\2579C\004\227\356\264K_\306g\264\330"
+	.ascii	"+\020\256\200\311V-\\l\216\314\031v\016O \273\324. \273\\\025"
+	.ascii	"\367\256\236\377\232G\225\220\026\370b\272r\"\3149\255\340\013"
+	.ascii	"\314\275\267}\300\266\004[O\002\232\332\037X\364\240g/\304\240"
+	.ascii	"\326d\023\227\311\016u\265~L\205\331\241I7\205\3758W\306\266"
+	.ascii	"\372s\325\355\221jN\252;Q\275I\265&\325\034\251\316\244ZFu\214"
+	.ascii	"\352\225j\215\352\227p4'f8\264\346$\021C2}H\0354W}5\333\376\343"
+	.ascii	"\301Y]m\277\372Pd+\227\263\377b\240l\374\206o:\230eVv\231\355"
+	.ascii	"\226\212+wW\337k\327\263q\377\275@\331\210\330\035\020$\365\325"
+	.ascii	"\375\367\362i\274\206\347\273p\b\221\036\274\364E\331\345\027"
+	.ascii	"@\220\324IcVW\017\317^u\320Ia\016f\200\301\301\002\005\017N2"
+	.ascii	"\204J@\214V\326)!\n\026&T\350J*\032H(\245ne\003\212\250K!\261"
+	.ascii	"t!\220G\036TH]i4\"u\\8\037\347\312|\026tZ\224\271\375\370\346"
+	.ascii	"\237\211!1.\030\f\326\264!\304b\256\021s\236\ft\226\333\266\263"
+	.ascii	"O\362\275\214\344\b\300\202\310\2668\016\026\3216% P\002a\252"
+	.ascii	"\254c!\341;\362I\233\316!\206\003h\221\200\221\221\227D\207\264"
+	.ascii	"\235\240u=r\\>Y\233\335XE\b<\234\031@\206\240\206\306\266\026"
+	.ascii	"\271F\270\237o\271\302B\273\253`\310y^\354\r\304\253\340\234"
+	.ascii	"\260\341Ix7L1\021\347_\220\213(Ax\332\324v2"
+	.text
+	.section	.gnu.lto_micros.97.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\365\006"
+	.string	"b\21503`M\323\001\033\013Bz\004\327\n\203\252B\375b<\027\003:+4\n\230mD\035\260\255\322\205\301\232\252\021\267A\204\214l\2100\272Yw-\331[\312\224\002\276L\007\t\006\b\320\302(D\312\202\r\013\024\003\274\304\0078I\256\0340\021ZU\025a\264\355\335j\307\251\244\321\215\257N\323\303Y\321\344\307/m\210\210|v%\240\330(\346\310b3\305\336\260\324\013\373n\265c;\3552\3757\020r\023\317\256\304GeK\336\210\206\355\214\035\371\033\347\310\370r[\206\006\211xp>Pv7(="
+	.string	"\372s\007\200\376\024\343\327\363\362\337qGr\002\222i\330\323R\260\273\316L\233\270\365\266\005lO\266+\002\t"
+	.ascii	"{\311'c\272\364\206\353\006[\\\023\217#r\026\"\017w\305\324N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_millis.98.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\355\006"
+	.string	"bM03`M\323\001\033\013\202\353\021\\gY\312B\375b<\027\003:+4\n\230mD\035\260\255\322\205\301\232\252\021\267A\204\214l\2100\272Yw-\331[\312\224\002\266L\007\t\006\b\320\272(D\312\202\r\013\024\003\264\304\0078I\256\034.\021ZU\025a\264\355\335*\307\251\224Q\215\257N\323\263I\311\344\307/m\210\210|v%\240\320(\346\310b\363\304\336\260\324\013\373n\225c;\3552\3757\320\371\210gW\342\203\262\"\017D\3036\306\216\374\215s`|\271-C\203:\037\033\017\223\335\rJ\017\200\376\334\001\240?\305\370\365\274\374w\334\205\224\220d\032\366\254\024\354\2563\323&n\275m\001\333\223\355\212\t"
+	.ascii	"{\311'c\272\364\206\353\006[\\\023\217#r\026\"\017w\305\324N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_microsleep.99.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\356\001\025\022"
+	.string	"\366b{H\320\362&\035\"N\343\341{W\r\201\275\325\354\017\2102R\237g\350\215\2422\223\254O\310\025"
+	.string	"\315h\217\303j\324\006\242\312M\2129\343qG\022\016u\024#\330\031\326\224\247K\337\243\021\267!\017\2271\256\021\331D\312\224\002g"
+	.string	"b"
+	.string	"d"
+	.ascii	"G\352\340\222]!#\034\273\271\003\016I\036W\256\002>~O\001\037"
+	.ascii	"-\263\247\236\033\3323\335\350Q\022\262\273\241\226\260\246\354"
+	.string	"\021\3744e~\202\230\242E-\331f\217(-\200\016\362\344\367\251n\306\216\023\333\316\307\340\250\310\004\313\246\223\372\335\013\274\370\261\213Z\262\001=G\034\354\256\263f\373p\217\3346\007\3330v\022\b=\017 zR\341\255U\325\346\225\235\233\245\342\354\273<\361NXo\366\221~\223\230\006\301t\214\351\357K\253\246S\323?\231P\3443\202\006\206\336\256O\217\310\362\2109V\\\367\333\377\316,\026\021-\266\375\334\223d\327\341|y~Jl\250p\242\332\3751\360\350\007$\217_\024\226\237\226\247\375\030?\222\005\312\032\262bA\323\331\025\312\207n\351S\234[\3774\215v=tr\210O\3622\276s\221\324\354\031\232|\355\323\027\022;:\363\203\2046\257\362\333\335U\305\331N\036\fU\373\302w5\251T\253R\325\217H\335<\360\232z\036\"Z\366l\242\327\f\322S$y.\236n\003\332\257\357lTjw]"
+	.ascii	"H\001\311\3117\261\264\202\n-\t\020\274,\260\320\022 \343\272"
+	.ascii	"\331\360Y\246\005A\002L\2040\346\232\201\305\304\302\f415\241"
+	.ascii	"\f\354&l\255\370\245\301\005\013c\257\027,d\345\366zs\344\345"
+	.ascii	"\254\250r\224f\234oW\250\001\225.{(\242\342\374k\215\240\233"
+	.ascii	"\023\2507\177w\023\bjJR\025\224\317\024sS\n\337:\300GP#\223\207"
+	.ascii	"\020\001\322\246\020\003\276\026\003! P\002R\346t\007Br\366\317"
+	.ascii	"\0274\274\324\003\263\213/\213h\371\327\344\362\220Rpzj&\013"
+	.ascii	"NX\214l\265\rN\226\020\017\205J\272|\351\220\345%\201g\210DN"
+	.ascii	"\375\006c\264h-\206\235\024\256\030\\\226m7\203\337\207\210`"
+	.ascii	"\2727{\265\364\t"
+	.text
+	.section	.gnu.lto_delayMicroseconds.100.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\025\n"
+	.string	"\006\024H@ \311(\035\300\202\301NC.g\364b\006\360\340\032\b\325\342\235\006\264\261\354"
+	.string	"\210\371\2011m\374oh\003\274\215t\310\202\346\315\024\267Bt\013\013\204?\270; \243\0012Q\023\315\266M\244L)3"
+	.string	"3"
+	.string	"4"
+	.string	"\216\232C\316\0310\207\332\0270\207\356l\007\377X\366\006`%\004 \354n\324\225w\317\316\177\200o\336\352\364\314P\354\256\323[\235\334z\333\r\266+\354o\001\332\356\256\225e\277\365CMk\231\326Lg\246\257\351\310\336@\266k2\233\2601\210\300\305\3667\266C\204\317\323\376\313\001to\215x\333M)\340\332\375:\001'\253j\332Q\301\364\252z\225\202T\316\354\013\370"
+	.string	"\037\360[,bW\336;\364\355\302\034\246n(P\257\271@\365"
+	.string	"\2253\347+\001\203M\t\366wJU\261\037\376lD@<LHpx\024H\246t\310s\221a\201\021K\242\016\016T\212 \036\240\217\030\342H\321\303\361(D\304\305\322h\304\305\315\267W\2265^1\224\246\234IMm\222)\357\231C\242\001\013"
+	.ascii	"0\211\331K>\031\213\013o\006p\361\344\325\225/V\244\313\330\326"
+	.ascii	"j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.101.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\325\007"
+	.string	"R\21777@s\322\001\200\n&\362\242\017.\016u\005\022\375\356s\257\334\363\325d\271\021\265\240\001\337\340\240\261\266,j\"\031\231\314\004,V\327\323\236\363\337\272\257\252%d\313\224\002\035M$ \034,(Pl\002'\215li{\210p\200\210(SEGBE\f\013\322E,u\247\270i\3452L]Dq\\\027C\337\215\035\262*\201\343\362\200\037\3052a\273\301\221VU\003\201\251\346\314\315\353\271\323~\251\204%\255\261\377/d\265n\331\211\211tL#\363\213\364\360\334\225\305\240\264u\2505x\215\234\255U\274\342\271\325Q\320O\362\002\363\177\242\306"
+	.string	"g\232\t>\3160\017|\234\325kk\374\235\334.6!-9\377#4\261\347\364j\263\030\244Z\245\234"
+	.string	"\f\377\233\252\325\210\013\335\266\240mC\333\224\t"
+	.ascii	"0\211\331K>\031\323\267g\2308\373\3422\212\265\032\r\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_delay.102.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`J\001E\016"
+	.string	"6\333aD\360\222(\035B\254\007\326\020\371\037\333\323\016ue\206\376\322P`\016\301aB\200\245\353\306\244\246y\212\327\266WTx\275\025e\220\032\301\027^\316\314\371\353\207X\374\352\\ds\342yF\357\247YB\366\2262\245K"
+	.string	"M"
+	.string	"I"
+	.string	"\003\266G\233l\036\377\\\366/\332*F\266\273\235\2320L\323#\3244\371)\353\301\362N\217\220S\241\240\b\340\251 \310,&s\327\023\204\227J\270b\345z\327!\013\331\f\226\267\362\344\032\354\256\223\345\205\270\267\333\026\261\035\301~J\232>\207\243\343\245\205\b\307.J\315\307\316D\231\024o\375\366\3572\307#\003d\333\377\016\303\364\326\207\357I\312f\365\252\305v?\317\243\037h\036\375i</@O\373/wa:L\2117\273%N\320\330\375\f\270\323<vN`{\204\017\273\273p\223\334\216\227l\266\210C\236\345\216\211\236\f"
+	.string	"&Bc\324Py\352\204\251p\372\326;\250\244yK\273\203\207<\213\323\n$Rzr\332\250\345\330\244\331\337)\265\305>\210\313,fe\261\017\363o\336\2729M\253\2463\245Q\250D\212\006]H\200\340\300\002\005\"\037\001$\222t\310G\002\005\b\023\272\322\b\206Q\250\324i\310\020\"\351BF\244\356\323\261h\303\310\250+\211D\243\216\363\355\225\305\026F\314\2404\025\265E\035\3340\311\2317\252\n_\253\037\250\254i\252\306\234\250He\355\312\240"
+	.string	"L\005\006\031"
+	.ascii	"0\211\331K>\231\206u6\311Y\245\366tp\003\222f\201\r\266\303\016"
+	.ascii	"4\264\001\264t\252\265\256\264pe\304F\265\327-\201a\303\025\320"
+	.ascii	"\304\240r%\020\027\267T\251Z\006\352e\2230\237"
+	.text
+	.section	.gnu.lto_timeval_sub.103.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`e\004%\034"
+	.string	"V\363\260J\260\226Q:\225\034\370\330\351\212AGo<?Cb\263\241\345k\032\3079\301\013\256gLi\036E\213\261\257\376\363\313n\226l\312<\001\235\f\367\327\177q\274mb\003@\005\321jv\272\235\022\250\232y\364o|\322\310&R&\031\236"
+	.string	"\213"
+	.string	"\231"
+	.ascii	"0\033\211\241\360\246\306\233U\036\023\213\246\013\346\251ME"
+	.ascii	"\316\356\243\036\2741\215L\230RDZP\251\025h;]\t\246m\007%\244"
+	.ascii	"(\300\254\362\236^@\300\362\024\344\350\300<5\220\225s>\220\275"
+	.ascii	"\323\177\344\016,zL\255IREj\005\036\330\323<]\240\271\273{\036"
+	.ascii	"\357\221\333%\222\300\031\2773\255\360A]\251\265\236\265\323"
+	.ascii	"\312S\3623\345i\313x\356dsn\357\322!\255\216I\216~F'Q\274e?\036"
+	.ascii	"Y\253\265~xF\372\355\230]:\265\326\345\243\337\211/\375\356>"
+	.ascii	"\330\335\236]\322F\026`\350\370\270\\\324\341\244\362q\027h\304"
+	.ascii	"\255\264{\262v\322.\311ks\340/\340S\337\232\013\371\003<\310"
+	.ascii	"\017\340\301/\355\302/M\311;\303\2742\314\033\303\2743\346\205"
+	.ascii	"a^\031\363\306\230\367\205ya\314\353\302\274/\312k\222\274\256"
+	.ascii	"\346-\233\2272/\311\274\315\274\314\274'p\037S\236h\020a\325"
+	.ascii	"ZbKKeB\2170}\352\017\376\302\367\356mJ9\257\272\024\314\026\203"
+	.ascii	"jj\211QL3\250\324Z1\230\247\337K\345\366Q\037n\375j\230\022 "
+	.ascii	"\227.\300\341I\200v^\037\336\245xE\303|\\Z\353\350\310\262/<"
+	.ascii	"\205\227\"\321\354\007o\001\206\253\315\376\022\313\232v\341"
+	.ascii	"x)\"\251\351O\275VvM?\313\247\245;QI\273\354\367\\\220M\333u"
+	.ascii	"\345\323j+)(\352oe7\331\324\330\333\321\334\335$T\257i\307[{"
+	.ascii	"\252\177D\321\b\327Z\215\272\225\226\373\335\363d\305\343,G&"
+	.ascii	"p\003\210\262\353\341En9{\"; \314Z\353k\234\356\213\312\323w"
+	.ascii	"l\311I\307[\313\305\037\257\372\203<~S^\370>?BA\244\213\b\207"
+	.ascii	"\343\361\311 \024d\022]\304WA\317\202\004\b\0320\320\200#3\324"
+	.ascii	"!\204\320\017"
+	.string	"\256\\\037\234\b\025\034P8\207~6\340x\206\316 \016<\036N\037\234\320\211S\333\333\207\037\3349t\273\341N\030\260\276\223\2501\305\360\257%+EZ#\235\352/%\343\215%+C\370U\247i\244\335\265\351\232\256w;\3236}\231\216\351\231f\243/G\023\231\036\200\005\264\023\323\262(N:\343\254\257nYGU`Z\3263Z\3034\335\"k\222\330k\332a\305z\t\320\003\0201(O\216\252\350\032\326\261~\257\211\246_\232>\361i\271\004Z\250!@\007\021r\246\246\224\221$\205i\f\240\242\231#\272\001\021\2205dg\nu:\314\356\023\335\331\037\251\246\330tO\2204xC,\276\365\340\rAA5i\222 \371\n-U\355\235[T\034\231\rJ\300\274x \021u6T\003[\252\330\t\353\236},\246\245d\371\027\006\013\br|ISl\0017!\312.34\0346S\331M\031\253\323\316\250"
+	.string	",\032=\022\364\305\t\255,A\316\"\310\271sIP\020\006Y\"z?\210\220\275\2021:\211\371\237\210\330\032?\211y\377\345\354\307\"\262\352\221\244x\234\"#\236\"1\312\013\316_u!u'<"
+	.ascii	"sM\032\n\301-\342y[\314\037"
+	.text
+	.section	.gnu.lto_motorDevInit.110.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\266\002\255\026"
+	.string	"\246\351\223I\260\022VcN\020v\334hZ\216>b\352\274\315\023\002df\206A&\276\020\210b6<'\274\2141\\\252\374\255%o\245\3069\243b\235\001\376\031F\376\306\335\204\003\007\211tY!W\222\260Ai\305\344\355]\267\334R\246\024|"
+	.string	"x"
+	.string	"\177"
+	.ascii	"0\242\354\324~\213\027{\027\242\271\200{\2075\224\3565&p\354"
+	.ascii	"\274\265\361$\346\355y\002\346\255{\266\216\033{\356\223\236"
+	.ascii	"p\216|\334{c\365\204E^\032\357\222\366n\332\262\322\236\177t"
+	.ascii	":\242\207\357fY\213\220\234 \024\203P\274\204@j\313\262Gr\b\200"
+	.ascii	"\360\246\224\005k\210r\2046\264\004\332y=\362\324i\007\020\007"
+	.ascii	"R\270s\032\262r\3575\r\nE\334!\267mc\033gS\026\001W\227&m\243"
+	.ascii	"\217V\242}\023\375\370\244\\\207\266\353F\377\371"
+	.string	"\242\337\376x\327JM-\365E^YD<\250\2164H\367\206\330\002r\245\354\322\317\217\277}\330Q\346\277\360\221~\301\2202\333>\322a\364~4\323\351\3239\221\222\240\254\356\275'\267\246\235\267&\345_6\254\230\242\322\273\221\207\217\\ U\n\f\347-\fHV\215'\352\275\350\003\035\2715@\020\023\316\333\021\032U54\313\026k]\371\321\344\313{\357-]\365\307\233\374h\322\b^\253\253\376\206\004\220n\371M%\212S\3675\323~\371R\315@\003\3333\237\001\023 \307\275\327A\322\225l\276\317\2557\334n\346\355\201\036,\221\250\241\251K\223e\025R\n\302S}\362\037\037\201\347\207|\271\302\004\215*\276\3721.#\347\373\270\303\216>x\353\357\202W\266\276^\013'\310\217n\271$\250D\305\024IR\347G35\032\256\205\207\223q\325v12\024j14\233\213\313)\031\030,P\360@\205\2062"
+	.ascii	"\306\246\001\227c\321\345x\271\333\313/(\022,\264T\210\361j0"
+	.ascii	"\272\031/\206\263\315n\261\027\335.\206b\342\034\207\232.\306"
+	.ascii	"\313\345t\261\227\361\276\016m\265x~X\375*\320\247q\277\351N"
+	.ascii	"5\227\031}pf\336\026\350\301\372\035\375\202\226\r\263\022+\315"
+	.ascii	"r\001uVZCn\324'\245a\320V\242U\220\325Uk\025=y\2559f2ke\t9 `"
+	.ascii	"\002)fF\017n\f-\271\311\221\265+\337h\261\222!\022D\320\331x"
+	.ascii	"\323F\364|\310(n\340RS\027\260i\265\206U\021\224;g/\223\221A"
+	.ascii	"\b\214\262\303\n\230\246\225r\266#_\004\270J\305J\270\271\262"
+	.ascii	"\274-\262\366\324VOk\260\227fs`\177(\351\006e\023k6\024\303\374"
+	.ascii	"\204B\273\203\213\006\275I`\270\302w\036\3651\276\233\316\305"
+	.ascii	"e)\340-\200/\211E\245\211\256}\241\224_\227y\002"
+	.text
+	.section	.gnu.lto_servoDevInit.111.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\250\001%\021"
+	.string	"\246\237sH\300\324M:\304\261\311\363b\250\361\"'i\212\320)\300\303\030\313d\320Lv\004X\003!\342v\376W\255\262\035clCh\243KI|\315y\226\364>\024@!\352:\030\361\356(\253\226\003\334\314\333\0169\330F6\3312\245["
+	.string	"["
+	.string	"a"
+	.string	"\237\036_\002~\262^"
+	.ascii	"\374\264\315~\372(\264O\n\202s4\265\273\241\\a\326\277\361"
+	.string	"\376\324\366\371I\265\371DW\023E\214\234v9\233\317o\265\323\343C@\216\304\367\212\022rB'\207\323\357\205\317\345\213\256:\210\340\234v9\237\353Jew\2559\271\0227x\3333\2661\330\277\0216*\203\354\277\242n\206,\201\354\353t\267J\365W\031\244x~\246D8\355\362\364\212l\217\231\303\305u\277\375\223\033\230?\372En\235\340\300l\033%\305v]\rk\207V\273\244'\250\335Q\301\247)\260>\337\262\023T\301\256\366e|\206\3554B|\300.\320\016\245\335q\201CV7\271\325\200*A\371\233\037\234\366\034\001\305R\323^\004m\231\333\020\r<\260\r\342H\035H~\354\356\353\3505h~\213O{\240\321\347|\3724\340'\002\241!*/\345\022\316\221\233\366\034\200\211\251i\225'%\322\016\025\016)\203^s!\305My~\321?\030*\016\360h*1\242D%\265\312\263\307\037b/2\026"
+	.string	"F\321\340\240\001\003\b)/.\00201\033d\342\21283\213\321ZvqM\260\300R!\254\305`f-\265P\026\323\"\023\272\314h\241\313\304\"\207\330,\254\211\342,l\215{\td\242K\350\365PA\335$n\312 \223\354$('\013\275\321U\352\254"
+	.ascii	"\031\241U3\206J\225\233\362\376\355\356~\240\274.\" @\002\342"
+	.ascii	" #\017b\341\245d\355\347\213\030~\033\tO {\253\340\324\331\376"
+	.ascii	"\326^\370\206`\356\207&\212ag\250:\310m\007Y\245\271\303\277"
+	.ascii	"7oc\036\333\004\226\n\353\350\242\213\002\032\nE\374\376\225"
+	.ascii	"\256]\302\"\266W\367\031\275\360\302\224_\227y\002"
+	.text
+	.section	.gnu.lto_pwmGetMotors.112.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \377\365\006"
+	.string	"\"\21505@o\222\016\f\351\350`\373A\302\237\206v\202L\342\2177X\336S8\240\371\366\375\263o\267\024pf?\256\376K&\020Y\346\260cJ4@\316\306&\226\020\231\002o,\005\206\204\005\330\3414`\232\016\204p\320<\300\r&\001\255\202\257\b\016\006;\327\205\301*f]\351K<\231LQ\263K\3228q=\372\246\360\264f}\327C\365\035d\210\\\305\225F6\323\307Ps\033_L\272\3227\370R\025\226\314\213\223K\246<\224\217\377\363\325\r\251\310g\020A\354 \005\234\230,LZ2#<v\200\352\313T\200\352s\034\005\265\201nG\212\0019\255d\243P\033"
+	.string	"Bf\336\262\021\251\273\376\006\277\365c\004\t"
+	.ascii	"{\311'c\261\200\243\241\303\001\272\206W#\232\026\202\020w\305"
+	.ascii	"\324N2"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.113.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \367\265\006"
+	.string	"R\214.5@o\222\016\200\323\346\221\210z\301q\225)jH\023\340I\0323P\300\003]\330\277\371\310\331r\0228\266?+\032\313\264\250\272\340\230C\217\351m\303j\232\020\231\002o(\004\205\203\004hq\026\242\306\202\016\f\232\006\270\211\020\220\"\270z\340DhUU\204\030-\373B\006\231\305(\005\364$n;\323\375(H\347n\034\341q\305*]\317Ti@\304\002r\333N$\313\221J:\227\327>\356e|\001\362\205\376e(F<\272r\222Y\261\275\244\211T\302\361\027\363\365(\325DY\222m\"\244%3\341\323\350Uw\335vT"
+	.string	"\313>u\001\005\231\271\303\262\213\376\372g~\352\307\b\t"
+	.string	"{\3117cq\2023p\306\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.114.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"bL.4@o\222\016L\265\n\372\306\303\002W4e\371\306\021\254\221{\330\361\266\366\314\376\315^\207\246\240\2003\373q\365_\212\304\370\001?\354h\036~\357q\232%[\246k*\005\206\204\205\207m\032\256\f\366 \0342\017OsI\274\n\263\025\261\271\036fY\327\243\266\254\033\241\303|\034\350;R\222\354\202<\301\301j\235.\007\240\023:\201\017\215\017\226\2466\022W~\363\240\343\370^\322\215~\034\335\205tQ\224\226\314P\211%O&\223\220\277\363\324\005\006\235\263n\036\241\001\222\005E\211J\346\366\\G\263bv+R\004PE\212&\362\024\003\0162s\324D\030\335\365'\370\253?#\t"
+	.ascii	"{\311'c1\2003\300\305\001\272\206\003F\270%\004\tw\316\324\316"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.115.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375 \331%\006"
+	.string	"\204\nw"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\314\230\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\217\261\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307\211\001\221\216\217\264b\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\262\371P"
+	.string	"\203\003\202\260\371\270\003\006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\n"
+	.ascii	"{\311'\323\"\030\216\032\026\021\002s\r\027\214\030M\210\034"
+	.ascii	"\356\034\254\235e"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.116.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"=\f"
+	.string	"F\230VC\020q\224\016sI\242\034\250L\b\036\017\315>\b\025\363\006\352Tiax\016,"
+	.string	"$\307\205\035F\204\236*\276\005\215\274}*\2509T\330lb\210\320\003\334N\355gS\367p\216\347\361\250\374v\023)S\nA"
+	.string	"?"
+	.string	"B"
+	.ascii	"\027\2009\354\204\310"
+	.string	"2mP\326}\265\301\272{\262j\331\375<\216\330\241;\373\306\277\224%\260\362\241\204E\307\356F\025\361\356\331\371_q\215g\"\362\3144\330]\247g\322\341\326\3336`;\202}\n\001\212b\177\365c\377\376\314\225\206\231\2764\255\232\316+\375\217k\345\3446Xv9\264x\254\013\224A\302\3667v\307D\246i?\305Ut\377\034\303\232\335\0314Zv\327c\007\330!\347\0030\207WW9ti\333\274\034\252P\363EU\003\323K\377R\322#5\243\252W\225 \311\226\257\251W\341\360Y\274\305\311W1H*\357\035\372)\314\341\265\300\b\017#\331\362\001\326\t\326\346\016\373\023I\005a\377\332Z\nC(\004\032TAA\002\004\f\262\321'\200\006md\"A\213>\020&<\220\020Q\232\005.\204\212&R\250\024E\034H\374p\274e\320\270\210\3326.n\276\275\242\030c\241p\031Q\022C\265\035r\030'"
+	.string	")\273\273\300w\361\027\027\034\020"
+	.ascii	"3\t\332K>\031\213Go\206q\341!o\024\f\003\343/\306\3554\266\241"
+	.ascii	"lqM\274\240\205\315`a\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.117.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"}\b"
+	.string	"\362\217;90\221\322\001"
+	.string	"\236\021\035\016iS4\270\030\006\356\023\265v\346\247\322+\325\013\001\355\243\226\207\0203[\233J\367vXDt\033\211M7V\247DC\320\236P\024\276\344\357\235R\026\231\030\026\024\032F\025\034A\247\362(D\245\035M\r\370\304\221($&f\207\262\250\245n\252.J\251y\252\031\223;0\305@\325\331QZ'(\334{V\302\"^'\264\232\226\344\260\357}\374\225\207\236_b\215U<\370\315_}\276\025\304nZ\261f\323\313Ldy\201\320l6\352\330!+\312\021\373\236\2250[\206@\030\331qf\273\037\265\235\225\331\\Ll\037d#x8\304h\213F\337e\033\226\273\"1-\273a\202g\3007\1776\315\303\330\032\240\304:f9\273;%\311\277\307\317\177\312\005@\027\353\021\340aw\035AW\310-o;d\233d[%\013"
+	.ascii	"8I\335K\222\031{\302\267\346\214i\275e}\027r\361`\007\230\032"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.118.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`s\004\375\031"
+	.string	"Vn\240H\260XQ:\220(\363\036<\377o\022\025C}\370^\304\022\321\264\177\207e\350\273\207\366\324\036/\366\315\210V\017\345\251O\n`t\215\217\360A\217\271\314\017\253\016D\022#\016\275>)\260\261\032\201>\372A\376\336DJ\231\002\212"
+	.string	"\177"
+	.string	"\217"
+	.string	"jD\347\342\tC\341\327\245+\021-\242\323\361N7\r\354\245\262R\nb\325\335\bT^\303\250:S\245\250\262\251\362\347\251\242\260\253C\336"
+	.ascii	"\202N\205\2608w\337hz\322=*\370LTy\335\317E\307\035\035@\311"
+	.ascii	"\207\021\2221\335=c\035\252\323)C^\335\265\365\333\351\024k\250"
+	.ascii	"\f\013 \341 \003\373\265\bw\252H\031\3656\234\241\f\373\025\205"
+	.ascii	";\335\255K\272/~D\273,\237\356\376\372~1\364,\375o\373\377\363"
+	.ascii	"\207>\002@G\252\212\366\352\255\335i\035\232\377\r\305\252O\331"
+	.ascii	"\301Q\021\357\316\003\024\343\244W\317)\352\346\031\320Q'\034"
+	.ascii	"\361\266\314\201\300\350\222\352\016`\024\260\267\314?\356\226"
+	.ascii	"\223~\r\233\221~\025\242\232\243\243^\266\373\330\334\343\310"
+	.ascii	"\375\215\334\333\204{\330\334\277\344\276F\356]\341\2765\367"
+	.ascii	"4r/\312=+\334\317\271\227r\037\312=\207\373\345\275\022\300I"
+	.ascii	"\362\245\351\247\276.\3350\202fZJ>\001\321Q\377X\244`4^|%\312"
+	.ascii	"J\r\277\\\\\323b\227\024\2452e\365PSeK\006\rG\201\202\"2\r\213"
+	.ascii	"\305\311,\005\372\3444y\246~\222\377\367\250\223;\001@\365\017"
+	.ascii	"\332\004\304\213\252\273#0\321\246\020\"j\265\251\222\243|^B"
+	.ascii	"\226\254Fgd\314\034\262\366\250\020m\360\313\314\022\252g\305"
+	.ascii	"\333`\002]\022$v\267\204+\223*\261]{\250<\t!y\025\232*\227\017"
+	.ascii	"\360x\342m0(c\037^\030\3739\3421\001\311lw\357\230\223\256+\246"
+	.ascii	"r\266\022\265 ZN\305M|\003\240\007\f\026L\2000\242'\2263\241"
+	.ascii	"\342V\001w\313\335\206Z\017\352\311\320\341\002m\226\263\221"
+	.ascii	"\300\325r3\023B\265\241Y\020.\305\254g\347\267\0236\334,w\273"
+	.ascii	"\341f\256\261\225\221\356\303c\2429`\177\013\027V}g\336=\207"
+	.ascii	"\217\341,\326\005\221Tw/X\275\312\021d\222\234t\235\236\215&"
+	.ascii	"\254I\024\326\263\361C\306/\020hL\300\252\021\255\242\211\335"
+	.ascii	"<\365]\251t\313\006\016\264U\037\355\307\303\252/6\245\204\303"
+	.ascii	"Z\262L\3350\216\r\337\300\330&X\250a8\307\215\021\031\td\242"
+	.ascii	"\231\221\024\270\030\240\002\231!\322\035\021\0209\207\230\311"
+	.ascii	"`\233\355\270mv\2132\304\210\353\313\374\374\250/E\233\007\345"
+	.ascii	"\227WOV\254\277.\226\001\226\334KV}c\230\245#\rl\347\273\372"
+	.ascii	"-\3047\202(^\305\333\215pc1\300\\\266\322\262\030\266\202\020"
+	.ascii	"K+\riA\300w\201)B\220xb\217y!|\r\346\246-\216\205\233\023\247"
+	.ascii	"\274\005\242\220\350k\303\347z(\207t\357\3000\025\304\020\366"
+	.ascii	"z\034=\227\260H\3610b\254\226w\266\206\367\036_\"R&\034\\fg\347"
+	.ascii	"\315\3556g\013Z\325\277I\233\b\241\037\034\364\361\267\305\017"
+	.ascii	"\226\002\251\033\322\377"
+	.text
+	.section	.gnu.lto_pwmWriteServo.119.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\n"
+	.string	"V\225MA m\225\0163\264\b\202\n\265\333\033\361\033\354{X\370\003\204\006\340\352\202@!\007\035\3206\334(nd\2169qL\004\0060B\020\t"
+	.string	"$^\227\260\250=\321\237A\202\351q}\317\265m\223-S\n8"
+	.string	":"
+	.string	"9"
+	.string	"\326l\337U\020\034w+\250Z\273!\306sr\351\3176\361\020\265\033\251W\211\205bwg\274\360\357\372\371\337p\nh\032]%"
+	.string	"v\327\n\232(\334\361\2669l\023\260\257\021\252?jjU\365%Z\252\304I\260v'\314T,L\2722\330~\305\276\270\266\250\3665|\365=\364\007SvC\210h\355.\306\001&\227\226gD.\265cD./\0366U\007gu\026\250\335\005\3619\274\003\003\037\303\245A\"=x\351\213\"\227\007OhQ\243\312$\274b|\274\254\264\202\2443_b\253\021\253)\354p\244\321\202}m\343\311~\370k\017\234(\301\246\201\264\346\300\207GG\310\326\311\\8\340:\037\2174'3\300\200\200\0023\304!\3606\241\371\361l\024L\216\007\232\031\213\273\005\2347C]\347\315J\270\3276\236<\211\201\200\221b\004k\264\375 \f"
+	.ascii	"3\t\332K>\031\323\032\3240\341\f\002\343_ls\r_\315Ba\2600\021"
+	.ascii	"\334\271E;\237"
+	.text
+	.section	.gnu.lto_adcGetChannel.120.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\355\007"
+	.string	"\202N78@S\323\001@$\022p\321\bk)\367\005\325\rIN\347Q12\236\020\201\331F0\203B\034]\264\206\276\262\375\353\326\f\177!\255\277|n\214\374\345ta{\223\275S\n\016E($ \214D\022\230\200\305\306q\031\205\366\261\2069@\220\036\352\267Mx\331W\271\212\354\242j^F\305\n\334al^\375\272\316\253\240q\037Z\243\220\3224Y\223\271jbhV\356\330\243(\347\210\375j\247\210-\253\024\316m\\v=zxv\206\302\234\330\006m\220}\231,Li\207D\340U4<wAZ^v\307\003W\200S\333>\312S@\207\327FI\274R7\034,:\273c\r8\201u*?`\235\316\222\207\227\241\377\2257\230:rN(\361\362\303\260\273\226'\324\307=o\333\3006\3116I\013"
+	.ascii	"5I\332K>\231\026\301\360\325\260H\b\264r\275k8\007\213\021\331"
+	.ascii	"!\242\351\232O"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.124.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`N\001]\017"
+	.string	"F\333gH\340\322\2501\242\252|<[\2600\216\fY\276/\030\240\177T\350\266H:\033\005\216\256D\265\354\326\353Dm\273\f8k\256f\341\003/\325\322\3025\373XS\022\355\240\020\310\032K\262X\375\230?$5q\rm\271\245L)P"
+	.string	"Q"
+	.string	"Q"
+	.string	"%\336+\351\004\274W\2136\217\227*n\001Z\210\030P\356\336ki\nq\212\257\035\235\242_\"\307W\022\316\273\023\0234lCA$\316ig 6\244\205"
+	.string	"\022\326!\310\215B\257}\212 o\346\024I\271\367z\312\310\022\267w\333\026l\257\354\307\002.:\257i\344\327^\272\275\320\001Rt\247\221]\216\223\242\310\331 baz\302\236\323\367>\242h\3641D>\247\306\275$\216\204\334\033U\310\205\355\333/\305\021\223\035(\366k~\214\313\020\337\363\201\344\342\356I\0304\031\321\275\245\202W[\322\253\313\007<\270"
+	.string	"\323\237\021c/x\320\312\020^eH VL^m\026\370\301\350h"
+	.string	"7\232O\217\331\017j\033\357\364\305\246\0036\203\330\007\372\315\306\3371\207V\213\226\254\310y\315#'\310A\303\335\346\373\374\247\203\277\363j\0175\363\262W\277\306{}\317\003>\235Z*|\022\016|0*\037\006\231\024\270a\246%\003\005\226\t'\025\227\317'/\016\0320\210\360"
+	.string	"\3064\200\005\2064*\225\347\224\351ta\205\305\272T1!\312egV(\226M\205-k\372\f\322\250B\353\002\301\320\216\224w\366\224\027\275\371\254\222L\033\225\242tD\301\361\303\323i\b\035"
+	.ascii	"25\006M2\367\222D\2465\350.\330\265|,=6\017\377\224b4\206\022"
+	.ascii	"\247\227\350\0213[\362,\003\361\312\201\365\017cE\306\n\220\202"
+	.ascii	"*KY5\026\232\013\272\340\230RV\206\305n\340\222\334lO*\314\212"
+	.ascii	"Z\005\005"
+	.text
+	.section	.gnu.lto_FLASH_Lock.125.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\030\002\265\021"
+	.string	"F_rI\300\322Q:\"\035 \001D\002\2460D\230v\246\266\374\315\007\007\353r\225<2\003\340\n&\033@\327\222\210Z\353\307\375\232\354\304G\240\366\257\\e\301\205X\\\310B\f\204HZ\006\001\317\240 MS\256\330z\262\211\224)\005Z"
+	.string	"Y"
+	.string	"\\"
+	.string	"\343\254\t\261\335,\345\232\346\034K.\r\242.=\236\365]\242>\340\273\274\3123\233\307\307\235Y\240Gh\346E\323\234\023\334\021\237\335[\235\371\307=u\023i\367>|=\021\0358R\204\2101\236\201\033\0211\216\273v\020m\252"
+	.ascii	" \3149\2557\261\346\226\267\035\301\266\004[a\002@;b\364\207"
+	.ascii	"\375\026\007z\361y\314\342\242\277]\372.\313\"aS\323'\253\316"
+	.ascii	"g"
+	.string	"\334\365\230\352d\2174]\035\373\336\334\034[\325\322S{\253^U\253\252\277:\200s#\267\313\365\b\255\3228=<\001\2319\244Q\t\222!\023?\347\217V\221\020\231|\305Y\314\376\003\343M\233\256\327\314\322\274\353\355\211f\202\370Fa\002\0322B\221\"X\270+\211dT\330\364iH7\365\37105\255\264\344\276\221\276\257\235\262A\177\363\210\314\322\374 %\234\244\007\205\b\226\346\254\375\346\353\016C\305\347\271t,\f\177\036\206\250\251\223?\3764:\237\031*&\321\034\255_\276\357Ifp\322`\201\202\007\0164\264\004\250\304d+0\330\347W\213\202\205\t\025\300\026\030\212\314\325\002rHq\251\200/\031\013\330\032ql\005&\003[b1\031\250\032\3477\307\306\035\245\303\231\3301\325\326\346\255\216\213#\261v|\240\234H\"\240r\355\013\030b\226v$7e\263\322\341\346.\200\3523|\276\2150%\026\241"
+	.ascii	"\221\253\341- p\002\031\272\352\001d\304\357\311'[\034r\364["
+	.ascii	"\360\271\271\203.\303[l\312\216n\356bq\255\346\022D\fL$L\303"
+	.ascii	"\322\003\353\325\230\256\335cME\257\027,\030\240\371\276n%v\333"
+	.ascii	"-\334\217<L6\322iq\030vGSx\266\313[\013\355\356c\256&,3\303K"
+	.ascii	"\335(\315P\335\020\345\370\n1\335d;S4\001\005"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.126.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\025\f"
+	.string	"\346\326SB\020s\223\016\377g\001\005\253{\202\036/"
+	.string	"\3408\020\373\024U6\003:\f\004\310r\025\202Q\223\206\326\337@\013g\236\213\200\032\305\004\326\255\201V\250\336\347gwgb\256"
+	.string	"T\016\262\377f\311\336R\246\024@"
+	.string	"?"
+	.string	"="
+	.string	"\334\003\225\027\024\027\036\273]\344\274"
+	.string	"u\370N\200:T\024\317\37643?#\"\301d\242\306\306\225\3764%\256\001\270\223\307\331\335\263<Ep\246\314\214\310\356:7\216\304\ro{\304v\005\373\b\002'\373\335\257\232>\365Tt\034\307\216\335\0211?\326\006\224\241\302\366\355\277 \331\033\373\300\n\b\231g\361]|\205\364\016\304\005\354\236h\304\330\355\0228j\016\335il\373,\336\202\344l$\204\026\226\207\374\346\247\245\247j\212U\257$-/'\331\303\276\313\310@\216]\355\233\337r\030\230\237\342\320\037F\371\355\320\037Q\207\327\004\202\022D\313\030w`Vnl\372\260\273Rj\212\375\267\032f@\322`\201\202\217\203\220g"
+	.string	"\206UW(\024!Ce\002\262"
+	.string	"\300%\036\n\030&\\\210\242\312\344\002\211\"\007\r\240\r\261\344\302\242\207c\253CuE\221e]q\323\355\337\352\351=\243>'45\271\0033\343\275\220T\265\003\023"
+	.string	"u\222\265\227|2\246a\310\260\002\355i\334\001\366\300b\204\022"
+	.ascii	"!\252\b\"l&\030\327Dgd\"\3001A\252m\243\260\034j\362v\2252"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.127.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\313\001\265\021"
+	.string	"\246\241yH\300\226M:N\330N%\314\r\035\350n\t\376\204\0354\2632\004R\271V\003\204\377@\301S\351\235\024\247\365\365R\255&\354t\nF\353\001\306tk\354\203f\330\246~\356\261\031\346\214\240\376\235\002\304rD\202\310\336[\246\024a"
+	.string	"`"
+	.string	"d"
+	.string	"\356\270S\3178\333>\214\307"
+	.ascii	"\362\213F\026\023\033\270@B\324\264\244\326Y\227z\313v:?`;\225"
+	.ascii	")\376\372F\247\334\227\177\332g\202L\214\241\b\373\226\"\036"
+	.ascii	"\235rG\237+\242LE\024Z9[\214V\204+\242l\"H\262\343\351\264o\221"
+	.ascii	"\030\264"
+	.string	"\213\342\240\326\352\rE\0217\312m\353\330n\3317\022\247\227\217\"z\022\333\321.\265 C\352B\3313\330\312$\373r\034\307\321\022\311\376\322\317}\366otM\347z\347\372)\363\005\210\327\242j5\032\235T!\224\007\013\373L@\266\212\255\032\021#\367\264/y0\200ZQ0\231\341NUE1\273\247\341\313\370\f\240\317>\234\245V$\037:j\235%\b7\004\224j\035z\350qC5\252S;\207\225\222I\2307I\345\357T\203\222!\212<!B\003,'7i\363h\330\207\246\022f+!\001+1W\356\023\r\b\216\326\233\224n\364\254\334\216|{\310\214ZH\231\344M^\342\320~\bm\023\3736Z\005\234j\215=\364\233^\343\363U\234zCk\037\236\372\255-N\3719\320\001&e\200\265\343\343UH\351|)\027\207\t\031V\340w\241\307\003w>\220\302\r\215\315\203\232\b\030T\236\313\2030\275"
+	.string	"'F\001\214\f\203\325\213"
+	.string	"p\265\362\246s^j,H\260\351\\\254\035\320su><^O\227\003\266\272\227\224\277\037\026\330\271\276\017\354Tf\365\263J\244\371\327&s\"&\203\354R\033g\255\265n,K\345\231\236#  p\"B\266\036brv\345\223n\332=\2069\262\237*+\275\221g{\257C\274\016`\205\332\016\026L\324\020a<\026\231\357\341P\323\335\212v\304\270\326\234\231\375+"
+	.ascii	"\006Cz8\304'\004\251A\272\244\357\325\225\206\264oT[\005\005"
+	.text
+	.section	.gnu.lto_uartPinConfigure.128.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\255\t"
+	.string	"\346\021E>\020%)\035"
+	.string	"\360\022\2109\203[\"\002Z\261\003\376a\241"
+	.string	"\337\017M\023\035"
+	.string	"*Um\370\377S\222\324(\005\267\340\226\004"
+	.string	"\265\036\310\n\302@\305\rR\274\020\230\376\343Bz#m\357\224\002/"
+	.string	"1"
+	.string	"5"
+	.string	"\242o\334\021D\337<\332A/g\253 C\242\340"
+	.string	"\330\335Ja>~\216\376m>@\306^\237\002\247\335\365$c*7\275\355\005\333*\3339\001~hw\327TfS\002\027\235\330g=\273)\003\004,m\343\211\261\375\221\315"
+	.string	"t\372\264?s\232\3615$'\355\312~vv\313\007W\356\233\313'\004 \030\326Q\271\017-\225\231\253\265\320J\250\211E\363\345o\\\005\263]\330\311\020\016\206j\370f\213\214\314\223.\235\320\227;X\034j+>;\003\330\345k\322\027\007\366B\227\030v.\222%6&\" *(T\246\203\325\307\301\002-X_\206G\367\205\036\252e\340\224\tC\343\002UEo\025vbe}\335GM\205 \325T2\330\362\302*\006\013"
+	.ascii	"D\225\332'\271{I\"c\317\371\254\025gz\245M\273`\362\255F\203"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_spektrumBind.129.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"]\t"
+	.string	"\226QC; \223\322\0010\001\f\202\206\016\230\370\207:\370\210\017\241\3714\020\204\207\030\246\264j\361\373\013#\251\214\265\264\177\375!\223\312\250\036\"\256\030\365\364\027\240C3n\347\322K\352\336)\005."
+	.string	"1"
+	.string	"3"
+	.string	"\367\276\033\210\356y\264\177^\336\026\001\347\242\202\003\264\273\225\332>~\216\376s\027 i\262\317\200\212\335\365$i-7\275\355\004\333\035\266s\002"
+	.string	"\273\273\2465\233\222l+\264\303\354\354\262\f\t\255\316\353\211\261\375\221\255\2403\361i\237\3465\343mLN\260[\313\361\354\226\r\256\337=\227?\020\005`XG\345\236\326\374\355ft'\024\305\242\371\3627\261\201\333\356\354\244\3107\313X\270g\223\224\314\223.\245P\231Ad\030v8\237\235Av)\233\364\305~N\271X\026\255X(\206\250^0\222!<\"\036\034($R\246\202\025\353\303\005^\214\204\237Q&\r\016\214\215*\252V\341I\254.\326\251UQ!\254\232J\006_\252\260\212`\n"
+	.ascii	"6\311\337K>\031\213\033<\243\270(+w\332e\220o5\032\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.176.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`a\001\025\016"
+	.string	"\366\331]F"
+	.string	"\221(\035`\343\220|\257V\"Zg\2119v\365]cj\213c\027\0364\314\334;\314\241\254FX\204`\300\200\021\360\271\352\007j\177\371\177\225\351\002J\221P\003\341\377\356\215\002\200\2215#\376\233|\262\311\336)\005E"
+	.string	"I"
+	.string	"H"
+	.ascii	"\361'\374\001\002\376\265\262\334\365\340\002f7,`\312}F\3337"
+	.ascii	"a\373\303`\320\276\361\220e\007\270Z*\304r\354.\375\224 \016"
+	.ascii	"^"
+	.string	"F\r\364Q.7\0314<z\256iDv\327\334\206{\336\366\310\266\003\373/\001\267\017\373\374\330]\314\361g\177\177\255\270\035\241\221\341j\231\355\206\207\201\234O\020\216\020\373*\374\360(\300\2470\214\316\306l\224\231\271J\314v\227\300\247\031p\237\016\037`\373\344\016`\373\234\340U\264\220BcwE \033!2\333\347eo\221\342vYo\371+\316\002\345\207\370tM\305\267R'\252\370\226?\024$\212\357\362\263\324 \021\263Q\256\310\342\214\377\372Yq\306R\223+\366\265\225*\266\214\034\016t\330\275\260C\307~\2301D<\366\303\036\355\246\b\244\322\210\247\252\234?\036\030\030\211\020\200@\by<\023UM\320U\257\2426.\205\0264P0B=\023IG\362\250I\t\tEK\335\t\r}\\%\230:\352\325\332Q\216\355x\251b\021\226L\221\036\261s\317\330.;\314I\200\314\213\277\220\224\234N\001\035"
+	.string	"8I\375+\023\207\031\207\273\017H\310\303U \02300\216\346\033\315.\277iL*\314\300\330]B(K\203\212k\270\\V(P\210$\036kC\327\247\326\231k\3559\202\3306Sv\032"
+	.ascii	"\256=\340F\213\350w\2251"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.177.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\224\006\335&"
+	.string	"\312E\370\016E\200\334M:_\233\036\261\261\023TQJjb`\261\\\205b\n\374\303\005\270[\347\324\007\3040\233\247\3663\277\273\312h\372w\017K,;))\212\2034\034\242;\353\"a0nH\001|\271\366\304\022B\344N)\331"
+	.string	"\314"
+	.string	"\337"
+	.ascii	"\274W\253\372\035V\214ML\234/wd\321\236\243\203\335\313\337\342"
+	.ascii	"\266E\213\323\310z\325U\255pG!e\254\2148_\336\367\202\362\277"
+	.string	"\2543\324\263\350\240\t\272\252U\325\275\200\272\227Es\216\354w\371W\216\005\370,:\002T\265\372b\024#\221\255\326.\b/\335;_\272\353\006\314\227\347\t\230/_\3056T\225\201v\235w!\251\t\214;\250\266\270\325Z{/\367\210M\n\374\2113Kri\020\320\317\025\243~6\310\262\272:N\255\352\312L\212\232\224\370\004\310K2\303\225)I\036\346\324Gq\212\334/.d\016\245\352\212\2227;\t%\b\231\343\233.E _r\213p\r\025\251\310\r\177\322\304\376u\312\243(\244t\300\203p\034j\255~0\310\235\273\355#\266\207\266\311\"\346\255\231\251}\3753G\203\303g\342$%z\242\222\371\362y\210mA\032\310C\364\307\227\361\3058\207IE/\177\374\030\246\263\326\341\2112\316!R\321\f'z\342\367\004\326\324F\371_\317\201\031\331\370\264U\352\207\256\2267\350Gn\276\244x\215\330%u"
+	.string	"\222\232h\251\207Jj"
+	.ascii	"B/\273u8\352\234I\035TR\237?\273qKm\222\324\345R\223'\273w\251"
+	.ascii	"\351R\237\001i\f#\"R\353\217@\177*Vy\326\344^?\331_\366\237\235"
+	.ascii	"\264\357\223\375\314\017c\235\241\274\274\3147\203\002\373\321"
+	.ascii	"\007c\250*7\343\022\336\217\243\223\335\213?V5\366\305hQ\214"
+	.ascii	"S\330j\255'\316\227<\251\243{9\230\337\2057\325\305\347"
+	.string	"\3620\340\305\002\200\210m\270\315\355\216Q\275\235\353\353\371\321<AK\323\f\243\b\301\270Vl\210\2211\345j\031\035\267\317:\3069\2345<\270\375\331w\016\250\2716\220\n\260\n=\021\267m\346.\210\023\346\003\302\326\356\250-\2339_b\344j\361\314\227=\t\353JV\245~\3244\240\345\356\276\354v\200Y\n \351p\016\227<|\250\2005\244\363\273\2309!\342\374\256\005N\255\301\023\3757\2073\302g\362\322$~?\363e\271\037J\021\322@\206\221\246\246\200\222k\2338\321\206\334\240\207\255\231Q\333\223}\027\244~|\200\322\265S\250\240'\356\356\2446\312k\350\"Hren9q#@\351\215f\372N3\2776\213\026\364D\357\206`\376\036`[X|\332\366Gjh\224\354j\3318\314\257\213\243\034)\332'\206pc\235\213\360\242\351\301N\303\316\227\203\351\327B\306\222S\023\215\024I\"\220:\224"
+	.string	"\301\202\201!<\255i0\2710\322-\235\351\276\034LHM\245)\270\2600A\002\206\013/\214\006\314pz\252\341\363\231^2*\201b\004R\317\206/\306\223\222\215\036\r&\245\031\275\245\247_\317hg\247\032\276\247\236\r'\247\247\236\3166\345:\207\340\n\271\316\":t\2431\177\244\304\037\335a\240\021\270E\265Q&\332"
+	.string	"\3731\323\341/\003\235\242\302_\004\032$Z\023\020\240!Z\321\336.\3743\264+\260\246\276\270\312\350\233\036\270\325\362\005!\245\320\226}\366l\327-\017"
+	.ascii	"{.\315:\246\225\013`I4\2527\335\236{\252\267`Y\314\322-\207 "
+	.ascii	"Yk\255\246\320\276\354\347\231\272\025\332\017\211\b\315.@\f"
+	.ascii	"\330\026\033\237\266\334\372nM\276\016\363%\r\200\205\250a,\247"
+	.ascii	"\230BF\021\022\tfF\322d8p\002\231)3z\021\200=TS\323$\303\034"
+	.ascii	"C\360?\342P2(\377x\307)\304\262\377\360\002)\244\236\264\305"
+	.ascii	"u\236\353@\227\362dDw\262\022>\303\363\022\022(2\245\343L\f\311"
+	.ascii	"m\223\322\201$Q\0354\030Qg7)*\032\254\221\312\274\315x^\001D"
+	.ascii	"=\264\021s\214':\024\314y\207\354\323\350i\270\271\307\301\363"
+	.ascii	" \375}\361.}\265\364@v\201\203\3218>\305\350\035\275\030\251"
+	.ascii	"\337s\264/r\331q\177\330r5\027)\020\023\352\227A4\302M\324\361"
+	.ascii	"j\234\037\032F\203\030\205\246^!\254\243\343\362Ja\334W@nvI\264"
+	.ascii	"y\263\234S\372\375\362\331U\221\215\211X\224n\3005S\007\271Z"
+	.ascii	"6\221\216\016r\202}\016\344\301.\245\354aS\256\377\330\273\022"
+	.ascii	"\031a\277gDv&+\241&\210b\030\332-#\002+\205j\250k\3442R\371\210"
+	.ascii	"\031\277\032\234jB\312t\257\321\205\224\266u\034\347\310\252"
+	.ascii	"\324\026\365\263\020S\001"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.part.0.178.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`[\001\365\016"
+	.string	"v\\eE\340\224(\035x\314\201\031\324$.\005\204\351\007\342G\320\027\223\201\032\017T\3100y\022\231\351.\201M\3735\026K\306\030i\2038\370\205\017\206\3530\300\351C\0305l,\005`R\264\251\217H\257\004\222\275\245L)O"
+	.string	"R"
+	.string	"O"
+	.ascii	"\263\335X\202Gs\333\243c?\321\036\267\023\320\036\355\331CPv"
+	.ascii	"_\036\310\330\201\2711\262\273\234\266\270w\250\031=\377\207"
+	.ascii	"\331r\221\270\302\003<9E\004\270V\360$\346E\353\262\247\b\227"
+	.ascii	"*\323\344\021@\312\356z+qk\267M\301"
+	.string	"\366\005\3735\0021\035a\032\302\264\276\346O\230~I\232\210pb7\346C\262*\"\017\0307\236[\fZ\305`.\231\335\030\002\333\034\007\312-%;[\221\202{\004A\3732\317\376\3702\224\375\361N\343\202\022\333\0212\006fHx\276\306\267\361\033\250\323\270|\300\356\253GP\277\203ED\225\237\026\330a\305P\345\347\343\b\311\001\262y\304\372\303zxf\2523\251W\245a\363c\225=\366ut\327\201\355\246\336\362s\034\247\344\273xt\210.\337z\364;\275\354[\020\026(>\230$\251\374Rg\254\361pw\327\372\262\003f\300\241\301\002\005\020\034\214B&]G2\215F\0236\220VD\030\002X%dAC\205\f\334\211\264b\022\235\270\017\035D,\234\212\251\343B \227@\220L\334\251T2q\237\303\325\227SR\252\262\302OB\375w\353hQm\017,\371\226A,}qj\324o{\373\320T\003\034"
+	.ascii	"u\222\265W\276\200\331\020^\033q\264\032\032^\273h.\037\360\""
+	.ascii	"\3518\237\354\225\024c\025 \n\206\335%4\317\020r^\325jS\013\226"
+	.ascii	"\320\030\fb\351QK\270\213g\311\373\f=\3562h\216\2460\277\266"
+	.ascii	"\340\001"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.179.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`Y\001\315\016"
+	.string	"\266\333dG\340\322&\035B\225\320\036\341:TJ\260\356\371\034Z\200Kp\036dj\330N\222H\337\333\275\234VA\r}\266\247\326FL\356\r\\\035\366\234\357\272\n\362\210\216\027\225\\\303\357.3\316v\031\007\302\0324\332\336r\247\024L"
+	.string	"Q"
+	.string	"L"
+	.string	"\207\361\030\255\377\334\274dW\246\203h7,\360iN\373tx\001\244O\355"
+	.ascii	"H\237\006m\243\223]\027\313\013\243\034\032?v\227S\025\007\257"
+	.ascii	"Q\202\276\353\372\331]R\234\310\001\213\211x4\271\024i\331]k"
+	.ascii	"#\356y\333"
+	.string	",\2661\330g\021%\006\354\354\2028\022\262(&\016\027\266?\344\032o\036B\237\230\316nH\300\266kF\226\210\307\004\367i\177\006\332%\177\326\262K\340\203X2\334\030\211\223\306\013\3712>\243\365 \226Gvy\2004\320>7\t\376\347\346$\334\020:*\037N\217\007r6I\324\032\277\241\n\340\263\373:\314\323^(\225O[\003M<\314\333K]\376P\221\017\365mp`\371-\374\r\244O\224\025;\032\365;r\206\340\304#\177v\255\250\007\217\215A\242\366X\245\334\335\265\312\354\013\375:\243\343\201\376\213\304&\261I\331\024l3)6+\024R\237'A\325}2\336\007\241\202\203\227\005(\227\t(\335\252c }\300\302\311\300J\002\004)\223\311\227Ju\3220&T\204\007/\334*F\346\353V\\\206\013\235\212\203\371h8\323fo&\346\343V\236\367q%\333\361rU\346\026\034\355`U\355q\033"
+	.ascii	"2\311\321+K\357\262\206\267=0<;\202}\242\232\360\345^@\036\030"
+	.ascii	"A\327-\222\030\200\211\331\023\023\203\036\0051w\361,1\214\213"
+	.ascii	"\004zp%\t\003\360\254s\237Q\304\335lT:\232\215>\241\340\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\270\f\r'"
+	.string	"v\277\330<pne8\222e\001\374\372\336\260\305U\230\376\305\367]D\337\377\217\251\317\344^\277\333&(\346\213/\254K\326\006J\326\006:\262V\352\242\351\314\3135\355\207A!.}\022;\310\235R\313"
+	.string	"\303"
+	.string	"\305"
+	.ascii	">0@\326j\340\217u\232\217\265!\260\307\263\204<\216%\334\261"
+	.ascii	"F\323\361+a\216k\341X\027\272\261&\004J\331\f3\270\016\003(q"
+	.ascii	"\330pX\353\0011\370\216\r\217\325\270\025\215\037\tg\274\210"
+	.ascii	"\214\023\tc|H\bc\235\007|\261>\333yN\350b=\250\305\332\007\206"
+	.ascii	"F\332L\026kA+\326\201T\254\001\201)\326\177@\024k?\033L\026v"
+	.ascii	"0\235\363F7T\353>\340\211\265\331\004\343\001y\243\033\023\353"
+	.ascii	"^\211=\032\220\304\376\f\030\341\345\210\177\021aL\032\326\302"
+	.ascii	"\326\204\330w=\260X\350\300v\036\214<\036\331\006\3008\216#\210"
+	.ascii	"\275\031P\355\223\343\007\227\205\266q#\217\007\346e\257\215"
+	.ascii	"\247\3117p\275\271yX\357\001m\017H\023h\366I\316\354\225t\355"
+	.ascii	"I3{+e\366M\310\354yc\366c\304\354\303\204\331\203\001\263\177"
+	.ascii	"\362e\317\305\265\367\342e\337\245\313\236\013\227\275\220r/"
+	.ascii	"e\313\036kk?E\313\236J\226}\026\226}\225\217\343h;\270\262_r"
+	.ascii	"\255\bV|)\254\342\2670k_\005R\331\217\372\373\375~\237\262\376"
+	.ascii	"a\2557IYk\002]\365(\t\240\254\371\330\022\037\2670\177\262\316"
+	.ascii	"\344dm\351\312\214\302&\353JL\326\224\226\254'\201J\274(\264"
+	.ascii	"ZKJ\262\216\204d\r\351\310\372\221\221\265\033X\304\2126<\"b"
+	.ascii	"\346D\326m\340\020#\"\235(\274\0207\n-\247L\025\332ykG\257Z\263"
+	.ascii	"}\\\037\002w\275\026d}\246\005\nD\215a\236\242\266"
+	.string	" \327DmP\376\214\276\330|\371\220\250N\344\315f\366\225\305~D\305\361\024\210zST\220\006\245T\btg\337\001\335=)U\317\200\346H\264\002\2123\177\026\320]\257\200\346H4'\305\231?\r\365\234t7@w\205\004\350K\237\356\\onf&\024@w?\001\205\212\013\024j\316\024\024\252\256\264/T\001\347UmQ\030\231\007\205\212\240\374\023*\224y\220\315\312g\241\236<\200\321\017\250\272\263g\325\225f\326\034\231\307\2123\257c\177\206\\Y\217\365\347\036\353K>V*\367\261~\355\305\304\3313\201\263w\362f\177\345f\017\245\315~\213\327^\013\233\375\326\232}\0245{#i\366H\002\256\3432\305\225\327%k\233\324\3543\231\037eUi\351L\006\0060\035\315\235m\036\323\034y\3461\360*\315*\220\001yL\027`eqy\321)\226\027\261\324@\221\b\314\247\363\251\364uu\235\271\221\305\324"
+	.string	"I\300\2748\005\315\251\274\376\352\224\3051\243S@y1\313Jg^\177k'\231\216D\263\230X\305\313\275\323\221i1}i1\213)n+\264i9mc(\271gS\237\322\3767-?:\240\301\364\2114\230\"\203)\216'\245\017\213\222\322)\nR:\025\205A\037\026uAse\231\021E)\356t\242(\235\242`A\247&T\240\240\347AM\220\240:\322\313=\b\212K\273\210G+\222\bAo\262A\320\2431\325D}\231\255\200\330\250Q\024\345P\253d4EI\2455\260\002)\241\342\346\021\220 (\025AD$\220\t$\030\"\351\001\027\026HQ\274_\237\245\253\266\017{0\310\020\016\316\372\320\202x"
+	.ascii	"\bZ\342\035Z\304(q:\215\273@\f\022\t]X\"\026X\266\350\260YJ6"
+	.ascii	"\240\233\210\233\005\332h\006\247\303\264\3612\354f\370\361\203"
+	.ascii	"\365F\244\355#\033\360cS\247\302\222=1\223\366\212\375\2242v"
+	.ascii	"C\333\255\027\351\240\232\317nP2)W\330q\354\376\241\367#'+7\304"
+	.ascii	"\262\216b\001-\231\361B\260\244S\304\004\370\356\377?\230,\026"
+	.ascii	"D\324\031\214k\\\346\364|\302-@\335\020\323\223\352\025)%\222"
+	.ascii	"\377\220\33327\371B\254[\3410JXC\322|J\341R:OPy\232\346\2204"
+	.ascii	"\237R\270\224\316\023T\236\246\345\001\320U+5\262\331\030\216"
+	.ascii	"\307\256\260%!IG\025\205\006\2163\303M[ac\314 \340\256\213\212"
+	.ascii	"\333\244\277\251\201\374\031:\334\274\031w\3225>y\332\365\217"
+	.ascii	"!\300h\346@\216.6\367\226\237\305\302\302\343\b)\253\032\013"
+	.ascii	"tl\341\366\230\034\376\304\310;\245p\240}\300LU\366\200%%\364"
+	.ascii	"+\300N\\#\250\366\245\376y\374\017\307v\245\3727W\237\304\003"
+	.ascii	"\035w\013`S\310\351\206\377\326\242\376\017 \255\220&=\340\311"
+	.ascii	"o\326\207\35391\025Z\305A\312\b\214N\344\007\244\0334h\361U"
+	.text
+	.section	.gnu.lto_.refs.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"u\n"
+	.string	"\026\332J7@m\223\341\003\353x\310\371\206a\244\217\336WEGUQ\024E\361\222\bba\217>\033\342\3165z\320\031\304\356\006\032Z\227\306\261\004\027m#\322\b\331m\367\2262\0057"
+	.string	"?"
+	.string	">"
+	.string	"\222\351\241i\001\235X?\357\233\3043R\262.\353]\215\364F\2058]\037\216\300\351\032\3273\215SN\247h\377\234\376\\\217\264\177\332\257\306\0074c\235\255\266K\236\"\002\017\303\243\312?\031\3570\033x\024\350\021>\204\321\333E/lz\260tv\340`\301\271\201\302\251\201\342\314P\341\3040\302\342\017Q\361\035\004\236\242~b}Z\035"
+	.string	"\205K\024\217(\017xG&=\024\343S\365\024\214K\325?\306\243\352\b\317kC\b\334U\274\033?\350\335\354\200w\303\006\274\034e\300]\007\027\360"
+	.string	"\033\016\341\340\217\r*X\257\312\t\270\244\301_F\343]\346\003\217\245\f\036\317\334\205^\247\026\370D\343\222\366\221\323!\256mWpk.]\363:\346\242_V\237\334'\022]\212:d\351n\020|M\245"
+	.string	"\231\265'p\366\007J\340\030\226~a\274\242\372\f"
+	.string	"R$\354\001M\244\353\"srV1E\273"
+	.ascii	"A\\\240\004\3352P\304dM;\333Z.\013"
+	.text
+	.section	.gnu.lto_.decls.5fc4e2df5d262bb9,"e",@progbits
+	.string	"(\265/\375`\215x\275\005\002\372g\007\277T LQ+\215\001{\006\305D\032y\206O\342\031, \036:\037Y\"r\2761N0\001\321\247UU\300@d\221]P\320\270\201\017H<$:\365$\310MS\016G\333\254\037h\024Y\236.\022\303!\300\2149\366\333\312v\323\362\3141\242\270\345\336[J)Sm\n\307\013i\f\230\353&\322r/\317\200%M\321$\330\333r8ma\241\345pC+\007\213\206\031\031|u\254\365c,\234u\236\005Icv\363\004wiyNl\343\347\370\n\2038\272\271\233\321\032\330*M\254\307\335\315\377\005<\266\372o\340U\203i\354\2409\221!u3\236a\247 \021\214q\363Q%\372\"\024^\016\263MQ\260\364Ej\257\005f\212j\001\365\263\261R\207$\246\215\304\005b\316N\320\006 \226\302N\030*\311\325\025\\\263%h\003\020K]\302\313Y;\267\335\202\215"
+	.string	"Q\266\240\r@\\\205\251p\024\236\30220\f\034\303\306a\251\037\277\300M!\220\200\245\356\240]\263vV\373\210/"
+	.string	"Q\246\004m"
+	.string	"\356\275\264!\023\203\306\215\f\3716\356y\370\351f\302\260\314(r\363\321-}4K\337\245\3559A`&\354\"\277Y\255\301Kv;f\216$8"
+	.ascii	"o>\032C\037\235\322?V\302Irk1\350n\306HOeQ\250n>\252\244\361"
+	.ascii	"\321mTY\213\272\233\217n\375\363O\377\024\243\177\326\351\237"
+	.ascii	"Q\364\335l\317\211\301\266='\266\263<\347M\363\363\013h\326\250"
+	.ascii	"\303\021v\363"
+	.string	"\r\032\016gs7\276\376\374\360\221&4\354\374\372v\252\324\021\332\350\273g\316!zIS7\377d\302w\367\320=\256*-{WO\007\252\313\346\272z\327L\212\006oP\355\346\237K\375\337\274[Fn)\204\306\315\227\314\022\307)\b\030\326\315?\205h\373w\267\203\211l\314\365r\361.\230\373\345\206\261qW\314\177\271\334.JLW\314\275r\263\020\222\355\275\305\\\273\3179\351\020\3242H\266\345V\331:\326\220\335\243+\346N\271ULX\232\332[G!nbw\246\f\355\204\n\222\344I'\337\024\324\232\211O\337\254\242o\022\321\377\305\362\233\345\277N\327J\216\0308$\301\233o\335\317/\226\004\204y\r\271\031[\236\363\246\016}\367\245\362[\345\277R.\335\347p\266\360\216,8'7\333\276\237_*\347\301O\246,\255\271\371\246\rm\227\266\347\364\2112\027\005\312l\310\315\027\341\355\306uHb\202"
+	.ascii	"\032\330\223\013\305\306\335\271\353\3447\352\312\335g\2717\334"
+	.ascii	"\334u\273M\254\235\325rW\335\344\250\002f\215O\b;\245W\303\312"
+	.ascii	"\231\355\266=\3473\235\276pQ;\234\230n~\206\323\317I.\223\343"
+	.ascii	"\024i\372\253\273\371\031\210~\016\323\377]\202\205\212\020\266"
+	.ascii	"#%\257\333\371\007\235"
+	.string	"\022\216$\267\215\211\031;\247\233/\333=b\343@\\$O\225\226\273m\357\345N\n\246/\313\355\346g.}\013\342\334\001\261fdyj\341\201%\313\232\221{\227\345)\351\346\253v\211\3308\017\267\310r'\2070\215P\360\346g\033\372\326\303i\013\255\207\363\277C\322\222\216\220l\334\374\337\264\213\226C\303n\r\220\233\357\231\217\rU\227\275)7?\313\320sS\254\025\023\226\246\322\250.\"{H\226\234NG)\303V\352r\373\271U\247\323I\367\346\"C\246\306\n\251\351\017\215\005\274\263!B\223\340\225:\253\345Nm\317\t*\360\357\267J\354\221+f\003Og\355\334\034pW\343\2775\256\220\273u\301n\216kv}\\\256\353u\261n\327\345q\313n\217\013\344\352\2707\356\217\233uw\\\033\367\353\222\335\260;v\265\356\325\305q\203\330\270+f\243\374\302\2701\356\263tzR\263\327g\371\256\230\365\343"
+	.string	"/\237\350&$Y\267\305]\272IL\326\315>y\236\021\3015Q\227\351\305\2329(\226.\251\210\227/\026\317\332Ye\330JHv\220\361\235\361Yr\247e\257l\261w&,M\245.\272\322\366\366\336?Tf\254\233eb\345\220\254\355YA;x\267\023\222'\"R\200d{/\217\224n\222\tKS\351R\327\0131!\220p\305\354\030\273\207\227d\250\222\244\033{{\357\250\251\233\244s\244ao/=\262\275\227\027\341\277-\256\330uq\223:$1A\340\307\340\336\336\313\333#\277Er\305\256\214k\245s\264\334GgR\023-j"
+	.ascii	"\367\336!|B\230^\304\324DI@\376/\215_\253\337\266\331$J{\357"
+	.ascii	"\nt\256\344\240\022u\363\235\361\363K\343<7ou\203>n\346\221\242"
+	.ascii	"s\226\266\347\264U\342\364\361R\037\003\321\3079t\006<C\0373"
+	.ascii	"\351\017j\364o\236\006\201\213\376\215\242\277D\242o\343n\222"
+	.ascii	"\236\003\314\256\310\334\374k\246\377\344\356B\215\024'eK\241"
+	.ascii	"%\274YK\262\242\272\3717L\377r\351\337+};\313s\376\302\320\277"
+	.ascii	"N:\315w\262|\221iq\363o\222\276M\243\277GF_\313s\336b\321\031"
+	.ascii	"\310\334\356\375!\220`\365:\260+X\241\224Tx\263\315\263fn\365"
+	.ascii	"l\231\207@\302\361\321\221Md\357m\365F\330\332\033\311\352\355"
+	.ascii	"\254\331\033i\307Z\r\254\325 \017\351\362\321\344\314\267T\364"
+	.ascii	"\317\317-\231\363\3305A6*7\337\306i\037\2740\026\n\220*;n\376"
+	.ascii	"m\334\315X0\377\217\263/\310i\2331\003\311\315\267G\364-\021"
+	.ascii	"m\267\3459\255\235\345b\343\216\305v\331;'\334\333\020\245\233"
+	.ascii	"o\177\350\022\354B{,\347-\017\375[-Yv\320l\371\262\314b\261\240"
+	.ascii	"^\366\342\232n\276\325\322\2672\264\235\262<\347o\255T\301MP"
+	.ascii	"3\302T\261Tt\344\264\350\246\334|\353B_\004\372\267tRn\340\264"
+	.ascii	"\3004\335\374\337\306Y)6\312r\373\354\210\331]A\273\371J}U\333"
+	.ascii	"-\313s\376\002\3326\261o6\356u\326\311\317)\253\345\216\016\024"
+	.ascii	"\027L\352n>\0054\016\320-\334/\340\332$\274G\337\276\356,\201"
+	.ascii	"}\335y\035m\311,\317y\255\263\3459\355\226\3559'\260<\247]Z\236"
+	.ascii	"\363\203\3559\177\313\366[5K\304\256a\246\247\255\355\266\367"
+	.ascii	"R\003\2526\245\313\355f\273v\255\021\273\274]\263E\036\002\t"
+	.ascii	"\307Q\332D\366^\332\265\2747\222\265\032\350X\253\201I\327\003"
+	.ascii	"\t\311\231\177\365\227\266\347\324\226\347T\303:\034< \340\317"
+	.ascii	"\032\370\363\006~\023\003\254q\006\314sr\360\347\026\362\006"
+	.ascii	"\346\006\017\277U@\001\314\016\177\026\301\274 w\360\233\026"
+	.ascii	"\230\034~[\306\364\371\337\341\267@\370 \376\023=\334\032s\260"
+	.ascii	"\202\377\362\3417\032\024\374\327\f\267\241/z\376\373\205;\230"
+	.ascii	"\023\374Xc@G\204\037o0y\306t4\370\363\006\346\206?\267\360\337"
+	.ascii	"\211\251!\217\3703\b\277\231\341\0300\3417w~\\\004\r\301\217"
+	.ascii	"m>c<\255\002\200~k\002\276\247y\366\333\037H\0366l\002O\1774"
+	.ascii	"\350\277\203\377%<\034\004,\330o\277\270rY\376\361\2338/a\344"
+	.ascii	"\256\371\217\301o\006\3767\342\003\035\376\266\313z}\0028\f\265"
+	.ascii	"\300\217\277\356\217\262p#$\376\033\3018\376\347\037E\301\274"
+	.ascii	"A\027\220e\265\254\0020\rt\304\217\247\354\224\235\361[\032\326"
+	.ascii	"\n?\375\246\315\177\237\303p\207\327\360\243=7\002\303q~\024"
+	.ascii	"\337>\026}*~\352\3758i\246?\306\300\215\310\374\2466\321?\367"
+	.ascii	"\370\255\013\346\371\0272`K(\377o\370\3170\277i\376x\b\271\345"
+	.ascii	"7s\016C\364\363"
+	.string	"?\353N\f\305\375\030\003&\376\361\002^\202\310\201\233\377,\242\201\264\023\222\376\313\345\3023\200\027p\235\377,\301\375\257\n\207!\001,L\373\337\023p\001\220\267\377i\""
+	.string	"G\3773\350"
+	.string	"x\304\260\003\020\024P\346\3657\177#7"
+	.string	"\307\300)\370O\026\376l\366_d\341\177\2272\341\177\235\006\377,\370_(5\177\226\373s\340\177\251"
+	.string	"\263\233\013\243|$\315\177;@\363\227\353\376\213\345\367c\233\317`\265\337\246`KX\027`\370\t?\252\304y|~\271\357\307\366\307\201\177>\363\236\337\364\340\307c\376\373\204\311\374\231\357\277i\360\003\362\336\237o\334\bd\275\337\336e;3\306\373\374fN\326\222\305R\240\205\334\224\367[\023\177.\363g*2?\206A\350\317Vc~\354\202\372g1v(\343\375\030(\207\371\363\006\363\237\203?\337\375\317\300'p\f\374/\261\202u!"
+	.ascii	"\271\313\177\377\214W\341?\251\376"
+	.string	"l\177\033&s\371\355]\266\313[n\363\237$\376<\364_\f\262\226,\377a\270\376\317\023\376\f\200?c\371\363\223?3\371\363\331\237\177\374y\354\317:\376\274\365\347\032\177\256\372\263\323\237\225\376|\364\347\365\317\310?\233\370\363\006\376\\\342\317*\3749\205?\233\360\347\021\376\f\302\237C\374\371\3768\360\307i~\374\367c\276\037\353\3758\357\307d~\354\345\307r?\216\373\361\333\217\333~\314\341\307\031~\\\344\307j?N\373\361\375\361\331\217\201\374\270\354\277k~\354\343\307=~\034\366\343\257\037{\375\030\307\217o\374\270\306\217i\374x\352\307Q?~\372q\323\217\217~\314\342\307*~l\364c\345\217\221?&\372\261\007~|\342\307C?\026\3721\361\307\034\370\261\006~\214\201\037[\340\3070\374\330\205\037\227\370\361\n?\206\300\217O\370\361\002~\234\200\037\027\340\307\"\374\370\347\307#~\f\342\307\003\370q"
+	.string	"~\374\341\307\036~\314\363c\375\343\363\307\370\277\204\377M\363[\036\277\r\363\333\256\337f\375\226\306o\271~\253\374-\362\177\211\377\376\375\026\305\177\373~[\342\277F\2775\341\277\221\377\362\375w\357\277f\377\375\361\337\257\377N\376\313\365\337\255\377b\375W\306\177a\374\227\352\277P\377}\372\257\323\177]\374w\351\277\373\277)\376\233\374/\362\277\306\377z\340\277\303\377\262\360_\t\374\027\002\377U\341?\f\377=\341\277\n\370\357\001\376K\302\177;\370o"
+	.ascii	"\376\373\341\277\031\374V\355\267}\277\345\373m\336o\313\374"
+	.ascii	"\026\357\267^~K\344\267B~k\366\337\370\177\002\277U\300o\177"
+	.ascii	"\374\026\205\337\216\375\226\304oW\370\255\330o\303~\273\343"
+	.ascii	"?\013\277\365\372\255\326o\255~k\364\377\205\337\256\277-\372"
+	.ascii	"\255\361\177\013\277u\341\267*\374\326\001\277M\341\267\013\370"
+	.ascii	"\255\001\376/\377\257\375\257\373?\242\260\260\260\360\327\201"
+	.ascii	"\3735\320\375\027\300\022'\024\366Q\306\255\312\312\315\357\021"
+	.ascii	"\243\337\003EgP\005\350'\323\311t\215dXbb\261UF\270\267w\025"
+	.string	"\017\320+^i>n~O\022\235\301\035\320\251d\317\245s\351\246\375\354\355\245u\336\340\353!\242oo\332y\3563\351\334'\022\007v\347\321\231t\036\235H\372h\357\243\345\226:\313\250\306\314\320\266\225\025\210\034(\2707/7\237H\357\361\241\337s\245\037h\016\006\232\204\347\336v\271%5\365?\033g\022v\t2\326\344f\020[\324\230\203j\3145vO\2419e\314Y\2010\227\234QI\021\264q\346\0323\246\032\224%\215\233\377w\215\374O\315.4e\344n~\217\222\376\004`\264\007@ [\304\232i\3144v\315g\037\361\201P\306\266\364\340\023T\321s\346\3371\323\323\026[\220\275w\006\2535\205\006\330\315\237`N\233}6^W\244\364\335\374\t\334\264y\306\352\201\240p0\r\337\236\214\264\254\257\233\365n\244\216h\341\273\371\023\024\321QG\236\360L\270\333\206\331\246\364\022$\202NC\256\310~\344"
+	.string	"\337\356\326\210@\244\206y\305\364b\332\231e\314.\246\030\363\316\304bZ1\301\230f\3140&\235I\305\374bj1\267\230U\3141f\236\231\305\344b\2221\247\230u6\316\3043\243<#is\332\273QlP{Kr0\355\241i\355e\257\"VdNj6L*'\327\b^\222\241K\272\002\367\234\322\260\366n\024\223\334\203\220\354F\271\025\3422\377O\334\235\032\323\310\3325\362EJ\004\023\317\2343\241t\231\331\223\202\201\350 e\330J-n4\3757\312\3043\227Q{$\3747\252I\3561(\247\344\005\331\235^^\372o\224\211g&\241"
+	.ascii	"\327\335\017\264\275\227uub\274\214\220?A\226\376\004U\332\204"
+	.ascii	"\202\002)\214:s\363'x\322\347Q\243\317CF\237\307N\237\347\211"
+	.ascii	">\217\022}\2361}\036(\375\r~\372\033\272\350oP\242\277!M\177"
+	.ascii	"\303\230\376\006.m\202\3559\277\001K\177\003\f\375\rM\372\032"
+	.ascii	"\324\350\357\331\236\363\032\272\350kh\242\257\341L_\203\016"
+	.ascii	"}\rQ\372\032\220\202\334<\373M!\246\231\325\323\26133\003s\263"
+	.ascii	"e\262=\247\206\250\237\233Al\234\354\251I\231@\314\037Upj/n."
+	.ascii	"\2233\353[\272\371\031\366\364\177\263\207\351\303\034\263q&"
+	.ascii	"\231\031vkR\201\215\221\355\275y\230;t\2162\354\335\325\203\314"
+	.ascii	"$3\305\314\035\326\316jo\252\021\204\234\371\232\002\270\367"
+	.ascii	"\366\t\021\"\004\016\324\217\033r:?C\022\375\f@\3643\204\355"
+	.ascii	"\310=:\360\203\306V\223\233\237\241K\377f\216\233:~\234\306\374"
+	.ascii	"\322\201\322\306\346\342\346\353\365s3\207i\304l\215\306\315"
+	.ascii	"\003\200\003\272\311er\3359\020\313\rCG\212K\006+\375\233Z7q"
+	.ascii	"\374\346\rs\013\007\311v\362u\263u\263='\007\313s^)?7\265\242"
+	.ascii	"T\035\241\222\205u\306M\361\312q\263y\265l\333{s\260f\262\004"
+	.ascii	"\351n~\006%\235k\274\2316L+\033g\326\270Y\003\2431i\350\034-"
+	.ascii	"7\325\371b\007N\023-\027.N\223F\233\0230\036{7\217P\222!\343"
+	.ascii	"\217jG\215\366\320\005\350&\f\023\306\321w\366\364oN\335\254"
+	.ascii	"\372\361\030\223\252\320\207\337\323\315\177b{NS\352\347\346"
+	.ascii	"\224R\214&c7\247\226\3474\243R\034O\226qP\330l\357\250\305\370"
+	.ascii	"\022k\272\371\364g>\323\311\352\231<b8Is\263E\263=\247\371\342"
+	.ascii	"\347fS\016\230\230\231\334\315\024\230L\346\322\037\017;37\217"
+	.ascii	"\310\0022\221\314\244\233J7\225\314%\273\367\336V\373\210\317"
+	.ascii	"\004\276\24313\300m5\005\3427[\334\\z\036N\207\223\211\230\330"
+	.ascii	"\330\315\377{\336\377\364\206\n\217.-7\177\007\214\376\355\357"
+	.ascii	"\177n\244\251\275w\225\271\334SI8\347ooMkA\3749\026\333\r\376"
+	.ascii	"\347\177\001\034X\356\244\301 {o\353\247\201\310!]}\330\246\335"
+	.ascii	"\024S\033\327\021\003\270\250\224\270h0\265qQi`j\343\332GJcG"
+	.ascii	"\032\2466\327\021S\333\336\032\224\224\216R\330\242bjC\332\032"
+	.ascii	"\230\3326\325n\321\205\312\356%\327\321V\332\332\032\266\322"
+	.ascii	"F\332m[T\037\230\224\270\250\230\332\220\25040\265qQ\3556\256"
+	.ascii	"\235a+!M\275P\332S\032v\033\027\337n\333\242\312\300\324\266"
+	.ascii	"E\305\324\306\265f\241^\020\022\201\261&\210\016@K\305\244\264"
+	.ascii	"\243\240\260\220\2462\3301-\2676\336\336\326miOm\273\2757\330"
+	.ascii	"\033kk\n\017\211\206}\222d\027\225\004\207\264e\227{o\016P"
+	.string	"I][[\311\356\310n;\246 [{\007I:\261\241\366\336{\204\243\245\335\336a\355\216\274\260\366\323\322\336\026\354\345\336P{\037\331m\267\367>\332{\243SX\313\275md`\"\203\202\332\333\312\007jc\035\315-\355}\335\306<\241bj\353\332\372\231S\322F\266],\217,\323\323\326&\333x\\S\272\355\210m?\355\275m\237&\243\202qfJ\353\316\005\026s\027\246\202Z\\Ln\346\200\3721Eqqs\036\304h\262\032kg\225\311\324\254\311\2046.\017f\301AT*\315\2025\305\030s\346\357\374\320Y\215\336\346\302\004ws\006\374y\016l\033cJ\273\271"
+	.ascii	"\226"
+	.string	"\347\364\220\007\364\354\027\227\3752\032\\\206\343\211\007\371\257\002]SVn\376\016\230\376\216\226\316}\203\203ot7g\276\237\3473[fg]7W`yN3YO\305\031\036Wn\376\016\f39\017\233m\035y:s3\336\373y.\223SE\307\036\231<\006\352k\351f1\372\212\230\225\326\315\337A\322\027\241\313\220=09,{\301K\262\324E\016\"a\362\227\214g\3432\230|\367|\226\233\370\300d.\030\b^>\321.\222\250\355\355\275\f\021\302'\2049\225\365E\213\316^zh+\245\247\0317_\207O_\307N_'\212\376\263]\336r\224d\215\223\233\265\230r~k\2007_\347\210\276=\362\204\007Y\266\222\263\344\272|%W\261q\031K\226\362L\227\247\374\316a\311P\256\021\235\243\f;\351\013\030\331\336\313\037,9,S\301K\262\007\344\b\313Xr\024\f\304\332\201m\244#\023\242\354\t\332"
+	.ascii	"\f\241C&u\206\tN\376/\3403\225"
+	.string	"?\237\345\246\334\343F\220N\211\355f;e{\316\r\226\347\274N\231\276\216\227\276\016\f}\235#\375\2343\032\204\35591H\002z\216\313q\330K\025\210\2629<\355\301\f\350\271\311m\\n\222\337 \260\334G6ze\270\260\312\207\220\233\237\303EcP\003\350\331-\273q\311\231\242\377\334\366\274\344\317I\262\022\253gw\026\261\271\233\257\235\3559\t\200\344\347\271-\023\t\223\246\357f\017\326\226\231\315\352u@I\022$/7[0\333s\366X\236\323\266\375<\257\021N\211\332qs.b\323$L\f#7?\307-\023y>\262\225\203\221fd\221\273\371\317h\317j\177N\313Cr\027/[[7\037\317\366\2349g?\317h7Z\246\354\255\335\214c\226\205\324\320\252\341ws\020\373\365\245\317\313\315\3171\373\221\303\362\230\016\336\033I\215\254,\003\261q\371G\366a\305\374?\371G&\273FP\035lc\260"
+	.ascii	"\232\3004\246v\346\347<\351\343\250\321y,\367\350\300\0322b\276"
+	.ascii	"d\261<#K\216\261\233\217sF\037\207L\346\361g\260\274C\213i\353"
+	.ascii	"\362q\263\255b{\316\013,\317\231\277~\236u\340\364\341\265\245"
+	.ascii	"\335lA\327s\216\037\007\311^\330\f\254\311\312\225\233\017h{"
+	.ascii	"\316\314\365\363\334\245\013\013\243\354\270Y'\343x\336\021\333"
+	.ascii	"\231\225\2331\360\002:\376\213\303\177\371\306\2072\276\254\305"
+	.ascii	"a\307K\007\322\227\233\217S\247\321\340@\274$S!)j\317F\316\312"
+	.string	"W6.ce,\254&O\231\2604\325B\022\324^\306\3125\216\005\007\be\201wd\034B\204\310J\300\254\334\320\3718[\372y\311\005\007k\007\306\200\037oPi{{/\363\024\026\314-:$1\255P\005\356\205\033\331\323Xnr\002a\355\334RxB$O\345\2501\264\275<\225\2318\234;v\254\r\3113\262U\246\31222\214\034#\323\310U6.Oe)SI\022@\301\r\3717u\3727R\364o\340\364o\332\364o\324\364\355l\317\371\233 \3727b\3727\\\032\004\333sf%\237{\244\327E\352\346\337P\351\377\371(#\331\270\234\204\007}D\300kpa\036\331\336\313\234\2247.\334\220'\306LK\b\354\204\214_\2223\337\346\211\376q!&\274!,\222E\210\t\361\240\021\037O^7\337\006M\337\246L\337\206\207\276M\227\3761\340q\340\255^\007L&/\352\\\334\214\323\374\034\003\266"
+	.string	"{\252\272\231\003\313s\336\006K\337FJg\020\007t\334\027\207\373\256\021\235\244\264\265\300\316\033\273\212\007\230\211\215L\322\315\267\331\372\307z\307g~\274\207\371\254^\007\362\302\\\221\272\331\002\332\2363\003\313s\342!?\307z\203pg\220n\306f\376[g\305\344\034Zcn\334\214\363\376\233\006\227\t\341i\207\216\233_\305\366\234x\314\3171\0314&\301!7\333X\236\323\003\033\3201\030\033\207\301`<\020\313\r\343\306\007\033\016\343\243\323\344\202\312\357\346\247}\372i\031\215A\024\320\261\221\3338l\004{I\231\366\2061B\331\334\230\031\340\236\232\362"
+	.ascii	"\337\245re\314$\335\374\224M3m\301uvM\347h\271\245\354\0226\036"
+	.ascii	"\204\200Nx\013f#S\373\271\342c\017w\301\\p\026\254\005c\301v"
+	.ascii	"6\016o\371\361\032^F!\301T\254\235\333\nW\322\256\023\336\202"
+	.ascii	"\217\210\r\331\202\255`*:J\313\r\343F\307\021\017\302\020:rZ"
+	.ascii	"b\254\351\344\2473\364S\030\372\351\224\276\bO0\024\035z?\236"
+	.ascii	"\202\351\260\024\\\305\306a*8\n\025\334\206\223\340%Y\332\024"
+	.ascii	"f\315\021*X\t\206\303lS\372\315E\340\336\336\373\347\230\n\216"
+	.ascii	"\303r:H\313=U\202\027]\204h{/\361\030\0221?l\362S\2459\264\251"
+	.ascii	"\356\213\330\315\327\200\372:O;\301vV\224\320n\276\276\323\327"
+	.ascii	"W\364\177\374f\3430\034n\322\206\341\360\022\314DGi\271\251P"
+	.ascii	"15\272\b\001\367^\372\204\260\271\302\242\303E\316\327g\032\273"
+	.ascii	"\345T\3112\027\345\346\353\036\372\372K_g\351$\036:\260+H\253"
+	.ascii	"\220)\342w\363u\f}-\245\257\233\364u\013\215\227\266\3474\301"
+	.ascii	"\362\234G\007\365\217\213\020)\362+2&\355\230\310\217\207`\265"
+	.ascii	"\233g\303\b\217\233\355\236\35591\260<'F\3739N\323I;\312\032"
+	.ascii	"\273\331\203\220\3433\263\016\354\r\367\367\303\312\232%\221"
+	.ascii	"\275\367N:'(D\306\3158\310\317\261\220\363\020\006:\271\335\274"
+	.ascii	"cyNL\206\313l\034\007\370\307r\347\206\r2Ar\363Q?}\313\301\211"
+	.ascii	"\013\013-\007'\036\313Ni\204`\271\371\350\030\375\343\036 \002"
+	.ascii	"\301$\241\211\205Y.\205Uoa\270\313\356\374\035\271\201\301<0"
+	.ascii	"X\232\031Vx7c0\374\205u \225i@Ev\246\312\016\033\207\301\362"
+	.ascii	"ro8\022\300\232\306\344\214u\\\356n\355\r\267\367\256@\277\370"
+	.ascii	"\033Ts\363Q-\372\3079\274\354\240\022Y\240\027\356\262Y\246\310"
+	.ascii	"\264\270\031oa\0346\216C7\247Q\270+e\333RC\rw\351\220\371\211"
+	.ascii	"\035\335\374\r\266\026@\324\322\277\224:\371l\035\2419\211<\371"
+	.ascii	"\320:\365\236\236\344\245MO\235\352\234\374\375\335\234\276\270"
+	.ascii	"\034\232\030\256\301\233S\246\313\261\345\230\353rs\352\342r"
+	.ascii	";N\330\360\3024\220\242\003\220\006\350\177\232\364T\351\267"
+	.ascii	"qi\222\016\343\263u\304W\002\215\247/2\264\315d\005\342\376\251"
+	.ascii	"5)Y\323\0020\203\346\032\020Mzd\217l)\036\252\247\260 h\372\305"
+	.ascii	"\262\216\212\360\351\321\323\035\002\t\247\303)c\006\215\335"
+	.ascii	"\315\327\205:\312\034\220/:P\017\326]Q\003\344f\255F\013\332"
+	.ascii	"\270\323\3515sX\201Vn\276\006[z\305\336{\333\323\235(\335\251"
+	.ascii	"\323hP\2457\230\301\307\247\375t\322<}\221\205)"
+	.ascii	"#\025\245\357\332\217\216\304\027\223\322\315\372LF\323\366\245"
+	.ascii	"\316\f\216\377\351)\346\302\354\351\346k\320B\007\300\210\230"
+	.ascii	"\353<1Z\357\016Y\342\275\311\226Iws\034\b>\351 \002\270\231\320"
+	.ascii	"@\240vMU\266\230\271\326\273\202h\232\b\321"
+	.string	"d\256\313\374)\216\03181\0377\377\303\027\255\307\244U.|<\261\323\003\340\261\345\332n\213\016s\020\226Iwl!dy\372\"\263\241;2\006\303\313u\230k0!\220p:+lNW_\364\235\316T U\031}\247\273h\345\210\312Z&\0224|w7s9\207\0340|I\310\334|,\325\325\342\311\315\377\360Cg\240\007\345z\n\024\235\005\2031\200\340\023\027\032\300\315d\005\342\206\315\211\215\213\225\353,\327XB \341yhf`\220n\326u\327\261\312\002e\357\346\353+6@r\264\235\335\\\345yA\362\236\370n\326TN\207c\025\006P\207\226rM\367\247)\024\255\034\\7\377\003\f\375\353(\177\2126\001sEv\363?D\351\177p\241?\344ps\323O2\304\360\331IJ[\353\306Ywe\373\276\224\351rr\375\344Z.\004\022\254\034\316\225R\227(\032N\307\245g\216\200=\271\336\367v"
+	.string	"\203"
+	.string	"\216\271Y\277Y9\275'jJ7\353&V.\317m\f\213\311\026.U\2027s>\344\310\334\374\017[\177xS\242Dw\331#[\352\244\272\"\234\241S\027xF\210\032\r\200 C\206\350\266\354\302.\177\322\336\bg"
+	.string	"^\247&ed\250]\267]#\t\201\204\323e\001\233*s\263f\323GP1a\2068\271Y\257\351\345\237\332\"6\336Z\334\374\f\372\2646\242\207x\tV\301q\263.\362A\226\032\034kn\276&\002\326\245\207\220\233\257=\335y\023*\207\210\2170e\364\207.ff\032\355dZ\341w\026\2667\005#\306\326g\327h\205f\326\f\371\242?\374\375\370\241\203\234L,\274\316\264\366l\270\260\264D\001\271\016\202e\005\226\246\037\031l\321\032<\211\375b\232\354Xika\235}W)\022\030%&\037\327dYI\223:37\3531\215\343\006\020\253\277\233u\217c\271M\2604ye`Ek\320C\351\372KI\363\260L\006\240\n#\234\241\303"
+	.ascii	"\376E\351\035\327<4\0160_\222r\334\254\301\264\216&[\256\234"
+	.ascii	"\321\221\303\354\312\230\r\236\r\027in\326L:\307\016\337\330"
+	.ascii	"\327\226\233\365\013\355U\244\r\252\360\346\017R@\377u\323\365"
+	.ascii	"\215\337\306\351&\335\245\367\266\332:\342\003!K\030\341\f@\034"
+	.ascii	"#L\322"
+	.string	"\2564\327u\027\335i\267F\215\016\215c\013j\215\026\034z\313\234\363r\362r\317\250,\263\006o\326WZ+\373\210\322\241\345f\215\245\263\324\244\311h\013BC\333\330)\224\302\023\273Y[\351\032:Z[=\232\204\301\3203\32224\300\0267\353\030ZF\272\206\2647\304kJW\241WfK5n\326TZ\211\314\2158\246\233\245vx0\335m\335|\r\245\243\376\364\314\342\245\305\276\371\031\\i\355\244\237N\035oh\346`<\203'\375\017\216\314\240\242\272Y/]\273\370\323\033$oH4n~\006I\372\327-\3764\307,m\017\336|\f\326\350c\200F\017\240IPP\333\035T<\b-Z]\f3\372\350\032\211\216F\225\275\265\233\321A\275\377\247z\256\b\217#\275\013m\225\026R\\\204\370\016\335\362\304\213\t!\272\346zpl\177VNK\327]\222\031\275A^`\340\211\364dZ!AS\303\213\336"
+	.ascii	"K\23246\310.\240\220\026@n>\006rz\203\267\276>\364\317fX&\335"
+	.ascii	"]\221\355m\005\302,\364\013\224\362;\372\227\363\027\245\013"
+	.ascii	"\334\347\316\236\352\342n>\006iz\2036>\276\237(zX8c`\230r\334"
+	.ascii	"|\fz\350\r\212\350\351\235H>[\230\314\335\0314\264\275\255@\244"
+	.ascii	"\201k\272\242n\276\007B\275\201\031P^\336\211d\217l)\237\262"
+	.ascii	";=,\300\275\255@\344h\371y\t\274\371\036\252\350\377G\301<\f"
+	.ascii	"J&;\355\235\004\3022"
+	.string	"\too+\020\024@\001<\202w\224\314\3211!\220p:\006\020\036\031\"\346O/\223,\177En\276\207'\372\177&\324\377t\347L\320\t\314\315\367\300\246\357\201\210\246`\b\320\321\2719\324\013\003\300\226\373\350F\f\037\226\0078\213+M\326]\306\213\221v#Op+\315\315h\227\243\\p\266\264\204\264\270r\263\235U\223\031\300\233\357AL\377\nN)B\026eem\017\275\202BA\351\220\030\331C\257\340\215\225LX\232J\233\220\250\355\241WP*\271\307\bgH\306<\001D\265\240Y\320-h\035\212\305\306\241W\320*i]\027\227?\234|\017/\364;\004\352w\370\323\357\220\207J\271iD\306\352n~\007,h\224\016s\372\035\220\350\f\316\200\216\312\311Y=\006X%\240,\220lOYyp\372Q\305]\335\374\016j:\203#@G\343\342\254^\276\201c\312\312\003\035\2560F\250n~\2070="
+	.string	"6%J\3207\233"
+	.string	"!Vd&\214)R\304\232\034}K\315\250\310\230\230\374O\321\"K\206p\241LP7+/O~\350\355LFw\226e\211\031e\013\317\017\357\346w\320\322\003\320\262\266\206\266\235s8\306\314\3202\226\034Cp 9\332v\005\211\226\231#l\177B\240\034a\263\201*\202\004\245\f\347F^\024\256\245\031\206#\345I\317\357\346w\200\322\034\260\025)r\"\245\341\230\302\345\253\314\315\357\200\244m\300\200\216\252\305\241j\267\215\001n\033\211\n\204\225\2513U"
+	.string	"\367T\025\0174\364\260;\273\371\027\234\321\"\314\240ih\332\211\024x\263\243\351\310\321\315\277 \214\006\241%\344\250\020\364\354\031\266\2153\013\235B\270\325\0025;z\206\201\240M]\2264.\260\2423\270\001t\024\b\n\004\207\231L\033\351\207\006\201sr\032\204\032Z\206\226\241a\347\225\226\022\346H\352\346_\300\246;H\362q\324\307\276Q\314\246\326n\376\005]:\203$\240\243=l\034\332\003{\231L{Wi\020\310vA\r\335\301\025\330Q04\314\356\r\003\365\261\244\244\217\207\215C\303\354\337\022\021\271\233\321\035\367\326X\276\330\223\373\237Z!N\322\232\334\374\013\234t\007k__\250\327I\3057f\206\266\255\260@\350"
+	.string	"YRC\007\032\335\301[W\027\352\225\376\235TeN\200\350\340\362\262ki\031\220\256\247\233oA\027\335\001\025\024\007\212\343D\222+\314]\362\224\024\271\371\026@\321\035hA\257\320+\364\306\231\016\n\261@\230M\260\250\260\320\033\250\026OST\f-4\353/L\217:<c\347L\231\001\203\r\305\262 \211\306 \f\320\321\032?\306\302Y6\016\255\201\2654\b\244\262\300\210\356@\017\255B\253P\032\034\006\331\320\034ak\232q\224\206\031\032\202]Y\250\214\276\24430\031h\214 g\304\210\211\311A\"\025\350\002\205\221\357\356\256|q\273\371\026\224i\f|"
+	.string	"\3315\213N\241S?i,\330\322\030\274\001\035\215\262qh\024\266\33205\001)\267=\013j\350\f\302\200\216>\3318\364\tw\225\320MRN,\220\322!l\240Ih\022\332\304A\360H\217\3512\004\357f\264\311\006\316\256\255\360f\264\005\312$gcY\306\204\272\220\002\005-I\213N\026\037\2205t)K\221\"\273\002\274\031U\302@\262\230\240\311\260"
+	.ascii	"I\207\310\"\210\"\t\242G>\256\366b4i\201\356\243"
+	.string	"Gtg{:\272n>\013\361\227)s.n>\tq\210D\211\3612h\242QJ\0236\270\206\203\f2B\326\\'f\223\033p4n>\0074\332\203 \201\201g_\236 \212#\352J\324\315\347\260\247=\240\222&\315\331\227\247g\343D\304\215\307\315\347`E{`\346\357\357\354\253\343\242\323t\005\260\360\346sX\242\t\320\342\344;\371\316>\005\304\311\355\231S\222h$9\363\263\357n\r\f\036\007\"\232"
+	.string	"`zzg^\336\033\231\031\0303\320\334|\016B4\001\202\224)s\346\255\355\005\222Q{\312\273mc\316\354|\334|\016c\232"
+	.string	"rc\302\310th\002\324\341\205\021\333\303\241\t\260\004\003&\216\307^\235\035\232\224\233\317\301J\177\220t\347\305\364\313\333*\303V\212\223\"\203\241\317\341I\177 e\267\345\344\322\303\212\003\223>\007$M"
+	.string	"?-Z\346\270\334Hi\321\363r\363}\002\365\007`X~b9\327\354\336|\035\234QY&\031bPn\276\017\031\355\201\n\320Y\305\236W\256|\316g\271{\240z|cf\200w\372sv\377Wio$"
+	.string	"\230GI\274\216\334<\202\f\320\317)'\223\223\312\235c@\013\246\215\004\004\204\264#\237:}\2379M\001\027\240\237R\244\\\277%]\347\220$9\326\334|\237$\232\2027\240\237P\240\334=\006X\035\331U:9\242p\371\3410!\251\302\272\371>Rz\004\035\320\031gO\271'\237\263{i\212\202&wF\366\366\324\366\340>[\277\002=\375\271\377\027"
+	.ascii	":=\324\264\304n\036a\007t2\261\347\033\223\023\316\364\263{i"
+	.ascii	"*u\352Z\333\253\200\213~\005s\372\326\364;G\254!Ar\272\371\234"
+	.ascii	"\315\215\231\001\2368\316\354\240\262\344\247\033\316\242\207"
+	.ascii	"\006\250\304f0G\232\245\222$96\274\354\276\332.\031\324\314\221"
+	.ascii	"\300$7\237m\025$\321\037\260\261\235kB\312\306\314\320v\006\323"
+	.ascii	"\360\266n~\005g\372\003-Fn\344\\\273{\357M\206*y\313\332\213"
+	.ascii	"\013t*\\3\375\200f\324\260\342\241?\bLK;\211@\221m++\0209+i\357"
+	.ascii	"M\355'\221\034eJ\\\214\233\317!:h\376\366v\234.\313\230S\313"
+	.ascii	"bC\213\310\022\"\344<#\303D\266\255"
+	.string	"\320@\344L\305\370q\303\354\347\331\r\225$RG2\016C%\246\026\245E\b\001\002d\220l[a\201\270[\260\312P\335\374\n\222\264\b\"ee\031v\222\230@\262*\204\\\240\004j\021Hx\234\307\351Co\233\305\206\233\226\234d\031\373\351\343\006\313M\257\360\346\377\235=\376\2479yD\342\n\317\036\247\330\024\252%\224 \313]u#\213\307\031\226}\330\304\260\202\246\204O\213\260\003\003\253\301w\272=\241\373\263\242E\204\371\372\327\211\244\267\245\301\206\006\302\346\215L*\352\346S\020\247AH\302u\346\340:\275\024\200d\310\336\266\262\002q\363\246f\306\024\265\255\271\275\237]]\252\304\354\233OA\021\rB\034\320\215\3378\267\364\236@H\331\230\031`*\367\302\253\353\177?\267N\227\205\214)Rv\363)(\223q\332\220qfa\375\314\302hXd_n>\257\006 \b4\343\2641\343\254a\367\324\336V\t"
+	.ascii	"b\206\314\246L\2222\202V?k\344\310h\302fu\363I\343\216\001\271"
+	.ascii	"\252k\373\237\236Z\244\326\250\271\371\024\334\320\247`\351l"
+	.ascii	":\251\316\246\023\306Y\365\023\306N\f\2552E8\360\002r:\251\234"
+	.ascii	"\316\251g@\332;io-\255S\355\213\017\315\323\315\377\371\364s"
+	.ascii	"\352\224\322Vx\2009n>\243N+\033`in~O`k\361X\034nX\213G\022EB"
+	.ascii	"F\250\272\022\325d\320O\210H\242P\022aP\215FB\352\211 \245\232"
+	.ascii	"\324\371\t\021#\324\244\321JT\207\320\"U5\246?!bU\036\221Af\020"
+	.ascii	"\3228D\036\223Iu8\314\220\"HuA}aU_0\"*\216\030\362Y\211F\024"
+	.ascii	"P\205\214\326\342\272\236\260\252/\030\021\0257\030M\360\023"
+	.ascii	"\023\254C\241b\252\022\025\327U51D\021\2044\006\345\034\213H"
+	.ascii	"\017\340\374\204\210\030\212F\241c\322hU\223\310\243^\213+\324"
+	.ascii	"\374\023\"*@\021\2044\262H\256\303\236\237\020a\342XLR\240\002"
+	.ascii	"\231<\261\"\217\350\020Q5\346UU\022\251D\347\320\031\264\252"
+	.ascii	"&\206\314\225H\224D\016\235C\353\261\230,:\205\216E\025j\362"
+	.ascii	"4\032\325u\310D\241\252\312!\363'D \213B\253\262\207\210\250"
+	.ascii	"&W%\221J4<\252EH\235\243Z\204$R\211\206\364Q-B\n\r\235\252P\b"
+	.ascii	"\255\032\213CED+\252*\221\306\240\241S=\026\215\307\"\362\250"
+	.ascii	"\203\220F#\221\350<\252E\310!S\350\250\276P$d\204\256\305c1E"
+	.ascii	"\021T\204a\202\325\b\251\022\025aXUe\317\315O\210(\nZ\207F\343"
+	.ascii	"\t\253Q\013\304\225\230BQ\320\232\363\023\"\204\210,\204b(\032"
+	.ascii	"G\210\250@9\024\"\262\020\3121\032\215\216G\344\021U\256FE\303"
+	.ascii	"cq5\026\215b\030\016u\224\253QQ^\177B\304\005\247r\270c\202\270"
+	.ascii	"bT\035V \203\322\004\321\250\202j\202\2504\262Q\223D\025BI\""
+	.ascii	"\004rP\004\021W\245:DU\020\024_\030\242\b\"\256/\f\217E\026\206"
+	.ascii	";B\307b\003p\324\244\321\232$\032e@\021\204\\\001\0055\211D\341"
+	.ascii	"\205\235\265x$a\263\252\017\b\022\"\346\020\251(\221\"S$\325"
+	.ascii	"\027\224F\343\tI\244\n\312\243\n\244\320jt\342\005\"\025E\036"
+	.ascii	"\210T\224H\213I\013\020\251(\312Y\221'\224)(\213\023\250\311"
+	.ascii	"\023\210T\024\361\020\251(\332Y\325\007\020\251(\302Q\236k\361"
+	.ascii	"H\002\307\001J\"\025E\031\224\247j\024*\246k\361H\002'\006#\345"
+	.ascii	"\320HL\241\022\025\327\033\223\002\245\320\021\031\244\262\300"
+	.ascii	"\202hT\2054\024\251\252\321\346<A\370\3219\004\021\253\222h<"
+	.ascii	"W#$\026A\304j\2044u\321h,\022\345\250+\321\005\242\242\022EG"
+	.ascii	"\020\241L\037p\363\023\"T\024\304\241!2\311\302DP\0201\304\t"
+	.ascii	"*\n\342\220\215\016\t\"2\344\224 B%*\256\253\222h\334QW\342\372"
+	.ascii	"\302M2\250H\224c$\252\311\341\b%(\221G\342\021G\005u%\006\025"
+	.ascii	"\205\216\305\235\2335I\\_H"
+	.string	"\252D\305\325f-\036I$\327\342\221\204\220jD\223\252\020\021i\\\221\310\006 a\250`U\225\252\013D\352\252d\241\274\021:\252\312\235\024H\2248\026\211,\240\bB\032o4\b%\221\026 \"&M \223%|^\3301A,\241*\211I\007P tTq\204T B&\213TU\343\240\bB\032\217\025\030B\340\205\023VP\201\207\002\020D\254Ib\221\210\n$\221+\222\005uU\215EDH\024\210T\024y0q,\036\217F.\250\310Q\2151\030!\205\316u8B\t?!bEr\304\212$\317\n\342\212\244M\021\221((i&U\241b\nd\262h\270\"9T\032\305\240\324Y\241\032\213\214R\0302\022O\330\024\355\b\025\323\241\344\260X\244\034\256HV\240\n\025\223I5\005rx,~\030\23202\026\371hXU\245\232D\256F\304\241\320\261\030\303p%*\207DF\311\025\205Z\244\274"
+	.ascii	"G5\022\203\2246\353\260\250T&o\202\222BE\"\363X$\322(\202\324"
+	.ascii	"\023A+\210DzG\211\202\221\230\302\210,J\252\353\221DP\262\002"
+	.ascii	"\245\252&M\250)\250F\023\307\023\210\210(\244(\032\332`"
+	.string	"T\217G\342\211\240\341\n#\342p\005\221hG\310\210<\241T\223'`PWb\212\342\032t\202*\204d!Y$\372\004\251J\243\341\261H4\\\221\274Y;$\3255\347X,a$\026\223\252R\303\n\030V\270`\303\023\264\006\255)\fA\305\244zTM\350\217P\302\007%\230\260\002\275\t\007"
+	.string	"\341"
+	.string	" \2347\341"
+	.string	"??\007(\341G\277\204\037\274\016\223\353J\324Y\323\244\212\"\211\264@\221\220Q\252\016\205H\240P\022a\030\n\262Y\225F\243\022Iu=\252(\244PSPW\242\0138Fd\020rE&Kd A\244\242\204\006\"\025%\204\324\240#\013\345\261\002\252\322H\007\305\261\270\202\272\022We\272\242(A$4\244\256D\241\"#\033u\250\n!YP\223F\306\"q(g\375\t\021B\252q\270\2360Q4\036\221EeRMq,\246(\b\251+(\215V\342\252\324\260\016Q\245\t\"\f\310\342\271\356\034M\024\215\304\341\020\375\t\021!(\207+\324\325\210H\303\360\\\217F\310\240\341\020M\252G\025\310\341\020U&U\245\321q8\324B\307\"\212\341\360T\036\213E\312\341\020=\"\213\312\242Q\035\016\323u\270*\213\306\f?!\342\003!5I<\241\374\300"
+	.ascii	"\353\n\365h$\036\223\352z,\236X\213\206\303\nR\250\311\242\341"
+	.ascii	"\360\034\236\303S\005AQ9\034\236(\202\220+\024!\221+\034\213"
+	.ascii	"D\"\2345I\\\225C\023\305\241#2h8\324A\246H\252J\234\025E\t\""
+	.ascii	"\025E\347Q\034\213+\024\t\031\245?!\002\305\261h,\0222\322 \251"
+	.ascii	"\246H\252/(\213Zh\350\026\225\367X\034&\205\204\210(\202\220"
+	.ascii	"\312\233uHT\336\2600\026\211\210C\303cQi\263\016\3235\211,\372"
+	.ascii	"\t\021\307\342\210U=\026W\365hA\252<"
+	.string	"\223BBDdR\005\301\360XT\352\024Aj2\257IdQN\n\t\0213\212cq\005\"\025E\350:,\341'\271\026\255\307\242Q*\244\252E\312a\022\271\"\211n\326a\t?\353\261\210\256\3035\211,\321\002\221\212\242\035\243\242\325\b9$RQ4B\231TS\024\223B\353\260\005\022\031Y\274\353\320\005\024P *\256:\031\024\204\207\324\024\324\"\0260\fY \001\303\rQq\305\252\221\030\364\202M\013\252\322hTt\243\002i\034J\252)ZP\203\222\310\241\034!\325\030\003\361\250\242\310$\013\023\251r\230BM!(\210\250W\025E\020\261hH$4d\363\023\037\216,R\223#V$29\342\246\250D\026\341\024\021\021\327\224EQr\230$\032\215L\034\211C#\242\242\017\bX\254H\252F5(\2108L\022\325c\32184\"*^\260\022\215>0<\"\213+q=\252\305$rhDT\234"
+	.ascii	"\004,V\fY\254\305 \244QM\201\363\023\"\020\020\244\026)U\242"
+	.ascii	"\342\252\327\241JT\\\207C\035\244*\207)\326s\035\2328\"\215\312"
+	.ascii	"\241\321H\fR\262P\016\207\032\202T\345q\230bE\327a\b\"\254\307"
+	.ascii	"\242\221^\207&\254\307\242\021\352\200\025H\250\220\177B\304"
+	.ascii	"\032d\224\\\225#\224j\021\213u\204r-\3060\302\350h\342\203\025"
+	.ascii	"F\307\242\361\203\021J\030\226`\302\212\021\252\220\2211\350"
+	.ascii	"X\034\221T\032\215(@\bB\252\322\350h4\324gr-\302\021\"\252I\235"
+	.ascii	"\344Z\224\263\026\223*p\204\216\352p\310(\006UI\214!GU\022c\030"
+	.ascii	"\026\031\241\b\"\3060l\201\304pG\350\250\016\325\024D\345\260"
+	.ascii	"\005\022C\034eRE\221$\022\r\365\261H<\0214<\221G\325X\034\032"
+	.ascii	"\242!(M\020\215CCt\035\242BF\344\360\346HddD\006\r\223FA\303"
+	.ascii	"\033\325\030\003qM1\324I\022O\004\345!\243\030\326$\362\204r"
+	.ascii	"\230\256\303\026H\fmP\004!\215Cs\035\216P\302\320\020r8LWU94"
+	.ascii	"\204\034\242-\220\030\336\254)\202T!d\320P\267@b\230C\\\211B"
+	.ascii	"CU\250\250bh\343\200\025H\2500l\201\304P\257\312\2421g\310(\206"
+	.ascii	"\241RM\252jrh\210\263\016U\020\024\225\347C\210a\204\037\020"
+	.ascii	"\f@\202\220\210\r7\200\001P\370P\201\t<@\007\211X\001\006\022"
+	.ascii	"/\214XU\023I\342:\342X$\022\215\bJ*G\210\310\200\004!b\321px"
+	.ascii	"\252BH\242\241iD\"\03304\377\333\334\310\242c\267V\270C\013\237"
+	.ascii	"\3116\236\246\320ei\264\035\"j\274\344a\351 \026J\357\306\321"
+	.ascii	"\0256s\317\330\274\226l\340<\0346)\030Ajh\036\370K\311\333\322"
+	.ascii	"\352\314W\222&2h\230g9]\274\240|\231a\352\270\t\323\364\005J"
+	.ascii	"\306\231\325\223#\rH\214\023\306\231vu\327\002\206\356\302\261"
+	.ascii	"\202\207\224V\245\237Hq;[C\245\311vP\231\312\233\262\221*\342"
+	.ascii	"'\267\334\301\221\222\n\333\262\2112\tm\240\322\037;x[9\236l"
+	.ascii	"\2360\215\024\020\313\325\013\033'\334\225s\2249Q\263i:\373\332"
+	.ascii	"\312\004\016.u\254\302\020\362\3310\245:\306\364\275%\331\270"
+	.ascii	"H\307xl}q\311\222'\230\264\004\207\t\2202,H\371\210\016\032\r"
+	.ascii	":\267#\355g\326\311\030\244\262\331\351\031\216\025\234W]Zh>"
+	.ascii	"\331 C%H:\370\2240\2139b:s\363\265\016\034b>\252\326\230Q\267"
+	.ascii	"\205^\341\020\301\266\0358\"Xbj\314\252\233\026SXZ\004\246O\310"
+	.ascii	"H\221\023\004L\231\300\020c\002e\253\303\031\366d\bY\212F\353"
+	.string	"\345\370Xrc\313_\212%GF\031)Z\374\320\277\354\007\0276\327w\"1\251\001\326u\006%\223\263\304\232\002\205\317MS\241\001\333\313o\202sM\360R\275t+M\022(:R3\251\323\2208\257\0347\353.iS\344\312\244U9P\312n\374 \223\326\200b\245\347\343f\023\r\316\326[\231\031cbL\277\026Wz|)\336\271\266\246eJX\230\364\bK\f\f\307\315\251\027\\\202\302\302\302\3025{#\245^n\n&\375\362\324\313wP<4&\2443/O0]xb\272`<\233\263\300-V\\\260\227\022\300\035\271\263\323Hi\232.tX[\362\215\373%X$)\325\242\303<5\265\235\335\034\200\271\024\312S))\224\024\213\332\316\225/\270\302\324\312S,O\353,\225\243\250&7?\275\222V\321wXV\326\\QQ\323\"\313\243\222N\321A\342R$\315\274Z\242kYN;\245K\243 \321"
+	.string	"\200K\337\322\267\364\211\016>\036\204z\252E\024\270T\356\351\023\025f\306\352nN\235\350\215\241\030\031\242ts\032gB5a\341U\335\234\302\235N\310\034\2172v\r\247\251*\212\326\315\007\200\232\006"
+	.string	"_\332\323!iZ\312D\310\323\027\031\340\316\332Z\216-i\222\247L\236\272\345\314\2701\306v\363\323%;\\H1\256\334\234*\371"
+	.string	"\fi\207\330\315\027\2013\b\006\007\343\346\364H\332&\270W\365\026\304\254G\226\024IF\263$P,\311\315i\221\224m\260\357\205\027\234%c\004\301\244\313tm\311\215\301>\016g\r1\034NR#Y0uK\002\327\345\346\224\210\311\364?\255@\214p\311\315\377K\325\274\200\351R\272f\200\224\201b\004"
+	.string	"b\032"
+	.ascii	"ZA\202\244g>[Ghn\b\237\206\004\001D\233\354\261u\231==KRfC\312"
+	.ascii	"\315\251\220\274\227\226'&LPk\300$%K\311\322\037\023\254y2[\263"
+	.ascii	"\245J\216*-{\372#\211\235\221)Z\203\275tG\272#\035\333\320"
+	.ascii	"\367\024\026d\0048"
+	.string	"\230\256\244=\236\216\321\241>\222fp\2719\345\221\212\241]_K6R\2614\f\207\0165Wj}a\2047\303i\r\266p=\375\342Ju\370l\035\361\221p\365\004\004\013\340f\302\002\201\003f\b\223\262T\207\224/&\271,7\247^Os\374\351\235\003\264\241\344\346o@\246\323\256\rn\350\r\374\322\253\364*\335:\342A\210\253\262\352\230n<\335\242\273PQk0nN\265\364\306\331U.\240nN\263\236\027\366FEus\212e\345rfT\311\322FC\013\300I\214\030i\r\237-\374\245\357\346Ea\330\235\325\323\032gW\2275\264\233S\032w\317\364\352\2432vs:C\306\223\026\300\030\024TZ\345\263\205\303 \341\362C\263\221Z\332\372\242zZe\301\b\022\242\2719\235\272~8\r_\032\"7\247R\270\013\267\311\310\222\025\210q\250$\243\r\325F\f\255rX$\016\2438GQ\347\230\252\342\004"
+	.string	"#\026"
+	.string	"@HD\"\220\212\322\254z\024"
+	.string	"\023o\272\220j: LQ\2304\214\031\020"
+	.string	""
+	.string	"@"
+	.string	"\"H"
+	.string	"\302\241\003h~\372\203;\233\340\033\316\340N,4\337R\267\035\016\211T\332"
+	.string	"\313v\330\211\253,\250\305\352\"@\266\341\313\366&e-\274\375\274\350\303 \240\300I\207\277(\030~\024\243\260\205\266\261\356A\373s\f&\232\337D\326\3003\213\033<\023(-\322\032y)t\026\317\350\2341\354\007\301]\036X\037Y\367\256\247\032H\244D\210\200\250\r\036R\247xdc\265\310*\017\206\320\372e\231\3062)z\360\006F\313\032\206\221\222\377\261\235\317\377J\037j\341\2504\"Mw<\211N)4Ky%K<\345\007\275[2\2312\305\r"
+	.string	"\033\220\304\307;\017a\353\316om\311&\226\235O\345s\370\255\345j\2423\334/-\222s\255\202\304"
+	.string	"!\304\203\331x\276\013/&\201\007f\362\342\234\270\251\215\016QM\0072\2676\221\305|X:\364v\266\006\236A,1\b!\343\371k\376\370\200\345\261T\024\334\336\315\036\234\314\303[D\265\323\333\326\323\365\220\315+\317\204\202!&Dh\3440}7Tj\023\306\221\263\252\343\037\327A\215\320\2665\272U\320\374\246\340\362u\314\315f`x\306C\266yT>:\237M\3755k7\231M\242~\3461l \261\r\\Y\021\311\0269\365`\316\376\277d\202\365\360\236HOK\"S\370\rYh%],\003\374C%\350Y\001|{\t\260\361e`\337D\200\326:\335\200\2126\204vz\262\365\022\307\322L\340\017P]|uW\241\315\226M(/\260\023J\250x\304\301P\341IR ~9\364\230y\f\342]\356t\201\234\244\335kC"
+	.string	"\003\006\223\203\0302\337\375\277\027\275;\206P\347#\24464\202\201G7\355\215\253\200\332OUg\335\200X\3002S\333\004\003\235\310\363\\\273.\346\"\340\311\356{=6\f\017!\024\337d\301hAMy\227\303\334\235b\002\236\207\035)\355\334\210\365\321>2\226&\362\f\007\200\022\271\017\326<\t\240TrJ\350&\315\225\252O\005\030\024\351W\024X>\370Vg\271\365&N\023\270\227L\362fs\253qG!((\247OA\232\b\277\336\314\244_\314\317\013\323\342(!b\3151ggP\037\"\024\240\346\200\317\311\350\216-P\374m\233Xp\352\316\277\025A\334\202\022&\306o\022K\370\341\016>V\371\344\374\007\003e\020\244\r\322kD"
+	.string	"(\364G\254b\361\002\307\363K\342\216"
+	.ascii	"'\332}\301w\314?\343\267\241H\271\307v\314\307L\004\307\310\357"
+	.ascii	"4\357\225\353U\027O\330\351\372\257k\221-\332]~7\002\335\200"
+	.ascii	"6\212b\302\363m\246\266v<>\025e\016\371.2%\"e2\320Bh\304\274"
+	.ascii	"\222\301J\334\330`[7\241\243/\276;\001O\354\021\007\203\362\234"
+	.ascii	"\366AX\310D\267/\276\006\332\3734\253\265\372\272u\027\366\245"
+	.ascii	"\325\237$\n`\b@\227\\\013]k\204l\235\204\245\304\027r\203\004"
+	.ascii	"\337tJ\300\005\225;j\241s/\fK\230\270\030-\346\225\354\227\323"
+	.ascii	"\350-\322\310j\304\357\276\001\001\211\303\314L\030\351\3300"
+	.ascii	"\033\375\2248\213\031\007t\356\304\033\337\034\315\020\277"
+	.string	"\004\350\322~\200\33238\003\017w\310G\345%\342\346C\202\335\215\017r\245\343Jc\202\366)`?\254dq\232\317qc\227\r_+\034\002\231L\021\002\1772\242Q\276Ft\304\203\321\017\256\177\341?\273\023\007\016k\224V\277\322\246\rm\311\177\243\017O#\305\356,fAC\022\n|N\t\243r\004^\360\376\331\027,pH\245\024\237\001\250QY\235\0363e\345\276@\242\255\205\341Z\267-~v\254\304\213\240\217\035\007\326h\326p\223\320rxK\365\225\320\345\031\323,\315\376\204\006\017+\213t\216\340\240\256\201\037\317\0072C\0320\366\2041X\335\020P]\027\324-?\300\2560\340\273\340.\274\373\271+\231\200}+\351\033\341\033B\202\373\377T!\260\025E\244e\352\302\353l\034\321\3178\333\f\210&\0211\3629\307$\245\260zf \252\364\201\033o\237#\344;h[mx\020D\316\243\313\206$9"
+	.string	"d\360-\013\005\300y5\353\017\036\r\353'R!Q\244\030\226\366)&\327:\201$\304\023\314\025\253.;,:\242\342K\330\312\357T\352JW1!]\030\351\324\201\337ChZ\356\001\216f\021D\366/\237\204\271\032|\374Y\213\"\343'\302\017\240Q\3531\225\034c\261\277\006W\264H\231\276"
+	.ascii	"y1\245\2425qxn\303\033yy|\245\255\003\254\230)p6\353\371\254"
+	.ascii	"+)\344X\n\034B\2259\226iv\362g@\254\220H\366\316.k\266\263K\334"
+	.ascii	"\333\247\376\346\"\361\200f\354;\377O\355 ;\352J\365^C\303\201"
+	.ascii	"=\325\356\022\345\3558\357.\212,\230\023\030\360\336\334\311"
+	.ascii	"\370\230d\303L=\033\013^\343\342\301\241\245\321\227/\203\005"
+	.ascii	"\306.\327\270\360\3609X\\j\341@#\316bL:\227\201d\325\206\210"
+	.ascii	":E\373\r\326\025\267ae\272o\314lG\364\362\206\265\343-0\354\346"
+	.ascii	"H^+\371I\262\210f;\037\002\266&Ac\320\225V\322\202\214\274\201"
+	.ascii	"\033\315i\304\2014'\370\350\275h\t\242\031"
+	.string	"\001ol9\301\336\035/#\241\231v\214\256\352\260\230\326\321\333\375\211~\363\f\022\301\b\036\254\027\261m\b9l\265\230\003!<\332\255\303\2673\037\335\303e\250j\356\036\201(\265\254\273\306\224\235\030D\305a\240\316\316J\347\262l\350\360\266f#\223\242\254m\204Y}\212\345\312\001v\206\340M@\263@\025\267f\007\021\215\255\245{K\374W*\312\003\243\250\223\333\307\342\217\243\217mQX\264H\030\204\303\255\025\271B\315\375\b\035B\365\362e\177\273R>\311:\214\224\345\226\240\252\313<dL\204L\332^(\316\226\346bQ[|\025\327 ]T@\332\32221,\215\202ZD\344\024\272\241\334\001D\213\330\004\260\204Q'\032\354\3333\230R\353\016\234\003\262\323W\217\355M\270\205\360\215\013\360~L\231\331lN\027\372+\300\356n\206a\336Q)&\232\254\240\001#)\211\357\301\240$\034_\244\374\320q_D"
+	.ascii	"\256\026\344\325\002\301@e\033\304\336\354\312\2013\301D\207"
+	.ascii	"\301\252\004K\036)\034\035\263\317\002&J\275\003,\224\265#\232"
+	.ascii	"\225\322]\211Q\347\002\245]\227\334\30374*\363\036\324\370\303"
+	.ascii	"\033\353\323kX"
+	.string	"T\301 \204\006G\300\346O\225}\232\270\274\020\212;\377\301\032t\360\230Ha\332\231\004m\222\275\255\226j|\225\336/\t\320\264-#@:\323\030i\231d\342\027\372)1\026J|\234\325$f\256\030\326\025\207\200\315\276E\261\002\201\021\002\3401\215\372\322,\364\227Z0\247\255\303\365\346\244\210q\225\220_\025\200\303\036\214\020\370\301)[w\324\261q\326\303`\023\246)RzS\201>\300;\3314 \346$^\335\307\357\367\".\354\337\230\205\337uV\004\204\312\240%\367l\013\260\344<X\023OIY\320a\260\366\373J%\b\216\330\365i\366\341\250~\275\3208\373\246\214\013X9\004\244B\215~\336e\221\237\375@JH;\267\335\227\201w3\253lE)\3055~;\207\021\023\244\376wbi\333\317\212gFq\364\314\202\214]F\335+\236\370\tR\275:"
+	.string	"D\210UQ\027\301\375\300\340n\361\203\0252R\337I\246\354#\357\374i\337\367\373\003Z\244\303s\352\330\332\037k\326\311\016MG\353\250\215\003B\\A\243\325\364\353\003\226\3140\024\261\222\016'\3213\311\024\200\026mHS\016\341\nSa\274l\225\003Wk)\225\300\201\257\214\260\002x\344\256\342(\277k6+\274N(\241~\3666^\256q+\302oe@u\026\223\273!~#\356\256\031\305J\336%\237\224\032\240#\323\335\323\256\234\326lDB\353\241G?\320\340\367`\202\034\211\3360X\210\0224\274\274\247E\311L\237\272~4\234\271\321\204\223\364x\266x\003M\034\223\033\214\231"
+	.string	"\207\004\230X\356\t\264\306-\372@\256\337_#\275,@^\257\210\232\313\204\253\330\002\345xG\341\0209\325D\317\230\251\034x\304\353\3303\223\205nyR\376\271v\263\357,H/\215S$f\021\367T0QT\177\301\\I\352\027P\034\231\013\200\354&\r\373\344#\364t\246>FT\024\227\017C\001\367S\333\361\240\313M!-\362"
+	.string	"\235\217\256\236\362\230\374hl\004\353\357;\203\326\337\216'\b\305\037P?9\200Z\322q\340\257^:\006?8\367V\247\266\237\026\226\375\326\237\363\303\323Y\334i\357^\202\024\177\270O\330\236\331\035\324\273o(\341\303\335\317VY\371x\235;RE\004\217\331=%\242\361\231\007\221\357\344"
+	.string	"\235*\365\321\237\025\312S\234\326\004P\023\264\360\260U6\347\\4\310'L\363\331pxo6\275\032g I\001\317,\002O+\361>\240,\372\365 \205@db\\\3413s\315\217\302y%\250b\201\0242\034F\3624X.<\363\216\004\367v\031\2719Q\037\222<\207\231~]\305\264\266Q)D\001$\232\371{\204\372\304W!pD\300\241\3448ixrr\303\034{D\026!\335yO\205\237\276\237PD\205\220\024\t\246\202\222\030\232\262+j\344\263\026 \313\377\023#\177\375\3275\301H\255s\372-4\230t"
+	.string	"O\316\016\327\311\360\306f\373^\363\375\330\032\350\315\215\347OD\225\255\032K\037\2149\322R\257T\025\fx\333\2169\267\332\325\034\320\273\377.\r\212W\005\215\200\016\372\271Y\361\230>\277\033\242\364\n.\326\203\310\226\017\350\330r\206\016a\266\245\035d\226M\373\344;\323\332UN\200\365\327\tai\233u\204\b\276\357F\270\257\002z\030\231\256\260\344\326\343$(Dt\033\306\306\256\273\247\250P\315u\363\346\032\002{\241#\t\222\355L\034q8\366\037a&.\002[vO\t\025\313\276OC\327\336\026\245t\252p\260\177P\bc[\001>\017\202\362\204\320\024\256\354\256uy.\325\244,"
+	.ascii	"\355\034\267\317\247,\231oIIY@IY\270\302 \216.\035Q\213\t\320"
+	.ascii	"\240/\255\224\036\243\271\277r}\016\330\335\205\361\357{2\371"
+	.ascii	"\344\220imI\226\223lVWa\023g\233J\2236\177\237I6Z~\032\022w\013"
+	.ascii	"s\2346j%\203i\260\334\320\037\276([\352D\330\35275\323\003#."
+	.ascii	"V}\360\340\025\020\366p\002M\271\251\347\026\0302%\n\256V\342"
+	.ascii	"\004\330\261=i\363+ N\270wl\240^]PR\331\255\276D$ \310M\036v"
+	.ascii	"|\340\371\b\346<\0043\200\2501x\241\306\327\3030^\207k\021\023"
+	.ascii	"q\322\245r\243:4\372\027t2\325\005c\342}\001\034\344h\301\337"
+	.ascii	"\244\236\365\247k\352\251C\240\304\277ob\n\211z\342R\036\341"
+	.ascii	"{|1-bD\307\351iHk\021=.\2130\251\202\025\216\016W\377AL\350\252"
+	.ascii	"\310k\003\005\017~\272\201\315!\262i\304\013\3165\303\267o\030"
+	.ascii	"\002Gz\331\312\037)\003\241\313\252? M\345\312\2671 \001eB\227"
+	.ascii	"\001\201E9\344\3013(T\034\230\300\364\005\235\210\264\245\340"
+	.ascii	"\234t\032\315\320\250\037K\263\032\227\360#\307\025R\361\337"
+	.ascii	"w\330\222g\241phTC\277}6lf\036z\320\271r\254\271\267W\244\020"
+	.ascii	"]y\217\362Z\225X\0311\343qso\004\002\311\322qq\316:\230\253\326"
+	.ascii	"c\236\262\n~\037{^\250\f\376\236\216\376\220)e\215\261+R\235"
+	.ascii	"\260F\254\210h\276(\224\\\260\260\267\243\244p,\031\210\255o"
+	.ascii	"Z\305_@\341\250}\013\024\210V\252\3308\241*\267\223\002X\250"
+	.ascii	"\241%-\033~U\352>\307d\005;\207\226)T\f\322I\367\021/\354\033"
+	.ascii	"\367-\336\343\002L&`\021\0020\342\\\314^+\315m'g\370\316\256"
+	.ascii	"\351\365\321\273N\203\334 ( \340\376O\375\350\351\243\372\262"
+	.ascii	"\250\304\"\363\007\013\316\262\216\271\031\022\307\255\237+\227"
+	.ascii	"\217gC\324\205\271_\232|\253\316\261!\231U$e\217k\312\376&*\303"
+	.ascii	"\022\\\250A#\277\f\216\270:\006\276\374\216hY1L\342\024GXn\210"
+	.ascii	"\315\266;\263\255\024\314y\324\215D\323n\007\200\312\037\303"
+	.ascii	"\341#\004e\275Kx2\373\262\215\376\230\236\236f\241\301\211:\004"
+	.ascii	"\227a\342\362x%\376h\266L\327\257\316\353\347\020E\320\204\017"
+	.ascii	"\"\266`\270\225\210\232\253\214&\002\243\222\210\242:Z\267`W"
+	.ascii	"\304-\223\360\326TO%\215\3757\204\006\321\257\266\275\236\022"
+	.ascii	"\371\310:#\003\001\325\354\034\017\217\230\303\233?\006\225\350"
+	.ascii	"\311\034z~wR\306\374n\346,!\253\017\366\275\215\254\361\311~"
+	.ascii	"\205\345\034\203\027A\222\016\207\225:\337B\221 \273\321\370"
+	.ascii	"\341\013\233\f^\270U\336\360\303\377\300\244\214\030\206,\301"
+	.ascii	"\003\311\245\331$\246\270\265h\215w\367/bX3sE\231\023\024)\024"
+	.ascii	"d?\207\211\341I+\207@'\333\333"
+	.string	"\270\330\032\243\np\f(\026\354\r\n\352\233\234\223\354\332\357\3466\241_;\021\307\021E\311\227<\335\"\004B\233\315\fG\351\307?`\317\336\230oy]\034j\210\235\315|\226\266w\371\313\030\243\b\020gN\371\276\"\230\340\262\321\336\340]F\270%L\264\030\364}\272\327\225<\262k0|\327\226Z\254e\376@4o\244\035S\207\256^\344/@\347Q\034\024\013S\314\031^1\022\033\321\316\347\370\250iS\001\007\235S\254\036\343gr\3148\357\355\021\377\266\215\211\320\234\373\331\005\235A\205%\327\307\230bJ\031\367%\240\225}\373\276\204\353\213\344\347O\037\372\326&l\267\032\201\305\331Y\262\3724\006\241\2123\023\222\013\031m/2[?\fL\336\333~|\322\033j\302\346\033\357\224\027~\223\373\343!a\f\336\240be\200\"\3068Q|,\344Kq\313D\204u\025%\221\210\370,7\"\035J\300\300\030k"
+	.ascii	"\247\307\321iI'"
+	.ascii	"g\004\205\300\374\214!{\354P\344\323\360\346\231z\3572\337\356"
+	.ascii	"A\r2?\236[0Z\007\3110\034\307\345\234\022w\332<a\177s\312\347"
+	.ascii	"V\274\266\337>8\321\036}\374\352-\016M\256\265\346nq\366\202"
+	.ascii	"\214\334\257)}7\314\002\005\217\302-\2011\303Q\r\335G\363\202"
+	.ascii	"\340\357\227\350\375\253\031\017\267V\355\240\207\344\364\310"
+	.ascii	"8\203\242\335\361\360\323\302\336\351\371\345&Wj?P\034N#\366"
+	.ascii	"\035\016_\330\177\372\272\273\370\374=\234\274\255\366\254\262"
+	.ascii	"\017}\007\345\006\271\036.\204\001\022\235\177\236)X\021\374"
+	.ascii	"\017\n/\003\017i\260\235\203i\263s ?q\210\250\331\001\373\215"
+	.ascii	"\252|\2046\257\260\327\257q4:>\3676pI\373\337\250\327+\205\027"
+	.ascii	"m\370\223\315\2262\377\"GA\361\215\013Z\033#\277Cg \b7\257[\310"
+	.ascii	"\336\226\3762B\272\231\364e!~\365\354\005"
+	.string	"#\233\366\355pF\377\246\315\007\344f\232\372\021\247\207\355\375\n~t\226g\212\357\271\352\354\234\377\230A\315\307\257|\031\240\360\316\327\370q\356\246\026\216\363\376\317\005k\312\216\261\223\233\245\234\310\3763\004\363\007\"7\350{\203\255\340\312\013\347X3\274^\243\226\0019\003\357\323KnA\211\272\006\224\032&^\316\225\303\023w|\230\300\327\rr\2278b\274\217\257\313\223\323\344\277\031fL\345]5N\271\273I\b\226\243\261\315\336\274?\304\264\246\330\002#5\201W<\212\213\265J+\336\371\366\266W\371-gi\377N\345_l\232j\310\247,\343\221\373\327~p\277\240\006\312{(\343\233W\367\b\232\346\303\267/\247\020\366\311\326(\221\352\346\320\250\205?\213\270\315~5 \035\345>\302\b\227\254\230\367\233\371Vu[?\t0H\034\276\323\355\212s\306\037\275/l\177\211\311V\330'\242\377=\356\271\230[m\306"
+	.string	"]\366\362\324\325\352\274\233[\037\335\016`\363\276\263\335=\370\005\370\376\216\207\210s\036\207\364U\312/%\340\3024\337\221\367T\301\023\313|C\033\016>V\352\216N;\220M\320\330\325M-\2730\f\327\250*G!\017juC"
+	.ascii	"\367\370\207\202\252\177"
+	.text
+	.section	.gnu.lto_.symtab.5fc4e2df5d262bb9,"e",@progbits
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"__config_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"__config_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"tcpDataOutAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"fgetc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\004"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\004"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5fc4e2df5d262bb9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
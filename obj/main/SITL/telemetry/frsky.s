@@ -0,0 +1,17031 @@
+	.file	"frsky.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/drivers/bus_i2c.h"
+	.file 7 "./src/main/drivers/bus.h"
+	.file 8 "./src/main/drivers/sensor.h"
+	.file 9 "./src/main/drivers/accgyro/accgyro.h"
+	.file 10 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 14 "./src/main/drivers/resource.h"
+	.file 15 "./src/main/drivers/serial.h"
+	.file 16 "./src/main/common/time.h"
+	.file 17 "./src/main/fc/config.h"
+	.file 18 "./src/main/fc/rc_controls.h"
+	.file 19 "./src/main/fc/runtime_config.h"
+	.file 20 "./src/main/sensors/sensors.h"
+	.file 21 "./src/main/sensors/acceleration.h"
+	.file 22 "./src/main/drivers/barometer/barometer.h"
+	.file 23 "./src/main/sensors/barometer.h"
+	.file 24 "./src/main/sensors/current.h"
+	.file 25 "./src/main/sensors/voltage.h"
+	.file 26 "./src/main/sensors/battery.h"
+	.file 27 "./src/main/io/serial.h"
+	.file 28 "./src/main/io/gps.h"
+	.file 29 "./src/main/flight/pid.h"
+	.file 30 "./src/main/flight/imu.h"
+	.file 31 "./src/main/telemetry/telemetry.h"
+	.file 32 "./src/main/telemetry/frsky.h"
+	.file 33 "./src/main/telemetry/frsky.c"
+	.file 34 "./src/main/flight/altitude.h"
+	.file 35 "./src/main/config/feature.h"
+	.file 36 "./src/main/drivers/time.h"
+	.file 37 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	frsky.c.067d59e5
+	.weak	frsky.c.067d59e5
+frsky.c.067d59e5:
+	.long	0x1773
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2b
+	.long	.LASF2299
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1816
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1817
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1818
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1819
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1820
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1821
+	.uleb128 0x3
+	.long	.LASF1822
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x37
+	.uleb128 0x3
+	.long	.LASF1823
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x6b
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1824
+	.uleb128 0x3
+	.long	.LASF1825
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF1826
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x30
+	.uleb128 0x3
+	.long	.LASF1827
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x45
+	.uleb128 0x2d
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1828
+	.uleb128 0x3
+	.long	.LASF1829
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x3
+	.long	.LASF1830
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7e
+	.uleb128 0x3
+	.long	.LASF1831
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x53
+	.uleb128 0x2e
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF1832
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x3
+	.long	.LASF1833
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x23
+	.long	.LASF2190
+	.byte	0x4
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x4
+	.byte	0xd4
+	.byte	0x9
+	.long	0x103
+	.uleb128 0x2
+	.long	.LASF1845
+	.byte	0x4
+	.byte	0xd6
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1834
+	.byte	0x4
+	.byte	0xd7
+	.byte	0x3
+	.long	0xec
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1835
+	.uleb128 0x16
+	.long	0x126
+	.long	0x126
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1836
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF1837
+	.byte	0x5
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x18
+	.long	.LASF1843
+	.byte	0x5
+	.long	0x30
+	.byte	0x6
+	.byte	0x1e
+	.long	0x16c
+	.uleb128 0x25
+	.long	.LASF1838
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1843
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x13e
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1844
+	.uleb128 0x7
+	.long	.LASF1848
+	.byte	0x10
+	.byte	0x7
+	.byte	0x1a
+	.byte	0xc
+	.long	0x1a7
+	.uleb128 0x2
+	.long	.LASF1846
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x16
+	.long	0x1a7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1847
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0x132
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x103
+	.uleb128 0x7
+	.long	.LASF1849
+	.byte	0x8
+	.byte	0x7
+	.byte	0x21
+	.byte	0xc
+	.long	0x1d4
+	.uleb128 0x2
+	.long	.LASF1850
+	.byte	0x7
+	.byte	0x22
+	.byte	0x12
+	.long	0x16c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1851
+	.byte	0x7
+	.byte	0x23
+	.byte	0x10
+	.long	0xb7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2300
+	.byte	0x10
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0x1fa
+	.uleb128 0x1f
+	.string	"spi"
+	.byte	0x7
+	.byte	0x20
+	.byte	0x7
+	.long	0x17f
+	.uleb128 0x1f
+	.string	"i2c"
+	.byte	0x7
+	.byte	0x24
+	.byte	0x7
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1852
+	.byte	0x7
+	.byte	0x25
+	.byte	0x3
+	.long	0x1d4
+	.uleb128 0x12
+	.long	0x1fa
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x8
+	.byte	0x17
+	.long	0x24e
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1862
+	.byte	0x8
+	.byte	0x21
+	.byte	0x3
+	.long	0x20b
+	.uleb128 0x3
+	.long	.LASF1863
+	.byte	0x8
+	.byte	0x27
+	.byte	0x10
+	.long	0x266
+	.uleb128 0x5
+	.long	0x26b
+	.uleb128 0xf
+	.long	0x276
+	.uleb128 0x4
+	.long	0x276
+	.byte	0
+	.uleb128 0x5
+	.long	0x27b
+	.uleb128 0x7
+	.long	.LASF1864
+	.byte	0x88
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x10
+	.long	0x318
+	.uleb128 0x2
+	.long	.LASF1865
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x25a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1866
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x318
+	.byte	0x8
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x11
+	.long	0x1fa
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1867
+	.byte	0x9
+	.byte	0x50
+	.byte	0xe
+	.long	0xc8
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1868
+	.byte	0x9
+	.byte	0x51
+	.byte	0xd
+	.long	0x5b6
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1869
+	.byte	0x9
+	.byte	0x52
+	.byte	0xa
+	.long	0x98
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1870
+	.byte	0x9
+	.byte	0x53
+	.byte	0x9
+	.long	0x178
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF1871
+	.byte	0x9
+	.byte	0x55
+	.byte	0x15
+	.long	0x5a3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1872
+	.byte	0x9
+	.byte	0x57
+	.byte	0x14
+	.long	0x24e
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1873
+	.byte	0x9
+	.byte	0x58
+	.byte	0x1a
+	.long	0x4a4
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1874
+	.byte	0x9
+	.byte	0x59
+	.byte	0x18
+	.long	0x3ea
+	.byte	0x68
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1875
+	.byte	0x8
+	.byte	0x28
+	.byte	0xf
+	.long	0x324
+	.uleb128 0x5
+	.long	0x329
+	.uleb128 0x15
+	.long	0x178
+	.long	0x338
+	.uleb128 0x4
+	.long	0x276
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1876
+	.byte	0xa
+	.byte	0x80
+	.byte	0xf
+	.long	0x344
+	.uleb128 0x5
+	.long	0x349
+	.uleb128 0x15
+	.long	0x178
+	.long	0x367
+	.uleb128 0x4
+	.long	0x367
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0x12d
+	.byte	0
+	.uleb128 0x5
+	.long	0x206
+	.uleb128 0x3
+	.long	.LASF1877
+	.byte	0xa
+	.byte	0x81
+	.byte	0xf
+	.long	0x378
+	.uleb128 0x5
+	.long	0x37d
+	.uleb128 0x15
+	.long	0x178
+	.long	0x396
+	.uleb128 0x4
+	.long	0x367
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1878
+	.byte	0xa
+	.byte	0x82
+	.byte	0x10
+	.long	0x3a2
+	.uleb128 0x5
+	.long	0x3a7
+	.uleb128 0x30
+	.uleb128 0x7
+	.long	.LASF1879
+	.byte	0x20
+	.byte	0xa
+	.byte	0x86
+	.byte	0x10
+	.long	0x3ea
+	.uleb128 0x2
+	.long	.LASF1866
+	.byte	0xa
+	.byte	0x87
+	.byte	0x1a
+	.long	0x338
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0xa
+	.byte	0x88
+	.byte	0x1b
+	.long	0x36c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1881
+	.byte	0xa
+	.byte	0x89
+	.byte	0x13
+	.long	0x396
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1883
+	.byte	0xa
+	.byte	0x8b
+	.byte	0x3
+	.long	0x3a8
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xa
+	.byte	0xa9
+	.long	0x44b
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1896
+	.byte	0xa
+	.byte	0xb6
+	.byte	0x3
+	.long	0x3f6
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xa
+	.byte	0xb8
+	.long	0x470
+	.uleb128 0x1
+	.long	.LASF1897
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1898
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1899
+	.byte	0xa
+	.byte	0xbb
+	.byte	0x3
+	.long	0x457
+	.uleb128 0x7
+	.long	.LASF1900
+	.byte	0x8
+	.byte	0xa
+	.byte	0xbd
+	.byte	0x10
+	.long	0x4a4
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0xa
+	.byte	0xbe
+	.byte	0x11
+	.long	0x44b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0xa
+	.byte	0xbf
+	.byte	0x19
+	.long	0x470
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1903
+	.byte	0xa
+	.byte	0xc0
+	.byte	0x3
+	.long	0x47c
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1904
+	.uleb128 0x7
+	.long	.LASF1905
+	.byte	0x10
+	.byte	0xb
+	.byte	0x33
+	.byte	0x10
+	.long	0x4df
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0xb
+	.byte	0x35
+	.byte	0x23
+	.long	0x4df
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0xb
+	.byte	0x36
+	.byte	0x23
+	.long	0x4df
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x4b7
+	.uleb128 0x3
+	.long	.LASF1908
+	.byte	0xb
+	.byte	0x37
+	.byte	0x3
+	.long	0x4b7
+	.uleb128 0x7
+	.long	.LASF1909
+	.byte	0x28
+	.byte	0xc
+	.byte	0x16
+	.byte	0x8
+	.long	0x566
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0xc
+	.byte	0x18
+	.byte	0x7
+	.long	0x30
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0xc
+	.byte	0x19
+	.byte	0x10
+	.long	0x45
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x10
+	.long	0x45
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0xc
+	.byte	0x20
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1915
+	.byte	0xc
+	.byte	0x22
+	.byte	0x9
+	.long	0x6b
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1916
+	.byte	0xc
+	.byte	0x23
+	.byte	0x9
+	.long	0x6b
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0xc
+	.byte	0x24
+	.byte	0x14
+	.long	0x4e4
+	.byte	0x18
+	.byte	0
+	.uleb128 0x26
+	.byte	0x28
+	.byte	0xd
+	.byte	0x43
+	.long	0x593
+	.uleb128 0x19
+	.long	.LASF1918
+	.byte	0xd
+	.byte	0x45
+	.byte	0x1c
+	.long	0x4f0
+	.uleb128 0x19
+	.long	.LASF1919
+	.byte	0xd
+	.byte	0x46
+	.byte	0x8
+	.long	0x593
+	.uleb128 0x19
+	.long	.LASF1920
+	.byte	0xd
+	.byte	0x47
+	.byte	0xc
+	.long	0x22
+	.byte	0
+	.uleb128 0x16
+	.long	0x98
+	.long	0x5a3
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x27
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1921
+	.byte	0xd
+	.byte	0x48
+	.byte	0x3
+	.long	0x566
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1922
+	.uleb128 0x16
+	.long	0x9f
+	.long	0x5c6
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	0xab
+	.long	0x5d6
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1923
+	.byte	0x9
+	.byte	0x5a
+	.byte	0x3
+	.long	0x27b
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xe
+	.byte	0x14
+	.long	0x709
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1959
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1960
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1971
+	.byte	0x7
+	.long	0x45
+	.byte	0xf
+	.byte	0x17
+	.long	0x72c
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1971
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x3
+	.long	0x709
+	.uleb128 0x18
+	.long	.LASF1975
+	.byte	0x7
+	.long	0x45
+	.byte	0xf
+	.byte	0x1d
+	.long	0x785
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1975
+	.byte	0xf
+	.byte	0x30
+	.byte	0x3
+	.long	0x738
+	.uleb128 0x3
+	.long	.LASF1986
+	.byte	0xf
+	.byte	0x32
+	.byte	0x10
+	.long	0x79d
+	.uleb128 0x5
+	.long	0x7a2
+	.uleb128 0xf
+	.long	0x7ad
+	.uleb128 0x4
+	.long	0xc8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1987
+	.byte	0x48
+	.byte	0xf
+	.byte	0x34
+	.byte	0x10
+	.long	0x871
+	.uleb128 0x2
+	.long	.LASF1988
+	.byte	0xf
+	.byte	0x36
+	.byte	0x24
+	.long	0x906
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1989
+	.byte	0xf
+	.byte	0x38
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1990
+	.byte	0xf
+	.byte	0x39
+	.byte	0x10
+	.long	0x72c
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1991
+	.byte	0xf
+	.byte	0x3a
+	.byte	0x13
+	.long	0x785
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1992
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xe
+	.long	0xd4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1993
+	.byte	0xf
+	.byte	0x3e
+	.byte	0xe
+	.long	0xd4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1994
+	.byte	0xf
+	.byte	0x3f
+	.byte	0xe
+	.long	0xd4
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1995
+	.byte	0xf
+	.byte	0x40
+	.byte	0x17
+	.long	0x90b
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1996
+	.byte	0xf
+	.byte	0x41
+	.byte	0x17
+	.long	0x90b
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1997
+	.byte	0xf
+	.byte	0x42
+	.byte	0xe
+	.long	0xd4
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1998
+	.byte	0xf
+	.byte	0x43
+	.byte	0xe
+	.long	0xd4
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0xf
+	.byte	0x44
+	.byte	0xe
+	.long	0xd4
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0xf
+	.byte	0x45
+	.byte	0xe
+	.long	0xd4
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0xf
+	.byte	0x47
+	.byte	0x1e
+	.long	0x791
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2002
+	.byte	0x50
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x8
+	.long	0x901
+	.uleb128 0x2
+	.long	.LASF2003
+	.byte	0xf
+	.byte	0x5d
+	.byte	0xc
+	.long	0x936
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2004
+	.byte	0xf
+	.byte	0x5f
+	.byte	0x10
+	.long	0x94f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2005
+	.byte	0xf
+	.byte	0x60
+	.byte	0x10
+	.long	0x94f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2006
+	.byte	0xf
+	.byte	0x62
+	.byte	0xf
+	.long	0x963
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2007
+	.byte	0xf
+	.byte	0x65
+	.byte	0xc
+	.long	0x978
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2008
+	.byte	0xf
+	.byte	0x67
+	.byte	0xb
+	.long	0x98c
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2009
+	.byte	0xf
+	.byte	0x69
+	.byte	0xc
+	.long	0x9a1
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2010
+	.byte	0xf
+	.byte	0x6b
+	.byte	0xc
+	.long	0x9c1
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2011
+	.byte	0xf
+	.byte	0x6d
+	.byte	0xc
+	.long	0x9d1
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2012
+	.byte	0xf
+	.byte	0x6e
+	.byte	0xc
+	.long	0x9d1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x12
+	.long	0x871
+	.uleb128 0x5
+	.long	0x901
+	.uleb128 0x5
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF2013
+	.byte	0xf
+	.byte	0x48
+	.byte	0x3
+	.long	0x7ad
+	.uleb128 0x12
+	.long	0x910
+	.uleb128 0xf
+	.long	0x931
+	.uleb128 0x4
+	.long	0x931
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x5
+	.long	0x910
+	.uleb128 0x5
+	.long	0x921
+	.uleb128 0x15
+	.long	0xd4
+	.long	0x94a
+	.uleb128 0x4
+	.long	0x94a
+	.byte	0
+	.uleb128 0x5
+	.long	0x91c
+	.uleb128 0x5
+	.long	0x93b
+	.uleb128 0x15
+	.long	0xb7
+	.long	0x963
+	.uleb128 0x4
+	.long	0x931
+	.byte	0
+	.uleb128 0x5
+	.long	0x954
+	.uleb128 0xf
+	.long	0x978
+	.uleb128 0x4
+	.long	0x931
+	.uleb128 0x4
+	.long	0xd4
+	.byte	0
+	.uleb128 0x5
+	.long	0x968
+	.uleb128 0x15
+	.long	0x178
+	.long	0x98c
+	.uleb128 0x4
+	.long	0x94a
+	.byte	0
+	.uleb128 0x5
+	.long	0x97d
+	.uleb128 0xf
+	.long	0x9a1
+	.uleb128 0x4
+	.long	0x931
+	.uleb128 0x4
+	.long	0x72c
+	.byte	0
+	.uleb128 0x5
+	.long	0x991
+	.uleb128 0xf
+	.long	0x9bb
+	.uleb128 0x4
+	.long	0x931
+	.uleb128 0x4
+	.long	0x9bb
+	.uleb128 0x4
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	0x9c0
+	.uleb128 0x31
+	.uleb128 0x5
+	.long	0x9a6
+	.uleb128 0xf
+	.long	0x9d1
+	.uleb128 0x4
+	.long	0x931
+	.byte	0
+	.uleb128 0x5
+	.long	0x9c6
+	.uleb128 0x3
+	.long	.LASF2014
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x12
+	.long	0xd4
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x11
+	.byte	0x22
+	.long	0xabf
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2022
+	.value	0x100
+	.uleb128 0xa
+	.long	.LASF2023
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2024
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2025
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2026
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2027
+	.value	0x4000
+	.uleb128 0xa
+	.long	.LASF2028
+	.value	0x8000
+	.uleb128 0xb
+	.long	.LASF2029
+	.long	0x10000
+	.uleb128 0xb
+	.long	.LASF2030
+	.long	0x20000
+	.uleb128 0xb
+	.long	.LASF2031
+	.long	0x40000
+	.uleb128 0xb
+	.long	.LASF2032
+	.long	0x80000
+	.uleb128 0xb
+	.long	.LASF2033
+	.long	0x100000
+	.uleb128 0xb
+	.long	.LASF2034
+	.long	0x200000
+	.uleb128 0xb
+	.long	.LASF2035
+	.long	0x400000
+	.uleb128 0xb
+	.long	.LASF2036
+	.long	0x800000
+	.uleb128 0xb
+	.long	.LASF2037
+	.long	0x2000000
+	.uleb128 0xb
+	.long	.LASF2038
+	.long	0x4000000
+	.uleb128 0xb
+	.long	.LASF2039
+	.long	0x8000000
+	.uleb128 0xb
+	.long	.LASF2040
+	.long	0x10000000
+	.uleb128 0xb
+	.long	.LASF2041
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2042
+	.byte	0x7
+	.long	0x45
+	.byte	0x12
+	.byte	0x18
+	.long	0xb18
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x1
+	.uleb128 0x32
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x12
+	.byte	0x27
+	.long	0xb31
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2056
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x3
+	.long	0xb18
+	.uleb128 0x12
+	.long	0xb31
+	.uleb128 0xd
+	.long	.LASF2059
+	.byte	0x12
+	.byte	0x4f
+	.byte	0xe
+	.long	0x116
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x13
+	.byte	0x15
+	.long	0xb67
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2060
+	.byte	0x13
+	.byte	0x1a
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x13
+	.byte	0x58
+	.long	0xb9e
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2066
+	.byte	0x13
+	.byte	0x64
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x14
+	.byte	0x14
+	.long	0xbd5
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x14
+	.byte	0x2d
+	.long	0xc0c
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2079
+	.byte	0xa0
+	.byte	0x15
+	.byte	0x2c
+	.byte	0x10
+	.long	0xc4e
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x15
+	.byte	0x2d
+	.byte	0xe
+	.long	0x5d6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2080
+	.byte	0x15
+	.byte	0x2e
+	.byte	0xe
+	.long	0xd4
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2081
+	.byte	0x15
+	.byte	0x2f
+	.byte	0xd
+	.long	0x5c6
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF2082
+	.byte	0x15
+	.byte	0x30
+	.byte	0x9
+	.long	0x178
+	.byte	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2083
+	.byte	0x15
+	.byte	0x31
+	.byte	0x3
+	.long	0xc0c
+	.uleb128 0x33
+	.string	"acc"
+	.byte	0x15
+	.byte	0x33
+	.byte	0xe
+	.long	0xc4e
+	.uleb128 0x3
+	.long	.LASF2084
+	.byte	0x16
+	.byte	0x14
+	.byte	0x10
+	.long	0x3a2
+	.uleb128 0x3
+	.long	.LASF2085
+	.byte	0x16
+	.byte	0x15
+	.byte	0x10
+	.long	0xc7e
+	.uleb128 0x5
+	.long	0xc83
+	.uleb128 0xf
+	.long	0xc93
+	.uleb128 0x4
+	.long	0xc93
+	.uleb128 0x4
+	.long	0xc93
+	.byte	0
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x7
+	.long	.LASF2086
+	.byte	0x30
+	.byte	0x16
+	.byte	0x17
+	.byte	0x10
+	.long	0xd01
+	.uleb128 0x2
+	.long	.LASF2087
+	.byte	0x16
+	.byte	0x18
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2088
+	.byte	0x16
+	.byte	0x19
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x16
+	.byte	0x1a
+	.byte	0x13
+	.long	0xc66
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x16
+	.byte	0x1b
+	.byte	0x13
+	.long	0xc66
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x16
+	.byte	0x1c
+	.byte	0x13
+	.long	0xc66
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x16
+	.byte	0x1d
+	.byte	0x13
+	.long	0xc66
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2093
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x1a
+	.long	0xc72
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2094
+	.byte	0x16
+	.byte	0x1f
+	.byte	0x3
+	.long	0xc98
+	.uleb128 0x7
+	.long	.LASF2095
+	.byte	0x38
+	.byte	0x17
+	.byte	0x2b
+	.byte	0x10
+	.long	0xd42
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x17
+	.byte	0x2c
+	.byte	0xf
+	.long	0xd01
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2096
+	.byte	0x17
+	.byte	0x2d
+	.byte	0xd
+	.long	0xab
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2097
+	.byte	0x17
+	.byte	0x2e
+	.byte	0xd
+	.long	0xab
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2098
+	.byte	0x17
+	.byte	0x2f
+	.byte	0x3
+	.long	0xd0d
+	.uleb128 0xd
+	.long	.LASF2099
+	.byte	0x17
+	.byte	0x31
+	.byte	0xf
+	.long	0xd42
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x18
+	.byte	0x17
+	.long	0xd8b
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2106
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x3
+	.long	0xd5a
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x19
+	.byte	0x1a
+	.long	0xdb6
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2110
+	.byte	0x19
+	.byte	0x1e
+	.byte	0x3
+	.long	0xd97
+	.uleb128 0x7
+	.long	.LASF2111
+	.byte	0x14
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0x10
+	.long	0xe5f
+	.uleb128 0x2
+	.long	.LASF2112
+	.byte	0x1a
+	.byte	0x1d
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2113
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2114
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0x1a
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x1a
+	.long	0xdb6
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x1a
+	.long	0xd8b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x1a
+	.byte	0x26
+	.byte	0xe
+	.long	0xc8
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x1a
+	.byte	0x29
+	.byte	0x9
+	.long	0x178
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x9
+	.long	0x178
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2121
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2122
+	.byte	0x1a
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2123
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x3
+	.long	0xdc2
+	.uleb128 0x12
+	.long	0xe5f
+	.uleb128 0xd
+	.long	.LASF2124
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0x18
+	.long	0xe5f
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x1b
+	.byte	0x1a
+	.long	0xe9b
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2128
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x3
+	.long	0xe7c
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x1b
+	.byte	0x20
+	.long	0xf14
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2138
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2139
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2140
+	.value	0x800
+	.uleb128 0xa
+	.long	.LASF2141
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2142
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2143
+	.value	0x4000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2144
+	.byte	0x1b
+	.byte	0x30
+	.byte	0x3
+	.long	0xea7
+	.uleb128 0x6
+	.byte	0x5
+	.long	0x30
+	.byte	0x1b
+	.byte	0x48
+	.long	0xf74
+	.uleb128 0x25
+	.long	.LASF2145
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2157
+	.byte	0x1b
+	.byte	0x55
+	.byte	0x3
+	.long	0xf20
+	.uleb128 0x7
+	.long	.LASF2158
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x6c
+	.byte	0x10
+	.long	0xfdc
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0x1b
+	.byte	0x6d
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1989
+	.byte	0x1b
+	.byte	0x6e
+	.byte	0x1c
+	.long	0xf74
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0x1b
+	.byte	0x6f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2161
+	.byte	0x1b
+	.byte	0x70
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0x1b
+	.byte	0x71
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0x1b
+	.byte	0x72
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2164
+	.byte	0x1b
+	.byte	0x73
+	.byte	0x3
+	.long	0xf80
+	.uleb128 0x12
+	.long	0xfdc
+	.uleb128 0x7
+	.long	.LASF2165
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x49
+	.byte	0x10
+	.long	0x1015
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0x1c
+	.byte	0x4a
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0x1c
+	.byte	0x4b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2168
+	.byte	0x1c
+	.byte	0x4c
+	.byte	0x3
+	.long	0xfed
+	.uleb128 0x7
+	.long	.LASF2169
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x4f
+	.byte	0x10
+	.long	0x1056
+	.uleb128 0x10
+	.string	"lat"
+	.byte	0x1c
+	.byte	0x50
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x10
+	.string	"lon"
+	.byte	0x1c
+	.byte	0x51
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x10
+	.string	"alt"
+	.byte	0x1c
+	.byte	0x52
+	.byte	0xe
+	.long	0xc8
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2170
+	.byte	0x1c
+	.byte	0x53
+	.byte	0x3
+	.long	0x1021
+	.uleb128 0x7
+	.long	.LASF2171
+	.byte	0x18
+	.byte	0x1c
+	.byte	0x55
+	.byte	0x10
+	.long	0x10be
+	.uleb128 0x2
+	.long	.LASF2172
+	.byte	0x1c
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x10
+	.string	"llh"
+	.byte	0x1c
+	.byte	0x57
+	.byte	0x13
+	.long	0x1056
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2173
+	.byte	0x1c
+	.byte	0x58
+	.byte	0xe
+	.long	0xc8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2174
+	.byte	0x1c
+	.byte	0x59
+	.byte	0xe
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2175
+	.byte	0x1c
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc8
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2176
+	.byte	0x1c
+	.byte	0x5b
+	.byte	0xe
+	.long	0xc8
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2177
+	.byte	0x1c
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1062
+	.uleb128 0xd
+	.long	.LASF2178
+	.byte	0x1c
+	.byte	0x76
+	.byte	0x1a
+	.long	0x10be
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x1d
+	.byte	0x25
+	.long	0x1125
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0xa
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2191
+	.byte	0x1d
+	.byte	0x79
+	.byte	0x5
+	.long	0x178
+	.uleb128 0x24
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x5
+	.long	0x1162
+	.uleb128 0x2
+	.long	.LASF2192
+	.byte	0x1e
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2193
+	.byte	0x1e
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x10
+	.string	"yaw"
+	.byte	0x1e
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x26
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x20
+	.long	0x1183
+	.uleb128 0x1f
+	.string	"raw"
+	.byte	0x1e
+	.byte	0x21
+	.byte	0xd
+	.long	0x5b6
+	.uleb128 0x19
+	.long	.LASF2194
+	.byte	0x1e
+	.byte	0x27
+	.byte	0x7
+	.long	0x1131
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2195
+	.byte	0x1e
+	.byte	0x28
+	.byte	0x3
+	.long	0x1162
+	.uleb128 0xd
+	.long	.LASF2196
+	.byte	0x1e
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x1183
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x1f
+	.byte	0x1e
+	.long	0x11b4
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2199
+	.byte	0x1f
+	.byte	0x21
+	.byte	0x3
+	.long	0x119b
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x1f
+	.byte	0x23
+	.long	0x11d9
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2202
+	.byte	0x1f
+	.byte	0x26
+	.byte	0x3
+	.long	0x11c0
+	.uleb128 0x7
+	.long	.LASF2203
+	.byte	0x18
+	.byte	0x1f
+	.byte	0x28
+	.byte	0x10
+	.long	0x128f
+	.uleb128 0x2
+	.long	.LASF2204
+	.byte	0x1f
+	.byte	0x29
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2205
+	.byte	0x1f
+	.byte	0x2a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2206
+	.byte	0x1f
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x1f
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x1f
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x11b4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0x1f
+	.byte	0x2f
+	.byte	0x11
+	.long	0x11d9
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x1f
+	.byte	0x30
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x1f
+	.byte	0x31
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0x1f
+	.byte	0x32
+	.byte	0xd
+	.long	0xb7
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2214
+	.byte	0x1f
+	.byte	0x33
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0x1f
+	.byte	0x34
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2216
+	.byte	0x1f
+	.byte	0x35
+	.byte	0x3
+	.long	0x11e5
+	.uleb128 0x12
+	.long	0x128f
+	.uleb128 0xd
+	.long	.LASF2217
+	.byte	0x1f
+	.byte	0x37
+	.byte	0x1a
+	.long	0x128f
+	.uleb128 0xd
+	.long	.LASF2218
+	.byte	0x1f
+	.byte	0x3b
+	.byte	0x16
+	.long	0x931
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x20
+	.byte	0x14
+	.long	0x12d1
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2221
+	.byte	0x47
+	.byte	0x16
+	.long	0x931
+	.uleb128 0xc
+	.long	.LASF2222
+	.byte	0x48
+	.byte	0x1c
+	.long	0x12e7
+	.uleb128 0x5
+	.long	0xfdc
+	.uleb128 0xc
+	.long	.LASF2223
+	.byte	0x4d
+	.byte	0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	.LASF2224
+	.byte	0x4e
+	.byte	0x16
+	.long	0xe9b
+	.uleb128 0xc
+	.long	.LASF2225
+	.byte	0x82
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0xc
+	.long	.LASF2226
+	.byte	0x83
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2227
+	.byte	0x1a
+	.byte	0x4c
+	.byte	0x9
+	.long	0xab
+	.uleb128 0xe
+	.long	.LASF2228
+	.byte	0x1a
+	.byte	0x45
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2229
+	.byte	0x1a
+	.byte	0x4a
+	.byte	0x9
+	.long	0xab
+	.uleb128 0xe
+	.long	.LASF2230
+	.byte	0x1a
+	.byte	0x46
+	.byte	0xa
+	.long	0xc8
+	.uleb128 0x13
+	.long	.LASF2234
+	.byte	0x23
+	.byte	0x1e
+	.byte	0x5
+	.long	0x178
+	.long	0x135e
+	.uleb128 0x4
+	.long	0xd4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2231
+	.byte	0x12
+	.byte	0x6f
+	.byte	0x12
+	.long	0xb31
+	.uleb128 0xe
+	.long	.LASF2232
+	.byte	0x22
+	.byte	0x1f
+	.byte	0x9
+	.long	0xab
+	.uleb128 0xe
+	.long	.LASF2233
+	.byte	0x22
+	.byte	0x20
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x27
+	.long	.LASF2003
+	.byte	0xf
+	.byte	0x71
+	.long	0x1398
+	.uleb128 0x4
+	.long	0x931
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2235
+	.byte	0x13
+	.byte	0x69
+	.byte	0x5
+	.long	0x178
+	.long	0x13ae
+	.uleb128 0x4
+	.long	0xd4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2236
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2237
+	.byte	0x24
+	.byte	0x1d
+	.byte	0xa
+	.long	0x9d6
+	.uleb128 0x13
+	.long	.LASF2238
+	.byte	0x1f
+	.byte	0x43
+	.byte	0x5
+	.long	0x178
+	.long	0x13dc
+	.uleb128 0x4
+	.long	0xe9b
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2239
+	.byte	0x1f
+	.byte	0x3e
+	.byte	0x5
+	.long	0x178
+	.long	0x13f2
+	.uleb128 0x4
+	.long	0x13f2
+	.byte	0
+	.uleb128 0x5
+	.long	0xfe8
+	.uleb128 0x13
+	.long	.LASF2240
+	.byte	0x1b
+	.byte	0x95
+	.byte	0xf
+	.long	0x931
+	.long	0x1426
+	.uleb128 0x4
+	.long	0xf74
+	.uleb128 0x4
+	.long	0xf14
+	.uleb128 0x4
+	.long	0x791
+	.uleb128 0x4
+	.long	0xd4
+	.uleb128 0x4
+	.long	0x72c
+	.uleb128 0x4
+	.long	0x785
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2241
+	.byte	0x1b
+	.byte	0x9d
+	.long	0x1437
+	.uleb128 0x4
+	.long	0x931
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2242
+	.byte	0x1b
+	.byte	0x8c
+	.byte	0xf
+	.long	0xe9b
+	.long	0x1452
+	.uleb128 0x4
+	.long	0x13f2
+	.uleb128 0x4
+	.long	0xf14
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2243
+	.byte	0x1b
+	.byte	0x89
+	.byte	0x15
+	.long	0x12e7
+	.long	0x1468
+	.uleb128 0x4
+	.long	0xf14
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2244
+	.value	0x200
+	.long	0x1480
+	.uleb128 0x20
+	.string	"now"
+	.value	0x206
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2245
+	.value	0x1eb
+	.long	0x149a
+	.uleb128 0x1a
+	.uleb128 0x8
+	.long	.LASF2246
+	.value	0x1f3
+	.byte	0xd
+	.long	0x178
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2247
+	.byte	0x21
+	.value	0x1e6
+	.byte	0x5
+	.long	0x178
+	.long	0x14b8
+	.uleb128 0x1b
+	.long	.LASF2270
+	.value	0x1e6
+	.byte	0x40
+	.long	0xd4
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2248
+	.value	0x1d8
+	.uleb128 0x21
+	.long	.LASF2249
+	.value	0x1d1
+	.uleb128 0x21
+	.long	.LASF2250
+	.value	0x1cb
+	.uleb128 0x1c
+	.long	.LASF2251
+	.value	0x1c3
+	.uleb128 0x1c
+	.long	.LASF2252
+	.value	0x1b8
+	.uleb128 0x1c
+	.long	.LASF2253
+	.value	0x1b2
+	.uleb128 0x11
+	.long	.LASF2257
+	.value	0x19a
+	.long	0x1514
+	.uleb128 0x8
+	.long	.LASF2254
+	.value	0x19c
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x1a
+	.uleb128 0x8
+	.long	.LASF2255
+	.value	0x1a4
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x8
+	.long	.LASF2256
+	.value	0x1a5
+	.byte	0x12
+	.long	0xc8
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2258
+	.value	0x173
+	.long	0x1550
+	.uleb128 0x8
+	.long	.LASF2259
+	.value	0x175
+	.byte	0x15
+	.long	0xc8
+	.uleb128 0x8
+	.long	.LASF2260
+	.value	0x176
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0x8
+	.long	.LASF2261
+	.value	0x177
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x8
+	.long	.LASF2262
+	.value	0x179
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2263
+	.value	0x167
+	.uleb128 0x11
+	.long	.LASF2264
+	.value	0x151
+	.long	0x157b
+	.uleb128 0x8
+	.long	.LASF2265
+	.value	0x153
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2266
+	.value	0x154
+	.byte	0xd
+	.long	0x157b
+	.byte	0
+	.uleb128 0x16
+	.long	0xab
+	.long	0x158b
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2267
+	.value	0x146
+	.long	0x15a3
+	.uleb128 0x8
+	.long	.LASF2266
+	.value	0x149
+	.byte	0xd
+	.long	0x157b
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2268
+	.value	0x13a
+	.long	0x15bb
+	.uleb128 0x8
+	.long	.LASF2266
+	.value	0x13d
+	.byte	0xd
+	.long	0x157b
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2269
+	.value	0x126
+	.long	0x15df
+	.uleb128 0x1b
+	.long	.LASF2266
+	.value	0x126
+	.byte	0x21
+	.long	0xc93
+	.uleb128 0x8
+	.long	.LASF2271
+	.value	0x128
+	.byte	0x1e
+	.long	0x1015
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2272
+	.value	0x115
+	.long	0x1627
+	.uleb128 0x1b
+	.long	.LASF2273
+	.value	0x115
+	.byte	0x25
+	.long	0xab
+	.uleb128 0x1b
+	.long	.LASF2274
+	.value	0x115
+	.byte	0x48
+	.long	0x1627
+	.uleb128 0x8
+	.long	.LASF2275
+	.value	0x117
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x20
+	.string	"deg"
+	.value	0x117
+	.byte	0x15
+	.long	0xab
+	.uleb128 0x20
+	.string	"min"
+	.value	0x117
+	.byte	0x1a
+	.long	0xab
+	.byte	0
+	.uleb128 0x5
+	.long	0x1015
+	.uleb128 0x11
+	.long	.LASF2276
+	.value	0x107
+	.long	0x1650
+	.uleb128 0x8
+	.long	.LASF2277
+	.value	0x109
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0x8
+	.long	.LASF2278
+	.value	0x10a
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2279
+	.byte	0xf9
+	.uleb128 0x14
+	.long	.LASF2280
+	.byte	0xe7
+	.long	0x1679
+	.uleb128 0xc
+	.long	.LASF2281
+	.byte	0xe9
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x1a
+	.uleb128 0x22
+	.string	"tmp"
+	.byte	0xf2
+	.byte	0xf
+	.long	0x126
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2282
+	.byte	0xd9
+	.uleb128 0x14
+	.long	.LASF2283
+	.byte	0xc6
+	.long	0x16a2
+	.uleb128 0x1a
+	.uleb128 0xc
+	.long	.LASF2284
+	.byte	0xce
+	.byte	0x20
+	.long	0xb3d
+	.uleb128 0xc
+	.long	.LASF2285
+	.byte	0xcf
+	.byte	0x12
+	.long	0xc8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2286
+	.byte	0xb8
+	.long	0x16b8
+	.uleb128 0xc
+	.long	.LASF2287
+	.byte	0xba
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2288
+	.byte	0xaf
+	.uleb128 0x14
+	.long	.LASF2289
+	.byte	0xa5
+	.long	0x16d2
+	.uleb128 0x22
+	.string	"i"
+	.byte	0xa7
+	.byte	0x9
+	.long	0x30
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2290
+	.byte	0x9c
+	.long	0x16f0
+	.uleb128 0x1e
+	.string	"a"
+	.byte	0x21
+	.byte	0x9c
+	.byte	0x21
+	.long	0x9f
+	.uleb128 0x22
+	.string	"t"
+	.byte	0x9e
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2291
+	.byte	0x8f
+	.long	0x1707
+	.uleb128 0x29
+	.long	.LASF2292
+	.byte	0x21
+	.byte	0x8f
+	.byte	0x24
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2293
+	.byte	0x8a
+	.uleb128 0x14
+	.long	.LASF2294
+	.byte	0x84
+	.long	0x1723
+	.uleb128 0x1e
+	.string	"id"
+	.byte	0x21
+	.byte	0x84
+	.byte	0x22
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2295
+	.byte	0x1f
+	.byte	0x37
+	.byte	0x88
+	.long	0x172f
+	.uleb128 0x5
+	.long	0x129b
+	.uleb128 0x2a
+	.long	.LASF2296
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0x7e
+	.long	0x1740
+	.uleb128 0x5
+	.long	0xe6b
+	.uleb128 0x35
+	.long	.LASF2297
+	.byte	0x25
+	.byte	0x7e
+	.byte	0x13
+	.long	0x30
+	.uleb128 0x1e
+	.string	"amt"
+	.byte	0x25
+	.byte	0x7e
+	.byte	0x21
+	.long	0x30
+	.uleb128 0x1e
+	.string	"low"
+	.byte	0x25
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x30
+	.uleb128 0x29
+	.long	.LASF2298
+	.byte	0x25
+	.byte	0x7e
+	.byte	0x33
+	.long	0x30
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 38 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.file 42 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF457
+	.file 44 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 45 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2d
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF511
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 48 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF584
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF602
+	.file 50 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF625
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF511
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF685
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF689
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF690
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF753
+	.byte	0x4
+	.file 55 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x37
+	.file 56 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 57 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 58 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 59 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x23
+	.file 60 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3c
+	.file 61 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.file 63 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.file 64 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 65 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1152
+	.file 66 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1157
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1166
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1171
+	.byte	0x4
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 74 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1206
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1207
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1208
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1209
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1210
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1211
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1212
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1213
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1214
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1226
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1233
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1234
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1235
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1238
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x59
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1239
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.file 91 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5b
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 92 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 93 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1660
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1661
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x11
+	.file 94 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5e
+	.byte	0x4
+	.file 95 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 97 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 99 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1667
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0x4
+	.file 100 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1701
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1702
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x1a
+	.file 101 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.file 102 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x19
+	.file 103 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 104 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x68
+	.file 105 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x69
+	.file 106 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x22
+	.byte	0x4
+	.file 107 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1772
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1815
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF484
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF510
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF516
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF522
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF569
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF581
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF601
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF610
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF614
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF618
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF620
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF622
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF684
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF688
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF752
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF853
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF854
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF855
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF861
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF863
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1053
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1061
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1151
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1155
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1165
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1170
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1186
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1188
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1155
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1203
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1225
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1237
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1269
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1279
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1291
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1663
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1694
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1706
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1710
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1727
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1746
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1771
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x16
+	.long	.LASF1
+	.long	.LASF2301
+	.long	.LASF2302
+	.long	.LASF2303
+	.long	.LASF2304
+	.long	.LASF2305
+	.long	.LASF2306
+	.long	.LASF2307
+	.long	.LASF2308
+	.long	.LASF2309
+	.long	.LASF2310
+	.long	.LASF2311
+	.long	.LASF2312
+	.long	.LASF2313
+	.long	.LASF2314
+	.long	.LASF2315
+	.long	.LASF2316
+	.long	.LASF2317
+	.long	.LASF2318
+	.long	.LASF2319
+	.long	.LASF2320
+	.long	.LASF2321
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x6c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2322
+	.byte	0x11
+	.long	.LASF2323
+	.byte	0x11
+	.long	.LASF2324
+	.byte	0x11
+	.long	.LASF2325
+	.byte	0xc
+	.long	.LASF2326
+	.byte	0x6
+	.long	.LASF2327
+	.byte	0x6
+	.long	.LASF2328
+	.byte	0x6
+	.long	.LASF2329
+	.byte	0x6
+	.long	.LASF2330
+	.byte	0x4
+	.long	.LASF2331
+	.byte	0x4
+	.long	.LASF2332
+	.byte	0x11
+	.long	.LASF2333
+	.byte	0x11
+	.long	.LASF2334
+	.byte	0x11
+	.long	.LASF2335
+	.byte	0x6
+	.long	.LASF2336
+	.byte	0x6
+	.long	.LASF2337
+	.byte	0x2
+	.long	.LASF2338
+	.byte	0x7
+	.long	.LASF2339
+	.byte	0x7
+	.long	.LASF2340
+	.byte	0x7
+	.long	.LASF2341
+	.byte	0xb
+	.long	.LASF2342
+	.byte	0xb
+	.long	.LASF2343
+	.byte	0x5
+	.long	.LASF2343
+	.byte	0xb
+	.long	.LASF2344
+	.byte	0xb
+	.long	.LASF2345
+	.byte	0xb
+	.long	.LASF2346
+	.byte	0xb
+	.long	.LASF2336
+	.byte	0x9
+	.long	.LASF2347
+	.byte	0x9
+	.long	.LASF2348
+	.byte	0x8
+	.long	.LASF2349
+	.byte	0x8
+	.long	.LASF2350
+	.byte	0xe
+	.long	.LASF2351
+	.byte	0xe
+	.long	.LASF2352
+	.byte	0xe
+	.long	.LASF2353
+	.byte	0x8
+	.long	.LASF2354
+	.byte	0x3
+	.long	.LASF2337
+	.byte	0x6
+	.long	.LASF2355
+	.byte	0x2
+	.long	.LASF2356
+	.byte	0x14
+	.long	.LASF2357
+	.byte	0x15
+	.long	.LASF2358
+	.byte	0x15
+	.long	.LASF2359
+	.byte	0x15
+	.long	.LASF2359
+	.byte	0x14
+	.long	.LASF2360
+	.byte	0x11
+	.long	.LASF2361
+	.byte	0x14
+	.long	.LASF2362
+	.byte	0x14
+	.long	.LASF2363
+	.byte	0x11
+	.long	.LASF2364
+	.byte	0x11
+	.long	.LASF2365
+	.byte	0x13
+	.long	.LASF2366
+	.byte	0x11
+	.long	.LASF2367
+	.byte	0x12
+	.long	.LASF2368
+	.byte	0x12
+	.long	.LASF2369
+	.byte	0x11
+	.long	.LASF2370
+	.byte	0x11
+	.long	.LASF2371
+	.byte	0x11
+	.long	.LASF2372
+	.byte	0xf
+	.long	.LASF2373
+	.byte	0xd
+	.long	.LASF2374
+	.byte	0xd
+	.long	.LASF2375
+	.byte	0x2
+	.long	.LASF2376
+	.byte	0x2
+	.long	.LASF2377
+	.byte	0x3
+	.long	.LASF2378
+	.byte	0x1
+	.long	.LASF2379
+	.byte	0x3
+	.long	.LASF2380
+	.byte	0x6
+	.long	.LASF2381
+	.byte	0x6
+	.long	.LASF2382
+	.byte	0x14
+	.long	.LASF2383
+	.byte	0x14
+	.long	.LASF2384
+	.byte	0x10
+	.long	.LASF2385
+	.byte	0x10
+	.long	.LASF2386
+	.byte	0x11
+	.long	.LASF2387
+	.byte	0x11
+	.long	.LASF2383
+	.byte	0x11
+	.long	.LASF2388
+	.byte	0x10
+	.long	.LASF2389
+	.byte	0x11
+	.long	.LASF2337
+	.byte	0x14
+	.long	.LASF2337
+	.byte	0x11
+	.long	.LASF2390
+	.byte	0x10
+	.long	.LASF2391
+	.byte	0x10
+	.long	.LASF2392
+	.byte	0x10
+	.long	.LASF2393
+	.byte	0x10
+	.long	.LASF2394
+	.byte	0x10
+	.long	.LASF2395
+	.byte	0x10
+	.long	.LASF2396
+	.byte	0x10
+	.long	.LASF2397
+	.byte	0x11
+	.long	.LASF2398
+	.byte	0x11
+	.long	.LASF2399
+	.byte	0x11
+	.long	.LASF2400
+	.byte	0x11
+	.long	.LASF2401
+	.byte	0x10
+	.long	.LASF2402
+	.byte	0x10
+	.long	.LASF2403
+	.byte	0x11
+	.long	.LASF2404
+	.byte	0x11
+	.long	.LASF2405
+	.byte	0x6
+	.long	.LASF2406
+	.byte	0x6
+	.long	.LASF2407
+	.byte	0x6
+	.long	.LASF2408
+	.byte	0x6
+	.long	.LASF2409
+	.byte	0x6
+	.long	.LASF2410
+	.byte	0x6
+	.long	.LASF2411
+	.byte	0x6
+	.long	.LASF2412
+	.byte	0x6
+	.long	.LASF2413
+	.byte	0x6
+	.long	.LASF2414
+	.byte	0xb
+	.long	.LASF2415
+	.byte	0x2
+	.long	.LASF2416
+	.byte	0xb
+	.long	.LASF2417
+	.byte	0xb
+	.long	.LASF2418
+	.byte	0x8
+	.long	.LASF2419
+	.byte	0x6
+	.long	.LASF2420
+	.byte	0x6
+	.long	.LASF2421
+	.byte	0xa
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1651:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1180:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1672:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1178:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1705:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1287:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2247:
+	.string	"hasEnoughTimeLapsedSinceLastTelemetryTransmission"
+.LASF1920:
+	.string	"__align"
+.LASF1879:
+	.string	"mpuConfiguration_s"
+.LASF1883:
+	.string	"mpuConfiguration_t"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1427:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF827:
+	.string	"USE_FAKE_BARO "
+.LASF902:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF516:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2045:
+	.string	"THROTTLE"
+.LASF1298:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF437:
+	.string	"_WCHAR_T_DEFINED "
+.LASF794:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1909:
+	.string	"__pthread_mutex_s"
+.LASF1394:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF524:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1051:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2034:
+	.string	"FEATURE_TRANSPONDER"
+.LASF900:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2095:
+	.string	"baro_s"
+.LASF2098:
+	.string	"baro_t"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF838:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF456:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2236:
+	.string	"getBatteryCellCount"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF632:
+	.string	"__SQUAD_TYPE long int"
+.LASF1187:
+	.string	"sched_priority sched_priority"
+.LASF848:
+	.string	"USE_PPM"
+.LASF1734:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2009:
+	.string	"setMode"
+.LASF1892:
+	.string	"ICM_20602_SPI"
+.LASF2093:
+	.string	"calculate"
+.LASF1159:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF767:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1296:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1554:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1091:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1166:
+	.string	"__pid_t_defined "
+.LASF1158:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF949:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF551:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF575:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF875:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1822:
+	.string	"__uint8_t"
+.LASF686:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1188:
+	.string	"__sched_priority sched_priority"
+.LASF1988:
+	.string	"vTable"
+.LASF1681:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1555:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1844:
+	.string	"_Bool"
+.LASF1353:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2261:
+	.string	"payload"
+.LASF586:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1728:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1500:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF809:
+	.string	"SKIP_IMU_CALC "
+.LASF813:
+	.string	"U_ID_2 2"
+.LASF922:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF2266:
+	.string	"coord"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1272:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1173:
+	.string	"__CPU_SETSIZE 1024"
+.LASF789:
+	.string	"TELEMETRY_SRXL "
+.LASF528:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2278:
+	.string	"minutes"
+.LASF1197:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF1932:
+	.string	"OWNER_ADC_CURR"
+.LASF1154:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF568:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1642:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1305:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1615:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1460:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1276:
+	.string	"IOCFG_AF_OD 0"
+.LASF515:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1976:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1859:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1843:
+	.string	"I2CDevice"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2221:
+	.string	"frskyPort"
+.LASF1578:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2132:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1861:
+	.string	"CW270_DEG_FLIP"
+.LASF1781:
+	.string	"ID_RPM 0x03"
+.LASF1688:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1283:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF429:
+	.string	"__WCHAR_T__ "
+.LASF795:
+	.string	"USE_SENSOR_NAMES "
+.LASF1647:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1973:
+	.string	"MODE_TX"
+.LASF1012:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1406:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1739:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1004:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF450:
+	.string	"_STDBOOL_H "
+.LASF1486:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1470:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1619:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1143:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1594:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1565:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF968:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1929:
+	.string	"OWNER_LED"
+.LASF549:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF816:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1654:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1335:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1238:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF2248:
+	.string	"configureFrSkyTelemetryPort"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2024:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1881:
+	.string	"resetFn"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1832:
+	.string	"uint16_t"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF682:
+	.string	"__FD_SETSIZE 1024"
+.LASF2208:
+	.string	"halfDuplex"
+.LASF2220:
+	.string	"FRSKY_VFAS_PRECISION_HIGH"
+.LASF932:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1177:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2139:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1586:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF530:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1430:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF779:
+	.string	"TELEMETRY_HOTT "
+.LASF677:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1666:
+	.string	"BEEP_ON do {} while (0)"
+.LASF959:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1518:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1539:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF399:
+	.string	"_T_PTRDIFF_ "
+.LASF879:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1131:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF720:
+	.string	"INT_FAST8_MAX (127)"
+.LASF629:
+	.string	"__U32_TYPE unsigned int"
+.LASF1756:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1068:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1000:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF842:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1398:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF670:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF739:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF598:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1624:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2249:
+	.string	"freeFrSkyTelemetryPort"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1786:
+	.string	"ID_ALTITUDE_AP 0x21"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2257:
+	.string	"sendVoltageAmp"
+.LASF938:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2063:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1803:
+	.string	"ID_ACC_Z 0x26"
+.LASF428:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1698:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF1750:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1306:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1171:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF468:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1704:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1934:
+	.string	"OWNER_ADC_RSSI"
+.LASF1668:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1610:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF903:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1767:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2251:
+	.string	"sendHeading"
+.LASF587:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF649:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1008:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2177:
+	.string	"gpsSolutionData_t"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1724:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1106:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1667:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1618:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2181:
+	.string	"PID_YAW"
+.LASF1511:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1646:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1936:
+	.string	"OWNER_SERIAL_RX"
+.LASF678:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2134:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF1234:
+	.string	"__have_pthread_attr_t 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF966:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1314:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF420:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF935:
+	.string	"BIT(x) (1 << (x))"
+.LASF1960:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1662:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1373:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1997:
+	.string	"rxBufferHead"
+.LASF724:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2178:
+	.string	"gpsSol"
+.LASF1727:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF1473:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF856:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1531:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF663:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1830:
+	.string	"int32_t"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2159:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF526:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1597:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF898:
+	.string	"FAST_MATH "
+.LASF826:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2011:
+	.string	"beginWrite"
+.LASF1124:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1184:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF439:
+	.string	"___int_wchar_t_h "
+.LASF1968:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1568:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1738:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF459:
+	.string	"__USE_ISOC11"
+.LASF1285:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2218:
+	.string	"telemetrySharedPort"
+.LASF1805:
+	.string	"ID_VOLTAGE_AMP_BP 0x3A"
+.LASF1338:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2269:
+	.string	"sendLatLong"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1773:
+	.string	"FRSKY_BAUDRATE 9600"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1686:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF872:
+	.string	"VTX_TRAMP"
+.LASF451:
+	.string	"bool _Bool"
+.LASF597:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1957:
+	.string	"OWNER_BARO_EXTI"
+.LASF985:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1261:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF723:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF570:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2281:
+	.string	"satellite"
+.LASF1383:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1972:
+	.string	"MODE_RX"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1762:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF849:
+	.string	"USE_PWM"
+.LASF1433:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2194:
+	.string	"values"
+.LASF694:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1935:
+	.string	"OWNER_SERIAL_TX"
+.LASF603:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1005:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF687:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1065:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1347:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1019:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF716:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1361:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1912:
+	.string	"__owner"
+.LASF659:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF791:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF553:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1605:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"_T_SIZE_ "
+.LASF1735:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1606:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1800:
+	.string	"ID_SECOND 0x18"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2079:
+	.string	"acc_s"
+.LASF2083:
+	.string	"acc_t"
+.LASF926:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2022:
+	.string	"FEATURE_FAILSAFE"
+.LASF1777:
+	.string	"PROTOCOL_TAIL 0x5E"
+.LASF1664:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF2110:
+	.string	"voltageMeterSource_e"
+.LASF790:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1102:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1548:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF604:
+	.string	"__stub_chflags "
+.LASF1292:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1170:
+	.string	"SCHED_RR 2"
+.LASF1678:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2245:
+	.string	"checkFrSkyTelemetryState"
+.LASF1958:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1439:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1868:
+	.string	"ADCRaw"
+.LASF1870:
+	.string	"dataReady"
+.LASF1793:
+	.string	"ID_LATITUDE_AP 0x1B"
+.LASF453:
+	.string	"false 0"
+.LASF1970:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF743:
+	.string	"INT8_C(c) c"
+.LASF961:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2273:
+	.string	"mwiigps"
+.LASF424:
+	.string	"_GCC_SIZE_T "
+.LASF608:
+	.string	"__stub_setlogin "
+.LASF1611:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1910:
+	.string	"__lock"
+.LASF1225:
+	.string	"__ONCE_ALIGNMENT "
+.LASF993:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF610:
+	.string	"__stub_stty "
+.LASF1071:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF963:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1596:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1858:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1685:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1908:
+	.string	"__pthread_list_t"
+.LASF745:
+	.string	"INT32_C(c) c"
+.LASF1355:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1263:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1806:
+	.string	"ID_VOLTAGE_AMP_AP 0x3B"
+.LASF1530:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2039:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1476:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1875:
+	.string	"sensorAccReadFuncPtr"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF479:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2026:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2074:
+	.string	"SENSOR_BARO"
+.LASF1884:
+	.string	"MPU_NONE"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2167:
+	.string	"mmmm"
+.LASF1712:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2191:
+	.string	"airmodeWasActivated"
+.LASF2217:
+	.string	"telemetryConfig_System"
+.LASF1940:
+	.string	"OWNER_SONAR_ECHO"
+.LASF867:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1742:
+	.string	"PIDSUM_LIMIT 500"
+.LASF582:
+	.string	"__attribute_copy__"
+.LASF1571:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2023:
+	.string	"FEATURE_SONAR"
+.LASF514:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1761:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1437:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF997:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF641:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1041:
+	.string	"PG_VTX_CONFIG 515"
+.LASF952:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2171:
+	.string	"gpsSolutionData_s"
+.LASF1928:
+	.string	"OWNER_SERVO"
+.LASF937:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF820:
+	.string	"ACC "
+.LASF1899:
+	.string	"mpu6050Resolution_e"
+.LASF1072:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF843:
+	.string	"STACK_CHECK"
+.LASF563:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1612:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF786:
+	.string	"TELEMETRY_IBUS "
+.LASF765:
+	.string	"USE_PWM "
+.LASF1798:
+	.string	"ID_YEAR 0x16"
+.LASF1601:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF845:
+	.string	"TELEMETRY_LTM"
+.LASF931:
+	.string	"PP_IIF_0(t,f) f"
+.LASF1621:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1382:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF623:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1328:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1416:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1690:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1085:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF951:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1162:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1795:
+	.string	"ID_COURSE_BP 0x14"
+.LASF1315:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1691:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF2219:
+	.string	"FRSKY_VFAS_PRECISION_LOW"
+.LASF1854:
+	.string	"CW0_DEG"
+.LASF2192:
+	.string	"roll"
+.LASF405:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1379:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"USE_VCP"
+.LASF725:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1697:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1747:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1823:
+	.string	"__int16_t"
+.LASF742:
+	.string	"WINT_MAX (4294967295u)"
+.LASF546:
+	.string	"__flexarr []"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1825:
+	.string	"__uint16_t"
+.LASF1196:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1812:
+	.string	"GPS_BAD_QUALITY 300"
+.LASF1993:
+	.string	"rxBufferSize"
+.LASF1927:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1658:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2137:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF500:
+	.string	"__USE_POSIX 1"
+.LASF1139:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF463:
+	.string	"__USE_POSIX"
+.LASF1721:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF1954:
+	.string	"OWNER_RX_SPI_CS"
+.LASF440:
+	.string	"__INT_WCHAR_T_H "
+.LASF1211:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF1857:
+	.string	"CW270_DEG"
+.LASF709:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1669:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2204:
+	.string	"gpsNoFixLatitude"
+.LASF1665:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF594:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1229:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF496:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1999:
+	.string	"txBufferHead"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2035:
+	.string	"FEATURE_AIRMODE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1990:
+	.string	"mode"
+.LASF828:
+	.string	"USE_FLASHFS "
+.LASF1374:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1918:
+	.string	"__data"
+.LASF1614:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2199:
+	.string	"frskyGpsCoordFormat_e"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF897:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1142:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF2054:
+	.string	"THROTTLE_LOW"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF580:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2069:
+	.string	"SENSOR_INDEX_BARO"
+.LASF948:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2068:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1790:
+	.string	"ID_LONGITUDE_AP 0x1A"
+.LASF2077:
+	.string	"SENSOR_GPS"
+.LASF912:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1409:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"_PTHREAD_H 1"
+.LASF619:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1809:
+	.string	"ID_GYRO_Y 0x41"
+.LASF2213:
+	.string	"hottAlarmSoundInterval"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1731:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1194:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF921:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2202:
+	.string	"frskyUnit_e"
+.LASF2298:
+	.string	"high"
+.LASF810:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1042:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF543:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1848:
+	.string	"deviceSpi_s"
+.LASF796:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1300:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1254:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF2133:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1818:
+	.string	"unsigned char"
+.LASF690:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1313:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF717:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2018:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1190:
+	.string	"_BITS_TIME_H 1"
+.LASF595:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2017:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1052:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1055:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF721:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1466:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF406:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1503:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1921:
+	.string	"pthread_mutex_t"
+.LASF819:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF804:
+	.string	"USE_NAV "
+.LASF998:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1520:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF760:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF981:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF818:
+	.string	"USE_FAKE_LED "
+.LASF1675:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1128:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1836:
+	.string	"float"
+.LASF1799:
+	.string	"ID_HOUR_MINUTE 0x17"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF976:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF461:
+	.string	"__USE_ISOC95"
+.LASF1242:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF2112:
+	.string	"vbatmaxcellvoltage"
+.LASF460:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1174:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF744:
+	.string	"INT16_C(c) c"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1082:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2010:
+	.string	"writeBuf"
+.LASF2122:
+	.string	"vbathysteresis"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1032:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1808:
+	.string	"ID_GYRO_X 0x40"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1385:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2142:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1274:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1331:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF689:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF787:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF398:
+	.string	"_PTRDIFF_T "
+.LASF1093:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF591:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2118:
+	.string	"batteryCapacity"
+.LASF470:
+	.string	"__USE_XOPEN2K"
+.LASF2020:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF943:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2228:
+	.string	"calculateBatteryPercentageRemaining"
+.LASF2012:
+	.string	"endWrite"
+.LASF2129:
+	.string	"FUNCTION_NONE"
+.LASF531:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1613:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1086:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1250:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1853:
+	.string	"ALIGN_DEFAULT"
+.LASF913:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1013:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1058:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF490:
+	.string	"_DEFAULT_SOURCE"
+.LASF782:
+	.string	"USE_SERVOS "
+.LASF1245:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF380:
+	.string	"__unix 1"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF712:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1627:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1813:
+	.string	"GPS_MAX_HDOP_VAL 9999"
+.LASF1966:
+	.string	"OWNER_VTX"
+.LASF569:
+	.string	"__wur "
+.LASF776:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1896:
+	.string	"mpuSensor_e"
+.LASF532:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1126:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1914:
+	.string	"__kind"
+.LASF2046:
+	.string	"AUX1"
+.LASF2047:
+	.string	"AUX2"
+.LASF2048:
+	.string	"AUX3"
+.LASF2049:
+	.string	"AUX4"
+.LASF2050:
+	.string	"AUX5"
+.LASF2051:
+	.string	"AUX6"
+.LASF2052:
+	.string	"AUX7"
+.LASF2053:
+	.string	"AUX8"
+.LASF983:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2041:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF1785:
+	.string	"ID_ALTITUDE_BP 0x10"
+.LASF2108:
+	.string	"VOLTAGE_METER_ADC"
+.LASF1699:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF1204:
+	.string	"__clock_t_defined 1"
+.LASF1400:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF2103:
+	.string	"CURRENT_METER_ESC"
+.LASF436:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF651:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF773:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1886:
+	.string	"MPU_60x0"
+.LASF1751:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1949:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1101:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF780:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1617:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1784:
+	.string	"ID_VOLT 0x06"
+.LASF1772:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1311:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF691:
+	.string	"__intptr_t_defined "
+.LASF930:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF699:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF710:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2226:
+	.string	"cycleNum"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF542:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF633:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1502:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF606:
+	.string	"__stub_gtty "
+.LASF1873:
+	.string	"mpuDetectionResult"
+.LASF1241:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1083:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1316:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1448:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF2106:
+	.string	"currentMeterSource_e"
+.LASF1543:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1207:
+	.string	"__timer_t_defined 1"
+.LASF1428:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1887:
+	.string	"MPU_60x0_SPI"
+.LASF727:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1516:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1413:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"USE_SPI"
+.LASF438:
+	.string	"_WCHAR_T_H "
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2007:
+	.string	"serialSetBaudRate"
+.LASF675:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2119:
+	.string	"useVBatAlerts"
+.LASF2006:
+	.string	"serialRead"
+.LASF1153:
+	.string	"_SCHED_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2222:
+	.string	"portConfig"
+.LASF593:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1566:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF2268:
+	.string	"sendFakeLatLongThatAllowsHeadingDisplay"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF749:
+	.string	"UINT32_C(c) c ## U"
+.LASF2116:
+	.string	"voltageMeterSource"
+.LASF1073:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF2001:
+	.string	"rxCallback"
+.LASF1725:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1059:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF480:
+	.string	"__USE_GNU"
+.LASF1649:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2203:
+	.string	"telemetryConfig_s"
+.LASF2216:
+	.string	"telemetryConfig_t"
+.LASF2161:
+	.string	"gps_baudrateIndex"
+.LASF1039:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1845:
+	.string	"test"
+.LASF1303:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2165:
+	.string	"gpsCoordinateDDDMMmmmm_s"
+.LASF2168:
+	.string	"gpsCoordinateDDDMMmmmm_t"
+.LASF1080:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1995:
+	.string	"rxBuffer"
+.LASF2289:
+	.string	"sendAccel"
+.LASF1778:
+	.string	"ID_GPS_ALTIDUTE_BP 0x01"
+.LASF1454:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1994:
+	.string	"txBufferSize"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1980:
+	.string	"SERIAL_PARITY_NO"
+.LASF2014:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF482:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF639:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1863:
+	.string	"sensorAccInitFuncPtr"
+.LASF683:
+	.string	"_BITS_TIME64_H 1"
+.LASF1064:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF722:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1765:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF2056:
+	.string	"throttleStatus_e"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF555:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1959:
+	.string	"OWNER_USB_DETECT"
+.LASF1317:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1919:
+	.string	"__size"
+.LASF1118:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1271:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1105:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF475:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF571:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1023:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF627:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1776:
+	.string	"PROTOCOL_HEADER 0x5E"
+.LASF1880:
+	.string	"writeFn"
+.LASF2279:
+	.string	"sendSpeed"
+.LASF566:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2107:
+	.string	"VOLTAGE_METER_NONE"
+.LASF814:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1358:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1127:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF556:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2212:
+	.string	"frsky_vfas_cell_voltage"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2096:
+	.string	"BaroAlt"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2215:
+	.string	"report_cell_voltage"
+.LASF1758:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF2270:
+	.string	"currentMillis"
+.LASF486:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF454:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1641:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2030:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF423:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1770:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF418:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1963:
+	.string	"OWNER_INVERTER"
+.LASF865:
+	.string	"TELEMETRY_IBUS"
+.LASF1743:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1200:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1757:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1944:
+	.string	"OWNER_SPI_MOSI"
+.LASF1620:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1911:
+	.string	"__count"
+.LASF1989:
+	.string	"identifier"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1831:
+	.string	"uint8_t"
+.LASF605:
+	.string	"__stub_fchflags "
+.LASF2115:
+	.string	"vbatnotpresentcellvoltage"
+.LASF2200:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF2214:
+	.string	"pidValuesAsTelemetry"
+.LASF631:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1609:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF941:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1226:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF928:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1341:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2070:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1449:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF777:
+	.string	"TELEMETRY "
+.LASF2057:
+	.string	"ARMED"
+.LASF1017:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1103:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2044:
+	.string	"PITCH"
+.LASF1491:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF899:
+	.string	"VERY_FAST_MATH "
+.LASF1643:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF846:
+	.string	"USE_ADC"
+.LASF509:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1693:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2180:
+	.string	"PID_PITCH"
+.LASF2211:
+	.string	"frsky_vfas_precision"
+.LASF441:
+	.string	"_GCC_WCHAR_T "
+.LASF583:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1104:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF644:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF861:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1050:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF635:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF702:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1766:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF590:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1559:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1852:
+	.string	"busDevice_t"
+.LASF2300:
+	.string	"busDevice_u"
+.LASF1472:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1404:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1185:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1425:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF864:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF493:
+	.string	"__USE_ISOC99 1"
+.LASF444:
+	.string	"_BSD_WCHAR_T_"
+.LASF2080:
+	.string	"accSamplingInterval"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF783:
+	.string	"CMS "
+.LASF589:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2153:
+	.string	"SERIAL_PORT_USART8"
+.LASF416:
+	.string	"_SIZE_T_ "
+.LASF1956:
+	.string	"OWNER_MPU_EXTI"
+.LASF1677:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1179:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF2223:
+	.string	"frskyTelemetryEnabled"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1801:
+	.string	"ID_ACC_X 0x24"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1286:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF427:
+	.string	"__need_size_t"
+.LASF1926:
+	.string	"OWNER_PPMINPUT"
+.LASF2150:
+	.string	"SERIAL_PORT_UART5"
+.LASF2144:
+	.string	"serialPortFunction_e"
+.LASF755:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1723:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF573:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF934:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1633:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1006:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1001:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF395:
+	.string	"_STDDEF_H "
+.LASF1576:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF825:
+	.string	"USE_FAKE_MAG "
+.LASF2244:
+	.string	"handleFrSkyTelemetry"
+.LASF1583:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1269:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1119:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1256:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1573:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1591:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2124:
+	.string	"batteryConfig_System"
+.LASF762:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1203:
+	.string	"TIMER_ABSTIME 1"
+.LASF2097:
+	.string	"baroTemperature"
+.LASF654:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF752:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1403:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__USE_UNIX98"
+.LASF1440:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1513:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1140:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1027:
+	.string	"PG_OSD_CONFIG 501"
+.LASF535:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF991:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1037:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF958:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1815:
+	.string	"BLADE_NUMBER_DIVIDER 5"
+.LASF1894:
+	.string	"ICM_20689_SPI"
+.LASF2092:
+	.string	"get_up"
+.LASF996:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2090:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF637:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1977:
+	.string	"SERIAL_INVERTED"
+.LASF1060:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1794:
+	.string	"ID_N_S 0x23"
+.LASF421:
+	.string	"_SIZE_T_DECLARED "
+.LASF2198:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2186:
+	.string	"PID_LEVEL"
+.LASF2085:
+	.string	"baroCalculateFuncPtr"
+.LASF1160:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1846:
+	.string	"instance"
+.LASF1905:
+	.string	"__pthread_internal_list"
+.LASF704:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1301:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF679:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF574:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1906:
+	.string	"__prev"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"PG_VCD_CONFIG 514"
+.LASF858:
+	.string	"LED_STRIP"
+.LASF1550:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF750:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__USE_MISC 1"
+.LASF2239:
+	.string	"telemetryCheckRxPortShared"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF705:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1595:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF916:
+	.string	"NOOP do {} while (0)"
+.LASF2076:
+	.string	"SENSOR_SONAR"
+.LASF1320:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1054:
+	.string	"IO_TAG_NONE 0"
+.LASF855:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1461:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2033:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1733:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1268:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1467:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF778:
+	.string	"TELEMETRY_FRSKY "
+.LASF1290:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1537:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF517:
+	.string	"__GNU_LIBRARY__"
+.LASF1066:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2073:
+	.string	"SENSOR_ACC"
+.LASF513:
+	.string	"__USE_ATFILE 1"
+.LASF1598:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1939:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1168:
+	.string	"SCHED_OTHER 0"
+.LASF2140:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1851:
+	.string	"address"
+.LASF911:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1589:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1475:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1789:
+	.string	"ID_LONGITUDE_BP 0x12"
+.LASF2135:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1421:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF854:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1077:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2121:
+	.string	"consumptionWarningPercentage"
+.LASF550:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1278:
+	.string	"IOCFG_IPU 0"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF618:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1422:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2061:
+	.string	"GPS_FIX_HOME"
+.LASF1167:
+	.string	"_BITS_SCHED_H 1"
+.LASF2036:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF665:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2037:
+	.string	"FEATURE_RX_SPI"
+.LASF2252:
+	.string	"sendFuelLevel"
+.LASF2193:
+	.string	"pitch"
+.LASF1941:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF656:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2263:
+	.string	"sendVario"
+.LASF1376:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF523:
+	.string	"__PMT"
+.LASF2162:
+	.string	"blackbox_baudrateIndex"
+.LASF442:
+	.string	"_WCHAR_T_DECLARED "
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2206:
+	.string	"telemetry_switch"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2183:
+	.string	"PID_POS"
+.LASF1224:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2163:
+	.string	"telemetry_baudrateIndex"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2243:
+	.string	"findSerialPortConfig"
+.LASF917:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1087:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1888:
+	.string	"MPU_65xx_I2C"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF807:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1015:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1634:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF757:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2231:
+	.string	"calculateThrottleStatus"
+.LASF1779:
+	.string	"ID_GPS_ALTIDUTE_AP 0x09"
+.LASF2130:
+	.string	"FUNCTION_MSP"
+.LASF863:
+	.string	"USE_RESOURCE_MGMT"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2060:
+	.string	"armingFlags"
+.LASF751:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1519:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1694:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1464:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1719:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF973:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1689:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF576:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1593:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1730:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF430:
+	.string	"_WCHAR_T "
+.LASF630:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1397:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF946:
+	.string	"UNIT_TESTED "
+.LASF2234:
+	.string	"feature"
+.LASF972:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1529:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2175:
+	.string	"groundCourse"
+.LASF1266:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2141:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF731:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2081:
+	.string	"accSmooth"
+.LASF1710:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF718:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF698:
+	.string	"INT32_MAX (2147483647)"
+.LASF2038:
+	.string	"FEATURE_SOFTSPI"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1802:
+	.string	"ID_ACC_Y 0x25"
+.LASF1878:
+	.string	"mpuResetFnPtr"
+.LASF1219:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF964:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2299:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF533:
+	.string	"__P(args) args"
+.LASF967:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF730:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1074:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF708:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF956:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF754:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF412:
+	.string	"_SYS_SIZE_T_H "
+.LASF655:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF774:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1318:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1443:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1329:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF667:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2274:
+	.string	"result"
+.LASF1431:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2259:
+	.string	"currentCell"
+.LASF829:
+	.string	"USE_FAKE_FLASH "
+.LASF1095:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF1248:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF481:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1687:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1038:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF770:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1720:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1538:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1424:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF666:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF696:
+	.string	"INT8_MAX (127)"
+.LASF1213:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1907:
+	.string	"__next"
+.LASF808:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1206:
+	.string	"__clockid_t_defined 1"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF472:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2062:
+	.string	"GPS_FIX"
+.LASF1392:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2246:
+	.string	"newTelemetryEnabledValue"
+.LASF448:
+	.string	"__need_NULL"
+.LASF449:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2059:
+	.string	"rcCommand"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF485:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1220:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF510:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF466:
+	.string	"__USE_POSIX199506"
+.LASF474:
+	.string	"__USE_LARGEFILE"
+.LASF1579:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF634:
+	.string	"__SWORD_TYPE long int"
+.LASF1368:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"USE_PPM "
+.LASF1349:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1309:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2101:
+	.string	"CURRENT_METER_ADC"
+.LASF1974:
+	.string	"MODE_RXTX"
+.LASF868:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2126:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF1138:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF502:
+	.string	"__USE_POSIX199309 1"
+.LASF1111:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF831:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2295:
+	.string	"telemetryConfig"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF684:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2058:
+	.string	"WAS_EVER_ARMED"
+.LASF1451:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1876:
+	.string	"mpuReadRegisterFnPtr"
+.LASF860:
+	.string	"TELEMETRY_HOTT"
+.LASF1455:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1236:
+	.string	"____sigset_t_defined "
+.LASF974:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1322:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF906:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1108:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF539:
+	.string	"__END_DECLS "
+.LASF1172:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF918:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1916:
+	.string	"__elision"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1849:
+	.string	"deviceI2C_s"
+.LASF1947:
+	.string	"OWNER_SDCARD"
+.LASF1783:
+	.string	"ID_TEMPRATURE2 0x05"
+.LASF1810:
+	.string	"ID_GYRO_Z 0x42"
+.LASF547:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1112:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1362:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1638:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1014:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1151:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2282:
+	.string	"sendTemperature1"
+.LASF446:
+	.string	"NULL"
+.LASF1829:
+	.string	"int16_t"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1533:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1819:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1821:
+	.string	"signed char"
+.LASF950:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1780:
+	.string	"ID_TEMPRATURE1 0x02"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF409:
+	.string	"__size_t__ "
+.LASF753:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF504:
+	.string	"__USE_XOPEN2K 1"
+.LASF1246:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF781:
+	.string	"USE_RESOURCE_MGMT "
+.LASF2283:
+	.string	"sendThrottleOrBatterySizeAsRpm"
+.LASF1635:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF841:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1603:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1877:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF982:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF559:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1011:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1866:
+	.string	"readFn"
+.LASF1156:
+	.string	"__time_t_defined 1"
+.LASF2028:
+	.string	"FEATURE_RSSI_ADC"
+.LASF624:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF896:
+	.string	"sq(x) ((x)*(x))"
+.LASF1509:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF601:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1253:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF939:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1544:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2258:
+	.string	"sendVoltage"
+.LASF1233:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF458:
+	.string	"_FEATURES_H 1"
+.LASF1753:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF417:
+	.string	"_BSD_SIZE_T_ "
+.LASF577:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1562:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1258:
+	.string	"__cleanup_fct_attribute "
+.LASF561:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF844:
+	.string	"USE_DASHBOARD"
+.LASF784:
+	.string	"TELEMETRY_LTM "
+.LASF805:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF2250:
+	.string	"initFrSkyTelemetry"
+.LASF1755:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF2233:
+	.string	"getEstimatedVario"
+.LASF1212:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1264:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1279:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1674:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF602:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF990:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1869:
+	.string	"revisionCode"
+.LASF802:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF653:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2155:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2156:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF876:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2190:
+	.string	"SystemCoreClock"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1487:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF877:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF994:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1682:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF640:
+	.string	"__STD_TYPE typedef"
+.LASF1680:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2136:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF746:
+	.string	"INT64_C(c) c ## L"
+.LASF2293:
+	.string	"sendTelemetryTail"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1709:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1582:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF775:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1260:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF397:
+	.string	"_ANSI_STDDEF_H "
+.LASF511:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF2240:
+	.string	"openSerialPort"
+.LASF1049:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1389:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1961:
+	.string	"OWNER_OSD"
+.LASF527:
+	.string	"__LEAF , __leaf__"
+.LASF1249:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF1522:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1553:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1636:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF980:
+	.string	"PG_PID_PROFILE 14"
+.LASF1602:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1117:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1890:
+	.string	"MPU_9250_SPI"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1814:
+	.string	"DELAY_FOR_BARO_INITIALISATION (5 * 1000)"
+.LASF2127:
+	.string	"PORTSHARING_SHARED"
+.LASF1692:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF592:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1703:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF719:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2229:
+	.string	"getAmperage"
+.LASF2284:
+	.string	"throttleStatus"
+.LASF768:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1284:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1067:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1319:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF799:
+	.string	"VTX_SMARTAUDIO "
+.LASF1865:
+	.string	"initFn"
+.LASF1671:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1746:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF914:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF953:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF647:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2008:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2185:
+	.string	"PID_NAVR"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF646:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1505:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1165:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1983:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1804:
+	.string	"ID_VOLTAGE_AMP 0x39"
+.LASF1310:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF596:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2154:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1130:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1508:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__ptr_t void *"
+.LASF2031:
+	.string	"FEATURE_OSD"
+.LASF1701:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1024:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF803:
+	.string	"GPS "
+.LASF1702:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF636:
+	.string	"__SLONG32_TYPE int"
+.LASF977:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2146:
+	.string	"SERIAL_PORT_USART1"
+.LASF2147:
+	.string	"SERIAL_PORT_USART2"
+.LASF2148:
+	.string	"SERIAL_PORT_USART3"
+.LASF408:
+	.string	"__need_ptrdiff_t"
+.LASF2207:
+	.string	"telemetry_inverted"
+.LASF2151:
+	.string	"SERIAL_PORT_USART6"
+.LASF2152:
+	.string	"SERIAL_PORT_USART7"
+.LASF2066:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2004:
+	.string	"serialTotalRxWaiting"
+.LASF1291:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF880:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF462:
+	.string	"__USE_ISOCXX11"
+.LASF1584:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1816:
+	.string	"long int"
+.LASF1679:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF986:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1410:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1745:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1839:
+	.string	"I2CDEV_1"
+.LASF1840:
+	.string	"I2CDEV_2"
+.LASF1841:
+	.string	"I2CDEV_3"
+.LASF1842:
+	.string	"I2CDEV_4"
+.LASF529:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1302:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF488:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1098:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF908:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF692:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF700:
+	.string	"UINT8_MAX (255)"
+.LASF1267:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1937:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1625:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF695:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1183:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1395:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1217:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2209:
+	.string	"frsky_coordinate_format"
+.LASF534:
+	.string	"__PMT(args) args"
+.LASF1044:
+	.string	"PG_I2C_CONFIG 518"
+.LASF785:
+	.string	"TELEMETRY_CRSF "
+.LASF402:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF522:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2271:
+	.string	"coordinate"
+.LASF1352:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2078:
+	.string	"SENSOR_GPSMAG"
+.LASF1365:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"sendDataHead"
+.LASF401:
+	.string	"__PTRDIFF_T "
+.LASF1718:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1157:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1182:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1205:
+	.string	"__struct_tm_defined 1"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1198:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1490:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF669:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1239:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF1585:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2111:
+	.string	"batteryConfig_s"
+.LASF2123:
+	.string	"batteryConfig_t"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2105:
+	.string	"CURRENT_METER_MAX"
+.LASF540:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1088:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF927:
+	.string	"EXPAND_I(x) x"
+.LASF965:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1484:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF862:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1732:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1833:
+	.string	"uint32_t"
+.LASF1149:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2173:
+	.string	"GPS_altitude"
+.LASF415:
+	.string	"__SIZE_T "
+.LASF674:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF812:
+	.string	"U_ID_1 1"
+.LASF1683:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1288:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1599:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF811:
+	.string	"U_ID_0 0"
+.LASF1998:
+	.string	"rxBufferTail"
+.LASF837:
+	.string	"USE_UART6 "
+.LASF1223:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1033:
+	.string	"PG_PPM_CONFIG 507"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2225:
+	.string	"lastCycleTime"
+.LASF1499:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF657:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1850:
+	.string	"device"
+.LASF673:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1243:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1359:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1608:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1558:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1237:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2237:
+	.string	"millis"
+.LASF1931:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1796:
+	.string	"ID_COURSE_AP 0x1C"
+.LASF2224:
+	.string	"frskyPortSharing"
+.LASF1741:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF565:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1982:
+	.string	"SERIAL_UNIDIR"
+.LASF904:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF501:
+	.string	"__USE_POSIX2 1"
+.LASF1030:
+	.string	"PG_PID_CONFIG 504"
+.LASF443:
+	.string	"__DEFINED_wchar_t "
+.LASF1569:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF552:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1189:
+	.string	"_TIME_H 1"
+.LASF1515:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF487:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2174:
+	.string	"groundSpeed"
+.LASF625:
+	.string	"_BITS_TYPES_H 1"
+.LASF859:
+	.string	"TELEMETRY_FRSKY"
+.LASF1817:
+	.string	"long unsigned int"
+.LASF1195:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF713:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2241:
+	.string	"closeSerialPort"
+.LASF947:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF467:
+	.string	"__USE_XOPEN"
+.LASF548:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1009:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1244:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF431:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF969:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1122:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF706:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF498:
+	.string	"_POSIX_C_SOURCE"
+.LASF1150:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1938:
+	.string	"OWNER_TIMER"
+.LASF1864:
+	.string	"accDev_s"
+.LASF1923:
+	.string	"accDev_t"
+.LASF1481:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1010:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1867:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1604:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2256:
+	.string	"vfasVoltage"
+.LASF1557:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1587:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1788:
+	.string	"ID_GPS_SPEED_AP 0x19"
+.LASF1332:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2232:
+	.string	"getEstimatedAltitude"
+.LASF924:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1419:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1592:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1713:
+	.string	"LAT 0"
+.LASF1062:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF801:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1828:
+	.string	"char"
+.LASF1218:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1670:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1752:
+	.string	"PWM_PULSE_MIN 750"
+.LASF648:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__stub_sigreturn "
+.LASF878:
+	.string	"DEFIO_NO_PORTS "
+.LASF1514:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__S32_TYPE int"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1275:
+	.string	"IOCFG_AF_PP 0"
+.LASF1915:
+	.string	"__spins"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1344:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF626:
+	.string	"__S16_TYPE short int"
+.LASF1837:
+	.string	"IO_t"
+.LASF1078:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1684:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF411:
+	.string	"_SIZE_T "
+.LASF499:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF491:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1913:
+	.string	"__nusers"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1588:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1076:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1053:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2145:
+	.string	"SERIAL_PORT_NONE"
+.LASF1463:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF688:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1950:
+	.string	"OWNER_FLASH_CS"
+.LASF857:
+	.string	"USE_SERIALRX_XBUS"
+.LASF793:
+	.string	"USE_RX_MSP "
+.LASF1493:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF920:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF452:
+	.string	"true 1"
+.LASF1110:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1325:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF572:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2291:
+	.string	"serializeFrsky"
+.LASF1401:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2235:
+	.string	"sensors"
+.LASF660:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF419:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2205:
+	.string	"gpsNoFixLongitude"
+.LASF2075:
+	.string	"SENSOR_MAG"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1696:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1650:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2267:
+	.string	"sendFakeLatLong"
+.LASF693:
+	.string	"INT16_MIN (-32767-1)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF685:
+	.string	"__STD_TYPE"
+.LASF1661:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF671:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1891:
+	.string	"ICM_20601_SPI"
+.LASF715:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1084:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF643:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF554:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1729:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2043:
+	.string	"ROLL"
+.LASF426:
+	.string	"__size_t "
+.LASF1155:
+	.string	"__need_NULL "
+.LASF1981:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF756:
+	.string	"I2C1_OVERCLOCK true"
+.LASF850:
+	.string	"SERIAL_RX"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1002:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2179:
+	.string	"PID_ROLL"
+.LASF1874:
+	.string	"mpuConfiguration"
+.LASF1216:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF447:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1860:
+	.string	"CW180_DEG_FLIP"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF851:
+	.string	"USE_SERIALRX_CRSF"
+.LASF925:
+	.string	"STR_HELPER(x) #x"
+.LASF1232:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1445:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"CLOCK_TAI 11"
+.LASF2019:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1007:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF871:
+	.string	"VTX_SMARTAUDIO"
+.LASF769:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1942:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF792:
+	.string	"USE_RCSPLIT "
+.LASF558:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF944:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF599:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1556:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF853:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2254:
+	.string	"batteryVoltage"
+.LASF1181:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF740:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF588:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1871:
+	.string	"lock"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1494:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"ID_VERT_SPEED 0x30"
+.LASF1192:
+	.string	"CLOCK_REALTIME 0"
+.LASF445:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF729:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF400:
+	.string	"_T_PTRDIFF "
+.LASF525:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1367:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1838:
+	.string	"I2CINVALID"
+.LASF1227:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1235:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1774:
+	.string	"FRSKY_INITIAL_PORT_MODE MODE_TX"
+.LASF1695:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1193:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1214:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1769:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1676:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF821:
+	.string	"USE_FAKE_ACC "
+.LASF1045:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1570:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1782:
+	.string	"ID_FUEL_LEVEL 0x04"
+.LASF1479:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1536:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2286:
+	.string	"sendGpsAltitude"
+.LASF1123:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1482:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2149:
+	.string	"SERIAL_PORT_UART4"
+.LASF2201:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF2296:
+	.string	"batteryConfig"
+.LASF1797:
+	.string	"ID_DATE_MONTH 0x15"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1452:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF839:
+	.string	"USE_UART8 "
+.LASF1221:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1885:
+	.string	"MPU_3050"
+.LASF1048:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1230:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1855:
+	.string	"CW90_DEG"
+.LASF2125:
+	.string	"PORTSHARING_UNUSED"
+.LASF2158:
+	.string	"serialPortConfig_s"
+.LASF2164:
+	.string	"serialPortConfig_t"
+.LASF1208:
+	.string	"__itimerspec_defined 1"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1631:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1862:
+	.string	"sensor_align_e"
+.LASF1577:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1775:
+	.string	"CYCLETIME 125"
+.LASF2280:
+	.string	"sendSatalliteSignalQualityAsTemperature2"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1297:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1639:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1653:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1978:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1979:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1736:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1560:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF984:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF541:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1163:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF2000:
+	.string	"txBufferTail"
+.LASF2285:
+	.string	"throttleForRPM"
+.LASF2276:
+	.string	"sendTime"
+.LASF484:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1442:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1388:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF960:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF940:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF476:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2087:
+	.string	"ut_delay"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1022:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF759:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2172:
+	.string	"numSat"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF763:
+	.string	"USE_CLI_BATCH "
+.LASF1547:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1835:
+	.string	"double"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1323:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2287:
+	.string	"altitude"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2197:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF936:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1377:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF658:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1210:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1945:
+	.string	"OWNER_I2C_SCL"
+.LASF1943:
+	.string	"OWNER_SPI_MISO"
+.LASF1334:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1308:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1967:
+	.string	"OWNER_COMPASS_CS"
+.LASF434:
+	.string	"_WCHAR_T_ "
+.LASF823:
+	.string	"USE_FAKE_GYRO "
+.LASF1458:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1164:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1581:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF970:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF668:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2027:
+	.string	"FEATURE_RX_MSP"
+.LASF2227:
+	.string	"getMAhDrawn"
+.LASF495:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF435:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2042:
+	.string	"rc_alias"
+.LASF1259:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2021:
+	.string	"FEATURE_GPS"
+.LASF2064:
+	.string	"SMALL_ANGLE"
+.LASF1622:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1075:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF560:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1047:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1222:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1826:
+	.string	"__int32_t"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1946:
+	.string	"OWNER_I2C_SDA"
+.LASF1771:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1827:
+	.string	"__uint32_t"
+.LASF457:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1525:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF464:
+	.string	"__USE_POSIX2"
+.LASF2292:
+	.string	"data"
+.LASF1096:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1663:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2029:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF987:
+	.string	"PG_IMU_CONFIG 22"
+.LASF910:
+	.string	"Q12 (1 << 12)"
+.LASF2114:
+	.string	"vbatwarningcellvoltage"
+.LASF761:
+	.string	"USE_CLI "
+.LASF1895:
+	.string	"BMI_160_SPI"
+.LASF806:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1129:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2099:
+	.string	"baro"
+.LASF1364:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1992:
+	.string	"baudRate"
+.LASF989:
+	.string	"PG_RX_CONFIG 24"
+.LASF1016:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF477:
+	.string	"__USE_MISC"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2157:
+	.string	"serialPortIdentifier_e"
+.LASF1975:
+	.string	"portOptions_t"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF697:
+	.string	"INT16_MAX (32767)"
+.LASF471:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2065:
+	.string	"FIXED_WING"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1043:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF726:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1485:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF919:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1371:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2160:
+	.string	"msp_baudrateIndex"
+.LASF2094:
+	.string	"baroDev_t"
+.LASF1996:
+	.string	"txBuffer"
+.LASF432:
+	.string	"_T_WCHAR "
+.LASF933:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1412:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF425:
+	.string	"_SIZET_ "
+.LASF1637:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1551:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF701:
+	.string	"UINT16_MAX (65535)"
+.LASF1370:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1708:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1161:
+	.string	"__PDP_ENDIAN 3412"
+.LASF676:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF396:
+	.string	"_STDDEF_H_ "
+.LASF1289:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF507:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1307:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1656:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1580:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2143:
+	.string	"FUNCTION_RCSPLIT"
+.LASF1526:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2091:
+	.string	"start_up"
+.LASF2117:
+	.string	"currentMeterSource"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1754:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2089:
+	.string	"start_ut"
+.LASF1436:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF680:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF748:
+	.string	"UINT16_C(c) c"
+.LASF992:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2272:
+	.string	"GPStoDDDMM_MMMM"
+.LASF1304:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF734:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1199:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1962:
+	.string	"OWNER_RX_BIND"
+.LASF1021:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF798:
+	.string	"VTX_CONTROL "
+.LASF2242:
+	.string	"determinePortSharing"
+.LASF1545:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1965:
+	.string	"OWNER_TRANSPONDER"
+.LASF988:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1700:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF2255:
+	.string	"voltage"
+.LASF1115:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF736:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1148:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1722:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1391:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1107:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1337:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1457:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF403:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF433:
+	.string	"__WCHAR_T "
+.LASF1898:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1517:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1764:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1175:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2002:
+	.string	"serialPortVTable"
+.LASF1176:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF1191:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2082:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1201:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2265:
+	.string	"gpsFixOccured"
+.LASF2131:
+	.string	"FUNCTION_GPS"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1971:
+	.string	"portMode_t"
+.LASF492:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF822:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2086:
+	.string	"baroDev_s"
+.LASF1904:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2100:
+	.string	"CURRENT_METER_NONE"
+.LASF1121:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF681:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1740:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF2138:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF1541:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1952:
+	.string	"OWNER_MPU_CS"
+.LASF1955:
+	.string	"OWNER_SPI_CS"
+.LASF1035:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1252:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1749:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1094:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF2128:
+	.string	"portSharing_e"
+.LASF620:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF873:
+	.string	"USE_I2C"
+.LASF1917:
+	.string	"__list"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1714:
+	.string	"LON 1"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF824:
+	.string	"MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF538:
+	.string	"__BEGIN_DECLS "
+.LASF1834:
+	.string	"SPI_TypeDef"
+.LASF578:
+	.string	"__restrict_arr __restrict"
+.LASF1542:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"UINT8_C(c) c"
+.LASF455:
+	.string	"_STDINT_H 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF962:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1546:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1986:
+	.string	"serialReceiveCallbackPtr"
+.LASF1623:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF2210:
+	.string	"frsky_unit"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF414:
+	.string	"_T_SIZE "
+.LASF503:
+	.string	"__USE_POSIX199506 1"
+.LASF1902:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF638:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF607:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF579:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1057:
+	.string	"I2CDEV_COUNT 4"
+.LASF971:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1787:
+	.string	"ID_GPS_SPEED_BP 0x11"
+.LASF645:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1564:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF905:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF2169:
+	.string	"gpsLocation_s"
+.LASF2170:
+	.string	"gpsLocation_t"
+.LASF505:
+	.string	"__USE_XOPEN2K8 1"
+.LASF942:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2184:
+	.string	"PID_POSR"
+.LASF771:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1469:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1434:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1984:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1028:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF923:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1924:
+	.string	"OWNER_FREE"
+.LASF2015:
+	.string	"FEATURE_RX_PPM"
+.LASF2102:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF508:
+	.string	"__WORDSIZE 64"
+.LASF1109:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF2120:
+	.string	"useConsumptionAlerts"
+.LASF1847:
+	.string	"csnPin"
+.LASF1711:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2188:
+	.string	"PID_VEL"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF506:
+	.string	"_ATFILE_SOURCE"
+.LASF915:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF600:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1081:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1792:
+	.string	"ID_LATITUDE_BP 0x13"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF465:
+	.string	"__USE_POSIX199309"
+.LASF1987:
+	.string	"serialPort_s"
+.LASF2013:
+	.string	"serialPort_t"
+.LASF1925:
+	.string	"OWNER_PWMINPUT"
+.LASF621:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1255:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1262:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1063:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1645:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2005:
+	.string	"serialTotalTxFree"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1092:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1446:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF945:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1169:
+	.string	"SCHED_FIFO 1"
+.LASF1706:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF497:
+	.string	"_POSIX_SOURCE 1"
+.LASF1985:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1186:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1340:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1132:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF733:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2275:
+	.string	"absgps"
+.LASF404:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1070:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF581:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF672:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1346:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1061:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2166:
+	.string	"dddmm"
+.LASF1299:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1644:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1893:
+	.string	"ICM_20608_SPI"
+.LASF1506:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1125:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1707:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1882:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF852:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1628:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1003:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF788:
+	.string	"TELEMETRY_MAVLINK "
+.LASF518:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1922:
+	.string	"long long int"
+.LASF1532:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2238:
+	.string	"telemetryDetermineEnabledState"
+.LASF519:
+	.string	"__GLIBC__ 2"
+.LASF741:
+	.string	"WINT_MIN (0u)"
+.LASF1270:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1273:
+	.string	"IOCFG_OUT_PP 0"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1768:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2025:
+	.string	"FEATURE_3D"
+.LASF975:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1948:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1133:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1567:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2088:
+	.string	"up_delay"
+.LASF909:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2196:
+	.string	"attitude"
+.LASF1134:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1549:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2260:
+	.string	"cellVoltage"
+.LASF2072:
+	.string	"SENSOR_GYRO"
+.LASF422:
+	.string	"__DEFINED_size_t "
+.LASF766:
+	.string	"SERIAL_RX "
+.LASF1113:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1737:
+	.string	"ALL_MOTORS 255"
+.LASF1135:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF2109:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF585:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF869:
+	.string	"VTX_COMMON"
+.LASF1228:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1717:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF832:
+	.string	"USE_UART1 "
+.LASF1791:
+	.string	"ID_E_W 0x22"
+.LASF2262:
+	.string	"cellCount"
+.LASF1293:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1136:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1626:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1512:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1240:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1889:
+	.string	"MPU_65xx_SPI"
+.LASF1144:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1100:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1350:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF478:
+	.string	"__USE_ATFILE"
+.LASF1036:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1969:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1901:
+	.string	"sensor"
+.LASF1523:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2104:
+	.string	"CURRENT_METER_MSP"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF840:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1231:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF584:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2055:
+	.string	"THROTTLE_HIGH"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1251:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF772:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1716:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF564:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2176:
+	.string	"hdop"
+.LASF2195:
+	.string	"attitudeEulerAngles_t"
+.LASF1281:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1964:
+	.string	"OWNER_LED_STRIP"
+.LASF1540:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF728:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF833:
+	.string	"USE_UART2 "
+.LASF797:
+	.string	"VTX_COMMON "
+.LASF483:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF800:
+	.string	"VTX_TRAMP "
+.LASF1900:
+	.string	"mpuDetectionResult_s"
+.LASF1903:
+	.string	"mpuDetectionResult_t"
+.LASF2187:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1715:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1760:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF2189:
+	.string	"PID_ITEM_COUNT"
+.LASF664:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1657:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1257:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF870:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1209:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1648:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1079:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF661:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF2071:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF979:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2003:
+	.string	"serialWrite"
+.LASF2290:
+	.string	"serialize16"
+.LASF1807:
+	.string	"ID_CURRENT 0x28"
+.LASF2084:
+	.string	"baroOpFuncPtr"
+.LASF834:
+	.string	"USE_UART3 "
+.LASF2264:
+	.string	"sendGPSLatLong"
+.LASF2230:
+	.string	"getBatteryVoltage"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1528:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1137:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1726:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1343:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1897:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF1386:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF830:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF817:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF410:
+	.string	"__SIZE_T__ "
+.LASF957:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1282:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2182:
+	.string	"PID_ALT"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF650:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2253:
+	.string	"sendAmperage"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1147:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1951:
+	.string	"OWNER_BARO_CS"
+.LASF544:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF536:
+	.string	"__STRING(x) #x"
+.LASF1026:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF901:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1097:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1820:
+	.string	"unsigned int"
+.LASF2067:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF835:
+	.string	"USE_UART4 "
+.LASF1029:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1659:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1652:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1763:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF622:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1552:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF567:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1099:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2040:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1146:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1590:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1295:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF642:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF520:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1034:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1527:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1930:
+	.string	"OWNER_ADC"
+.LASF1824:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF707:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1872:
+	.string	"accAlign"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1090:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF1660:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1629:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF836:
+	.string	"USE_UART5 "
+.LASF1575:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2032:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF866:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1326:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1933:
+	.string	"OWNER_ADC_EXT"
+.LASF1630:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1025:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1744:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1856:
+	.string	"CW180_DEG"
+.LASF1991:
+	.string	"options"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1953:
+	.string	"OWNER_OSD_CS"
+.LASF2297:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1616:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF407:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF955:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1496:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__USE_ISOC95 1"
+.LASF1407:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1141:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1277:
+	.string	"IOCFG_IPD 0"
+.LASF2113:
+	.string	"vbatmincellvoltage"
+.LASF2288:
+	.string	"sendBaro"
+.LASF611:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1632:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2277:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF929:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2410:
+	.string	"rx_pwm.h"
+.LASF2332:
+	.string	"thread-shared-types.h"
+.LASF2419:
+	.string	"pwm_output.h"
+.LASF2320:
+	.string	"/usr/include"
+.LASF0:
+	.string	"./src/main/telemetry/frsky.c"
+.LASF2417:
+	.string	"voltage_ids.h"
+.LASF2359:
+	.string	"stdint.h"
+.LASF2404:
+	.string	"pthread_stack_min.h"
+.LASF2353:
+	.string	"altitude.h"
+.LASF2301:
+	.string	"src/main/build"
+.LASF2317:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2343:
+	.string	"barometer.h"
+.LASF2358:
+	.string	"stdbool.h"
+.LASF2409:
+	.string	"flash.h"
+.LASF2337:
+	.string	"time.h"
+.LASF2363:
+	.string	"wordsize.h"
+.LASF2389:
+	.string	"cpu-set.h"
+.LASF2328:
+	.string	"bus.h"
+.LASF2312:
+	.string	"src/main/target/SITL"
+.LASF2334:
+	.string	"pthreadtypes.h"
+.LASF2412:
+	.string	"sound_beeper.h"
+.LASF2379:
+	.string	"parameter_group_ids.h"
+.LASF2316:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2360:
+	.string	"libc-header-start.h"
+.LASF2393:
+	.string	"timer_t.h"
+.LASF2402:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2372:
+	.string	"platform.h"
+.LASF2321:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2305:
+	.string	"src/main/drivers/barometer"
+.LASF2335:
+	.string	"resource.h"
+.LASF2398:
+	.string	"atomic_wide_counter.h"
+.LASF2308:
+	.string	"src/main/flight"
+.LASF2349:
+	.string	"imu.h"
+.LASF2413:
+	.string	"vcd.h"
+.LASF2356:
+	.string	"stdc-predef.h"
+.LASF2330:
+	.string	"accgyro.h"
+.LASF2352:
+	.string	"frsky.c"
+.LASF2391:
+	.string	"struct_tm.h"
+.LASF2386:
+	.string	"endian.h"
+.LASF2380:
+	.string	"exti.h"
+.LASF2351:
+	.string	"frsky.h"
+.LASF2406:
+	.string	"io_def.h"
+.LASF2361:
+	.string	"features.h"
+.LASF2315:
+	.string	"src/main"
+.LASF2309:
+	.string	"src/main/io"
+.LASF2370:
+	.string	"time64.h"
+.LASF2400:
+	.string	"setjmp.h"
+.LASF2394:
+	.string	"struct_itimerspec.h"
+.LASF2362:
+	.string	"features-time64.h"
+.LASF2354:
+	.string	"feature.h"
+.LASF2304:
+	.string	"src/main/drivers/accgyro"
+.LASF2399:
+	.string	"struct_rwlock.h"
+.LASF2340:
+	.string	"runtime_config.h"
+.LASF2338:
+	.string	"config.h"
+.LASF2367:
+	.string	"stubs.h"
+.LASF2414:
+	.string	"gyro.h"
+.LASF2325:
+	.string	"target.h"
+.LASF2350:
+	.string	"telemetry.h"
+.LASF2373:
+	.string	"common_fc_pre.h"
+.LASF2355:
+	.string	"maths.h"
+.LASF2371:
+	.string	"wchar.h"
+.LASF2364:
+	.string	"timesize.h"
+.LASF2302:
+	.string	"src/main/common"
+.LASF2345:
+	.string	"voltage.h"
+.LASF2421:
+	.string	"rx.h"
+.LASF2319:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2381:
+	.string	"rcc_types.h"
+.LASF2347:
+	.string	"gps.h"
+.LASF2384:
+	.string	"time_t.h"
+.LASF2342:
+	.string	"acceleration.h"
+.LASF2357:
+	.string	"stddef.h"
+.LASF2415:
+	.string	"filter.h"
+.LASF2348:
+	.string	"pid.h"
+.LASF2307:
+	.string	"src/main/fc"
+.LASF2327:
+	.string	"bus_i2c.h"
+.LASF2420:
+	.string	"timer.h"
+.LASF2368:
+	.string	"stubs-64.h"
+.LASF2405:
+	.string	"io.h"
+.LASF2377:
+	.string	"parameter_group.h"
+.LASF2344:
+	.string	"current.h"
+.LASF2407:
+	.string	"io_def_generated.h"
+.LASF2416:
+	.string	"current_ids.h"
+.LASF2376:
+	.string	"utils.h"
+.LASF2388:
+	.string	"struct_sched_param.h"
+.LASF2418:
+	.string	"mixer.h"
+.LASF2341:
+	.string	"sensors.h"
+.LASF2392:
+	.string	"clockid_t.h"
+.LASF2331:
+	.string	"accgyro_mpu.h"
+.LASF2387:
+	.string	"endianness.h"
+.LASF2324:
+	.string	"stdint-uintn.h"
+.LASF2403:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2390:
+	.string	"clock_t.h"
+.LASF2408:
+	.string	"adc.h"
+.LASF2366:
+	.string	"long-double.h"
+.LASF2339:
+	.string	"rc_controls.h"
+.LASF2346:
+	.string	"battery.h"
+.LASF2365:
+	.string	"cdefs.h"
+.LASF2401:
+	.string	"__sigset_t.h"
+.LASF2310:
+	.string	"src/main/rx"
+.LASF2369:
+	.string	"typesizes.h"
+.LASF2329:
+	.string	"sensor.h"
+.LASF2374:
+	.string	"common_fc_post.h"
+.LASF2395:
+	.string	"locale_t.h"
+.LASF2313:
+	.string	"src/main/target"
+.LASF2382:
+	.string	"pthread.h"
+.LASF2375:
+	.string	"axis.h"
+.LASF2306:
+	.string	"src/main/drivers"
+.LASF2396:
+	.string	"__locale_t.h"
+.LASF2336:
+	.string	"serial.h"
+.LASF2385:
+	.string	"struct_timespec.h"
+.LASF2378:
+	.string	"build_config.h"
+.LASF2311:
+	.string	"src/main/sensors"
+.LASF2323:
+	.string	"stdint-intn.h"
+.LASF2303:
+	.string	"src/main/config"
+.LASF2322:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2333:
+	.string	"struct_mutex.h"
+.LASF2314:
+	.string	"src/main/telemetry"
+.LASF2411:
+	.string	"sdcard.h"
+.LASF2397:
+	.string	"pthreadtypes-arch.h"
+.LASF2326:
+	.string	"io_types.h"
+.LASF2383:
+	.string	"sched.h"
+.LASF2318:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\223\001\205\016"
+	.string	"T\025\207\002"
+	.string	"'"
+	.string	"\276\217\224\305\006\b\002"
+	.string	"\002\001\002\002\002\003\355\201\326)\004\002\003\352\263\360\321\b\004\251\335\273\317\007\005\323\200\315\277\004\006\006\341\230\360\352\017\004\002\005\002\006\002\007\002\006\b\315\277\261\313\005\002\002\b\002\b\n\206\233\304\331\003\002\002\005\002\t\f\204\372\330\221\003\006\002\n\002\n\002\007\002\013\017\311\306\345\206\013\004\020\375\362\315\354\004\b\002\n\002\f\002\001\021\022\331\302\373\304\002\022\002\r\002\r\002\002\002\016\016\002\016\023\214\324\307\260\007\n\002\002\002\001\002\005\002\017\017\002\017\024\346\326\261\340\002\024\005\002\013\017\002\017\025\026\202\342\221\312\017"
+	.string	"\027\205\276\350\350\017"
+	.string	"\030\364\314\211\271\001"
+	.string	"\031\262\277\355\257\006\020\002\021\002\007\002\022\035\241\323\204\257\007\006\002\007\036\037\327\313\314\200\017\004\002\n\002\001 \343\346\257\326\004"
+	.string	"!\274\342\313\241\003\002\"\254\241\214\350\n\023\002\023$%\316\252\305\366\016\022\024\002\022\017\002\017\004\002\004&\227\322\354\331\016\004\002\025\002\025\002\026\002\026'\240\342\234\212\n()\307\354\376\303\t*\275\301\260\257\004\n\027\002\030+\253\235\3708\002\002\031\002\031,-\316\352\207\265\016\016\023\002\023.\353\315\243\273\006\022\031\n\004\002\004/0\240\342\234\212\n"
+	.string	"7 `\002SF\345\001\025\204\326\001T\"P\276\220L\3216R\214U"
+	.ascii	"\3701\334g\016n\357\265\001\371\216F\026\210\023\214\210+e7\005"
+	.ascii	"\314x\007\276\254\261C\307i\233\351C\220\253l\321kj\231\023i"
+	.ascii	"L\202`)\021\373h\271\275p\212i\004\220\006\270\0014\027Y+\034"
+	.ascii	"F\304\003\032p\003\030W\023\352\267/\033\210\2472`\315\3200\260"
+	.ascii	"\r\"1\230\222z.\256\254\342\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\345\004"
+	.string	"\202D\016\026\240m\r\377\377\377\377\377p\371i?\026_\341\273q\361o\255L)\352jf\200\330eY\355\324N\322\321\220\372\236\325Y\033\231]\224\0049\214\202\030\0246X\367n\235\317\2671 \320\002\271\243c\267\202\356,\324\007y\357.K\256\006\227\024b\031\366\f\034;\004\323"
+	.ascii	"\316\215\021\013\343\256d\301+\304:B\020\344s\022\331\300(\004"
+	.ascii	"fd\2411x\0343\340)f\212\2145&\214aL\370a\020\306D0\200\207.F"
+	.ascii	"\3008%\210\326\235\240`1\336\316jc\265x&\305\033\002"
+	.text
+	.section	.gnu.lto_.inline.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`f\b\345\030"
+	.string	"\026]iH\340\360&\215\001\360\2005\356\0048u\3011k\035\\\236\\/$\225~b\355\354\004\275\305\253\367\002\273\347\342\035\0243\324C\301\365\217Gi\210\301\262\3022\016f\220\367^s\273e\272\253\277\341\306\361j\215\270XF\266\334)J"
+	.string	"Q"
+	.string	"["
+	.ascii	",\340\351\037\374\211\347\350c\211\370R\007HQ\301\351\245\r\366"
+	.ascii	"0\3020\202"
+	.string	"\210\265\307wO\013\247\205\252\323\273t\372\277\244\317\356\246\326\356\232*\355\256k]]\344\356\202\250\377tw\027%\177\227\306\343\361E7\354\202\255\217\215Z\020*a\006\315\222\313\005N\316\004l\325\347\331\024d\357?\236R\251\037o\232awE\236\2640~L\351M\303]\320\245/ath7\246\365i/\376j5es\365\\\265\350\005\243 \026\335S\366\224\265\350\004\0246<\372dy2\2205!N(u\007\333V\306\264\273\261cz\003T$cr\323C\242\303\311\002>\346\320\350\314\264nrG\250iiv\211M~L2\321\356\222\334\362b\256)\207\203\351+\343\006\307\232,\326\213\342\330\335\220\031\340\363`02A'\3625\2114\243\341H\305&i~\200^\314^}*\016\273;r\310\265\377\247\024\304}\200 c@\307I\202A\340\025\220\207B\3104\263I\341a\307d\004\237\372\034\230\026\322B"
+	.ascii	"\363\006\b%\035\254\242\nB*FV"
+	.string	"\231\247|tA\243\304\364\344r\354@i1\024c\307\312,\340}\322fE\r\021\363\331 5\273`\311'/#\310~rl$\341,\350\320Hy\300\001\200\254\250\341)3CR\233J\215i\fp\242\031\262\252y\022\200\3434\005\243\020tF\340\214)\221`Dd&,\263\240Z8\372\240\025;\2475>c\313\017>\325\020\036\031i\344u\242N@\016\255<\301\216P%U\242{\262\340D\234\340\232\311eyr\364\202\204>\252\360&%\332b\2664\222\025\306_Q~\333\241\025I\364G\264\240\335T\\\323\327z\227\361\201\257\333z:\263a\313\274,\257\177\026Z\300\263-AO\252^si\254\321tx8b\3555\222}hg+\205yP\240\210\326\223\031\004\341\246\032\312\214\220\357\351\361\232_O\364\314\212\201\21396\036w\030\360V\357#\326\231S\251Y\251\320\327:\255Bm\216U\250\362\222)\232`"
+	.string	"Q\210M\360\203\016)\303\353\025\216C&\304vh\254>\226\226\372\271\b@\023j\205\253\305N\036\267\355\320\207\f\21699\352\003\226\322\342\216z\001D\267s\231>\370@\245X\f\261\013#A\257T\314\344\340\247{\335D\335\005\033\335\243\375Dsy?;\350\021\354B&M\207\f&\214\321\374Q\3730\247)\224U+\r\365\345nP\212@\253\344\317.\t\236?\021O\313R\021\316\336U\001\f\340iB\352\306ij\300\373\037\210.\306\323\274&\353\370:R\254B\036"
+	.ascii	"Hh1\236\340=\223\rv\275tr\305\0022"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\375\0075\023"
+	.string	"\006\223A4P\3134\0060\351\352\233\277e@\333AQ\217\013\324dff\026\026\271m\346]U\025\025\244\340/\364\330\207\326\222\220\327\0278\315\201\223\223o\242\245\225;\245\024-"
+	.string	"5"
+	.string	"8"
+	.string	"\255dd\031\013,\343M\372\333XSx\265\212\260X4Zk5W\026_\177\236\207\260\032\302\334B\317\347f\177\373\354|r\366++\t\t\030\034\323\256h\273\">\341\345\322\351\204B\263\213\231\300\273\331\227H\204\304Pi\023\374\311\204\263X\374A\313h\013\337"
+	.string	"\034\216\207el\003~J&\363\371\224\374\007m\bB\220\347uE\241R)Wv\313\270\251T\024\216\240\215Qn\246V\374\002\247R\001\2016\247\323\247\251F\343\2317\033\325@3\020\307X\303\3160\006\343\361\210D\033\001\255\002\367}\337g\323\247d{\261\366\342\355Y\021{\305^n=\270!\276\023\341\300 \376\035\342\310\023\276?\354N\036vH\274\\y\277\357:\267\f\002\200\277\250QmE#IA\2621\007\300\002\t\310\250\346\022 \242:\f\3028\245\230Q\220\224H$I\202\244I2\314\001\343h\024\b\r\361\205\350\255\200\240\3613\246\224\350\251\222N\324\r\300ZG.\342\375\346E\346#\244J\031\205\225OE2L\3152\037\306\234\"Hqy\337\031\303\326Y\363\3163A\272\207\\\"\020\254So[)b\nr\242"
+	.string	"hZ\315\365I\031\332\017"
+	.string	"\0314k\305Hi\315}\335_<\231\302C]\320\241Up#R\316\344\3333i\300\250\235\276S\275\f\3507\231]\035k\324\037{+\b\250\207\007\266\336\266\220\326@\323\246r\301\250<\206\253F\367\r\265?s\212/X\373\032\355\313\260\322g\265\235\344\273\241 ^\227\355;+\301\356*\235\325N\356\224\024\232\304\021\331\251\360\302\261X\214v\205O\265\017>n\034G\261\022\030!\260+\024Tpe7\226\273\242\272l\265\260 \217\021we\374$\004z06\337\245Ya+\333\n\342i(\026\3027;.\325\032{\322\037\3463\210\236\305\300\354P{2/I\261^\321\357O\216@0_6V\354\305\230h\260\317Ci\354\001\357\b\242&\330\230DJ"
+	.ascii	"E\274\024Y\3039?[\240N\300A\2566,\305\252\257\302\345\003"
+	.text
+	.section	.gnu.lto_.pureconst.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375 \\M\002"
+	.string	"\302E\021\032\200W\215\001\0178C&"
+	.string	"c$~\21080r&]lW\255\377\217\237M\310n\360\202\b\202m\340\002\0178\300/\267\274r\312\231O.y\344\220?\356\330\032g|q\305\023G\374p\303\365\302\304\261\273;\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`2\001U\007"
+	.ascii	"RI\034#pU3\034\204N\377\377\377\377\377\377\377\177\327h\007"
+	.ascii	"5\021\t\214d\257\221;s\3773 \266\264\211\2252\005/\325;\006\027"
+	.ascii	")\200\362J\347\013L\222Unu\262r\326\376S\225W\255CJ9U>\367 \023"
+	.ascii	"*\037\215\331\214\027\323\211/\327\252 \2429l\340R!*\217\bPg"
+	.ascii	"k\177\030\301\302I\371\256y\222K\312#t\312_\3713\001\367v\237"
+	.ascii	"8 \260\202!\272n\021(\324\375\340@\0172tP@/hS\232\301\265[\275"
+	.ascii	"%\021u\335\272\003\376\236\314\314\215\332\335\260-\333=a\213"
+	.ascii	"F\210\303P\262\022\t\342rS\007\353\034Z\205\305\2661\330+Z\260"
+	.ascii	"\b&\021\\\2170\342\207`\256F\3440l\330\203\2230-\267+$E\3208"
+	.ascii	"FX\2049\356C\033\2547\244\203`\276\302d|Dl\f\262\256.\013\212"
+	.ascii	"\353\006"
+	.text
+	.section	.gnu.lto_.lto.a2091a47be0d4765,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sendDataHead.92.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\325\t"
+	.string	"\246RD>@\247(\035\f\024$\013,\311\377[\306\350\277\273\274\372\332\032\t\305\243\005O\r\273\3616\204\377\021\357[m\211\375\nG\203]\253\342\250\300\363\370\363c\204\371\b)B?k%\237\304J\231R1"
+	.string	"/"
+	.string	"2"
+	.string	"\253\027\201\335\360\301\016\3333\177\266\202\207'{i\205\240\0060\330\335\250&\377\236\237\177"
+	.string	"\307\200)\323\363\302\331]'\230\032\271\365\266\031ls\354'\004\331\300\016M\251-\373\226U\226}\327\257iZ3\235\232\376\226QA\320\260`W$\346`aY\201\024\333\327\330\034I\314\264#6\337]\036\326\335\252\002T1*MS\217z\220Ym\351\003\267\001\355js\210\362\240\027@\324d?\300\303\222\217\342\016R\036|\346\223\264gW\214\352\2241\347\253$\301\006\336t\024\033\317\204\004\004\207\340\371\244;\\\tC\344]\304\2227\352@]F7\212\032\037\013P\354x\242\310)8\264\321yq\024\nyQ\023\356-\253\254\212\025\330I?\274e\006\016"
+	.ascii	"~\3112c\017\203\254\275_K\301\023E`\3422\003\204a\020\204v\\"
+	.ascii	"\030s0V\203\251!\340./\332I\006"
+	.text
+	.section	.gnu.lto_serializeFrsky.94.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\261\001e\017"
+	.string	"v\034gG"
+	.string	"\221(\035\363\206\302y\343\316\335>\311a\260O\3241\347v(\253\216\345zJ\201\340\320\"\004\024\004X\025\257\353\217\375\271\tG[`?\213\341\377\177W\363\033\263j\016e+\226i\"\270d\3010\324\b\331[J\231\002U"
+	.string	"K"
+	.string	"S"
+	.string	"2\024\306\322\234\353\003\013\305Mw{<BQ\312mS\362\242\256\372\322\216PL)\327\322\255#\266tJ\020\225\026\034<\242\005\t\240&\204\315j%\247\245,\r\254n<xD\024\331\325X/\364\245\213AT\355r\013\272\373\033\212\033\364\034\375_\372\317\340\327\031\001\265/\314\f\255\367\306\017K-\273~\345q\034\307\363\312\257.\252\223\367r\367\314\373\345\275v\235\0325 )\2725\2148z6W\264\374\327__P\277\307\037R#\260\253\257\027"
+	.string	"\241\324\345t\356V\211\221\351\206\205|"
+	.ascii	"G\347Q\177\312\177\211\211\200\025\247~\215\351\t\323\225\304"
+	.ascii	"E\340j\250\363\nn:\225;RNv|\007#\243\265\2066,\"\246\254\202"
+	.ascii	"'dAkNi1\341Br\373\223&\254\206gN}2\205\237\366\202j\326\335\""
+	.ascii	"{\0302/ \230]\247\321\3236\331A,\006\312\006\007}\t@$\b\016\210"
+	.ascii	"|>B\245\020\211\374\310\307dB\032=\360L\243\322'\372 |%/BIH\344"
+	.ascii	"\215\214H\336'\300A\t\337\310+\201\340\310\363\200\265\312\346"
+	.ascii	"\225\0066f'\254\222\335\335\034\263\214\221\223\231\225\225\203"
+	.ascii	"\306f\210u(\261\275[\005\253b;4\335^\246\237\331\002\" \320\202"
+	.ascii	"\021\261\335\0209\341\244i|1\274\276\225D\201f\203wr6\225\213"
+	.ascii	"\330X(<h\271\305\362D\307/\360\211\t\327*\357U8\330\023\305\355"
+	.ascii	"\016\315,,\332\032\024I]\362Xm\204\026\214\341\366\272\304y\254"
+	.ascii	"\341\r\037\216\306p\366"
+	.text
+	.section	.gnu.lto_sendAccel.96.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\314\003=\032"
+	.string	"v\260\244H\300VQ:U\nAE%rB\316\266\301(T]\207\004R\207\2008!1\374\004\350\366;\262\201"
+	.string	"\315x\323\363\367\307\262l\003\343\210bI,\247\277\355\323\331\237\035\322Z`\216\352\177\2068\242\334\031\333\210%\233H\231R\215"
+	.string	"\204"
+	.string	"\224"
+	.string	"n ^\266\364C\200\306K\230\224\230}!Fp\003\364 !\304iCu\304\353A\315\351\313\021/\177\"\2170\244\330\177\034H\355=7\211A'D#\036\023\324\234\263\346\3226\342%\315g\302K\3602\341\245k\366\225\373bL\025o)W\264e\316)[\030\336\203\276\033\324\332%\270Z\363\225\006\026\335.\350\022l\3159\001\354D\200\007t\304\356\246\340\r\024\337\023\335"
+	.ascii	"\r&\335\016\305U\2253\347\264\352vCwx\333=\266\035\330 \2003"
+	.ascii	"h]\263\240\205M\243<\342P%\026OS\243l\337\355\237\313\263\377"
+	.ascii	"\271/lP=\363\022\3252\240:\346\277\333\325z\357f\211\3521T\257"
+	.ascii	"B5L\250\026A\265J\245\016C\265\004\325 \250^\251V\251~\200\261"
+	.ascii	"\007\024\033-s\232\230\3622\235$\222\032\377\375\275\253}\177"
+	.ascii	"\310\177~\222G\327\200\356\363\221v\310\312xi\273v\243\037q\032"
+	.ascii	"\021s\274%X\223\030\250?\362\211\274\b\350F?"
+	.string	"\020\304!\336\017\330e_\216\364\227H\342\022e\177t\347\254v\334/\341\2360\275\213_Bs\332\b\300\354j\003\024\341p\210+\027f\217cr\323)\253V\\\231\005\007\025\256j\237\223\222\360\246\t8Sl\nWR\341fJ\222pq\250\364\300\225\253YpP6\235\312\360#\026`\n\354\0137\242S \306\2343A\2213\355\3703.=\323\240\327i\ba2\220\214;\236\246\356\332\034x\364:\323\bm\220uw\277T\340!\302\257\356q+n\373]'9)\233N\231\245\244cw\316:\367\271of\013n0\340$8\020sm\270wb?\034@\3202\310~h>3\236Y\207\231\217\314\303\006\035\036\331\016\r\204,6\300=\037f4\231OO\017M6\372l\377\334\027~\340\303\311\2667\271<\253Tlk7Ik\316\332\021\260\263\326A\025!\355\342\023\035\\\342bjT\357 \330\332\367l\316\332\226"
+	.string	"\245\034O\323?\372\211~\022J<\234l3\257\235I\361\222\331\227x7\205\343\312,\003\234\324m(f\375_\004\327\306\250\322\316\265\377\235\306\346Z\0069\251\225T\322WI\001O\25010\343\214sH\231`dffSHcP\002Q\250\214l\003\020xF\233\226Z\003u\352\274\020\"\021m\330z\344\224E] \327?\335C\234\200]\n\312\203\234j\023e\276\204\242\026\252\f\rq\252\006/\257C<\304w\276#3\230\222\301\f\305\205<R\024D\262\332\231\322\343\304!\300\247\305PC\240W\320J\237hlt\364\2719\372\013\264\216\177M\025D<,\353\330\324K\037wl\225\355O\2441\330\236\305\266\334\340\315\013\242\252\035!&s\276\202\342\035\304i,\371\364\002\003_N"
+	.string	"\031D\222\352\324pl"
+	.ascii	"I\246c{\324\037GG\364?"
+	.text
+	.section	.gnu.lto_sendBaro.97.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`n\004\r\033"
+	.string	"f2\251H\260\226Q:\025L\027\341\3733\211\013\026\330\006k\032\312+\325\f\234\223\t_\021\304\353\0071\371\274\365O\354\337\026/C\320\024\252\367x\247\344\345<\345?B6\0027\324\016\376S\032\370\314\004q\021D~c\263dK\231R\225"
+	.string	"\210"
+	.string	"\227"
+	.string	"\017m\323N\243G\234:D\334\216\351\346\341k\bL\352{>\3573|N\243'\202(\264\203\301d\316\371z\350\034\361a\313]R\017\365\003R\017}\031>\343\303W\022\230\375#+\300\361y\214\037\027P\313\264!9*\232\223w\363\320\b\304\207:\232f/9o\305T\355\230p>(s\316\330\2528\355\241\\\245\3717\372*\247\003z8t\311\322\r}\245\314\211!%"
+	.string	"\350\202\344\001'\024Jnt\025\241\263\251\252r\346\234\326\234N\350N\335\266\216\355\007\266\314\021\013dU\342\3614u\212\315\263\351\356\354\313\271)l\251v\335w\333\204\352\232\367\356\226T\323\034x\317\204j\031\251\216\221j\030\251~\221j\027\251f\t\325+)\365\230R\263\244z%\325\242T\253\244:%\325\241T\313P\275R\255R\375\003c\020'\330oN\022A*\263)\\jq\337\337\373\201_\373@?\311\206\016\224\253\3262\203B0\025\335\347#y4\3551~\304Y\244\372\355\216\230\370\034\206_C\347\211\2139\347\030ore\221;\341\264\273\273y\270\005zE\202T\212\217\343r\303\r}\334\226\344N"
+	.string	"b`\374\3614\377\373\215\016\241GS\215ffi\366\270\250\332\320\314\036x\227\314\316\354\305]\231up\213\032\205b\326\007\312\224\350A\335\230\265\342L\250\222N\t\304\217x;\360\001\210XQIg%Uy\272\215\177DR\024#\273\377\33595\235b\335\335\027.\252\246A\373\310W7\364\335^\3304\350\025\2651d\320\347\276\022\210l\013\344\261\307J[n\037){\307\203>gWP\024n\034Y\003\034\013\f\026$\200\t\340\271+\300z2|\230]\210\365\314xd\033d\032d<1\016\030(l\210U\230}\210\301Z\336\351 \233\305xvvf\261\221W\273\234\233\302*]\226"
+	.string	"\021\034\373\262,+\302\266!\bi\252\255\315\276\257\007\244\251\346\262Y\227\315\336wW\315\332|\351\255\255\201Y\337\207\244\343,\013\363\263\340C\252\321\332\367\256:\305,\333Z\253\fW\326e\334\025\326\216\373\333jY\342\256\266\346\206\270)(\375\016('\"\251\332\227}\345\234\3244\230Z\325\306T\271-\2456T\250q(\005\025\202\344\310\210$\t\n\022\245\305\220\002\241\251\"\017\021P\271\202lHaa\222e\277\003\265\023\020\252\215\272\365\242\027\\\222\227)5\332\222\r\261\224(7\242\301\351\241\3721\221\036\305kMdoj\207\230\217\025.\375\3000\351\344l\324]3\302\302\313\005\276O62f2\354\216&v\024\266"
+	.string	"\376\311\032f\036\272\003\263>~\267\251j\334\301}\f\357DF\221(H0\312\033H\361Lp"
+	.ascii	"1\221\366G\326J\023b\"\226\301\325\306\037\222\201\367\3355\377"
+	.ascii	"\324\335\017\241\335k\313V!?\321\003d~\027\031\240g8\r\375\374"
+	.ascii	"u37\317A\375\246\357\203\262F\r\377"
+	.text
+	.section	.gnu.lto_sendGpsAltitude.98.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\357\003\205\030"
+	.string	"v+\225F\300\330*\035\tu\377~\353\016\315\221\203\301\345\251N\313T\3050\b\210\022Y\227k\216T\213%\232\212-ZU\036\023&M\347.\3545\233&\317\307\237\033\314p\f\023\354\2210\r\204)\242\030\261l \215\033\311\235R{"
+	.string	"|"
+	.string	"\202"
+	.string	"\273{\3724\004\361\323\337\001\033?OMR\366uxA\n\366\0345\342\326\b\371r\272\007\342\247\374\316\343)'\365\033\307\021\273\316F\\!b\255G%\312.\317\345\323\t\304\317"
+	.ascii	"/\020~\312\023\b?\035\263\241\234\027cC\271\236Z\257gwQ\n\343"
+	.ascii	"\261\203T\306\374P\214\310v\2739\b\347Z\272\321@\246\335\375"
+	.ascii	"\356\322\304m&e(fw-m"
+	.string	"7\334=o\373\201\355\b6\210B-y[+\374\234\n@\206N&\177,\201RxVV\261y3\2519\373\240\335]\353\013{J\263\220B\322\343\224\036\335w\213B\351\360:\335\255!i\031J\177@i\305\022T\220]\024?V68\211\320\270\357\327]\332\007\372?~\025z&Y\200\245\221\350\251q\237\337\303\243c\260\363|\036\025tl\354\356\370i\373=\035\232\\\217\313\347)Ij\312\367`\327\241\231 \342r7\242\004\276\357\202HG7\221\336w\223HaF>=>\372]9\217\377\304o\n\023\251\357I}\315\247\224b\200Lp\033C\006y\233M4\275\361w\037\001\177Tcd \315\331X \001\253\310\335\275\321\2260\324\357.\362\354xB\223T,\337\022^C\265\254\265\230\311\037\373En\244\306\317\261j\265\n?\257\006d\264\2302\365\272\303\270\220\231\365!6\bl\016\027\"s\300\311\3562"
+	.ascii	"\362 \035\374\234O\317\004\252\277\356\024\313AJC\003\006\n^"
+	.ascii	"\004\2604\210x\311\274<\250D\257^`\035B\2706\240`\256\027k\206"
+	.ascii	"\345\201\365B}\220Q\315\240V\256\020\250\227\026\267@\260\\\250"
+	.ascii	"W\253\345B\215<\331A\253/\374\030;J\364H>bg\206\234\252j\302"
+	.ascii	"\266%\260\b\312tf\037\350\003'(S\261s\227\373\300\0135\341\201"
+	.ascii	"\007\360\343G\023\336G\tGdc(\341x\366\337]B\212\240\214\205\244"
+	.ascii	",*H\243\222\304\373H(uT\230\022>#n\244\001T\250\241(\b\021b\244"
+	.ascii	"D\202I\222F\013\334`\002\231\271\263:\021P=eD\025\224T*\303~"
+	.ascii	"\006T/\322\273\322#GF\235\020Ak2\211c\241\275\036w\223\264\300"
+	.ascii	"\316\374V\b\361O\361T\242\204\033c\300\265\315I\210G\001PcX\252"
+	.ascii	"}a\316\fFq\021\264z\203\371F\340\247n\"\345\302\021V\221\313"
+	.ascii	"t\211f\t\026\212\307;D\211\375\211?n\206a\006\210Co%\r\277\207"
+	.ascii	"\257\305\3042\354\354\211JA\223\344?.\374\310\264\303\321Y\021"
+	.ascii	"\353\007\234c\330!\257F\225\377\323\002\315?\317p\223\304\264"
+	.ascii	"\231\356\177\207y\204u\310\005\346+\377\321%\260{\254B\323mV"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_sendThrottleOrBatterySizeAsRpm.99.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\353\005-#"
+	.string	"\232@\300\rF\220\\Q:"
+	.string	"\006R\312\nN\245\335U\232zJPJ\305B"
+	.string	"S\314\303i\202 FML\242\200\276\355\357\030\342\336X\002\004\002U\n\b\035\303;\253\334/\007\350\017\314\315\265E\3315\276\214\233m\204\020B\344N)\310"
+	.string	"\272"
+	.string	"\313"
+	.string	"Mgmbf\tN\311a:\025\377\312\366"
+	.string	"\023\245\326\032;i[w+Kg\325:\237\216@18iD\2466\322[\371U\257\302t+K\"\316\250 \0259\265V\243\223>:O\316\036T\236\244\007*O\372TL\261\223Fkj\366\247\374"
+	.ascii	"\002\323\245\232h\273Y\355\251\231jRk\025\203\223np\236\2441"
+	.ascii	"\353\3548\257BR\315#PO\302;\265V\333\036\271\356\247Y\222\343"
+	.ascii	"R\235o\036I\321\363\003\356~b\371"
+	.string	"\201\246y\264u\004\\\234\020\211\002\362\3227t\242\344\371\343\343\270@\316\226\035\031\3207\006\355X\362\373\360\006]\031\360i\244\325Z?\3454\007\260G\251yTk5\375\001\243\356\327m\377\260\255\302&\337\004\345\227\300\232>\001\351\321\242\375/\347j\362\225X\005\022\375\017\251<\371\035J\002\204G\213\226I\221Q\243\3337\027\364?\323|\2733%:AS\251\036\273\252G7h\177\254k\3046\251\t\214\324\003`\324E#\265\200\013o\242\221zH\bF\0354R\007\270\326\r\364s\254{\366\253\033\006\243~\305\250\317\030\265\t\243._\324\344I=\236\324kR\337\200\254\314\231\t\305Zw\024\367\324.\262\013\223\013\177\255\377\352\307\372h_\313\337\"\372Y\333\203\013G\315Z>\374m9\027\335\261\224\316\035\217\263\313S\220\021\347I\332h\344\243f\373\312\306/\213\020\f\347\205>\026\307\254\273T\001\326\327\352"
+	.string	"\264\001\366\224\013\020h\257u\032\320V\200\365\331:l\013\237g\375P[\360\244)\367\304r\377\324\207G\213\\\260=\342\375\352\t\240\274t\361\312\r\3723Jr\351\034\2537Et\366\017\245\035b\004\375\217\334S\r\361\355\356\376\"\025\005\t\271\301\237\353L\0218\243R9[\234\225\033"
+	.ascii	"\304\255\237\375\325\270?K\271\234\312\360\262\216\265\006\312"
+	.ascii	"\220j\013\305\342\036_\255\274\003\273\343\226|\234\236\364h"
+	.ascii	"\261v2\316:k\255\023|1\037S\302Wr\322&N\234(O\356\326\222t\001"
+	.ascii	"@\244\232\355\261N\343Q=\006\2426\212\024\364\277\331\336\313"
+	.ascii	"\220\336\356\374\341\257\203(Ek\255\273-P\022\330O\371\211\306"
+	.ascii	"\352\215\217\346\361_ J6rH\271\022\037D\220\300%m\270\311\310"
+	.ascii	"\345\222p/r2\244\033\302\215\002\004\026\022\"8\250"
+	.string	"\375\344\356\025\265\245\030J\270\026\266%\\\3566\343&\343\226\263\321\200\2014\303\266\002\247d\253\025pR\215\033\316\226KJ\302\331bU\274\217u\215\234D3]\274\355\331\327\"\376\303\203\370\322e\365.\336\271A\017(\332\001Y<4\235N\027\236\306K\363\327\026\tX_H\264\002\210\366\302s\211\260\\y\355\255\356\243s_\344\025\224\346\236\373\241\223\224\236uTws\341\254\325\027\301g\3636\0314p\340P\23647\201\233\251)a\320Ts\203\246M\352\004!}\033\345\207\177!\241\323g\374Y\330\346\260etHh\207|\b\005\255\320ys\225\345\006m\005\247>\261\250n\250Q G\031BH\215\210\210\210H\322\246\003\220\002\031\"2;\022@\206A\360\214M)h\366\2179\313\022\255\355\013O\200V (2T\272#}\263*\016\241\277E\313|\254g)\374\b\230\234c\261\250\325\027\226\366\220\347v"
+	.string	"naPL\030pb\246\203\215\005{a\302\346\037\005\215\274\177\276<+\214\336\376=3\224\005\301\223o\200\307\362\332\033\314N\003\200W\t\003\275"
+	.string	"\320\177c|PQ\253\034jt\222/\316\013\002\035s\240\274|\020\326@&\317\324\016\276\212\265F\232\2357\"\376\307\022\357@a!\357\021\240\251[\335Vw\325?OF\230>~GVd\037\266\271T\253F\242\325Y\216"
+	.ascii	"\202\273.\254\211x\376F\337PY\3310\253@\3448P\302p\006X\322/"
+	.ascii	"\252\266s#G\360\t\276+\004g\272H+\026\314\220gy\222\267\215\361"
+	.ascii	"\376"
+	.text
+	.section	.gnu.lto_sendTemperature1.100.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\371\001%\022"
+	.string	"v\"wG\340\320(\035Y\244 i\334\n~\"\0319\002=\021Yaspe"
+	.string	"&9\231\001\270d\257Y@A\341M\340\361\273\0013G\037\315m\020 \006\253 \fW\020\2726\223\314Qc\204\003\336G"
+	.string	"\265=\233\335D\312\224\002`"
+	.string	"^"
+	.string	"d"
+	.ascii	"\260\347\274\034x-1"
+	.string	"6D\273\213z\264\210\367\310\361\001\243\307\274\200\321\243\217\003;=\242^\244\354\333\374\001\002\373MJ\207\n\307\312\206l3\2737\217G\037\360\036\177r\314\206\361\333\207%\311\320\320B\031\273\373\251\314c\317\230\377\232\227j,*O\222\310\356:k,-\267\336\266\001\333\r\354\314\020\276\311Rc\354w\2530v\2276=\274K1\355uiRLw]Z\273tv\351\003\330pi\261`\305\356\206\034\215\005\212)D<\374\355\3738\017}\036\237\034\373M\212\2673\244\236\030\033\021\3546\376\316\003\241\021\273{z\264\035{\316\313[\024\036M\206\306\343\021\305\"\325\345u\374\333K\004=\027R\274\331\303o\274\230p<7\371\324\b\372\316\257\301g\206\213N\257s\213\200Yd\325NQ4\034(\224\252\032\207f$>\256\251]\215\231\007Y\346l\253nB\202\267\273!\276\317\177L\374\020\217>Y\345k\253\321\343\225"
+	.string	"\b\033\2309o\254x\231\267\212\221m\241\225\257\271\003\203\2528O\304\b\332,r$7\210J\001\b\204\004!\bR\001\\wI\352u\322bE\370^,\227j\245\232\240r}\024LHV_\t\253\365\245\n\030\245\202\212\365\271PPX\337\351\006\276[\205\361H\007 Pe\266\257\363\327|d\005\b4\225\324\304\241\244\017\337\001jIO\303y\235z\312`\206;\265\220\324\017KZ\371Z\276<\247JR'\315%\177X\002* P\202Q\254\314\016uY\204\366dh\215Y\t\220f'\2246@\0228"
+	.ascii	"\002\276\373\335f\356\2550\366\216\270F\276p\364\216\200,~bq"
+	.ascii	"\313I\255\321C\342=+\314\026\033S\216\340\341D0\t\361`2\030\024"
+	.ascii	"\r} Q\177\335\354L<L\024\242s2`\016\341\234\364\265]\303\310"
+	.ascii	"\261\t\240s\013a=\001"
+	.text
+	.section	.gnu.lto_sendSatalliteSignalQualityAsTemperature2.101.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\377\007-+"
+	.string	"jK@\020H\200\334M:\253\350a@\354\364A\312\\\022\2069m\362\310\350\367w\005\247@\343\177\262!\366it\032C\323\300Fg\314\275FR6\0055\373\tK\264\224\371\336\252D/H\244\353\225\002\226\002\344\303\335\032!d\023\271\223\f\356"
+	.string	"\336"
+	.string	"\366"
+	.ascii	"\345\005\230?\362\255\260\216\243\236\336\305\257\3227\3328\271"
+	.ascii	"e\346\177Qq\022\222:\270}`\366\263\365_O\247\342\004\002\275"
+	.ascii	"\312\332Z\273\367>\270e\r\350-\337\353Iw\373\200\314\217\371"
+	.ascii	"S8\302\204\247K\201B/\222\363\230e\304\200\336\326s\261N(\371"
+	.ascii	"\373\326\243D\335\030\003\275H\224x"
+	.string	"\364\262vo\227\203[\026Bo\003|g\336\326\0130o9\212y\315\273\206\334SHJ\374b\273\367\372Z\310\243\236\303\241\247i\313\256Q\374\223\310\330VU\224z\216\354/\342\022\374\270\342q\264dp\006$\315\321l\354(\203\260\314p\\\354\t\224\330\340Q\317\223\310\312\031`I\362\343\252\307\315\262\301\032\331\033\236\"\261\334Y\031\251\032V\233\343\245\256HU\233\247(\243\354\335{\317\365:\2438U\353It\357\345ZU\274:\353\316\314O\230\331\211\371\364\n\346m\267\004\265\035\302\372\366z\357\225\352\316\342\252\365\030f\355\024^a\250j\034f.z\227\030\\j\003Pc\322\3237\276'\254m\374\356\351\273!\2721\033\275\f\n\275\367\376\370Z\276\005\310\327\272e\026H\365UH\346\355{\001\021\243\260\276qM\227\240\335\332\306\3345U;\213\371\345\355 \314\2662\002\036\256\362\001[\331\300\221\347 [\271"
+	.string	"\2562\001[y\300\217g\240\335\303\316?>=\271\312<7\236wle\035\\e]\256r\316V\306\331\312(\256\362\211V6mekV.\315\312}V\256f\345+"
+	.string	"\020\346\354\302\361^\253797i\263\0349\362?\376a\277\361%\363\221|\2621~\3327\336\260\t\241\371\261\230P\232\037\203\035K\324\3038E\245l"
+	.string	"\021\313\234\341\200\336\366\002g\023\350\013C\267\251\372\306\272\253\001\315?f"
+	.string	"\352\001}\242\033\226\"P\377\370\036P_ \272\345\334\254<\0076\007\355V\371k\200\301I;\373_g\237lH\2345\244\331Y\f\243\r\253\366\364\265\332\214\245O\303h\303\352\236\336\351\031\314\035L\263Sx\251m\370\232\016\350\275T?~\232\253\371\020B\204\b\363\326l\036\021#"
+	.string	"\343\256\332\021$\352\253\270G\325R|\256\347R(;M$,\255\217N\373t\0053\346=\341\317~\256_G\332$i\346\266u\232\353\260\315\230\325\271\314,CF\255\f\231\240\264&\007\037\223\006fL\032\220\327\022z\013\2246I\332f\346\250\036U\327-Z\330b\333b\033\";+\361$\227\225]\267\350\003\304m\330\205\r\004z[\333vUCt\323I\233\274\344\231e\177\215\227\032z\236\331]\366\211;\246\376\345fP|-6q\342DG,\220\216J\247\245\244\346\243\241\246\243`\221\222\317\305\222\222\322\222QPP\251\250_(\005\273\350\301\363\004`\205\t*(\374 \f\365"
+	.ascii	"\203HII\300`Q\023\216\215\206\236Z41\255\360=1\005\201J\300$"
+	.ascii	"`\320\347\002\251H\311g\304\324\344\033\342\361\322\013 \223"
+	.ascii	"/\270\264\304\344\323u\t_\336\017b\222\302\236b\376\361\353\003"
+	.ascii	"2\211\034\273N\372%)\314u\026W\364b\317\r\2313vr\372{\357\002"
+	.ascii	"\236\236\201\200\327\br\360\0164\357l\256\353\003\006\232\217"
+	.ascii	"\fj\003A}\344{\302 \262T\327\037\323\365\207a\276\354xz\327W"
+	.ascii	"S\342:\253\202)A\222\206v\020N\025\374t-\342e\246\223z\371\351"
+	.string	"\207\245\257\341\343\311\275\\\336+T\220\353\237\376\234\241\022\\\347\272t3\\C\2016\256?\304\332i\264\313\257\213\3754\3222\264[\271\310\260Jr\356j\001\002] \307\025\017P\350\020\r\200\244\250Q4\306\030R\f\311\210\210H\222$\351p\002\231\241*\363\021p\261\203hf$I\262_k\023\321Tf\253\261mA\300\334\t\305u\311a6\253\222\262\253\312f\227\001\250\216\230\346\\\r\272 ^\022z\224b\316\314\020C\301\022\004\021\260*\225\030wPA\035\354\205\263!\347\244\020H\306\237\256\027;]6D\362\342\352\0336=\302\323q\323\2779\373_\251\343\004\263?}\207\226\271\341\217\304\330\n\325\026V2W\357\216\260s\214MW\233\203\347\270w\016\304\n\227\030\210\033\241\306v~\2543\240\003:\303\233\020\2653Sn\325\250\331\313\202:\016*A\242\206$\002\360Xa\037'\373#%X_\016\343g"
+	.ascii	"w\355[.\316\004\035\310\301\353!\364 \2671\307X\230\355\212\205"
+	.ascii	"tn\334\226E\203\022+\255\t\2331\334\253\255=O\031f\352vb\352"
+	.ascii	"\222G\301<8;\305\"\216\323\315YA\315!n\357\345|\017$)\306\021"
+	.ascii	"o\364M\0269\\2\003!4B\205\345T\202\264!\310W%#\276\022\f(\354"
+	.ascii	"\360Z\211\233\202?H\375\355\302\226\374M(L\3708\354\035\271?"
+	.ascii	"\370_\017\312\250\024\341[[\332\211\030\300\322\317\232\t\277"
+	.ascii	"\273\3132,\233\022\376"
+	.text
+	.section	.gnu.lto_sendSpeed.102.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`$\004\325\031"
+	.string	"\346m\236H\260VU:\325 \336\372\230\022\262]~9\214\0310\261\227W4\006\355?\335\3559\367\n/\330\351\343\021b\033\257\335\033\377\344\213OO\232\267\377\016\357\316\351\272?\342\023k\307\037l\276\235\243\367\240\314?\202\310\336[\246\024\206"
+	.string	"\200"
+	.string	"\213"
+	.string	"8\300\225S\225\220\325\334\373\370\273\317\230\235\206l\2028s\303\303\244\326\252:uK<-}@x\272G\205\247\276\214\331x\252:\262\262\337\343\005,\263\307\240\245`J\3656\324\243S\353n\345\324\t\304\323\035]\263\227|\307\242\216p\2009\236\223Z+K\342\274\366)\267\346\303|\336\367\315\t\"\243;q9\021\330\250"
+	.ascii	"\006\320\335f*\210P\356;\337\021\272\230\335Q\253\326\352\225"
+	.ascii	"\321\315\334\364\266%\330\216`\317\022\0019~y\355e^\341\351%"
+	.ascii	"\201\0264\266\r\372;'\345h\362\253Kd\357n+o\354\317*m\354\271"
+	.ascii	"F\215\326\247\2716\321ui\256\307\271&\315u\312\\\213\341z4Z\207"
+	.ascii	"sM\347z\316\265\f\327K\327/p\242!\002\001H\255&\202P\252"
+	.string	"\020\335\341\302\366{\276/\250\002/e+\325\230\034P\347<\277\206G\327\036\203&V\235\021\320M\017\223\331y\374\237\n?\343\251\355\332i\310\304\252C\314\005A*MkC\007\024\243\211\270\363.\240\206TT\343$_\224\337\177\376\022>`\221\272D\016\345}\356\226m\211Le(U\271\242\220D\315\224T\322!8\030\002h\244\234r\016\341^\254\224\362\271\"\2331\334G\006\261\326\312\300\347\361\036-~\316\251]\\.I I\317i\006\300\232n\037\241\335\301\303^\306\251\030\t\343\315\021\374\223\025\301 i\225\260$\277s\361\347\223$f\237x\257\022^\226\2447Gs\333\240\375\033\307A\363\003-7\213\313\001\213\206\006\f\024\254L\261\333e%\363 \002\266\201%\203\305\\/\256\017\256\030\013D\207\226\027\226\013L\004k\245\342W\b\027\214\025{\275`\254qg\373\254\322\306-\233\274\331\357\001\245\020\262M"
+	.string	"\273rZ\370\336(\375\336\005\033\034z\276\240\363p0\260H\200\212\234$G\031\016\301\355\270\031I\221$I\207p0n?.\312\0249\225\214\244\370#2\222\007Z\2440p\342W}\237\177\347\024f\204l\250\223D\241\260\220\022Cy\222\017pE\243\364y\027\266\346\001W\250\2218\346\224Q\344&\030e\265I\033p\002\231!;\017\021\260%s\246L\223\354\354wu\244c\346\"'\202]\325\351*\267\364\377I\235\330nc\210\376Y\345\"\226,m^Q\212\017=;\017K\266\n\260\234\r\207\204[\212\310(d?\233\271\243\301\202\036\203\354\265\315\316%\f\004$/-\262\354\342r{)M\313!\272w#I\371\264\227\004\313"
+	.ascii	" \334\367\216\025\201\225\366__\241\2545F\261G\007Q\240\312Q"
+	.ascii	"YA\360(\324\300gxo80\347W\031\301\303\266%\372T\007\235\017E"
+	.ascii	"\273\325\001\253\202\235\202\003H~\272\301\177\303\264\320E\372"
+	.ascii	"\247\326\201<h\210h\265M7}\353\017"
+	.text
+	.section	.gnu.lto_sendTime.103.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\257\003%\030"
+	.string	"\006+\226I\300\026U:U\n\350&\307\337\323e%\n\367\367\277\200\003\375\006\021x\217\324\374\026ei\001\302q;"
+	.string	"q\362\357\331\320K\245X\327\243\325\006A oS\030\210\304{\013\356\372?\252\257\224J?\005\252#J\b\331D\356\224\002\177"
+	.string	"{"
+	.string	"\177"
+	.string	"\324\025\310S\225\351\367\300F\247\247#/\366sxA\nv\0341\262\346\214<\034\035\n\344\351\274\215\357x\324\"\343:\277!\373n\0049;A\362|R,\221@\236\232N@<\r/@<m\301\361\262 %\273.f\232\251TZ\022\0259\265\356XN\335B\236Zf+\371\256E\035]\340l=Mj\255\250eq\331\247\314\377\316\001\334r\263\317\021\246\326\352y\313\331\334{\333\tl[\260CT0\202\352\024\262w\264\2718\366\303\272+l:]\032\247It:\345\273[$N\217\343\264H\247)\235\016\305\351\025\247\2478\375\001+\301\"\023x\265\342\242<\251@4\370\342\273\337\376\317\007\366\300"
+	.ascii	"\304T\252T\022%p9\357\371<<\262\fv\036\377\007\303oF\255utj["
+	.ascii	"\366\035!\310\n$m.p,\247'\"/t\336\307\327q\036\354;BT mptKj\255"
+	.ascii	"\247\007#\033\226\373\275\230^.\310\217\211\357\275tS\016\361"
+	.ascii	"\270\350\007\312\317o\342\307\211\221:\205,\356}n\030\272\342"
+	.ascii	"\236\310p\351\276\366d7\334\365\331\206\312\031\305+:\322,p\007"
+	.ascii	"\021m\025\207\371\233M$j\004U\036\0211\262v\335\037\334\374\307"
+	.ascii	"\347\356\206LjA\b\037!\212vn\3303\2031D\373\335M\345\024\362"
+	.ascii	"\210\3443\342W\264gR\243A\233Q,\232\366\2125\177\373~\270\241"
+	.ascii	"\355\3143\0301\177\335\245\201\206%\243r\215N\251\034\24444`"
+	.ascii	"\240\300%\200K\365\002A"
+	.string	"3\263\032-\343\002\353\340jm@\301Z/\325J\345A\365B\321\314\304\254P2-\027\312\005\201Y5\252\026\352\305b\265P\243]\371\260\356\n_\370\001T.\315\376\317\007\004*\207\374\277\224\365\177\343\246\344|\324\374\200=\316Ss`\"\361\3350\242\035w}\265 \rh`E\307\347\337\371\005\035PYZ\322\226\366\266\241\262\207\302\227\241wS)\344\342\2226Bm(J\250\201$\307\230B\244\320P$a(M\013\007\200\002\021\262\273\r\021P\265\224*\324\202\244\262\354wC\246r5\370\033\205C\305\241\273,\017\204\247M\375\213\374\001\313\360\320\300\323X\355f\240t\t\217ww\242\025\362\330\177\212\347,\300\017rq#\255\256\347\352\317\334\006\021\334\250\254\237\005\"18\310Aa\244j\b O\300\"\336\032\312\"\265q\326]\274\260'\005\022\231\252\231O\215\350\356\322\253\361\210P\357\302J\325(N\022"
+	.string	"\264\222d\360\243"
+	.ascii	"\302\276Q\"\252'\f\037\b!\274!\262\374\033\262 :AL\213\357\375"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_GPStoDDDMM_MMMM.104.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\n\004-\032"
+	.string	"\326q\250G\260\326M:\016\256\217f\253\335B\361\236\313\311H\206C\333\022\247\020O\002\247}\217N\255\341\364\370s\303\007\345\371\230\013\026\375\355 La\217{'(\371\020\342\037\026w\341\"\3129\001\225Y\3602d\t\331\204H\231R\225"
+	.string	"\205"
+	.string	"\222"
+	.string	"\036|\354\251$\035(\253\006\341?\036\023>\266TR\270\004\"\344Q\365\202\311\356\356\3743\003\357<\361\311\335i(\275\006\022"
+	.string	"\230m\262A\302jwG\300\n\302\177\336\205;J|\236\366e|\206\322\243\222\374\332E\261\303jw\t\230'\374\247s\232\370\317{,\376\263\222\275\344;\026\013\266\200\342p#\312\356\316t\305\225\376y\232J>\b\364r\322-\375\023qoE'\342\352\242k\362tv\367U\317\016:\246L\020hw\235N\272\020w\274m\007\266#\330^\203\311\345"
+	.string	"z\243\327\312E\301e\025\3130\311\253!F6\271\354\035S\252\n\373\336j\n\3735~\001\227\272e9\237\272qNu\337<\352\017"
+	.string	"\246m4]\243i\032M\317h:\246i\0310\035\023\32301\375\022\323.1\335\002\246Yb\032\026\323+1\375\212\351\360K\203^:z\351O\323\236\246U\323\251\351\017\210\221(\262"
+	.ascii	"\312\356\207*S\226\310w\365\342R\377\324Ou\265\377\033\307\361"
+	.ascii	"*\303xpT' \004_v95\201)\313\212\276\024\246\317=\311t\305G~\213"
+	.ascii	"\241\276B\365\204\260\\u\345\356.\251\252\360k\021\324\t6\222"
+	.ascii	"4\245\024\333C\267\252\205\273M?>\217\367\260\340\273\370g\242"
+	.ascii	"\242\274\323?\277(\376\003U\326\"\n\307%\323K=\307sT\006%'j\216"
+	.ascii	">\3015\304O\243\247\237^\365\352i"
+	.string	"n\345\236\220N`\355\035$\246\252>\007\003GSUKs\213\003\025\334\026\216~\3123\002\265wV\274Q\034\375\216\\\f\246\254\342\274rr\243\247\272\016.7\243\241\333\204\2408D\243\240\030jDzt!\303\215f\2136@C`\200\302\201\237\002=17\243\241ZM\003\021h\241\236\r\026n\266\n\263\r\266#\032\021\355\002\355h\206\241\026D4\023\262\335f=2\027\031\321l\263\243\242\"\333\f\266\303\335[M\361\240\004\021\2342\331Fm\t\007\322r\247&5j\243\t\"\241\321\032\375\272r1fTFiT\265rO\327\361\230\316\304rT\006k\304\027\363\003Fc^\324Ea^n\261E]Z\324\313\302\322y,j\007=K(\334\335\037\337\007\020\355\005\311\356\336\005R|L\250A0\005\025T\244\206$\032\005\0051h\306\260\002!\262\325\003\020P\211\2066\313\034C\252\001\214\205CG)\273w"
+	.string	"\276\021\235\227\177\206\207\310\366\332\246~\260\3454\203&\331S\221A\003q7'%a"
+	.ascii	"M\227\311$:0)\201A\212I/q3u\311`P\347\266\241\324qf\357\034\022"
+	.ascii	"\315;\311\303W9M\177\361\216\016\205\2434\350\002E|\240\207k"
+	.ascii	"\365<}\007\224\323fsG\230)\237(+\250f\356\3765\244\302\"\255"
+	.ascii	")\205\371\230\242\310\203\236\376\335\334\370\017\226t=\036c"
+	.ascii	"\251\255S*"
+	.text
+	.section	.gnu.lto_sendLatLong.105.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`-\n\235&"
+	.string	"\272A\b\016F\220\332M:\001\240 \373\361n\373\034\020b_z\251\252\246\355&\022\250\332\033Fc?\272\351\232#\371\b\356\256K\307\226e}\342\222\356Jt^\001"
+	.string	"\340:\341c\272\256p\271b\203\007^I\363\026\021\262\t\221;\245\311"
+	.string	"\277"
+	.string	"\321"
+	.ascii	"\027\221\306\224\350|\027_\313\267@\235\313\023\007\362\006\026"
+	.ascii	"\224\263Z+\322E\177 /\016\230\317"
+	.string	"\002\265s\021\211\214\222},\236\220\004\365+QdM2^\301\312:\253\225\347\201\274H\337\363\316\021\227\322\247\234\312\356U\\\220u\213\364e\001;\253\325\306\321Eo /\332\302#+J\237~\224g]\312\356\274\027'P\253\220,[\265\362\220\234\304\273\001z\221<\017\275h\037\212\255s\321\020\310\213\336\331h\316#R\307\"Z2znj\255\267\035\362\335\251\030\356\334\371\357]\247\352\n\306\251\216\2131\250f\210\343\033\026\231\0051\023\340J*\374\3611\206\343\275O\253\253\2519\307\f\265V\317\252\253\033\367x\333(l\203\260k \002>\031\0229\322\210\377\202^\374\336jG9\323\314\263dv)\021Sg\034\233'5\027\313~XW\210M\247\037\030\215\323\016\350t\203\377\356\":\315\200h\234\036\242\323\013.v\333\350\264\002\241q:\210N'x\331\rD\247\177|\306i\004t\372\300\203w\317y?"
+	.ascii	":]\243\323:t\232\034\247\307q\232\322i\221N\207\343\364\216\323"
+	.ascii	"\223N\237\002\317\231\231\206\264Zk\244\311\251@\221\013\311"
+	.ascii	"\177\277"
+	.string	"\330_\366\007\377*A\177\214\230%4e>\220l\351\214\230?\026\266\304\346\347\203}-\255\351\362\277p-\245\261\225\003\352\324\f\255$\367\371[\336\361\016\352V|\255\2456;\273sy\222QD\353(\"W\227\227,`y\364(\252\263~\327\275RDQ\275\353\002~\2243\316\027.\247x\362\251\356%\f\027k\232'\365y\244\312\207\331:G\303\355\241265\341\204;\327X\355\310\"\202\0224{\002,\177|\366\307g\037D\260>?\363]\004\007\326\017\366\354\201\236}\360\266\262g\214\230\335\233\201\330'@N\304T?\314\337{\207&\300R\201\320*\310!\024\264B\344\334\240\275@\205&5\323\274s#\301\372e!\2006\301~n\271\002\332\227\335V\002\355\005\031h54\340kZ\346\234\354\247\241\345Mp\037\346\316PZ\304{Od\255\225\302\334\2402YM\004L\236\333\213\332M\270\251\205a\036&"
+	.ascii	"\346\255\274g\242\352k\243P1_e[\214\205\341Lw:\316\211i\205\211"
+	.ascii	"\232\223p\026\222FT\240 !\002\201\021\272\\\256Il\302\261ha+"
+	.ascii	"\241c\"\335\024!\nE\013\035\211[\224\316\t\247\002\227\002\347"
+	.ascii	"t[a\202I\305\255I\327\342\026!\3109\0268\335\315)\227\323\335"
+	.ascii	"vx\345\303*\272g\240\007Z\350_\255\203\032`\271Rv\021\326\n\004"
+	.ascii	"\303\253\374gS"
+	.string	"f\232}_\0272\337\343\374\276\332\372>/'|[Z'\272Pq\205x\256\265\316\203\315t\327\355Eu\326\252\315I4\222lhL\fL\030\260d@\264\f\210\366bCK4\356\320\202\365\305l\273\300\266\027\273\255\264\215\205\215{0c\330\017\330\317\353\013X>0\332\007F\373\237\2035\242\353\240\301\372\277\020E\333\240h\377\273\255,\002\373\242{/\372U\340\213\210\026\006\200\274\250aXb\025\232!\021\005IAA\222\341\020\003\021\241m\036\022\300\002:\230$)$\022\b\232\223\224_\326\001\300\247\256C\241\311\034\3132\254\036\247\266\361\226@(U\215*'\372k\265\244\325\020z*\371\336*\024&\374\024\25135g\004\334\031%@\026\350\376\032\325\207\271\004\314\330\021s$\032\360`?\t\307\320\0378\277d\n!\216\373@\230\251\240\002\017\336\346\200\310N\364\330\017\263\310{\300\022\213!\"\322\202\032\246"
+	.string	"\202\320\263y,\341\200z\225\256\372-`\002K\314V|\206\2517\252{\213\271\031\334\277\020\311T\321PIj\023%\305\255\234\304$\031\021\004\320\031%C\bq\334/\300\377}\227\213\300\214\0351G\022\300w I\320,\336\261@\257S!\274\247b\272\223B\203\227\001\264\037\240\006jK\315\3028\007\203\254\373\346\312\301"
+	.string	"R\372\021\233\376p\367\230\211"
+	.string	"\361\272v}\273\t\323\216<\276\220]w\233\354d:e\340\254R\004L\235\321 \004\316\321G\023\267\264\204-\f\246\020"
+	.ascii	"a;\033<\032\230f?n\230\\\200\374\372\276\263*_\005\277\344\270"
+	.ascii	"\254GuX\222\024\222\203\224\356O\001\364W(\2651\0323E9\324"
+	.text
+	.section	.gnu.lto_sendFakeLatLong.107.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`g\001\005\016"
+	.string	"\266\232^D"
+	.string	"\223\232\016\274JO\013R\332\024\034`y\236\020\301\215>\031]e\371\t\250\217U\265\305i\240\231E\2142"
+	.string	"\321,iY0\276\316\004$\252\252\347\320\367\037\345\332\303\367t\226\331\37762@\"\264\211\224)\005K"
+	.string	"C"
+	.string	"L"
+	.string	"\035\222\020\f\356\3423\242\233\\D\272\001\333\311\020\221b\367\003\311\243K\256G\203?P=^/P=Zd\3538(\263\226\211\016\034lx\354.\246%.z\212\374\177\007\361`^\236V\204\335uz0 n\275\355\021\333\022\354\347\004y\357\321g\251\036\257&9L\243\f\035\302\"O+nl\366\260AR*\t\373\324\356\2565\306\246\322\227\246-MW\231\216T\232\322\264j:3\375"
+	.string	"!&\033\024\302]\017\241\217\275\2114P\334\364\333\377\347/\316\323\314eb\351U\251\025\265R\0046*\217\001#\346\251\005\245\266K\376\255"
+	.string	"ppo\207*\245\317)\325\230\361\032\231\335\265\202nw4\222\252\372\222\nR\206\276\246Z?J8\366\3475\333\265\333\241\370/N\263\301?\361h\020K>\321\036\234\2444@Y\340!\220\302m[\026\235yZV@\234\005\254\205\013i\037\r\203\026\3022\250T\370`\031\007\302<\t\274i\3208,\264m\034\326\001G\247Vc<\341\273\031)\311.\324\356\b\b84\031Z@\036\374\227\031\300\341\331\332\205\274g\221N\003\033"
+	.string	"!3\341L\323Mm\b]\373\372\326\324\347e\013\372\300\312"
+	.string	"\342\300u\340A\360\034\300\362\207\274\005{\203`\004\375\f\242Up\247g\224C\217C\265\364\212\230\207k\"\020\316"
+	.ascii	"*[\300e^\264\223\f"
+	.text
+	.section	.gnu.lto_sendGPSLatLong.108.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`n\002\225\023"
+	.string	"\226b}H\320R%\035\250\270\233\270)\244\357\357M}0wO\216\233]\243\214\nu\307\240\r\206\003\327\016\312\223\351\226\230\275\2569\332>@v^\242\235\250rx\301\265\262[\302\223\003z\330\265E\201\205\262\236\362\306f\t\331[\246\024h"
+	.string	"d"
+	.string	"j"
+	.ascii	"-\357\354\342z\347\333Q\274w\256\237x\357L\263\261~S\252\"\035"
+	.ascii	"\226\206P\374\250\265~3\351\264{\035\235K\363_>\300\f\247\221"
+	.ascii	"\004\272\327\301L\325\030I\f\247T\345H\003\220\022R\210\256L"
+	.ascii	"Q\r\215\220\342N\312\222\365\242G\tY\243(D\036\306\227_\013\244"
+	.ascii	"\270+\202\240\326\352\035\311\013\267\310mG\260\235\300^\021"
+	.ascii	"\001\336\351\331\217\357\374\036\357\335'\354\312hq4`\\-\004"
+	.ascii	"^\032\3123%VZA\2333LjqQUu\203\3307\240\235H\366i\255\265z\036"
+	.ascii	"\331s\375\242kJ\327s\256w\256o\222RdcAT\255D9!\225\252\203\361"
+	.ascii	"\341\266\357\256\375\227\036a\301\2029\211\227\240\335\366\263"
+	.ascii	"\"\232T\361\211\tD\255E\001\224\307\234\266]^\202\257\231\205"
+	.ascii	"\032u\004Yv\027\240\212\r\341-nbJ\265V\231\025g\201\3433\275"
+	.ascii	"sN\030z\357\346TY\262\355\270\212?\245Xi\221\340rH-e\030A'\322"
+	.ascii	"u\274\235\313\241\351J\334\255"
+	.string	"\024\025v\306|\243\204\210B\314\230\367\232/\357\252j\302!\356\226\3671\357\3635\275CF\265\315\331o\372\t\035\237)\216\001\r\304\330\024\220\031\360\002\300f\026\206\262\316\262\027\037\234\235\331\203\317g\306\003\346\200\022@\236o\302MM\316'\233\355|/1\207\024\300\331\307\023\206\263o\344VO\353<2\rI\0254k\376\241\265n8p\333\237ebs\036lm\0054\265!O\302\335p\352N\366\267\227\f`V\243\335\300\301~\364\2128\201L\202\363A\005\324\034JF\2147 \220\002\2312\353\006!J8\232\026\303F\252\265\\\277\275\251V\223\2538V\330vV\t\332rz)\266\273,Fr\030\302qX\222\031\noA#Q\252\037\345\277d\263)W>\3155\337d]!\036\266\261\264\001\2760\335I\356\330\330Ct\325-\260\025\341\002[\245\3006\346\026\340\343\212\303\214'\244hk\326|[\204\200\332"
+	.string	"\326U"
+	.ascii	"\034\231\212!\230\013f\242\340\366\230\001"
+	.text
+	.section	.gnu.lto_sendVario.109.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\262\001\255\020"
+	.string	"\266\237nF"
+	.string	"\261&\035\375\311\223\235\351\030\372\254\346\300\273i\361<,\375\341\264i\247\236\241\357\235\214\314 x7\210\264\022\032\005\267\271\267\313\336\025\366*yZz\335\322\355\315\374\311\332\3360\353d\376\233\320o\233\220M\266L)V"
+	.string	"Y"
+	.string	"["
+	.string	"\273\242K\227\346\245\307\tl\227\372\001\333\245_\303\352.E2F\366i\214\200\304\372\314I\310\345\261`\f\232\227\335\030\310\245\017\314\313wn\3314\036\023\261\234\013\317+\254\261\273^\f\361\326\265\345?\346 X\212\353\312\225v\327\nKQ\271\343m\033\260\335\300V\007\001\326\324\240\207\367\224jNSoR\255\232\372"
+	.string	">J\274\220\240\263\353a\206c{\344\212\021\017\177\373~\315C?\307\235[\2379\231\373\302\351\264\320\374\260.\343\343D\230qbw\273K\333\255\333\254\346\252\230/\027\036\220K\221\213\221\246\277\361cG\301\272\315\352\301Ti\221\371\331\263\307-Z_ @\235YS\244\350l8\231(\017\037`\245C\346\363\234w\354\344\360Y\234\277\303\216\r\030\032\177s\227>\275\341G\215\242\227\354\323\231;\265KNz\330#\204\0250\272\374\00135\344f\261\331\032Rz\230C\034\242\313\332\202\204\317\352\r;\006jl\261\257mdq#7\311\264\2004AA\202\220\221"
+	.string	"\325M2Z\225\244P\024\274\025Je:\231.\230T\036\006\013#'\217\004\225\362F\005l\222\301\204\362T&&(\257\213}\3276\262X\304D\317\027A\3737\177\314E`z>\320\214\240\370\227\354\373\020\037>\304\305\031?5r\221\001\212\fT\331\242\037VH\351a\272\362$ P\202A\314\314\016uY\204\366dh\215\231"
+	.ascii	"\354\325\260\325\027\246xm\231\345O\215=\340\263}\021FD\007\007"
+	.ascii	"\032\230\204\354\200\fCjX\277\255M\223/\023\205)\006\301\225"
+	.ascii	"a\022\217\362\367\315\316\304\367P\330\316\324\200l\203s\322"
+	.ascii	"\337v\215F\036M\300\234[\b\353\t"
+	.text
+	.section	.gnu.lto_sendVoltage.110.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\252\004\255\036"
+	.string	"\3068\303H\240V\322p'\205\363\255O\303\317\n\256\350\324\215 \322\223t\364+\345"
+	.string	"\022\016\343\001\316 \013\234k.\311\317\330\363@\\V\370\247pc\376\013\237\302'\360-x\251\270\365\343\023\226\r[\036\032bUb\233\354&R\246\024\260"
+	.string	"\241"
+	.string	"\252"
+	.ascii	"\266\223\266\217uU\024\305E\340d\017\021\240R\217e\364\253\242"
+	.ascii	"\007f\023\024\261\353<\317\236\223\276\360\034F\266\223=J\200"
+	.ascii	"\354\343\360\201\037\243[%\231\247\324\314\nJF\005\363\344?u"
+	.ascii	"\032\257\262m@T\215\333\360\235\352\b\267t;\227\242\232H=0O\342"
+	.ascii	"d0.\3433|/\"\231g\226)\304r\322\345\300<y\273LyR\017S\236\034"
+	.ascii	"`\003\350\300\217\357\304$\234\322\355\004r\201I\235g\221\300"
+	.ascii	"I\0270O\332g7y1\3059\213\342\022V}\235\347\231[\024\367]}\376"
+	.ascii	"\253N\0332)]g\f\316\363\264\016"
+	.string	"\231\232\356\275\355\035\333\030l\362&\303\231%:\001\\%\317x\025\231!\262%3\225\005\346u\252\024\273\b\324\205\262/;\367\311.\325;:5uN\251\306\335x\343\334\330\274x\327\234\352\2469\361\2361\3251\245\032\246T\277\230j\027S}\253\251[L5\213\251^\241\251UL\265\315T\327L5\215\2466K\365\254T\22745IS\313h\352\245\251\325T_\300\217Y_O.,9O\021S\302\316#\244\026\213\033\177\342_\374\251>S\322\276\237\343F\177\207m\266J\302)\025O\021\n\242\272\210_F\277\341\353 _<\231 \236\347\031\024\364C\343\226V\311*\204\307\r\313\336\264\034\251\\Y\226\275\320IeWL\232UY\231Xp\f8ec[\233=\023!\t\363<emm\373`\030\315\326V&&\034\203Q\263/\312\316S\322\266f\317$\030\006|\217\037\221\374\025\016aA?\264P\236\244m"
+	.string	"\025NBZl\321\354\251\314%\227f\325\030\2141[s\257\367\261,w\266\017\272(\267\346(\333]r\03741\263\262\235U\031\311yJ\335\335\362\030t\001\324)\376\352j\022\341\330O\247\370\246\266.H?\374&\311\360\310\002\363\332\023\217\373\251\024\257\250\275\201\203>\272\367\276\333\240\353\t\361\"\3302\350xBG:\0203\377\354\022\374d@"
+	.string	"d\300\307\245\367\241\210\327@Hh\027Ds\220\317Q\007\242!\r\271\243\241\336\316\303Nh\327\313}\340\240\363\220\013\032\"\312\371"
+	.string	"0\017\304n(\327\343\361\206r\266\342\357\373\344\tC\216\374\026\350\230\335\372\320\013fc\312}Y\230}P\313e_V\215\302\261 G*o\353b\344\2661*\234|l\235\306\277\352\344q\304W\327oGgwJ\350\354\2159\253s o\331\234]\020\034\2635\341\3267B\300Y\034\026\023\316\336x\034\316.\250\215\355x\355Jl\353:nF\371Q\004\203\322\262\307\272\031\374Zj\264b\264\264%\004`\250A4F\021B\202B%#\222\024$Ic\220\002!\262\352\006\020P\t7\031\326\317\001-\033*\224\033\345\004t\214\025\322VW\240Du\250'\304\305\202\214\234j\347K\035\006\262yU\004\320\253\273\244\224\304\251\364\327\361\372\200\206\252\234(;o\036\203R\032\302\270*\333"
+	.string	"\333\301\026\3755b\013s\323\036\353\3220\221\20781AjxE-\317\233\245\365(j\343\001\023\374\212\301\017\2603!\330\355\302\227 P\244}6\263\262\020b\002\302?}\201q\234j&\255\371\233\005q\004\372\b\0360\265\317\213"
+	.ascii	"0\365\203\213B\360\\\2470\300\231\035vypm\204\236X\302<]b\240"
+	.ascii	"\377:Z\200\347\003\236.\272\240\002"
+	.text
+	.section	.gnu.lto_sendVoltageAmp.111.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\203\007U("
+	.string	"\232E\f\017G\200\234Q:\033\244\\B\205F\031\f6;z\\e\302^?;\270{Sx.\b\225\263\2674\236\225V;4\343#\354\242g\303\320\202\226\342\2351\335\347\264[\262\323\243\241M\036i~\373\177\225?#\371d\023)\223\f\337"
+	.string	"\315"
+	.string	"\334"
+	.ascii	"\373,K[\340\357\310=\226v\n\213J\323\224\366Zu\245F.\210Ly``"
+	.ascii	"\243\224j\360\372 \314Q\345W\375~\245\206\007\264\307S\372\340"
+	.ascii	"u;\240\257{\252\037\355\365\301\231\243\335[Y\t\024~\257\242"
+	.ascii	"\224[B\246;00\021\223\252\263\001}\355O-m\201\233\243K\235\n"
+	.ascii	"\360G\033h\252D\233\260\244\304\322\024\331\340u\035\240\257"
+	.ascii	"\267\343\316W\276\200\363u\201\273o\216T\222\316\240\214MUu\322"
+	.ascii	"4\325u\222\003?;\253\331\f\334O=h\216\260L\262\270\364\231\327"
+	.ascii	"{\210\305 ?}\212N\257&\003\261-:\266\342\320\304\355pB<\326\r"
+	.ascii	"6\237\345\001\302\250\312$\213A\336\346\204\033u\210\330"
+	.string	"\212Lf\315N\223\231O\235q\024\205\3143\ri\232.\023\213=\276\350w7\335\335\025\2733\037\001D\244\363\365M\264\344\030\344\262e0d\270\376\361\271 \223-\215w]\300\340\023q\r<\"\354\245e0c`)\223\355\"\205\334O\2737\323F\262[y\023T^\0043\336\003\225\327\300\225_\243\312\233+\232\361\026\250\274DC\277\372\n\335\352\033\364\343\027\367\344\367Vy\201*\257\255\362\376\240\274\265\031/\r\345\365\251\274=\225\027=yg'\357Yyk\3455+o\317x\371\344\275\203s\216\020\250)\215\006\231\356(\273\223~U\256'W\376V\177\362\277\372\217\357\332{mi'896J\251(\345~+k\257\325No\240\214b\013\306\216V\313\261\026\330\271\262\221\013\336R&\035WPL\240\257\f\206G\273\233\264\021\242M\232\017\267\nO\236C\375dO\017ucu\202\356iS\314\3208kt"
+	.string	"\357~"
+	.string	"\301'\316\372X\257C\272\254\254v\202^n\022b[\032\371\220\314\225\230\332O\273;\317\356Q\255\021\36103g\027-9\022\251-\207\b\365\257j\0135{\341\314\256}\212\031\032\367M\267\331\037F\301uw\r;\326\321\260/\310\2618-\344I\0252\246"
+	.string	"\316\025u\016HQ\201.B\271\013t\206a\036!\227-\255\007Q\357\255H\0045\021k)\006\365\255\236\013\352\f>y\262\334'\211\007\354X\216\316\351\202\034\223\303\375\252\257\206 \367\233\362\020\370!\200/|\275\316\335\022&\370\304\3151\365\322\326\226>\026\215\362x\244\277;\337)\250\3240\261\235\335=q0;4M\231*\354\275\374\213\212}\223\327\345!\361\003<\244\235\357E\022\215\331\214\035\013\032\264\335}_\n\274\013\024VX\250\020\001\002"
+	.ascii	"\036\322\316\367\"i\304\257\307\363\371v)l\253\002\302\317\305"
+	.ascii	"\214\036\013\335\257\347\343\301\340\275\340\371t1Z\354`\350"
+	.ascii	"T\364f\350 \020m\222\f^O\347KJ\352\351h\310\340\315\264\221\224"
+	.ascii	"\330\372\n"
+	.string	"\266p\367VU\377\324K\374\370\nvq\275\266\244\362\025\234\365\323~\351d\nq\200\322j\322\252C}k\034\r\256t\002\365\276\213\304\271\240PB\273\016t$\310d^[\262P\f\325\322p\331\032\250+\236\241\261\376\264\255\253\327\260H\255\177\316\346\267\256qI\035\0210\202\245\373\254/\221cbA\004\007\032\001\0270J\t\035~\314i}\300@\357\225Fm\300\250\257|\316hK\213\326\317\372j\360i\332\232\271\202\363\326>\375\241Q\030\205\3419\226R\300n\035\200\226\250\201$$\025c\250h$(I\222$\035\200\002\221)\253z\022\200EA\315:\207f\244)Ie\2371\213\240\3275t|c\323\346&\026:\266\274\023\273y)\261\004\263\363\2244\032%\024\330\250\322\273\233\307tK\224P3g\265\365&\331,\253\310]Z\320,\312,\364\036\310N\337F\241\006.4\347\317\202\361\235\"\232\250c*\247"
+	.string	"\245\b\335\"\310#\366\330\243\nf~L\255\316\206\344\304\020\\_\240t\345\t\201\024\236\007\371%\276\\`\337\t\033HuF[O\314X\374\261IW\347\300v\020!\017\215 \212\033\270\247\331\227\314\340\343O\230\246U\031\013\017\004\210\0207\245\207\221\220JN=:s\026\320\372\211W6\363\243~\022S_\031$\313\345\351\356\215W\200\025\021\327\270\013\214\002\034"
+	.ascii	"\023\021x\343\265\225\355\006\3143\001V\350wF\225l\250\311\b"
+	.ascii	"YD\222\324\202\342\363\305\001z\351\255\267\334\177Y\231\200"
+	.ascii	"\315j\267\032'\202G\213\310\177\251\\*\366u<6\022:\277\\\353"
+	.ascii	"y\035Z^|S\017c:\344\245\3304\3149\310\2711w\025\374r\376:Q!L"
+	.ascii	"\221\305Q\324\r\243\214Y\275\204\032"
+	.text
+	.section	.gnu.lto_sendAmperage.112.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\321\001=\021"
+	.string	"v\240qG\360\260(\035\351\\|\363\212\257\037?F\350\365W\3453\356q\346_\037\242[\361\272\334\270#b\275v\022\215\364\323\352\261\375\327.\202\264\361\205\203A\262xcb,\037,jw\233\366\360aX\237Bblv\023)S\nZ"
+	.string	"["
+	.string	"^"
+	.string	"\264\332\234stiSw)\340\005>\227z\002\237K?\306\365]\216f\220\354\237p\203\222\353&HD0\021\201K\215FbN\361\343\322\013\272\313\177~\331;\027EL\320K\r\331\3103\347\0047\304_\327\227\177\230\207f(\260+\3104\347\264\316PR\356\275\355\004\266%\330z\n\347\346\262\330\234\332\373x\207\244\272\343\324 \251^N\255\234\372"
+	.string	">:T^l,\rq\236\334x\314\034\331b\304\307\337\276\037\363\321\257\361\347\327<\001q\251\321x\\\247\3714\024r|\227\266_\227i\211Bq~"
+	.string	"\331\261\241}\\\216d\2208\375\214/\036\205\3532\255\t]JK7]\320Ze*\272\002%\205\007\222\316\344\343\003\254x\266\232{*z\350\234\346\035\016\027\342\216\033\273\237\271M\241\366XwWY\310l\241\336\354}u\345\215I\211\230\336\374\251-\222\322\317\276\255\225\330\302l"
+	.string	"F\247\n\356\233\217\335aD?\263\250da\326\030/t\246\366\330bL\267\305\016\247\273\204\202P\262\360\300\001\003\322"
+	.string	"\326\035Bj\211\214\254.\200\255\025\013\225Bi@\261\300\r\031N)0d5\002\222\016X\305\001\265\002Y*\325\n\374\304\360\334\\\026W\300\311\t7f\3733?\314%\216\rO-\364B\353\355e\266\020Dh?^\024nh\337\355v\033\301\304\226\002Z\177\304\240+%\013\363\003' @\002\203T]\017u\262\210\366hh\215\254,"
+	.string	"=\307\024\315\342\003\371[\030\201\267\213,9wR\030\305{Kf\235f"
+	.ascii	"\270q\215\227\266\243{\b\255\2424\n\330\231\002\306a@\214\035"
+	.ascii	"#\377x\263cb\201\222\020gvp\354\302\222\207\330b$?\3757X\313"
+	.ascii	"\376\323.\320\271\205\320\237"
+	.text
+	.section	.gnu.lto_sendFuelLevel.113.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`7\005\245\035"
+	.string	"\3063\263I\240\330M:\301\2073\276C\276O\261\361x\231\262s\376IP?\357\"%#?\300\200\253\337A\352\252P\313\376>\312r\362\331\310\346\243~//p\326K\n\257\036\351\273q\353\"\274\3068_\272\016\243\371\017i\204\020)S\n\234"
+	.string	"\230"
+	.string	"\235"
+	.ascii	":\204\256\344\333\370\215\347pM\t\276\232p$i\302A5\3631\t\361"
+	.ascii	"1\305\260@^\264\215\213\355\312\331\263iR*\311\\\244\201\202"
+	.ascii	"\240\372%\237\306k\b\275\364TX\316\336\215L8y\232\271\350\004"
+	.ascii	"\344\305\330\007\214\027\303\013\030/\3723\204\354\327\305}\031"
+	.ascii	"g3y\271b\272^d\025\335\310\232s\312V\305q\027\303U\234\357\272"
+	.ascii	"!\340\033\272(u\026^\357\350\241\353\246\352\001\2140\025q\352"
+	.ascii	"\035}_z\27306\347|\322\025DO\247\352\272\231sZy=\243{\274\355"
+	.ascii	"\013\266ylQC\336P\323\363\034\333\355\220\025\210\224\253\251"
+	.ascii	"U\354R\247\233\302~8\027\205\255\352\030U\303\374w\277\220j\027"
+	.ascii	"U\303T=\222jQ\325\241\252\327\245\326Q\375\001._\325\013\255"
+	.ascii	"ER\316\020A+\323J\214\202\361\337o\037\350WQ-\211\255X\223RI"
+	.ascii	"\306\234S\346?_\312/\343\200\242\226\004\356O?\261\\9E\314\004"
+	.ascii	"\201\362}\374\007\320\237~\"\220F)\224\260v\310\2131\332\003"
+	.ascii	"\310\3471s\004\202}\036^P\003\364\035A\261\241r\206\260i\201"
+	.ascii	"\245\2245g)s\3219\344\003Qt\032\364u\274\305\251\227\343,.j\024"
+	.ascii	"9\001e\203\3017\311\374\276p\277\364\030\001\265%L\320\363\302"
+	.ascii	"'\2354B\004K\353I\370R\231\037]=h|\031\355\372@\n;zW\363\300"
+	.ascii	"\303 \265lU\275\305\351\312\251NF\001\226ZP>\374\370D\237\272"
+	.ascii	"orZ\305\272\273\357Q\264%@\355\n\026\364<]\034\222n\207\f\003"
+	.ascii	"RE\347\234C\353\331\370\315\300\244d\247Tlc\370\220\0319\347"
+	.ascii	"\216\201\037\344Bp|\027\027M\323\321\363t\306\213\337\003,h\344"
+	.ascii	"4h\003Y/\r\357\251\321"
+	.string	"\001\263\337\276\243\303\263\023\002\3318\254kh\016j44`\240\200\006\200wh|vn\263\232\254\203\255V\263\341\024\270\325fk\034\232\240\r>=9\262\240\236\033\255F\343@\273\311:\360\314j2\234\036\037\031\r\002\333<\320zd7\233\255G\366*s\037a\225[\235}\340\324\rP\261\372A]\204yY\230\227\375\317e_\366\244\270.\373\200hK\247\301\230\365\177\024\024i\007\333\230\265\026\225\320i\360S9A$\321\177RQ\342\036\n\266\342\352\022\277\311\367Xn\351O:\313\025\"XZX\343\302\326J4\345\310\303\035\327f\005\220(j\250a@\306\230B25\023\024\244 \205\315\030\220\002\231!:;\022`EIV1\243R\220\322L\373\031\226\322\277\254*\230i\325I[[\276:\272\\\256]\271\235\335\377\340\226ImWG\231\327\316v\340\304\332P'\364\244\216Q`Om\375 0p\237\247"
+	.ascii	"\270\213\236]X\222\301vc\326l='\247\245\323(Z\030\221;yh\244"
+	.ascii	"\233\304/\315\037j\257\r\244\365\230\027\032\027\304E)\033\304"
+	.ascii	"\177\342\232|\236\332\345\212q+Vg\211\272\322\230\234$\344\305"
+	.ascii	"\336|\311\250\264\216\374\251\311\357\\Q\246r\255j\231e\351\002"
+	.ascii	"N\b\021\271\312?\031\312F\006w I-\317H97'\326\357\307\r\254Y"
+	.ascii	"\270t\3100N\247\207\301\360\3038\035\375\"\240\230|\221\234\004"
+	.ascii	"\316\276\271\b\030m}\261\236Ann\371m\374\324"
+	.text
+	.section	.gnu.lto_sendHeading.114.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\362\002-\024"
+	.string	"\246\243}H\340\320(\035\273\367,\222\200\037D\237qW\352\367\225b; \210\332b+\206j\235\223~ \337\351\253=\204$\343\360\345`\225\350\243\271\r\246\"\306\205\f\363\023.\323I\0215\037\350Q\036A\230-v\355\223\306m\267L)c"
+	.string	"f"
+	.string	"k"
+	.ascii	"\376x\023\266\367\324\034\200369\336\356\272>]\002~\0028\201"
+	.ascii	"\357S/\340\373\364K\330T\237.\031/\373<V"
+	.string	"\020b;\t\026V\313\270\302\341\345tv\307\326\247\021\200\237\252\362\315\266\361\361fO9\030`t\275\335\r\345\207\337\2567\377;G\341dZ\256\247\222\335\265\342dfny\333\007l7\260\245\030\032c\303\321j\222=\272\250\264\261oZYc\233\324)\324T\203&\365\351\272\373\233j\235\352{\234\210\212r2\310\031\343\306,\351X\243\311\"\347\272\337\376\316\037\0222!b\365\212r:\327\371@V\371\2661#8\274\\\317\366\234\377c\022\244\263\273\252O\333\267\367\324X\342\270\032FzE\271\326\247\013\306\313\244\367\t/J\252\231\223\364u\260O\236\344\365\204\314'\257;K\374$\t\214RJ\t\350\251\241\035G\3779\210\303\305\230\003I\345}\356\022Q\223\234z\201\357R\245\353e\204\213.\331>\371\212\032\b\r;v\025\022>nvW\004\305S\240\370 >\235\"\323\343d\337\347%H\r\036Q\227\274\342"
+	.string	"\352\200\273\305g[X\321\343\314\272 [\034\260;$\306 \004\302\002\221\004\257"
+	.ascii	"\264\373\344UKY\231E\bk3ZL\026\233\020\243\205\024P`\262\360"
+	.ascii	"d\266\022\276>\254R!6\013i**\263P5\2127\255\254\361\003\021F"
+	.ascii	"\242t\261\277\013B\332\036O\244y\361\326\375\035\214\345\373"
+	.ascii	"\356\036\036DM\032\022\252}\017Z\2050\260\352p\264\276\317\277"
+	.ascii	"\363y\303\250\307\023S(\231\242A\201\022\005\252\004%I= p\002"
+	.ascii	"!2\273\ru\262\b\265g8YC;O\242\307\2450+\253\031\3568\261a\357"
+	.ascii	"\362(`\377\202\367\300\227c3\275\331F\007q\030\b\231}\224\255"
+	.ascii	"\201K\274\005\204\351\275\030\273ke\355R\324s\245+m\230\376\200"
+	.ascii	"s\345\262\373\326`3\224g\032Z\343\\\330\210\005\264#\320\355"
+	.ascii	"=\226\030Y\215\265V\177\267\354\307\270'\026\017\232\236\225"
+	.ascii	"C\216J\240WW  x\231\035\030[!9\034\347\247\337\r\326\261\377"
+	.ascii	"k\027\344\334B\350O"
+	.text
+	.section	.gnu.lto_initFrSkyTelemetry.115.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"=\b"
+	.string	"\322\31776@o\323\001@\035\220\035\036_B\302\227\023\201\375\315\223"
+	.string	"\026\355\235\322\335\326#[\023\2602$\243C\023\217M\343\231k\030\236\"\360\200U\004~\3063C\204H\231R\2760\236f\303-D\217\353\260\fk\300\272\350\300\240\220\305\213\333D\314\200\265\007\214\213\235\246q\321\n\367\323*(aT\352\350\204S}\220\207\\X&\263b\345E\277\332\232,\017\246n\237\n\321\325\037=\224\360;\254m\224\277U\247\222\004\252t\362\305UN\207\250\354\b/\017^\021>\024\312q\222\204L6[\354\220\223\252a\177Z\005\331\231\316\247\037@\360Q\342\235\354^\274\270l\211\032\361\260}\313\237\215\362\220c/\222aAb\331\335\250\033\377\236\237\377\320\005@\017\347\tp\260\273N\320\203q\353m\027\3306\260\235\022\017"
+	.ascii	"3\241\347\037\030\322\\\005\266\201\024\260\267\020&\300\tAh"
+	.ascii	"u\240VqaD\030,y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_freeFrSkyTelemetryPort.116.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\215\b"
+	.string	"\362\31799@o\323\001"
+	.string	"\253N/\312\321\225\241\335G\212X@&F\342\330C6\276\357\234\201c\t1_rl\343\323#fm\251*\212'\013\200\200\325\021\004\233hn\320\356\277wJ\001\366t\266\005P\226P\267L\263.\213\301\322j\203\002\302U=\031\250v8\306\034\254\254j\030\226\325\315\267\227\245\031\202*\226\221\224\260\177Q\237\344\246\013\373|\350'\347\2042\271\210\216\004\234P\003)*4^\332\017\020\361\236\t&dg?\344\"\"\237\303[(\336\373\364C\364\363Rs1\212+\013\204\036*\227\2150\366\327E\211a?\263\262d?\372\364!\230j\211@\331\255X\305,8O:l\337>\bgo\314\331+\3774\366%\033\024\246\324\356V\231q\356\221\363\377q\215G\352\036\001\016v\327\321#Y\334\362\266\013l\033\330~\t\017"
+	.string	"3\001\223~\306\251\271"
+	.ascii	"\266y!/\f\366\205t\300\022S\361\320\312\006se\241k\270\301\020"
+	.ascii	"\036\270t\213v>\001"
+	.text
+	.section	.gnu.lto_configureFrSkyTelemetryPort.117.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`w\001m\017"
+	.string	"F\035iF\320\224M:V\r\217t\355\031\242"
+	.string	"\340Q\035\315\210&V\r\354\271\366Pju\004a`y\324.\b`\267\2155\357\255V\207\246G\005\323\341Z\0026\274\305\322\025\234\305\"R\036`\217\207\375\233\025 \333{K\231RV"
+	.string	"M"
+	.string	"T"
+	.string	"IFv\007\264\245\260\375\222]v\220\317t\366@,ld\024\355.\247'\356:|\232.\177@Gs\b\342\357-\340\341P+\351b\257\364C\244\242\324\325\244\276\0047?8J:\330+\360\203\307\304{\236\035\272\232L"
+	.ascii	"*\273\353\224u\037\356x\333\017l#\260\017$=\222"
+	.string	"G\214\332M=\023\257\025h\267X\026\261\357\342>3\376\216S2y\331\241/\023\017\257$\267\233W&\371=o!\"a4\264yd\317`\2519\366\337\356\256\025\307\216\351\b\323\360\245\237\2465\323\371\364In4+\032\242\001h\327C\373\226\350C\210\357\021\"T[\302\204\274,\352[\021Jc\233\302g\270\230\b\355n\212?\333`R\240\263\273P\005\250>\275\315\221\327_b\252\252\t\315\007\r\033,\223l\237N{\t\260\033K\361_\034\006\214\277s\350\030\024*\036\246\022h1\002\205O\346@\n6\241\264bV*\013\\K\305:\241N\027N,\016\003\214\013\2123\251V\034\312\211S\031N*\216\225J\251\270\322\354\365\267\212\243\362R\030\324\234\267\242\037t[\213\301\312J<<\021\"\242#D\211\032+\202\336*F\003DB\214\2066\217\034\325\257\375\306\252\001\013\013\222l\350@>\315;\210\266\021\034"
+	.ascii	"2\241\237\037\360\024\203\250\355\216\221\265\263\262\026\217"
+	.ascii	"M\032\3200\200\032\364x6\264@@H\3065s\315\004\333]\3159\241c"
+	.ascii	"h\226^\320g\202W\206\257&\366j\300,\350.\030^\006\033\317\034"
+	.ascii	"\204\366\212\253\251("
+	.text
+	.section	.gnu.lto_hasEnoughTimeLapsedSinceLastTelemetryTransmission.118.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\035\n"
+	.string	"V\224J@ \307*\0358K"
+	.string	"\220`7\260\002w\0048\233\307|\030\304\345\\\221\304\016\202\030_8\202\233\221\371n36\301\344;\247\"#\200D\005(\032P\213\r\244\036\305XtV\"\303\252&\233l\231R7"
+	.string	"7"
+	.string	"5"
+	.string	"\233;t\237\334\033\272O\333\256\350\244\254\272\310\002\373\314\200\213@\203]\321\223+W]U\376m\237"
+	.string	"\036\024x\305VW\004\215\335\265\276b&\267\274m\b\333\033\266\031\0042\333\352\371\332\317I\265J\365\273\207\230\005\"\343.l\274\255\202\211`f\373\366\305\224\235\261#\\2To\363i\017\220z\r\305-\354HJ\311\201]q\302\022\t\237\001-\373vT\247r\312\231\300E\273\344\244\312\223\300\264t\264/\340\003P\376\213K&\375\353\3237u\237\227\232\226\023\226\216\316\240\254:\260\305\225J\025\373\334\356\256e\356|\030\035\217\013\013\n\016\003\351\003\002}8B\321\007\202%\217\202=\234\023\b\t\374\360N`\370\205>\320\027z\242OG\310\363\200$\217\243\361(\344\003\275p4\002\275\214\270\347V\312\246\334\260d\007"
+	.ascii	"\2513\241\214i\367\033f4\306\f\246\205\013\227\221\246k>\001"
+	.text
+	.section	.gnu.lto_checkFrSkyTelemetryState.119.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`L\0035\030"
+	.string	"6+\233I\260\030U:\204\327\333\365A\313\03007\3635\361\001!V@\305\0300}\202$\210\205\033\365\327\310\340i\336\337\353g\0373\364\302le\245\301\266Q\001\361\016\347\257<\207\311\260}x\330\302\243'jd\036\277\021B\210\224I\006\204"
+	.string	"\177"
+	.string	"\202"
+	.ascii	"\373\300\364q\037\304b7\365\361{\037l7\265\260]-Os\324/1\002"
+	.ascii	"*\262Tke5\216\303\216:\231Jr\024\233a\373\330Q\3003\230->!\247"
+	.ascii	"\222\306\206\f\335MI\266\034\216K1\002\222\233\022\325\rH\004"
+	.ascii	"\360C\013\357B_\300\263\351\230\274L\367\361<\233\256\005\213"
+	.ascii	"\253Zk\352F\343\026\t\344\210\202\252\233\013\361A\260\247\373"
+	.ascii	"\220\363\213\333\214\271\244\251\265.\327n2\276\251\357.\220"
+	.ascii	"\335\375\260\333\022\002Yh\ff\367C'\362\332\357X\025.~\315E~"
+	.ascii	"|\233Xp2\036\356\207\334\203\220\311\027.\225\205\273\351\214"
+	.ascii	"{\267\373\036\016\207\303\355\033\273#\257\352\277\257\311\274"
+	.ascii	"\245\310K2\257\310\274\335\274\037pa\211\306\214\036S\332JZc"
+	.ascii	"\f\303T\244\321I\217\377\376\335\357\203\016d\361t\3131\270Z"
+	.string	"\353\213\232\247\367\355\205\032\300\250\331\275\320F\230\201\375\367\263\212\2455\206\2051E\276\245ZS\007\037\003f\227\215\016aiR6\003\035Ff\377\367\225\214\205[\200\311\336\005\021\202_3{E\353\330\356\223\\\211\210\02166\344G\262\031\211\006\217\013\335TEL\220/\\\230(\330\303\221\001x\027\347\344\327\266;\366\225B\024\3641\366\316\310\305F\217\034\311\317\211\234\034\362\243\330*\363((\251\262p\337\313\021]\021{\267\377!\273\317C\361{w\247\305\257u\333\324\240u\354\034\354\345\230t\357\366/\362Mb(;sV\230)Aa\002\004\031\001\247\217\316\315\207\022\247\016\211\033\236\232\016+N\036\003\213#\363B\341BM\260^h\317\271s\352\234=,\236\234\233\035\026\016\352b\311 \330V\212\023e\365\264Z(+\225\312.\326\276\2614\262\236\211\265\326\212\352\235\021\202\002J\367!\213\002\\\361\222\240\350"
+	.ascii	"\253z\017\304\220\341\311\241\370h\330\260\201\374\250\352\023"
+	.ascii	"\360(*Q\222\236>\204\222\355K\027\005K'\016\253Y\307Vu\244\364"
+	.ascii	"Y\212$\306d6j\036uI\002\212\001\205e\3576F\250a\034\006\231B"
+	.ascii	"\214\261I\242\2444M\033\220\002\2411\263\r\020XgE\031\306E\306"
+	.ascii	"?W\222\345\231&\220 w\346\306\233\303\257\372\274M\310_'\022"
+	.ascii	"R\243\366\033\351\237{\212'\303\227q\243\031\374\016\0244\225"
+	.ascii	"~\372\n\216\271\340\302i\213\212\301f\204b\326\251\316\006%\026"
+	.ascii	"\026\f\031\013\331\n\025\277\f\226;\244\317$o\317 \273N\205`"
+	.ascii	"\231T\245\351o4B\251\361\023\343\257\323\020\261\037=\021E0\234"
+	.ascii	"\323\270V=\374\212-\323C1\341\304f\353\300\236\315\272K\r"
+	.text
+	.section	.gnu.lto_handleFrSkyTelemetry.120.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\234\004}\035"
+	.string	"&\364\267G\240\230Nc\200\332\204\027\250\341\220]P\272\235\367?\244\214\356`\321\002\365e\201B\217\007\221\337\274S\177\203\320\254p\032$\002)\003\004+\256O\327\363\264_\006\370\304W\212\217\3472\321&}\036Zf\255I\271\245L)\240"
+	.string	"\226"
+	.string	"\247"
+	.string	"\276\275R\2374\272\335\234\345\330\277\362\253\016\304\350V\276_\247{&\341\224\212\262{\311\004\257V`{\315]\306\276\212\017`_mdS9y\343\n\230bZ\022\"\274\367\352\250\215\033\275\305V\263U\244\323\310w\031\217\336r\244\247\333j:X\237RcUT4\234\202\257\271\270\025\021\224\035\271\0023.\2112+v"
+	.ascii	"o"
+	.string	"\243\322\254/\233\202b\356\336{\033QL\021fL\362\321\3644\251H J\006\332m\374\2119'bK\277z\201\262\351i\316\232\316\275\327\0238:\335.\267\r\303v\006[\214\n\325\347\331\327S\034Y\020i\016\375\253\273l\215Phfwb\261\311\337\2445\354\323\341p84\215\262k\3234\265\351\031;\035c\247_nu\343\354t\255N\333:]\353\264X\247\2518\375\032\334\325\327x\246\"\367\256\030f\271b\025\t\217[\375\366\375\255{\025\235\364\2074\b~\331\357\342\362\345\222\310;>\213\211\254\022\036\310\221\363\371\256\242s\371D\362\216\266)KY\225\360^r\301\253'\330\266\212l-\227 \230\360X\366\315'N\232A0\354\307\253\037\344\204\003Zw\361\242\312\272\255J\022(\2643\236%\034x\224\224w\332\035<\314\003\235K\"R'\007\232\375\203\245T\244W\212\301\344M>\200\330\331\261\257\224\302"
+	.string	")\301d\310nJ*\247\341x!E\314r\237}\241<YaI3\355\277\372S(\261\270he1\024G_\350\225z\374\346\320\376\221#\361\365\354v\3665\206\332Hy\035D\217\362C^\321\304\204g]7\345Ty\351\255\236C\232X\214\233\266\317\210y \216v\200\372\321#\337\2240\312\247\315\030rQ\023\331S\236,)I3\315\376\327\211\020\371:\f\304\233\007>B>??>\030\206\202v\275\236\211\236\027;\330Ep\020\002\302\203\034\034"
+	.string	"D\274 \352\036\234\242\021B=\021\272\242\336\320\016h\367\263\033\322\005\371\354"
+	.string	"\351zzB:\034\033\363H\354z\272!\036\257\247\273\221H\327A\242?\361\336{[(\350\374\350\221\255f\276<\r\365\261\246\320`\005\251b\341\254v\341c%\224\030\027D\266,\255a\003L\367\331\032\355e=\031\253Q\033\262\2562LB\213\024V\252\215\265\224'\213\214\336\306Vj\351\227\202Q*\035 U\241\205\021\241Y\315\364\223\033\314\316P_\013C\006\024\364\310>\224\213\225\320\260a\203}\235\241-\301a\250\2014\206\2342\210\204DD$IA\322\006\240\002\221\031;\017\020`V4*4\006\007J\322_;\351\332Ke\352\303]<\003\327~\026\002h\"\224}/i\022\027\343#\250\354X\350\266G"
+	.string	"\3242\351.;\201\231\004\022\305\360\022;I\266R\372\2764\343z56e\253\313\001\\o\261;[B\307$\320w\021)\255\302G\367u\342\326\254\367a\372\240\246\234\343\245\236\353D]\220\252\2440n\031\222\021\026\204\340\251\367\322\322\257E\326L)\263\207\320^\267d\320>>o[=c=Ow\262\354\rY\335,\025 q\037"
+	.ascii	"'+$4^>\246\225p\017\237v\336\021\221B\303\352\370$<A/\2339\231"
+	.ascii	"\273s\224\222\303P\031\244j"
+	.text
+	.section	.gnu.lto_serializeFrsky.part.0.152.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\021\001-\f"
+	.string	"V\026PB m\225\016\240\256\301\003\300x\313\324\013\206E\327\2430\bD0\225\264A\004\225\217\032\272y\3731V\r*\001o\022';1\006\002\020\260\307\240\375\343Z3\332\222p\006\340\2560\273uS\3336\3312\245:"
+	.string	">"
+	.string	":"
+	.string	"\032kT>\325\3663\330&5ph\237\370ha)\252\t\bZ)vw\373\224\025\036^j\026\372\"\252ty\326UD9\270b\236Q@v\327\225\007\367\274\355\216m\021\373\013\002j\235\352O0Z\211]\006\261\025Ka\206\300\360\361\366G\222\317\362\3056\351\253Q&B\306\247?\206\366\345\323\200G\232\340\344\332\335\215F\305\206\324k0\007'\374jd\271+\341\003\210\3351\267\210\311\245\035\352\364\2423\007d\311>\207\267\n\370\027L\340\323\213\337\344\363\322\002\202Ic>\353W\340a\304k\325\337\360\217W\205\371\253;\304\2440\313L\252\354g+S\366\f\346p\036\034PGg\243]x@\017(\363G\023\001\370<\222M\344\201\\\210\013\300\201\233\200\022Oh\373x\337\246a\270\033\300y\033\330u\336\246\317V\246FP\270L\362$-\372\241\035\324B\342\265\n\263Em\"\033"
+	.ascii	"\217\311\362@\226+\3110\tm\005\357\"\214\f\b\016xL+\027\005\""
+	.ascii	"K\222\261\027\2540\325Ry@\3065<\260\tG\027\037\234\002cW\215"
+	.ascii	"\316\021\332\266\351\262s\001\340\304s\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_checkFrSkyTelemetryState.part.0.191.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`U\001\265\016"
+	.string	"\246\231_G\360\2606\035\313\262\266|x\n\013Y.U\177P\322\313\375:\300\021e\b\352fw<\321\231\025>l8\r\325Xl\366m\346\325\357.\303\241\276-\3409\030P\333\327\356\275\230\215\273\233\265\326\231\0300\r\242M\366N)H"
+	.string	"H"
+	.string	"O"
+	.string	"\332\351K\330N\301\030\264o|\004\261w\021\003C\216kw\267\323\371\341\340\261))\350\207\204*\307\244*\324\360\211\t\220Y\321\022\t[0\222\026\r\207\213\227.!\213\224\001N?Jv\327 \033\356\354\266!\3306\261\037\"\353\201\276\030q\326o\337\267yN\312O\370\203'fw5\326k|\234\324\307\3170#.\241\263.\3727#\031B\366o\254"
+	.string	"\004~\374\f\250\214\373\342\200\007\206\t\327\356\210\340\324$ \247\276M\312}1ek\276\b\332\0015r\210\314\320\241\361\251\342\202\354\241\332\361^8t\354\254|y^\266hdt\346\\\331\250\354S\222\300\261\321\"w\330G\361\024(_\204M\236\274\312\313N?_5\256\016b\314\212\354\221s\345I\217\355\234\2611\351g\003\036\310\330}\351\341\021\006\325\006 \024\006\013\022|"
+	.ascii	"To$2A\251#\t\242R(\002\252\226\b\370\344\363U0u\023\266\257;"
+	.ascii	"UR\035\325\323V\242 \"m'\235i\373\0240g\241v\333\211\343\272"
+	.ascii	"M\263-?g\\\2622Y\260\271\372\227\371,\336\342#q\\vz $ `\002\031"
+	.ascii	"s\353\001\305\374'A 2D\216KD\320\b\217s\300j\322\030\215\234"
+	.ascii	"\031b\354&\204\220\204jl\376=\324\2720&K\362\336\241\260lH\276"
+	.ascii	"=<\363YVg\r0;]\013\306\351\177\307K\275\245\264e\317[c!\254\275"
+	.ascii	"\247\320\264\035\367\2560\006"
+	.text
+	.section	.gnu.lto_handleFrSkyTelemetry.part.0.196.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`$\007\005("
+	.string	"*D\034\017Gp\334Q:5\036,y]g\256\306"
+	.string	"L]N@QLS$b\021\364\3368\020\216\264\346!J.3\352(\033\202\300\207\257\326\330v\320\271K\242Xl\300\321\302\375\253\326*\307\235c\031\365:\032$H#\204\354\235d\324"
+	.string	"\335"
+	.string	"\341"
+	.string	"\177\270r\316+\026\247\276\365\303\240\372b\2756\324\257<u\016\330\346\241\360a\354\372\223\301\035\t\335o\373_\007c\177\345\351\231\230\257C\251\345c-\347\366\301\317\206\220\376\314}\b\375i^"
+	.ascii	"\372\363V\272\033J\330l7\235\267\307L\244\245\243\212L\231s\326"
+	.ascii	"\375\304J\316\036\267\252@\351\r=M|\203\330~\324qd\377\020\213"
+	.ascii	"x\365\325\244@\245\274zRxe\342\370T\275\271\330\017D\021\022"
+	.ascii	"\271\252\331\025\024\321\302\"\0169\020\3627-\315\253+\275u\300"
+	.ascii	"\"\n\371-),\232\271\234s\325Eop\b\344'\3255\205\2069\326!\360"
+	.ascii	"b\323\301\332\027=O\n\207\230CVO\202\027\373\3351\234\2727\300"
+	.ascii	"\203n\035r\316}\251\"o\241w\367\233\356\376u\243a\001A\320\330"
+	.ascii	"\354\344\333\347\342\254\306A\307\313\345\322O\343$\335\270\333"
+	.ascii	"\251z\373\206\273\215\002\335>\325\333\346z\033\253\267"
+	.string	"\257z\373\bn\221\003\232\234\255\226m\331x\202\201\362\260\253i\243#\250N\312E\265G+\243\243\245N\"\242\302r\332\326\274\320t\317\314\305\366H\004\266\017\272\373\327=\242\366H\274\265\255\311\201F\367\363g7\273\337'\3633Kf*\024\273\244\225y\372\230\216\326K\331\200\211\204{\237\266\3642Of\233\207\250\260m\255\215\360\263I\244d\226\272W1jq\214\022L\232_Y\222\276\227\237\365\221\2756T\002\244\232\027W\323\307\372fF#W^\232\372]\036<\351\322\327\362-M\347\202\203\250\001\251\346\245\314Y\370!\375\331mz\001\250\031\321\236\342\311\272\327v\372X\033\025\003g\335\023\216\3541\215AH\r\017\362j\230>\311|\373\234G\214J\264t\253\212\024.*\273)l\227\224\026\363\305u\274%\241'\202\233\373\023\332\315~\261W\356\203'\336`\004\272\331B=\f\001Q\f\261\0032B\315\315\217"
+	.string	"[?\266N\234\325GBM\214\003#p\273K\230\270\017\232\030\225b\304\277\300\246\316\226\211\002\305\3307&\247\373\304\343\240Hs\006Z\350\303\271Z\212~\223\237\255b\305\n\364'\306\027\373\202\260\262$F\276\300T3XG\373\255\330\300zt\335\331\021Y\274\370\023\340v\267pq\037\354\334\024\216\352gI\372I\376\310g\r\211qVw\033@/~1\026\007x\371\364\355\006\320\343\213_U\234\272\313\356\263y\033\244~\223\336\361\356\203<\364\347q\201%E\251\273\354\213]-\013=\243\310\311\307cbBz\241\373\371z?%\336\357G\303\206\r\032&\230\224x>_\323.\b\206\257\327\333\235}\304\313p\004\343\202\005\tE"
+	.string	"p\364\224p\357\212\234j\374|1tN>&^\022\317\006\217I\247D\003)I\267\363\375tE\006\272w\203\347\3231\365z>\335\332\335\367f\356 \205\247\032\337\3149g\334\225z\212\373d\301\224\f\213\362\210\233=s^5t\314\323p\320\300\214+\203#\241\267\013\274\341!\021G\204\312\245\252\273\255\006\305}3\026\t\233E\205\243\272\277\274Y\006\253\204]\302.A\177\242\030\250x\263\253[\272\222eO\361\2041\262\235GY\0216lv\200p\2309cq\370\331\277&v\227\355\340\036\355H\326\311"
+	.string	"\265`\377\214\205\302j\001qT_2?\330n\224\3421\223N\362{\f\372\200\225\250a4\310\020B\312\314\314\210$I\222\016\200\002\221\"\262z\020@\305Hh\2234\006./e`\227!\002+\2445\26688\037\246\306m\2563Sg\003\264\274k\350<){2\024"
+	.ascii	"\220]\374\324\275\341\003`\030\235\247\344$\353-E\313%o2\360"
+	.ascii	"y\3043\254\242M\252x\300\003\364\206\336L\314\300x\313\301\205"
+	.ascii	"$\003i\253 Gl\310\215\005\354t\214\001\037d#\252\231\252\350"
+	.ascii	"\271\356U\255w\232\211\373\253a\205\2705\034\321\004\334\206"
+	.ascii	"gJ\267G\214\005\351\323\267\366\346\304\314\0318E=R~o\r\\\256"
+	.ascii	"7\006\306:\235\324\2077f\372\260\005O<\314\343\260wn.\024QP\003"
+	.ascii	"\262$vp\326F+\b\316x\267\2613\350\272K\276\035\201\001\233\242"
+	.ascii	"\327\345\267aX,Nj?\367\001\035av\016\217o\256<\320\374\255\224"
+	.ascii	"Q=x$F\037\312+\255\027_\002\237S\273\241\360q\2635\r$\360`\215"
+	.ascii	"\032\031\322\345Q\217q\245\231\202K\nn\215\220ai}\253\271\035"
+	.ascii	"kH4\007&H\362\217\243%\250\350\306XbR9]b\335\345\305#\0305\305"
+	.ascii	"\002\246\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\r%"
+	.string	"\246\372\317C`\252M\007f^\027\207\206\3056\335G\"6ZCr\301\0275\266W\366\033\004\030\374\t4m\264\2705\366\212\t\001\275\021\2521\303\227\250L(b\241\273\271\261\340n\264\325\021ck\001\201\177\333\266I\246\024\274"
+	.string	"\267"
+	.string	"\302"
+	.ascii	"*\236\r\245x.\204\202\337\214'\236\t\231xn\273%\236\007]\022"
+	.ascii	"\354f\034\301ln\212\226\211x\026t\025\205\3706\003\301m>\360"
+	.ascii	"\333H\364\360\r\246\3033 \016\317\1776<\373\321\320G2<\367\271"
+	.ascii	"\030\272\310\205&2Z\350\257\n\317t.\205\347\265\t\317|$<\333"
+	.ascii	"\211\320LF\b\317{.\326\263\036\362\3013\236!\303q\360\\\3476"
+	.ascii	"xn\257:ld\320K\254\236\331\026\264\220Q\301s1A\007A\360\034\250"
+	.ascii	"\252\211M\365\254v\375\355\355\355\355\300\363\034\003\337b\327"
+	.ascii	"\231\233\210N\361\232\002\317q\200R\254hdf\022MS\264\013\363"
+	.ascii	"3\2379\322F(\212\242\302\347;\227\231u\211\002c\222\233j\257"
+	.ascii	"\355\036s\373\2236&\371NMr\323\327\226-\257\335\245<\307\361"
+	.ascii	"\334l}-o\307\352\322\021\311\233\355v\233\362V\346\"\271\216"
+	.ascii	"\305\2659\037\336\234\367\312\235\252Sq\354x\344\303{\344\245"
+	.ascii	"\272cG\322\311\264\035EQ\257Kz\216\330\027l\214\2232\341\350"
+	.ascii	"8\"\271v\177\355\031\243\""
+	.string	"\034\275\323f;i_\244\030\215\336+I4\362.n]\317\361\274\b\3077z\3439\221\215gD5\236\017\321xv\233\361\335C\306w\222\030\337J\272\276\221\300\370N_|\033q\361=\204\353\033\254\3057\220\255\357\037Z\337^\215\242(\363/\353\333G\263\340\221\275V\360\331\030]\252\226\232\245>\215?\027\313\"f\355\376\274W\354\376\261\206&\247\352\347;6\327\216?'\357\317\261\250~\336\224\232\352\350\344%\353\344$\221\312\311{\255r\362'\266)\355\265e\332\227\311sk\263\032/\\\306\f0y\035`\362\341e\362\246\026@Z\256\335i\332\326\244L-9\317\254/\226\257(k\305\235\252\342\330\245\251%\037\336%\327\2458\323\233X\300\364\241\351\246\352\343\265\273V\347s\322\347XR\276\256\262\206\316YO\351\266\261\002\245\254T*{\336j\373-\217tG\252C\255\301\322`\273Z\256T\213\315R\177*"
+	.string	"\326d{-/\335\2459\265\364fK\357\224K\347b\263\332\276l|\030\321\022l\262g\320\315U\030\264\n\003k;\nz\217m\245&f\310,\005\235\267\n\203\276K\315\240\353\330f\267+O\362\220A\357\365L*\350\273\365*\252{\204QSD \352\242\261\221\211\261\230('\325f7hl[\002D]62'i\314F9\271\366]33\203\207\303\020\360\255\253\001\336\253\225"
+	.string	"\006\002\274\331\334\351d\312t:\316\254\251\324\374\220U\235\236S\235N\317\265\277\323u*\360t]\333%Y\030\031\324\351\273u\301\351\274\024\351t\036\313;\275L\223N/Y\245\323}jy\272YD#<\275\311w\372SQx\272\331\372R\335\232"
+	.ascii	"\312s8(\357\242\002(\037B\001\201\b\200@\217\021\200\322\250"
+	.ascii	"1\030\220qL$(I\222$\215\001\340\0021\241m\033\021\200\030\313"
+	.ascii	"\031\220\"\221H$\210T\007w\332\354\261+\363!>\357[\024d)fN\206"
+	.ascii	"\217Y&\245M\217"
+	.string	"T)A\035_:\340\217\352\310B/.\316\357\3072\003\351\317\f\351\261{7\364\214au\026N4K\2417\303_\324\032E\277Yc!\204[\237\263\"M\223\301\334~-8\036\351\217\235t.\331\253\271\271\221n\367Q\253;\3669j:-}\\:\265Ur\271\241\322\202E\"\332\362\005&O\350\233\223~\001\340%\334\215\227\302oR|\254\023h\245\025\255\3645\2465\255\024\225\254\316\206ibj\305\263w\324Q\375$\212&e\217\341\377\232D\234\026\314\3668,\001\345\374d\365\270\235\274\260\344\0352,\225\020\262az\206\327\342O\321\251H\350Td\032j\022\235\n\231F}\344\027\321|\243\336{\202\205\247\"\360h\3675\307-\320\213(\b+\317\371r\235\203\363\346 \210\226D\320\340\303\001\347\033\035\001\004^ }^\314s\027N7\272X\237\2637\262&+\t\n\347&\013\241\253\365Pr/\311\241"
+	.ascii	"\313\n\033H\306\362\037\261;\211\321h\356k\300\217A\322\354\250"
+	.ascii	"7\003\267[\230Y\345\331\031\002[\227\001FR\303\216*"
+	.text
+	.section	.gnu.lto_.refs.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\315\006"
+	.string	"\366\2231\033\320VQk"
+	.string	"_<\b'\020\027\305\321\026}\320\367\026B\005\0035B\266\3342\005&"
+	.string	"*"
+	.string	"+"
+	.string	"\320\211\232"
+	.string	"\355\200V\222\221\273\236\020\273\036\0356\342\fq6\352\344~n\307e\256s\257\273\324\346VW\251\224m#\252\306\305b\\\026\270<\270\021\226\237\312\313`\301\215\240!\350\b\305>(7\222\003\314\207}V@\255\330\216\350\006\002X\031\311*\352\241\304\352H\2269\213\270\r\204\275\007sP3\356\213\310ZDW\334\021\313*\332\320l$\273\316\032\303\205\273,\025,\203\315X\204O7\3034B\264\345\036\210l@4\300d\237i%\255x<\220l\345,\301=\221~ v$\n\247\232NXH\262\220\263\001\005"
+	.ascii	"vd\2710\324b\374B\250\226;Z.\013"
+	.text
+	.section	.gnu.lto_.decls.a2091a47be0d4765,"e",@progbits
+	.string	"(\265/\375`\221W\315t\001\352j&\210S Ja:\215\001\300\237u&.\313\227/\027\233\313\347i\037\306\250\343\230\251^\336\326\373\300\277B1\026zFT\337\277'\367\222\300h(\001\223\325\272\357}\337\367\332\217m\373\367\234\bH\222\360\350B\177\252\354C\024D0\330\234\2648t\310\266\267\224R\246x\007z\b\327\b\272J\3377\"~\341\3048Rc\353f\017\026\t\375\257O\377\307\247/\323&\241K\026\tMs\325\330;=\276\031o\322\330\351\026\224\212p"
+	.ascii	"\301bu\363\177q\372\035|\271b\260\225,\375\026Fw\353,\363\242"
+	.ascii	"\271c\332\320\\2\367\214\255k\333R8.@\323\324\263C\351\303\320"
+	.ascii	"\333\236\236\035h.s\315\024])\2211v\363\177Xe~T\372\350\234\033"
+	.ascii	"\346n\261!\231q\363\321\273\013\0065\243\217\272\351\313Y$\364"
+	.ascii	"n\233\204\276\216Mk\246MB\255\225EB\2176\321\327\316]\270\353"
+	.ascii	"\245AHnO\325\216\233o\333u\263\314\177\271oba\224b7\037\025\323"
+	.ascii	"/\366\336\333\376\013\372\373\027\324\322\211\370\305\202\204"
+	.ascii	"fu1w\333\336\273\b\313\201\251\332s\363Q!Z\310\"\241v[$\364\246"
+	.ascii	"\335k\345\252\375\246]\3469\030q!\252\233\226\367\226\262\266"
+	.ascii	"\002\"k+8\277(\221RC\363Q\036\372g\237\266YT\316l\330\2168s\316"
+	.ascii	"nF\364FjF\231\233\247(a/I~\204\271\371g\236\266l6.\025\321\317"
+	.ascii	"\336_}iUWg1j,\257R\352R\021Q\031m*0\033\3134\254={\310EB\242"
+	.ascii	"*\353\007K\r\313\252\306\275\"Q\225\365sugu\343R\331\272\266"
+	.ascii	"\023g}\232\367\311e\341F\271eW\311\035\273N\256\224Kv\241\334"
+	.ascii	"\345Mr\231\334%\226y\233\334 \277B\256\327\225\262.\016[\327"
+	.ascii	"v\002\f\337mr\273\366D\360\270@8LY\221\320%\347*e\\*l%KcQ\243"
+	.ascii	"1w\233\334\034\227\313\326\265\235\220\313s\255\232\334\031\367"
+	.ascii	"\212\303\224\325\226\372:@\223,9d\366\366f\002\355\335\245\331"
+	.ascii	"\232 _1\262\032gf7\377<\323\267\314{\304\310\0278\345\221\233"
+	.ascii	"\257\221\237\203\021\227#\264\367\331\336\233\003>\203\304\311"
+	.ascii	"\332\315\277s\303\376\377\344*N\272\212\334|\277.\230ez\270D"
+	.ascii	"\230Ew\214\217\233\332\315?\235\350[\017(\356\353\263\036\320"
+	.ascii	"\237Gtf\332$\364m\026\t\375\351\003\310\017\264\315\n\0347\314"
+	.ascii	"L\206\267\205\311\315\327\307\355\301\334J(\332\335\02127\377"
+	.ascii	"\244\241\177N\351\347=\235\235\270\201\321\331qu\374Xc6\343\346"
+	.ascii	"\3478\372\231\215\226BEM\337\315w\353j\021]\325!bw\3633\031\375"
+	.ascii	"\314E?\273\351\3473\375\314D?\027\321\377\275\2724\226L\322\342"
+	.ascii	"\334\\W$\324\307\354n\310\315\317@4\005\026\t}\316\322\317S\372"
+	.ascii	"XO/\335\251\037*f\321\317\232:@\332n>\216\243\217\353t\b\213"
+	.ascii	"\204\236\331\327\247\b+\210\216\262\233\371(\021\311\021I3v\363"
+	.ascii	"1\026\375\337\362Y=\226i\367\330\275\313\334{m\357\375\016\360"
+	.ascii	"\330;\")\243M5\325c\031\267\307\346\261w\266\356\310\316S>|x"
+	.ascii	")\333{+}\370p\273\346\330\021C\363\261\022}\234C\037\337\320"
+	.ascii	"\277\325\333\360\2132'\244\310\315\277\275C'\216\215\314\356"
+	.ascii	"\346\333\264+p\226\226M\216\3152N\213\233\337\332\261nl\236\205"
+	.ascii	"c\353X9\366\215\235c\333\330\246ec\343X\246\245c\325\334\256"
+	.ascii	"\261x\317\314\275\251\366\336\267ig\312"
+	.string	",\307\374\"\310\234\231\343b\277pA\323A\032{Gt\356\3555f\271\367\376\210-\366\315\326u\035`J\233\263_\204\245c\301X1\266\256\355\204\036]so\346-\334o\331\262\274)\303\301\bK\307\232\261oDx\357 f\226{3E\334\322\261h\354\035\207\030{{\001\311\300&\207Kko\357\375\341\303\007\245\017w\n\215\2567\020d\313\264I\250\222\026\375KE\333:\333\202en\260v\267t6\356\247\024s3\367\336E6\357\310\224\326\315\277P\264\007\366\266\033P\333\327g7\240\277`\372Z$\364wK\337\366\351%;:\204MB\325l\230L\007m\311\325\315\267t\372\366\212\365\002\304g\212K\327\315\267St\227[&\372u6\t\275\355\241o\245\364[h#\233\204^\005\255d\223P\213\305\266Y\246\004\326\355\034\2148V\246\355\263\275\231EC}\244\364\321s\363O\320\267\022\240\266\317J\200\276"
+	.string	"\332\310\256\375\326\314\236Y5lU\303k\267\355\315<:\325\310L\221\272\331R\261h\226i\325~k\305\246=\247y\355\265\275\231CXj\307\231-7S`\223\320l\221P\241\245\333*/\262\333#~\365\355\022Z\324\327\327\327g\227\3203m\022\252-\022\372\337\346\033\\\001\325\355C\202\006~\274D/\356:)\031\373q\330\177\037\200A\304\217f\200\2118\004mx\025\265\240\377\224\361c\fvn\336e\273\233\007[\002\354\267\370\023\374\250\007\343\020\233\305\306!\275l\211 \rB\376{\300\026\240?\272"
+	.string	"\334\002\007\371o\326\331\334\030\277=:\207\tP\004`#\274\002\310\201~\224"
+	.string	"\377\035\373\361\343\b\370\370\261\022\276\300\177\177\364\370\357\016\234\001\335"
+	.string	"\350\277F\377\r\372/\030\346\341\206\343\307$\366\b::\250\300\032=j"
+	.ascii	"F\321\241:\377\265\222\367\343\256w\370\206\037\375\341\372\361"
+	.ascii	"\002v\374x\004\035\370Z|\267g\370O>;O\315o\263\330\270\033\302"
+	.ascii	"\177M\374\226\001nW\316\2330\377]\363_\025p\216\377xp\376[D\305"
+	.ascii	"}\300\177\333t\371\237\207\357\311\377>\030\307\225\316\007o"
+	.ascii	"\313\377<\377\371\356\346\277B\256\224\366\343\254\377\024\260"
+	.ascii	"\f\370\321\177\266\370\257\025\017~<\002\313\303\215\376\263"
+	.ascii	"\205\024\277\275\200\303\221\376\023\354q~|\343\277A\260\215"
+	.ascii	"\032\377\2453\341\277\r8\201\313\377\016e\316(\036\204\341\252"
+	.ascii	"\027\375\247\217\377\256\200cT\360[L\365_\t\374\227\017\2070"
+	.ascii	"e\313t\260%\260\324o/x\005\377\031\347\277Vl\231\377.\340\277"
+	.ascii	"'\374W\204\377\202\301J\016\366\202c\370O'\230\304\306\037\370"
+	.ascii	"\257t\242\377lc\353\334\337\362\331\276\3376\340\277C0\007\376"
+	.ascii	";\005o\340\277\322\377\016\377O\370\317\341\277\n\254\201k\370"
+	.ascii	"\317\253\233\206]\374\257\362\241\377\234\372q\210\344\177\321"
+	.ascii	"\254\001\356\366"
+	.string	"\237\377\\\341\307\353\217\243~L\374q\360\307\300\037K\340\307\016\3701\n?6\341\307\r\3701\t?F\361c\023?F\300\217\r\360c\002\374\370\203\037\213\370q\006?\366\360c\244\037\007\375\030\203\037[\360\343\t~\314\341\307\020\374X\351\307\031~\214\341\307F?&\372\261\320\217\365\217\321\037\347\037\337\377\366\371\357\236\377\362\375w\357\277z\377\265\363\337\274\3776\377+\347\277o\376\333\346\277x\377\245\373o\231\377\216\371o\230\377v\371\357\334\177\267\3747\356\277p\377u\373/\226\377\262\375\327\312\177\325\376\213\366_\263\377F\371/\224\377\312\370/\216\377\216\375\266\304\177\305\376{\344\277E\376\033\366_\260\337^\360\337!\2775\300\177\273\377|\376+\344\277A~\233\341\267\031\374\367\307\177\025\277\305\377\335~\313\200\377\362\370o\216\377v\375\227\353\277:\376\373\201\377z\340\277\035\370\357\004\376\233\360_\025\376\333\364_"
+	.ascii	"\3747\205\377:\340\277$\376;\200\377\036\3757\377\027\377o\372"
+	.ascii	"\355\001\376\367\371\177\347\277\235\377j\377\327\377e"
+	.ascii	"\376O\320\327\327\327\367\007u\375G\027\370\rp\025It\372\004"
+	.ascii	"\003\332\002\327\245u\363\223\332\3649\344\206\r\270\252\233"
+	.ascii	"\237\224\246\231Z\311\230\267\263\233\317 '\2109\323ey\376\320"
+	.ascii	"\273\272\023\346\346'\371\320>z,\345Y3U\306\243*\177\321\212"
+	.ascii	"C\247\353\344:\271v\350\020\272r\306\310\231\233\377S\307\231"
+	.ascii	"\243G\036\020+7\343@\307d5\361n~\222\225\376\177f\235X\247\215"
+	.ascii	"\263\306\251u\336\260\314s\353\244qn\335\256\323\n[\311\322["
+	.ascii	"\246\350\232{\357\237\312+7\313Sj\252\315\271u\3168Ce\337\210"
+	.ascii	"\224F{\352\216\315R\304\271u\306\260o\036\230\345\341\311\025"
+	.ascii	"\255\301\3236\206(\037\203\030}\fl\372\030\312N\031v\r\213\230"
+	.ascii	"\236\233\217a\210>\253\036\024&\327&u\3631`\351#\361\321GZ\243"
+	.ascii	"/g\223\320\213\261I\350\177\356\314\246\357\246\375\314\300\200"
+	.ascii	"\265\365\321kAK\316\324\315\317u-\214m\215\210\203\326L\303\313"
+	.ascii	"n\336\344PY\302\251\322\324\313v7\354\347f\207\266\334\313th"
+	.ascii	"\016@F\346N\266\223\361d>y/\327\311zr^\316\223\367d>\313\314"
+	.ascii	"zy\316s3\323\031qf\214\fm\271\227\365\362]^c'ND\326\313o\354"
+	.ascii	"\333OL\nm\211\332\2211\004\217R\266^6\t\305`\221\320#\225\351"
+	.ascii	"#\205\351#m\351_\320\243\177\241\205\334f\250\216\253\315\333"
+	.ascii	"\315\277\220%\263\221\222m\330\tc\341\346_ \222/h\351_P\352\037"
+	.ascii	"\325\321o\322\351\357\331$\364GV\364\217\310\364\237\313<\223"
+	.ascii	"\221!d\r\315\230g2\337r\2754\350\031w\370\360\335\234\305\210"
+	.ascii	"x\036s\2001\"Sn\3069L\006C\203\206\234/\317`4\0041\331\361E\316"
+	.ascii	"\315\034\210x\376\202\226y\031\222\307\313\236\253\243\352J\231"
+	.ascii	".]\270\310Y\261z\362v\363m\334\231\024-\031.\317\345\270\274"
+	.ascii	"%g\261\314,\227\337\262\\F\313m\330J\026\003\356\2304\307L1["
+	.ascii	"R\021\221\345\262\033\330\222\346\336\314,\227\315n\330\224\345"
+	.ascii	"\020\223\005<<D\371G^\372G<4\226 \031\036\265\233\177t\2453["
+	.ascii	"NCr%\253\3455\313\314l\331\3123\363\302\035\021\301\226\253\200"
+	.ascii	"\211\371\360\002\244D\210\020<\235\177$C\337(\217\276\321\035"
+	.ascii	"}#:\372Fq\364\215\352\364\215\274\350\033a\3217J\323\177\226"
+	.ascii	"r\t\230;l\020)\313O~\352\360\300u\345'W./9LYe439.\334\231\345"
+	.ascii	"U\346'\031\307\205\323\372\215\331\201\345\200\222Y\310Q,3?\311"
+	.ascii	"M\236\311\262\023%\253\326g\006\013:c\246MBIX$\364F>4\223\354"
+	.ascii	"\004\315K\310\3157\322\322=\314\362\221<\226\305\362\222l$#\311"
+	.ascii	"I,3+\311A~\225Y\007\220\262\035T\232J\362\217\033f\353\216\200"
+	.ascii	"p\306#wq\230\262\032\001\314\231\220\\\204\303\224\325\bv\320"
+	.ascii	"\262\222\354#w\001\341\r\351\013\262\2677\223\210\312\231X\030"
+	.ascii	"\243\234\303l\232,6\275\233_\304%\023\311`CX\312\364\220\312"
+	.ascii	"_\317`zU{\336n\316C\262\027F\303\247\210T\366\032B[\342\201\311"
+	.ascii	"^\027\216\311\r&wn~Q\233~\021\232~\021\024\375\242$\372E`\372"
+	.ascii	"E?\364\213pd\256\255<>\324\334\374\242\030\372D}4&\322\323'Z"
+	.ascii	"\243\377\274\225\263\336\226u\264\334\\\225k\020I\031\355\275"
+	.ascii	"dKS+cYf\316\312Y\371\006\376a\353\216\344)n\371m\017\214\f\232"
+	.ascii	"Od\247o\343\254\342\226W\331F\246a\231\271\306\257\f-\313\\#"
+	.ascii	"\317\260wDR\314\235\005$fE\217L\351\303\207#Z\230\036\235O\264"
+	.ascii	"\246O\204\246O4E\237\310\211\376s\f\017T]\340\3162\025\356;a"
+	.ascii	"\r\026\0367\277\003\334w\345\260\036\345\017n.On\017\255\357"
+	.ascii	"V\271iDJ\346\306B\225(\363\344\366\326p\337\215\243k\256\341"
+	.ascii	"\276{\345f!\242bn\345o\214N\236\334^\226\312;+\363\224e\342>"
+	.ascii	"\274\347\230\017\356C$\305\f\r\033P\006\3326\t\265^\026\t=\021"
+	.ascii	"\r\315g\351b\\Ar\363\211\224\372\366\f\347a8\034\007\007\005"
+	.ascii	"Q\264\344\350\355]+\234\207}\340\037\230)'\002\230\030\033~\353"
+	.ascii	"`N\216^Y\227\353\345\332a+Y?7\324\312\232\312\274\333\006\357"
+	.ascii	"\3400e\265\367\226\007P\346v\036\006r\3030SN\313P;\222\207\317"
+	.ascii	"\360\232Z\220<X\017\317\301w\260\034L\007\357a;\270\211\353`"
+	.ascii	"<\226\211\3630\225_-w\313\225\316x\334&f.\177W\324\2204\363p"
+	.ascii	"\020lFv\201\023:r\364\366n\227\274{w\327`+Y\032n\212Iso\346\265"
+	.ascii	"\312\303]7\315\326um%\235\013\2404\221\243\267\2677\023\223\331"
+	.ascii	"X\263G)\303\tZR\371\262\272\371Cm\372\035\234\3414lXs\270\f\211"
+	.ascii	"\252\254\237\033j\2720\033\214\207\335\3407\226\211\333`5\277"
+	.ascii	"V\227\213ek\203\327\3307\314\\\376\260\204\365h\34268\013\226"
+	.ascii	"\023@\227\254\017J\037>\374~T\315\001\001\312\037bA\177\bL\333"
+	.ascii	"\341\273\026\210\244\316\302<\271\371C7\354Z\310y\236H\301\251"
+	.ascii	";n!\247\315Q\033r3F\203\301\350\331K2\344fL\247\277zLi\336\214"
+	.ascii	"\317\330\267,`gT\314\340\264\263;U\314\330\26735\246n\036\203"
+	.ascii	"\311\210)\222sW5eo\214\030 1It\204\ts,\346\342\255I\303\274\031"
+	.ascii	"w\301`\376\377X;K\255%\230/\370\316\332\034\267)a^\\]\274\340"
+	.ascii	"$\033\f\220g\212\306\315\230\013\320\2339e\270\334\374;\366\355"
+	.ascii	"\377\317\t\246\007g\313\315\027jj\301[\342\320&l\304\372\354"
+	.ascii	"\264\034\307\271\3618\002v3\216;\355\236,y\273\371Bd\364\205"
+	.ascii	"\334\260\233V\242\346\207\227\233/\364\004\267a,\367\256m\263"
+	.ascii	"\301W\216\261\240n\224`\370\224`5\242=;\346\230\334|\241.\234"
+	.ascii	"\206\255\334\270'3\262`\346\261\225\233&\304g\206.\307\315\277"
+	.ascii	"\203\253\374\377!Z\203\266\245\313\315?\256\202Fd\303n\177\241"
+	.ascii	"a*?zl\370\230\335|!,}!+=e\203\225S\362]\335\374\240=\272\f\013"
+	.ascii	"\301cE\242`)\226\211\313p\2222\254\004C\321\222\245\251A\025"
+	.ascii	"\337\0264\277\003(\230\t&\263um'\274\274=\301,X&\206\202\235"
+	.ascii	"`(x\211\034\\\223\210\211\0233*h~PS\347(TX\316\340&x94$\007\310"
+	.ascii	"\227'7?h\215~\020\032\375\2400\372A]\364\203\260`1\214\3042\361"
+	.ascii	"\030>\002\206\215p\230\262\032\301\214Y\023\217a/\374\365\303"
+	.ascii	"B\307l\212\356\202\304\213\030\232\0374D\377\330\310q\221\241"
+	.ascii	"\031[\234\340\335\214\303\200tt\325y\271\371A:4&r{\243I\2142"
+	.ascii	"7?\250\206\276e>\016\036r9y\314\314\016*7?H\206~\320\326\007"
+	.ascii	"\332\243\017\264\247\017D\247\207\035c\357\354o\313\213\025."
+	.ascii	"7\037\310\215F-\022z\2403\372@]\364\333l\022\212ul(\"bDJ\315"
+	.ascii	"\315\007R\323n.\035\314\\\242\230\272\321\324\3029\360\226eb"
+	.ascii	"\034T\030\307\315\3032HTe\2410e\243\271\367\3068p\326\315\f\t"
+	.ascii	"\321$\017\231\334\206\017\037\362\225#c\204\350| +};\346\366"
+	.ascii	"m\260uG@ \203K\243\222\322\3042\256\235\333\207\303\224U\tb\262"
+	.ascii	"4\225\377\322\266<\233\232\322\234\223Z:\3032p\214\177YR\326"
+	.ascii	"\264lX\006\336\033\210\244\230;\013\025\023[Bfo\357\375\037\333"
+	.ascii	"\300X\330\n\327\3004\360"
+	.ascii	"\025\276\201gX&\226\201\253\224\316+l{z.\344\377\250\351\377"
+	.ascii	"\234\351\377<\321\377I\242\377\003\246\377\363C\377'\207\376"
+	.ascii	"\017\r>W9\307\016\353\346\353<\227\357\352\261\314\273\347\352"
+	.ascii	"\335\262\335:Wb\356\235\345\316\335#R\036\355M$\316\236\233\347"
+	.ascii	"\356\331\272.\346\336\272\020\247\rX\237\275\275\231J\037>`-"
+	.ascii	"o\354\260\241\371\272L\377w\017OP\037*@\372\340\271zDhLj\020"
+	.ascii	"\271\371\332K_\363\320\327[\332\352+\375_8\277t\376\213w\331"
+	.ascii	"\334&\006N\267\031ed\334|\345\3349\277\315\033g\337\246\007^"
+	.ascii	"{K\335f\321\236\275\245\212\254\255\300\332\n\362\0240&oh~\277"
+	.ascii	"\031\377\362+C\007&\344\346\337\371\027\035sfgn~\005y\372\377"
+	.ascii	"\3118\213\b\235y\243\007\345Wu\212\t\355\211\233\323\367\213"
+	.ascii	"\201~\261\361\n\253A\205\252\3559h[\314+\247\347\206\333"
+	.string	"O*LV\336\031=7\377?%*\245F\027*QnF\373\240}\377\355\377\366\375m\334\327\207RI\203\005\315?\312\347\013\025\353\022\205\306\236\323l\217\214\232\0317o\300e\017\325\203\356\241|vg\205A\363\034\345+\232#g\004\216\275[\332I\242\274\371\025\254\321?\212\347TC\365\2166\271\023$J\221\233=\230\311\313C\355\330\264\t\372p\225\225\261\260T\262\251s\324NQ\027\2311R\3200c\354\274\361\272\371\025\300i\017W\344\310A\233`W\\e\226\207^Y\332\234\243\315!):\354\232\234I\256\035\2225,I\264\007<j\324\240pB\330-\003\213\032%\315_\030&\327\2357G\341\240L\250DI\233\273\031usZ\t\345\240\353\243\345f\264\315\tdO\231\222\346f\224\315E\362\377'\337P\003\273\272\031\305\373U\315\311\351\270\031]s\271\376\377$\240M\226\336\305\021df\307\307\346\346W"
+	.ascii	"D/\025i\241\005\364N)\f\027<\2719$}|vG\357\200\212\370P\236\335"
+	.ascii	"\374;(\223:=\275\266\233_\201\r\275\304\245\314\313\240hB\330"
+	.ascii	"-\003.\214G\023\211\216%2\314\034E\203\322\341\271\232[Cw&\233"
+	.ascii	"\311r\245&\254\317\2309{z)J\227.\350\230\003tI\303\223S@\224"
+	.ascii	"4l\250\230\243c\316$\032\313\021)x7"
+	.string	"\243^\3200N\232a[\302\240`\352\310\354\370\302\261\241\215\214\326\227\223F\004q\254\342\200\374\377\021\212k\341J\334\315\247\340N{\350\232\233\303`\266\325G\267\207\247\314X#\244\214\356@d\313\026\324\315F\320\222L-L\024\335\241+.\356\307\362\247\212\327Y\221\233O\301\230\356\260\204\203C\245X#\346\324]\217\016D\341j\341\346S D{X\322\326\206\272\205\260[\306\025\260\256&\226:\303G\314\315\276\005\265\321*\243r\363)\270\322\035\316\330\330\320+J^J:KM\354\320\226@\336x\314]\271acV\252\206\344\321\035\350\252TA\325\224\274\224yKfu\310\362~\300\320\325\020SC\323\200|,\263\230\335\214Z\021\352\303\273\253r\363\001\300\006e\002@Nwh\243B\005\375\262F\356\364\200\031B\263\265E\353\346\003`Lwpcf\206J9\246\332A\252,\367\356Z\322vfa\344n>"
+	.ascii	"v\350\016zee\250\024\261)<\315\240:\"yT\244\\\270\030hG\244\334"
+	.ascii	"\374\t\326h\017S\2348AY@\261t"
+	.string	"\321c\301\b\037\0257(\013?\007#P(?yxx\361\271\031}\"\f\303\342\345\346O\220\246?\201\231\366 \265\364\037\035\373\030\332\304\246m,%*]K\031O\013M\344\320\345\321&Z\315\336\236\0317\243IP&w\314\013\227\023\224\t\272D\314\2152cSr\0178/cP%7\210P\220\260\036x\0230\321\266n\351\250\230\330\245\002\241mKi-\215\301\221wv\244\244.\312\315\227\240\217\266 l\351\250\021#7-+\231\033\013C\025\034sz\354\355,1\032\210\220\313\262\272\371\022\314\351\016RK(\230E\303\302.\325\b[j\353\202\271/\t\324\364\355\245B3\350\341\205\202y\241_#$\345\261\373\261=\261\341\003\035r\364k\350\016[\035\032\325\377\037\224\016k\017\337\315\227@KgP\026$\b\036\251;\265\344j\352\346s\270\2433\250\362\003\005\362\343\316\026\272\243M\237\0347\237\003\235\306"
+	.ascii	"\317\322\321\036L\264\307\231d\204-\265E\302\211\035\2078\215"
+	.ascii	"\201\231\245\243]]\247\016l\265\245\300B8\221\342\220\2463\270"
+	.ascii	"\262\343;p\234\336\266\016Y"
+	.string	"\235f\331\356\352Z\032\"+\242\306u\36390\331Bsl-\261Y\302\201\346@qd\351\241ZR\332N\313\227\"7\237C\017\375\b\372h\f\340,\3354\213f\241Y7Mi+\351\204p\302%\0026\032\203$KGo\2407\356\031\b]i{\253\002z\270\312\202\352p\205\r\271\371\021xAi\2405P\0328.\203}\205\326\270\302qZ\271\267\222\271\2616\350!\353Z\002\352\321CH\216\233\037\201\231~\004>t\006^P+\324*\316^\0046t\006e\320*\264*\216\233e\004[g`\207R\241Ta\276\350\350\017B\226\316>\213*\373P\251\033\246\267\234\276\032\213\003\201\032}\b\302\350\333\033\206~\310\321\247\317\b*d\020\300i\016\315\245\237{n\231\347\236S\354*\017m\t\324\364\"e\347\346C\300\202\316\220\266\364\223\3172O\276L\006\2046/\251&$\234\324!\313\013\2223\003O\311\315\207"
+	.string	"Kg\300[\372\271\267g\337\2622mc\001\311\370\302:\344\254\264\335|\b\246\264"
+	.string	"\372\364\364\360\322\350\r\312\354\330Q\203\246\214\376 \227\227\267eN\013 I\263\211\343\260\232m\372\203]\0348\247\034\373\246\367\362\007w5\266a\212\376\006$\372C\2307o\304|h\r\256\332\264ysc\271\341Jk`VWw\342\335\275\367^\376\260\210ii\236x?\327\004M)\361\262s\363\3174\247\232\377\207\350\314\024'Hn\376\006*}\332\235wXV\332\244\335\374\253\324\307C\021\035\274)Yn\376\201\226z\222,Q\312\323\035l,\235f\354IGg\337B\374\336b\\5\225\332\350[\373\206\n"
+	.string	"L\2312x[\226L\275\301\327\2301h\244\224\226\272\202\267\245\237_\276\234a\210\324\344\370\3602\267\3641\346\346\023\314\020\337\022>\271\233\257\024D_\211Kk\b\262\364\263\013\363\354b\337@\350\362R\346Q %\255\217noo1\032\234_zx\244\300\321\002\220\233\233\353\263\323\020hY\312d\331\211e\236[\316\"q\266\300r\024\231\341\205IrF\013 O\\\234\007x\266\262\350"
+	.ascii	"`-\375\204c\236p'\221,\225\266\225EpC\364\310\254\031=.,5\235"
+	.ascii	"A\234\333\335p\234\335{\004\035\262(Z\211\314\322O,\267\314\023"
+	.ascii	"\313\371\005BW\332V\376\342\232\344\311\375\362\330\224\321\270"
+	.ascii	"\371\032\234\350\r\320\226\330\316\206\343\364\336[i\264\247"
+	.ascii	"\324\304-\305\364\231g\032\363TC\367\266L/\254\254\337\261\314"
+	.ascii	"Sm\203\246\2253\315JV\227<\r=\3645Pi\f\346\226\3163{\2421O\264"
+	.ascii	"{\206\255\266\324\027\211&yu\232{;\213\251\3013\360\351\333{"
+	.ascii	"\2062\331\220\"\3454\363`.m\212e\236ff\\\230\\\031\342h\f\274"
+	.ascii	"\226~F\371\355\032\213g\231g\224SH\246J\333\312u\016W\331\336"
+	.ascii	"\336]\032\b\371\020\273\343\273\371\031\300h\r\320,\235J\316"
+	.ascii	"%?\231\234\311"
+	.string	"\t\305\356\275w\327V\322\031\241\203K\235\346\336\356\312Z\372\317'?\241\320YEyr\363\351\344\302\375\377\371\331\\n\232\334\374;'\331\377\237 >7\234\0349\311\316&Z\302\224Z|N\271=t`\347\322\356\005\335"
+	.ascii	"\373r\3633\034\321\377\355\357\217n\251\254\275\367\326\311\334"
+	.ascii	"YSB\350ooOk\227\376!\213\255\005\377\363_\001 s\307Ps\266\367"
+	.ascii	"\266v\264\223-R>(\330g]\226\325\332\227\022\204/-\252/.\253\265"
+	.ascii	"/\255#\253\265\257\255\244Z\242<\312\332_J\253\265\275\217\250"
+	.ascii	"\250\224'\274\264\254\326\244\366\221\325\332\326\3321\354\264"
+	.ascii	"\354f~)7\225\327>\332T[j\257yiQ`E\365\245e\265&\245ud\265\366"
+	.ascii	"\245\265\327\276\266\321\246\222\312\232A\265\263\216\366\332"
+	.ascii	"\027\235\275\346\245ed\265\346\245e\265\366e\306b\321\310\223"
+	.ascii	"\323\221\346l\254\3156\261\242\3327l\374\220\3122\252\263bzm"
+	.ascii	"6{\333\266\252\235\265\353\366\266`\357\037^Yl\244\270\254\334"
+	.ascii	"T\335\215\251,R"
+	.string	"^\226\271\367\336`c\n\314kS\325)\355\256\263z\342\265\367\223\251\247mc\357\275=P2\353\266\230\255S\022\371\261kT\355\r\301f\356mco\245\335u{o\345\336\373\227\365\203\271w\017#\253\245\r\033{w)\331\330?\224sU{\33767rZVk`^\"\346\256\254-\267\f\246\322Z\325\360\332\313\315\346+K\257)\255\354\032{o[G/\265p\344\335\314u\216\241i\304\346\334\334\374\244;\232\031$\027\304-\307\315\347\0212\263$5L\"\276;,<7\237a\317d\331\311\305\233#\204\354\346\007C0Rb\024rx\002\271\202\221H,\261\246O*<\020\207\251\n\344\323\232B\201(\032\241\240\214\301\3420=\256\310\2421\370\363\201\210 \241\372\"\205\026A\365\311\004\004'&(\252QF\"\025i$\006\213\232\204\305!\013\f)\324\342\020\352\250\256\252\020\303\317\2518,\016S(5\205"
+	.string	"\024WH\217'\236J\230\260\252NA\253\352\024\264\026\223F\023D\242j\002iU\235\216T\340j\204L\256\351\332\244\341OL T\026?\f\177bR\327\024j\270\"\027\260\252NG\177bR\241\206+\004+\020i\202\n5\\5rH$\016\241\320\240?1\225\240\202\204&\020\253\352tLW\nZ\004\215D\023\352\321h\242\350OL\302a\224P]S\027\3035X\002\231B@\025\032\241\216\303\024I\205\032\252P\211A\030&VdJ\034*\032\207H\344\020\nYL\217*VdZ\202\032,\016\233\204*2*-A\205\032\252xrJ\032\213\013@\246O\"\216\311\b\326\2431\205zd\221\301\350\002\006\225(,\246O\021\bU\342\212\264\270\200&$%uM\327&\030-\232\216(Z\004\325\247 "
+	.ascii	"\210\252\013\265\004\242\232D!,\252\310!\325\251D\024T\211 \021"
+	.ascii	"LD\242jbH\205 \f\177bB\022\215\307\265h\f\002"
+	.string	"\203G\020A\026\302b\n\005e4\021<\3768\025\207P\3074\b**\005d\tU\003\303\246\020\216(\250\304u5\036\237TL`<\246!\030\207\307T\005\025j\250\207B0\t\325c2\030D\341\305\020\0052\312\251\250)\005\221\332\"E\201D\252\301`\212Z\200\003\n\204\270\300\351T4\226\260\246%@%OP\211A\030A\315\001\262\004\214uHL\223\016 \246E\247a\223\272\016\211\304tM\233\204E\025\271T\002\031%\202\260\250\"\213V\364OLA\240\n5\\\213\311#\210 \013\247\224\210B]\323\025\td<\246+\262\baQE\032i\247\342P\230\252#\b\213*2(\030L\261\260\250\"\177\210B0\255\3074\n\205\252\201a\322z4\246\370\021\246\352\b\351\232\236\020\026U\244\020\224\272\"a4e\270\t&\230`\002\320\2706\245\020\241\350\301\341Q-\252N\372\036|\260\301\007$^\374N\242"
+	.string	"!\n\020\002=\211\002\210\020Q\200\017D\350\177 \002\253@\247\342\360\230>5\255+R%:\025K\034Ubr\001k\232\264\002Q`X/\030\207\0324\\h\201LM(&Y\b\251@\0222D!\241\220QNG/Ta\221\004uM\217\302d\272\002\370\302\270\242E0%\256\310\360'&\t^\244\305!\324\205\025\326t\205\213\fD\242\032\\\213*R=F\255\306\342\232\256p\261A\005^P\201\030\324\3401il:\252\253j\302ZT\217\307d\360\002\214u\030L\243R\0230\216\352\272\246+\212\3264\004\025Tdr\b\271\036Ub\t\023*2\211AuJ\327\242\032<\252)\234\212\303\3421\205"
+	.string	"T\022Y4\0069 \207H\365\250\256H\030Ok\272\302\005\021\022\230\256\351\211&d\224\323\321\2326A%\213\350JL1\022\0304\226\200\214r\032ZS\".\032\211\370\211H\304\304\024\330\224B\004!\241\252F5\005\251\310c\322hBXL\032\217NBQF\341S\376\023\023"
+	.string	"\220@\3431]\201\256\177b:\252\253\ne<\246+L\030\217\351\n\f\352\232\022\223Ab\032\3741\036\323\025?kR\303H\211\252\020\030\225\324\353\032\225\004\256\307tE\352(\024\214\307t\305PT\022\270\252N\350J,a<\246!\374\324crM\217j\024\224\252\302xLW\024\255\220\036\361\237\230\222PC\020\353\223\323\220\310B\211H4\036\363Sp\035F\235+\2440\260\013\364OL*Q\265"
+	.string	"\t\f\006\323s\375\023\023\006k\004\204\251\232\202\361\b\303\351\b\t\274 L1\034\327\024E\024GuE\016\235\324\024 \220\214\202J*\242P\327\341q\205\337qM\221B2\nj\250\210bU\221\352\361W4\016\327\364\230LFA\031\255\303\"\tE\024\353\2608D\217k\212`1\211B\230\252)\004\203%0 \201.\324\023\301`\252\213(\204\251zDW$\320\004\007$\230\340\200\204\037\024\211T\217Ba\372\013r0\304I\340\tdrE\320\237\230\220\311\025\033\220\300aT\223\032\034\272P\205A,\324\023j\024\f\025@\022R4\005\251\301b\272\"\213C\275\002Q !\027\207)\212\310 :\214Bbdr\005\026A\0040\030L\321\025\322\024L\234(\201\252B\243\t\027\352Q\b\2060USH\327T\370\263\026\001\177\177bZ\203\311\343\212\344"
+	.string	"\t|\241\256I\250\243\026A#\021\bD\327b\322\030\004\002\177G\265\270\202\021\b\374!\217*2Y\004\002\265\2608l\001\004\242\310\3420\n\t\004\376\210*\020\370\263\002W\344\220h\364'&\244\032\005c\335@\250\036\323'\344\006 \220\353p\005\210d\321i\203\027\311\342\220\270\201\007\037"
+	.string	"? \361\002\204*L\022\203\305!\210#2\t\202"
+	.string	"\353\013\265HL\213Gu-\016\201\302T=>\255Q@\240\006\027\3521\n\bDW\344\220\b\004\242\351\232\n\201@\364\230>\005\263\252\201!\022\bD[\004\215\304\254\002\213NCb\n$*:\r\211%\202\301T\257\177bJFA\001\215G\030N\301`\232\201\nL!\304\210\020\037$\243\240\220\212\306\341\232$\032\221\352\021\b\t\304\240\002\233\222QPAG#\262\250\"\321\225\230D\252)\024\215\3035\250\256\352\211d\024\324\005\027\252\020;\025\207\304(\250\264)\030L\221~O\253\321\b\325\024\f\246?D\2431\004\340\251\006\213(\254\310T-a-!T\327T\030\365"
+	.ascii	"\242\032"
+	.ascii	"\f\226@\0167\254\177b\002\201<\252.\206G\341qM\241\272\030\252"
+	.ascii	"A5\005\245\025\370\201\210\026\301t\005\221\230\232xq\004B\002"
+	.ascii	"\205TX\217\306\024\304txT\221F*qE\252\302\005zT\207,\206kQ\025"
+	.ascii	"\016\201V\240*4\232\260\036\215Q@\252\320\b\225W \n\353\321\030"
+	.ascii	"5\204,\032\207k\224\361\247\256i\n\302d\272B\253\032\0306"
+	.string	"\251\032\0306\351U\013Su\204\243\2200UG\340\240\203\2658Lj\3420UqTY\260H\206\360b\025Z\377\304\204\214r\002a\034b\200\202\202\202\312H \024\024\024\224\t&\2348q\302I\t\nJ(\024\236\177b\252\340\306(\365\bb5\032\217 \202\220@\247!\213\242\321\304\321\232\032\255\300\017D\254\305\341O\025&\327\241S\321X\302\213!\n\343\t\310(\247\243\247\340:\\\001i$T\327\243\352\2428\004^x\241\022\243\222'X\020\323' \025\210Bx4\032M \243DHZS\250\243\221\005P]\323\342Px4\032\203*p\035\026\037\020\264\016\213I\240\242q\210\034\006\325c\024\006d\312\302\005P\0031uqT\327\"\t\302b\322\330\004uL\211%\326\325\370\224A\005\262\004RM\022S\025\204\303(\f+\220\304Z\034&\177\252S\272\022\215.\200D\242\032\004\256Gc\224zD\372\b\225"
+	.string	"#\204\003\370 \004\323\321\t@"
+	.string	"\023\024<\340\004\021t\220\tF\013\344\221\005\b\030\307U\205R\211\352\n\2428L\241@\004\217H\020L\034\376\326\303\214\221\337\222\237\022\035[[\r\223j\312\314\236\233\231\236\030\371%1\362\033\263Y\n\200\313C[\376\306~H\250(\325\224H~b_ux\2749\217\024\355I[Ss\363\221<g\214\0269\266\233o\301\234\326"
+	.ascii	",\354W\344\027\206\343\264\262\r\337RL3\311\370\201\375\210\374"
+	.ascii	"\300p"
+	.string	"\\\227/\013\270\364\377\373j\006\251Y\035\3411\004\265\223\201\267\345\032\257K\245\335\344\324]\t\201c\247\240\2541\t\202\336\001\205\3111\263\004r&)\363\222\305\345\307\0301\265)k>P4DX\366\252\360\350q\022\371\260W$\355f\246\020\026\326\230W\327\rC\271b\350\201\343B\257t\220QC\356\267\003u\013Z\302\344\022\343\247\343\304\333\242\214q\365\313qB\241\222\262\227\334\374\323\302\037\350\353\353\353\333\263\267\324O\353\376p\374\266\376\323z\321\217M\231\225\024\232\377_\026\013e\266@\211r\263P]\0303l\277\033B\322\370\352\210\335\314\304\366\263\372\331\370Y\375j\374\202\324\336S{\007\031\373\355\251\301doow\345X\372\177W\377\325\370\227*8v\354n\376\321\370\027=nU\322\334\034\206\002\250Crsj@\256\305\030\020\005\025R\206\241\232\031n\306S\025@0PH(\227\n\323&\037\023"
+	.string	"\304J\213E\201\246F\031sHfFD\222$\311\264\006\036\b\240\330\257\204\342\305\204[\212\303\316\032\323>\343\251\350ZVV\240\321\330~\031\376\212\332m\255^\334{\236\f\241\355\3441\255^\317\037\003\"\356~~ ejB\013\245\364E&\022\230\rgU\220^\351\341\326\002\372\3666L|w\022>\020\020\353\366{M\354)\307-\003\235\017q\301A=$\217\204v\200\254\027\337\205\031x\373\037\301R\320\033\327\210?'\270\032b\274\276\2605\331<t\020l>kC\251\373\307\0367\222\232\002\234\236\177W1\033p\246\331\262\023\247\316\231\240\273\364\021\250\223\031\027\221\340t|T(*TZ\220\220\246d%\332\343n\003\022\206\276\327\204/FE\005\0019R\021\330\020*\204\244L0\222\345\275\377/\331\247\003\361\347\n"
+	.string	"\344\217g\036\237X\263G\341[\257B\003+\243\2678\242h\350\260\027?\326VN\2024Tr?h\257P\033\317\262\017Q\260Q\323\260\240\205\356\321\340\315\331\371-\n\2373\202\3511\005\236hm\030\225b\f\311\231\231v\377\322\262P\3024\317\274\032\031\366e\016peLI\207\264\221\271\tM\216\236\334\215d\373A2\313\215\200i\253S\267\245\246F\274\006\375\352\3609\271X\304^4Xl\213U\275\271\354\316\027\030\354Q\273\027-\252\2105\310\260\346\254Y\0209\024\002\353\325tA D\246\342 \366v\025G\333\253\207e\fY\241\371\b\315\027-\024\213\237\245N\361\343\023 \201L]\032\237\213?\354\266\354Y\035{\203\241#6\202:5\357\254\212c\272u\004\2525Mw\306\017R\356w\016\nT\3745>\314\330\323\217*\300\350&\376C\022M(\307\300J\214\247\345H\203@W\005\260"
+	.string	"\247M\2141\274\2727}\303\006U\301\034\031\321\01641E/\263s\247-\0044\227@\034-\371!\037Z\306\235\364\"*\033\240\3167\t\244\372z\026\306\030q\3728rma\236\300n\255\215\211\027\325\344'?M#@\267\351\377p\316\270W\3234\024\300\272\030_\347\351*\220\215\220\223\021\316m\243\361k\205\315\334\246\211\177\004\273\037\246o\027\003\004uAp5\326\222\2438,\240\221\026[\265>y\217n\315\235\313\350\002\242\342\230v$\220\034\234\320[L\320\265\037x\177~\310#Q`[9\244\246\316z`\247\013\266'\361X\324\024\216\003o\203\352\205\206\225$M\260V,V3?p\310O\322\371[+h\300Bo;\025e;\034\303_\017\3723\241\245\244n\356_\t"
+	.string	"\2307\221\217\377Q\202\b\317\030\307'\207XG;\030\274\227d\356\255|`\322\372\020\206A\235\021\331\212\251\240\316\342]9x\330\322\320\217b\204\031>\2714}\245\244\032\225("
+	.string	"\201\366FB\330>\316]1s\3773Iz\370\331\327\326\203\341\243\322\206\275\216\215\314\355u\273\005R\315\232H\3258\366=\267\247B^\361\021\301\020\036F\003\b\027l\244\277\245NP\206p\2071\324\372\224\272\254\214?\350ZFG\005\221\201fB\204\023\2504\211,\261\336\022\361\343\226\251\301\317%c\024\316\004f\333\337R\"\225>\201\230m4\361\356m1\036\225\021v\034&\001\350S\bs\b\231\017\226 I\030'\320\345\232\317\300-\373+\270"
+	.string	"\366\3337#(\330_RI\001"
+	.ascii	"\306\032\t\33513H\237\007z\005\262\273\244\243\345\347>\301^"
+	.ascii	"z\200wS\213\356\027\323\364\365\375\025\270-\177}\31353)\346"
+	.ascii	"\214okw\001I\201C\013 \323\274\375\361\302\024B\222d\254\rxE"
+	.ascii	"\224m\272F\252\034\226DP\001!\270\022\b\332\231y\302D\t\002\337"
+	.ascii	"v\340E\314F\262/\353t\r\032\323`\213E\336F\25285\236Uj7\201X"
+	.ascii	"?\377H=\025\333\265fu\006\330q\207\250b\006\366O\003F]\233\322"
+	.ascii	"\217\276r\023\307\234\325\250X\277\232`\251`\207\210z\031\242"
+	.ascii	"\020_T\231\031\211b\004\216\351,\013\233\017\021!f\370[\026\311"
+	.ascii	"\032c\007\323\007\311\b#J\225\276\350_{\345o\316\321\301'\361"
+	.ascii	"A`\271\363\225S#\271vLi\326S~\267\2606\243\332=\350\243\261\033"
+	.ascii	"d\216O\325t\326\264/j\307\n>\264\252;\265\204\270\2522\027$\374"
+	.ascii	"A\331\254\324\323\260\377\306\215\367yeP%\330Z\216m\365.v w\324"
+	.ascii	"\003\267\226\321D\367\272\324\277\246`\372\322U\240\257x\346"
+	.ascii	"\277\247O'\303g\373<[\001\273\333\f.\017\tq\331\026<7\207@\013"
+	.ascii	"z\350a\b4\220\034\223\333\243\244K\237u\211T,XKB\347\223h\330"
+	.string	"\274\261\352\310\017+\236\303"
+	.string	"\203\t\221\235\356\341I\264\377\3167\365\235\274M\357K3>\017\034\265\270\231$\204\310\3456\353\340\244\224\025\335\2326\0071\370o4:\236\352\b$\266\346dY\336\273"
+	.ascii	"h\205\035\375\204\374\306\243VJsw\370\312\327.YE\364\016\211"
+	.ascii	"K\"\316\n\233 \270=~.\211\224\bWS\302\276\032\275\323\354\005"
+	.ascii	"\254ah\352\233\225C\027\226\027\001\261\326)K\324\245\211\365"
+	.ascii	"\"\205\322R\334|\222\322\335\257\201\354\273\240Ry\276.\332\354"
+	.ascii	"\326<\025\252\334\326;\"\204\t\350\242\222?.\t\215\321&\326\315"
+	.ascii	"]\031\313"
+	.string	"\3528\016Ux\312\344\265\355\315\227\\\020GM\204\372\272Ft]\025a\273\315Q\267\226\211\252\354'\241f\373W\220\252\272\016\206Y\252\023\257\220\031\002^7by\223\023I\017\333\215T\b.\354\376\316\267\0303\213\354\207\243\340M\334\ria\233\372d\253LpU\266 \fs\231\211\343\275\034\023\335\363\207q#\304\031\017U?Vu\b\034\205hW\323fs\250\333\330\013\370\272q\347<b\212\t\322(\313@\3165\036{\313\274D#\0202f\037V\201\370,\262d\f\036\247-\002LF\241^\311\360\244x\301\"\\JQ\007\036?\343c0-\217\002\200\236uV\345b\231\357\221T\255#p\021\352\t\031\261\206)PM\243\364\305\3669.\r.\232EH\336\331L\306~\277\214\373\335\375oMME\2728\266\373hQ\371jI\210\007\374\2152o\242k\346ixJ\373\350\345\364\013xi|iN\237\017\364"
+	.ascii	"\377J+(\236)\n\207\206\265\001Y\263%\021\034r\221"
+	.string	"\340].\th\236\2649\366&\360\255lX\240i/\270\236!\206\377:\3753\tl\230\372b\007\262\034v__y\310-b\221g\234\030\007\022\202\\a7#\361\026n\205\230EL\205\240GO'\307\233`\221\022\332<\357\373\023\027\323\333\017\024d\316b\204X6\030\2222\340_E\237\271\277\200\270\327\371\025\240\350\355X\310\307H@=\234\025\004IH\031H\235\\K\003\020\325\007\200K)H\213\031\270\242\244a\370\027'\315\347\\\256\005\325\366\336\306\223\340\034\341\333\261\032\323\225\230\002$\"\034P\267\343\305\211\177l\007\376\236\201\2113'n\231d\200,\376\232`qT\375\271\361)\301\177uN\236=\005E<\237e\217\237I\252\t(!\323f\212M\016\351\257\230\351)B\223\214L\021\r>H\304\302\027@t\247\233\022\345m\375\324\3645\276\274\221\252%\352\2041\317\002Wp\026_|\276d}*b\325"
+	.string	"\243J\2256(\374T\372\263\336\f\036\240\nX8L\321w\337\250,\356\216\227T\202l|B\246\324\004%\006n-\235\001\3519.~\230\223\344\207?\256G\366-\277\225\352\021\350w\365\26578\321\302\310#eC\361\373\355\363;\306QW.\021\327\250d\247\366\242m\263\316\247S\363\363\267\256\024\313\230t&\371\020\345v6\030\233\264\371y\002\234P\244xA\240E=\007\333\021\233Mi\030)\253n\326\247\360\353\303"
+	.string	"\026y\256\302\257\240\251\311\334\031X\341\247\320}\313Q\302\026\030<\220~CQ$\3436\343\302\331\033\375\313\020\212=}\276\233hx\371jgjH\357\007\037\017\240\263\316\231\373\371\3178\331\3470\225t\216\346\025\007AI\251\220+?'\355\213\3228\330\305\346\3572\201"
+	.string	"\033\006\335\244_\223\222\034\347\242Q\246U\261q\3551\035h\236\274\323wyP\t\327\005\363\335.c_\205\223\374\307\343>1$rn\350\273Vw\230U\0333H\320/~J\004\242ieQ\351\266)\2328#m\033)w2k\021\237\257\235\274\370\324\311Iw~b\007\337\207\316\277\353?~\021 \212\201LF\315"
+	.string	"\032\235\211\013\265\035\243\360\022\273<\005\261\373\3417\273I\032\322\0306\341\366V\224i\263\177\022\321}\332\0013\307\214p\245\267\277\217B]\244t\331e\314\277\367\2301g\351x\373<jA\361"
+	.string	"\003\324z5\251\204x\367aY0\002\017\322\371L\346@\2338\273\005\244\204\310 ,\355\363\312\001\276U\035&\362\357F\250d@\274\376\266g\211.\022K\023\366\334\f\034\225v\277\024\212p\274\335Y\227\240\227@\3311\031\007[\333t)\004\332\3001\366\305pd\362\211~\2538\274\023=\332\277\207\031\370\244\246\330i\331)\371"
+	.string	"\027\213G\201\025\212\356\340\343\307Du\277\b\315\201G\331H\177\253m\020\230A\212t/\320\n\210\254]u\200\270\315\023\004\267\243\016\265\020d\036\007\212\344\374+_.\344a\003\031\360W$\341\232G\f\005P\203\037Bi\243\213\025\224\260*]\354\234\205\264\376\212D!\024fRQ\250\024\311\327H\026/\026\356\b"
+	.ascii	"\216\b\216\037P!=\314e#\250\357\223Rf\324\302\353h\3619\327\306"
+	.ascii	"z\341\216[\211\342"
+	.string	"\210/\305\b\r\376\205u@\002\352\217\210\340o\"^\030_\270Oi\211\300@\301Bw,\314\0171\314\331k\272\nR\357\02458F\366\337\221\361\357\225\301m8\225\3129l\337\003\356\20538\374\211\370\275\002PC\b0}gZ\375\333\204\363\314P\016\353)\334\203\300\277\266\335\343g\264'?1e\371\244\250LZ\313\257|\373\256]\276e\247a4\226\315-Q\302\301\202\032\202^\3771h\273u\325\363\303b\2072\362\3018x]B\0265\023\255\302\254}\331\257\001\373#\202\266\324\301\264\002\233i\227\377)\220\r\262\223\300e\337W\340\366\304\276\213\266\346\343\374\3646d\215\374\001\020\337\376S9\177O\233!>N_\231\304\025\273%r.M}\205\3327\256\364\007\351\327\205\376\231\321E\032\227~\337\022\367\n\331\203\030\374\032\332\373\b\346E\361\026\270\367\377\366\017\007\267@b\013\375xn_p\274\360\270"
+	.ascii	"\372\r\344\357\323\274\343\303\233\247\177\263\205\354+\266\276"
+	.ascii	"\212\301\266\376}\n\202r\370\341{\366\267\360fi\275\221\2774"
+	.ascii	"\276\300\367;@\336w\220\307\336\370\263_3K\231\366\350+X\363"
+	.ascii	"\326\273\007\020\261\t\247,n\264\265w:)\324e\201\266\334|i|\013"
+	.ascii	"\352%\317\330\rn\231E\374i\016{$\330X\373_!\016r\241\3661\n\346"
+	.ascii	"\\e\360PyK\276\356\307\347\347Z\237P\322\345\202U\353\206\217"
+	.ascii	"\212\271\351\210\357bo\230\345\361\342\302r\314\025\353\370\306"
+	.ascii	"\203\264\373\324\204M\206\262\255\001\367c\265\260\271\352d\246"
+	.ascii	"\363\201\332C\356\364\200a\301\261\345\212,\326\373%q\301\207"
+	.ascii	"\233\314\257\211vb\373\237g\367\350\205UcN\345\247\330\257\353"
+	.ascii	"\271L\n}M\366O\345G\316\377\205\022f \314}\037\261\356\023@s"
+	.ascii	"|\360\033\233'@\017(\304\"\032C\372\240\037\237\311a\266\037"
+	.ascii	"\315\306\233V\314`\343F\2253nh\005\207\331t\245\266\311\365\003"
+	.ascii	"U\350?\335\362\250\347[\033\027\002\377\231\331\224\270\003\312"
+	.ascii	"\226B\267\356\235R\234\013?\362>\230\264\033\306_h\232\023gV"
+	.ascii	"h\362\240w\304\326\017\2739\3471\304\375 \340\237k;\323c\320"
+	.ascii	"\366\345\315=\021?H\347\222\370\363\331\375\205\224,gG\343/b"
+	.ascii	")\242^\331\274\270\367\356n\307z\253\254\312?8=t\005"
+	.text
+	.section	.gnu.lto_.symtab.a2091a47be0d4765,"e",@progbits
+	.string	"initFrSkyTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"freeFrSkyTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"configureFrSkyTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"hasEnoughTimeLapsedSinceLastTelemetryTransmission"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"checkFrSkyTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"handleFrSkyTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a2091a47be0d4765,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits